@@ -30,7 +30,10 @@ class AudioOutput
         void stopAudio();
         void resumeAudio();
         inline int getBlockSamples() const { return BUFFER_SIZE; }
-        inline int getSampleRate() const { return SAMPLE_RATE; }
+        inline int getSampleRate() const { return sampleRate; }
+
+        // 44100, 48000 or 96000 Hz, takes effect when the stream is opened
+        bool setSampleRate(int rate);
         void fillAudioBuffer(Uint8* buffer, int len);
 
         inline bool isPaused() const { return stream && SDL_AudioStreamDevicePaused(stream); }
@@ -44,7 +47,8 @@ class AudioOutput
         // SDL-owned audio stream handle
         SDL_AudioStream* stream;
 
-        static constexpr int SAMPLE_RATE = 44100;
+        int sampleRate;
+
         static constexpr int CHANNELS = 2;
         static constexpr int BUFFER_SIZE = 2048;
 };
@@ -0,0 +1,80 @@
+// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#ifndef BENCHMARK_SUITE_H
+#define BENCHMARK_SUITE_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "HeadlessConfig.h"
+
+class Computer;
+
+// Fixed headless workloads used to track emulator throughput between
+// commits. Every workload except cpu, cpu-micro and sid-output runs on a freshly built machine,
+// boots to the BASIC prompt, then measures a fixed number of frames. sid-output checks the SID
+// output stage against a reference render and is not part of "all".
+// Results are written as one JSON object per line.
+class BenchmarkSuite
+{
+    public:
+        // Builds a configured headless machine (ROMs, video mode, SID model)
+        using MachineFactory = std::function<std::unique_ptr<Computer>()>;
+
+        BenchmarkSuite(MachineFactory factory, uint64_t frames, const std::string& diskPath);
+        ~BenchmarkSuite();
+
+        static const std::vector<std::string>& getWorkloadNames();
+        static bool isWorkload(const std::string& name);
+
+        // Run one workload, or every workload for "all"
+        bool run(const std::string& workload, std::ostream& out);
+
+    protected:
+
+    private:
+        // Frames needed for the KERNAL to reach the READY prompt
+        static constexpr uint64_t WARMUP_FRAMES = 200;
+
+        // Only one cycle in this many is timed per component
+        static constexpr uint32_t PROFILE_INTERVAL = 64;
+
+        // sid-output passes when every variant is this close to its reference render. The block
+        // output stage runs in float, the reference was rendered in double and stored as 16-bit.
+        static constexpr double SID_OUTPUT_MIN_SNR_DB = 70.0;
+        static constexpr double SID_OUTPUT_MAX_ERROR = 1e-3;
+
+        MachineFactory factory_;
+        uint64_t frames_;
+        std::string diskPath_;
+
+        bool runWorkload(const std::string& name, std::ostream& out);
+
+        // The cpu workloads time the instruction interpreter alone, without a machine around it
+        bool runCpuWorkload(const std::string& name, std::ostream& out);
+
+        // Renders a fixed register script on a bare SID and compares the output with SIDOutputReference.h
+        bool runSidOutputWorkload(const std::string& name, std::ostream& out);
+
+        HeadlessConfig makeConfig(const std::string& name, std::string& blankDiskPath) const;
+
+        // Workload programs, assembled for $C000
+        static std::vector<uint8_t> cpuProgram();
+        static std::vector<uint8_t> rasterProgram();
+        static std::vector<uint8_t> splitProgram();
+        static std::vector<uint8_t> sidProgram();
+        static std::vector<uint8_t> reuProgram();
+        static std::vector<uint8_t> reuBulkProgram();
+
+        static std::string jsonEscape(const std::string& text);
+};
+
+#endif // BENCHMARK_SUITE_H
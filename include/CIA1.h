@@ -45,11 +45,15 @@ class CIA1 : public CIA6526
         // Reset everything to default
         void reset() override;
 
+        // Catch up before a tape input changes and re-plan the next edge afterwards
+        void syncCassetteLine();
+
         // ML Monitor access
         std::string dumpRegisters(const std::string& group) const override;
 
     protected:
         void postTimerUpdates(uint32_t cyclesElapsed) override;
+        uint32_t cyclesUntilLineEvent() override;
 
         inline int getCIANumber() const override { return 1; }
         inline const char* getCIAName() const override { return "CIA1"; }
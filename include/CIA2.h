@@ -30,7 +30,7 @@ class CIA2 : public CIA6526
         inline void attachCPUInstance(CPU* cpu) { this->cpu = cpu; }
         inline void attachNMILineInstance(NMILine* nmiLine) { this->nmiLine = nmiLine; }
         inline void attachIECBusInstance(IECBUS* bus) { this->bus = bus; recomputeIEC(); }
-        inline void attachUserPortInstance(UserPort* userPort) { this->userPort = userPort; }
+        inline void attachUserPortInstance(UserPort* userPort) { this->userPort = userPort; requestReschedule(); }
         inline void attachVicInstance(Vic* vic) { this->vic = vic; }
 
         // State management
@@ -82,6 +82,7 @@ class CIA2 : public CIA6526
 
     protected:
         void postTimerUpdates(uint32_t cyclesElapsed) override;
+        bool needsEveryCycle() override;
 
         inline int getCIANumber() const override { return 2; }
         inline const char* getCIAName() const override { return "CIA2"; }
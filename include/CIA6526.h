@@ -11,14 +11,16 @@
 class DataBusLatch;
 
 #include <cstdint>
+#include <limits>
 #include <string>
 #include "Common/BCD.h"
 #include "Common/VideoMode.h"
+#include "EventScheduler.h"
 #include "StateReader.h"
 #include "StateWriter.h"
 #include "TraceManager.h"
 
-class CIA6526
+class CIA6526 : public IScheduledDevice
 {
     public:
         CIA6526();
@@ -26,11 +28,15 @@ class CIA6526
 
         inline void attachDataBusLatchInstance(DataBusLatch* dataBus) { this->dataBus = dataBus; }
         inline void attachTraceManagerInstance(TraceManager* traceMgr) { this->traceMgr = traceMgr; }
+        void attachSchedulerInstance(EventScheduler* scheduler, EventScheduler::Slot slot);
 
         virtual void reset();
 
         void updateTimers(uint32_t cyclesElapsed);
 
+        // Scheduler callback, applies the cycles elapsed since the last sync
+        void catchUp() override;
+
         uint8_t readRegister(uint16_t address);
         void writeRegister(uint16_t address, uint8_t value);
 
@@ -74,6 +80,18 @@ class CIA6526
 
         virtual void postTimerUpdates(uint32_t cyclesElapsed) = 0;
 
+        // True while postTimerUpdates() has to observe every single cycle
+        virtual bool needsEveryCycle() { return false; }
+
+        // Cycles until postTimerUpdates() next has to see an input line change
+        virtual uint32_t cyclesUntilLineEvent() { return std::numeric_limits<uint32_t>::max(); }
+
+        // Bring the timers up to the scheduler clock before touching chip state
+        void syncClock();
+
+        // Re-evaluate the next event after an outside change (register write, new device)
+        void requestReschedule();
+
         inline uint8_t getPortAOutput() const { return static_cast<uint8_t>(portA | ~ddrA); }
         inline uint8_t getPortBOutput() const { return static_cast<uint8_t>(portB | ~ddrB); }
 
@@ -106,8 +124,13 @@ class CIA6526
     private:
         // Non-owning pointers
         DataBusLatch* dataBus;
+        EventScheduler* scheduler;
         TraceManager* traceMgr;
 
+        // Scheduler bookkeeping
+        EventScheduler::Slot schedulerSlot;
+        uint64_t syncedCycle;
+
         enum class TimerBClockSource : uint8_t
         {
             Phi2,
@@ -164,6 +187,10 @@ class CIA6526
 
         TimerBClockSource getTimerBClockSource() const;
 
+        // Cycles until the next timer underflow or TOD tick
+        uint32_t cyclesUntilNextEvent();
+        void scheduleNextEvent();
+
         void updateTimerA(uint32_t cyclesElapsed);
         void updateTimerB(uint32_t cyclesElapsed);
         void handleTimerBCascade();
@@ -18,7 +18,6 @@ class StateWriter;
 class Vic;
 
 #include <array>
-#include <functional>
 #include <sstream>
 #include <stdexcept>
 #include <stdint.h>
@@ -86,6 +85,11 @@ class CPU
         void tick();
         uint32_t getElapsedCycles();
 
+        // Drive idle loops: everything that decides what the next instruction does,
+        // and bookkeeping for loop iterations that were skipped instead of executed
+        uint64_t getLoopSignature() const;
+        void skipIdleCycles(uint32_t cycleCount, uint32_t instructions);
+
         // Cycles by opcode
         inline static constexpr std::array<uint8_t, 256> CYCLE_COUNTS =
         {{
@@ -576,6 +580,7 @@ class CPU
 
         // ML Monitor
         inline uint32_t getTotalCycles() const { return totalCycles; }
+        inline uint64_t getInstructionCount() const { return instructionCount; }
 
         void postLoadState();
 
@@ -781,6 +786,15 @@ class CPU
             Y
         };
 
+        // Where a micro-op takes its bus address from when it runs
+        enum class CpuMicroAddressSource : uint8_t
+        {
+            Fixed,  // op.address
+            Micro,  // microAddress
+            PC,     // current PC
+            Stack   // $0100 | current SP
+        };
+
         struct CpuMicroOp
         {
             CpuMicroOpKind kind = CpuMicroOpKind::None;
@@ -789,18 +803,41 @@ class CPU
             uint16_t address = 0;
             uint8_t value = 0;
 
-            bool useMicroAddress = false;
+            CpuMicroAddressSource source = CpuMicroAddressSource::Fixed;
             CpuIndexReg index = CpuIndexReg::None;
 
             CpuMicroAction action = CpuMicroAction::None;
         };
 
+        // Immutable cycle program for one opcode or interrupt entry. Programs are
+        // built at compile time; page-cross and branch variants are steps that
+        // skip or end the program when they run.
+        struct CpuMicroProgram
+        {
+            static constexpr size_t MAX_OPS = 8;
+
+            std::array<CpuMicroOp, MAX_OPS> ops {};
+            uint8_t count = 0;
+
+            constexpr void push(const CpuMicroOp& op)
+            {
+                if (count >= MAX_OPS)
+                    throw std::logic_error("CPU micro-op program overflow");
+
+                ops[count++] = op;
+            }
+        };
+
+        static const std::array<CpuMicroProgram, 256> OPCODE_MICRO_PROGRAMS;
+        static const CpuMicroProgram IRQ_MICRO_PROGRAM;
+        static const CpuMicroProgram NMI_MICRO_PROGRAM;
+
         CpuMicroSequenceType microSequenceType;
 
         uint16_t microInterruptVectorAddress;
         uint8_t microInterruptSPBefore;
 
-        std::array<CpuMicroOp, 32> microOps {};
+        const CpuMicroProgram* microProgram;
         uint8_t microOpCount;
         uint8_t microOpIndex;
 
@@ -865,6 +902,10 @@ class CPU
         uint8_t fetchOperand();
         void decodeAndExecute(uint8_t opcode);
 
+        // Opcode dispatch table, shared by every CPU instance (C64 and drives)
+        using OpcodeHandler = void (CPU::*)();
+        static const std::array<OpcodeHandler, 256> OPCODE_HANDLERS;
+
         // Reset vector
         uint16_t resetVectorLow;
         uint16_t resetVectorHigh;
@@ -873,6 +914,7 @@ class CPU
         // Clock Cycle timing
         uint32_t cycles;
         uint32_t totalCycles;
+        uint64_t instructionCount;
         uint32_t elapsedCycles;
         uint32_t lastCycleCount;
         inline bool isPhi2Low() { return (totalCycles & 1) == 0; } // Check if we can temp allow I/O access while CHAR ROM is enabled
@@ -905,9 +947,6 @@ class CPU
         uint8_t cpuRead(uint16_t address, CpuBusCycleType type);
         void cpuWrite(uint16_t address, uint8_t value, CpuBusCycleType type);
 
-        // OpCode Table
-        std::array<std::function<void()>, 256> opcodeTable;
-        void initializeOpcodeTable();
 
         bool rdyLine;
         bool aecLine;
@@ -966,13 +1005,13 @@ class CPU
         uint8_t pop();
 
         //Bitwise operators
-        void AND(uint8_t opcode);
-        void ASL(uint8_t opcode);
-        void EOR(uint8_t opcode);
-        void LSR(uint8_t opcode);
-        void ORA(uint8_t opcode);
-        void ROL(uint8_t opcode);
-        void ROR(uint8_t opcode);
+        template <uint8_t opcode> void AND();
+        template <uint8_t opcode> void ASL();
+        template <uint8_t opcode> void EOR();
+        template <uint8_t opcode> void LSR();
+        template <uint8_t opcode> void ORA();
+        template <uint8_t opcode> void ROL();
+        template <uint8_t opcode> void ROR();
 
         //Branch instructions
         void BCC();
@@ -985,10 +1024,10 @@ class CPU
         void BVS();
 
         //Compare instructions
-        void BIT(uint8_t opcode);
-        void CMP(uint8_t opcode);
-        void CPX (uint8_t opcode);
-        void CPY(uint8_t opcode);
+        template <uint8_t opcode> void BIT();
+        template <uint8_t opcode> void CMP();
+        template <uint8_t opcode> void CPX();
+        template <uint8_t opcode> void CPY();
 
         //Flag Instructions
         inline void CLC() { SR &= ~C; }
@@ -1000,25 +1039,25 @@ class CPU
         inline void SED() { setFlag(D,true); }
 
         //Jump Instructions
-        void JMP(uint8_t opcode);
+        template <uint8_t opcode> void JMP();
         void JSR();
         void RTI();
         void RTS();
 
         //Math instructions
-        void ADC(uint8_t opcode);
-        void SBC(uint8_t opcode);
+        template <uint8_t opcode> void ADC();
+        template <uint8_t opcode> void SBC();
 
         //Memory instructions
-        void DEC(uint8_t opcode);
-        void INC(uint8_t opcode);
-        void LDA(uint8_t opcode);
-        void LDX(uint8_t opcode);
-        void LDY(uint8_t opcode);
-        void SAX(uint8_t opcode);
-        void STA(uint8_t opcode);
-        void STX(uint8_t opcode);
-        void STY(uint8_t opcode);
+        template <uint8_t opcode> void DEC();
+        template <uint8_t opcode> void INC();
+        template <uint8_t opcode> void LDA();
+        template <uint8_t opcode> void LDX();
+        template <uint8_t opcode> void LDY();
+        template <uint8_t opcode> void SAX();
+        template <uint8_t opcode> void STA();
+        template <uint8_t opcode> void STX();
+        template <uint8_t opcode> void STY();
 
         //Register Instructions
         void DEX();
@@ -1040,27 +1079,27 @@ class CPU
 
         //Illegal instructions
         void AAC();
-        void AHX(uint8_t opcode);
+        template <uint8_t opcode> void AHX();
         void ALR();
         void ARR();
         void AXS();
-        void DCP(uint8_t opcode);
-        void ISC(uint8_t opcode);
+        template <uint8_t opcode> void DCP();
+        template <uint8_t opcode> void ISC();
         void LAS();
-        void LAX(uint8_t opcode);
-        void RLA(uint8_t opcode);
-        void RRA(uint8_t opcode);
+        template <uint8_t opcode> void LAX();
+        template <uint8_t opcode> void RLA();
+        template <uint8_t opcode> void RRA();
         void SHX();
         void SHY();
-        void SLO(uint8_t opcode);
-        void SRE(uint8_t opcode);
+        template <uint8_t opcode> void SLO();
+        template <uint8_t opcode> void SRE();
         void TAS();
         void XAA();
 
         //Other instructions
         void BRK();
         void JAM();
-        void NOP(uint8_t opcode);
+        template <uint8_t opcode> void NOP();
 
         // Bus Arbitration
         bool shouldRDYStallForCurrentBusCycle() const;
@@ -1073,43 +1112,57 @@ class CPU
 
         // Micro OP
         void clearMicroOps();
-        void pushMicroOp(const CpuMicroOp& op);
+        void startMicroProgram(const CpuMicroProgram& program);
         bool executeCurrentMicroOp();
-        void buildMicroOpsForOpcode(uint8_t opcode);
-        void buildAbsoluteLoad(CpuMicroAction action);
-        void buildAbsoluteIndexedLoad(CpuIndexReg index, CpuMicroAction action);
-        void buildAbsoluteStore(CpuMicroAction action);
-        void buildAbsoluteIndexedStore(CpuIndexReg index, CpuMicroAction action);
-        void buildImmediateAction(CpuMicroAction action);
-        void buildInternalAction(CpuMicroAction action);
-        void buildZeroPageReadAction(CpuMicroAction action);
-        void buildZeroPageStore(CpuMicroAction action);
-        void buildZeroPageIndexedLoad(CpuIndexReg index, CpuMicroAction action);
-        void buildZeroPageIndexedStore(CpuIndexReg index, CpuMicroAction action);
-        void buildIndirectXRead(CpuMicroAction action);
-        void buildIndirectYRead(CpuMicroAction action);
-        void buildIndirectXRMW(CpuMicroAction action);
-        void buildIndirectYRMW(CpuMicroAction action);
-        void buildIndirectXStore(CpuMicroAction action);
-        void buildIndirectYStore(CpuMicroAction action);
-        void buildZeroPageRMW(CpuMicroAction action);
-        void buildAbsoluteRMW(CpuMicroAction action);
-        void buildZeroPageIndexedRMW(CpuIndexReg index, CpuMicroAction action);
-        void buildAbsoluteIndexedRMW(CpuIndexReg index, CpuMicroAction action);
-        void buildBranch(CpuMicroAction action);
-        void buildStackPush(CpuMicroAction action);
-        void buildStackPull(CpuMicroAction action);
-        void buildJSR();
-        void buildRTS();
-        void buildBRK();
-        void buildRTI();
         bool canExecuteOpcodeWithMicroOps(uint8_t opcode) const;
         bool tickMicroOps();
 
         bool beginPendingInterruptMicroOps();
-        void buildInterruptMicroOps(CpuMicroSequenceType type, uint16_t vectorAddress);
+        void startInterruptMicroOps(CpuMicroSequenceType type, uint16_t vectorAddress);
+
+        // Micro-op program builders, only evaluated at compile time
+        static constexpr std::array<CpuMicroProgram, 256> buildOpcodeMicroPrograms();
+        static constexpr CpuMicroProgram buildInterruptMicroProgram(uint16_t vectorAddress);
+        static constexpr void buildMicroOpsForOpcode(CpuMicroProgram& program, uint8_t opcode);
+        static constexpr void buildAbsoluteLoad(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildAbsoluteIndexedLoad(CpuMicroProgram& program, CpuIndexReg index, CpuMicroAction action);
+        static constexpr void buildAbsoluteStore(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildAbsoluteIndexedStore(CpuMicroProgram& program, CpuIndexReg index, CpuMicroAction action);
+        static constexpr void buildImmediateAction(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildInternalAction(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildZeroPageReadAction(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildZeroPageStore(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildZeroPageIndexedLoad(CpuMicroProgram& program, CpuIndexReg index, CpuMicroAction action);
+        static constexpr void buildZeroPageIndexedStore(CpuMicroProgram& program, CpuIndexReg index, CpuMicroAction action);
+        static constexpr void buildIndirectXRead(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildIndirectYRead(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildIndirectXRMW(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildIndirectYRMW(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildIndirectXStore(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildIndirectYStore(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildZeroPageRMW(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildAbsoluteRMW(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildZeroPageIndexedRMW(CpuMicroProgram& program, CpuIndexReg index, CpuMicroAction action);
+        static constexpr void buildAbsoluteIndexedRMW(CpuMicroProgram& program, CpuIndexReg index, CpuMicroAction action);
+        static constexpr void buildBranch(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildStackPush(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildStackPull(CpuMicroProgram& program, CpuMicroAction action);
+        static constexpr void buildJSR(CpuMicroProgram& program);
+        static constexpr void buildRTS(CpuMicroProgram& program);
+        static constexpr void buildBRK(CpuMicroProgram& program);
+        static constexpr void buildRTI(CpuMicroProgram& program);
 
         // Micro Op Helpers
+        inline uint16_t microOpAddress(const CpuMicroOp& op) const
+        {
+            switch (op.source)
+            {
+                case CpuMicroAddressSource::Micro: return microAddress;
+                case CpuMicroAddressSource::PC:    return PC;
+                case CpuMicroAddressSource::Stack: return uint16_t(0x0100 | SP);
+                default:                           return op.address;
+            }
+        }
         uint8_t getIndexValue(CpuIndexReg index) const;
         void compareRegisterWithTemp(uint8_t reg);
         void finishMicroInstructionAfterCurrentOp();
@@ -1120,6 +1173,13 @@ class CPU
         // Tracing
         TraceManager::Stamp makeCpuStamp() const;
 
+        // Gate for trace hooks; folds to false when NO_DEBUG_HOOKS is defined
+        #ifdef NO_DEBUG_HOOKS
+        inline bool traceActive() const { return false; }
+        #else
+        inline bool traceActive() const { return traceMgr && traceMgr->isEnabled(); }
+        #endif
+
         uint8_t executedMicroOpsThisInstruction = 0;
 
         // ML Monitor
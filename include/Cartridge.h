@@ -14,6 +14,7 @@ class DataBusLatch;
 class Memory;
 class Vic;
 
+#include <array>
 #include <cstdint>
 #include <fstream>
 #include <iostream>
@@ -172,11 +173,17 @@ class Cartridge
         inline size_t getCartridgeSize() const { return cartSize / 1024; }
         inline std::vector<chipSection>& getChipSections() { return chipSections; }
 
+        // Zero-copy bank switching: indices into chipSections for a bank, and
+        // pointing a LO/HI window straight at that bank's chip data
+        inline const std::vector<size_t>& getBankSections(uint8_t bank) const { return bankSections[bank]; }
+        bool mapChipBank(uint8_t bank, cartLocation location);
+
         // EEPROM API
         inline bool romWriteEnabled(uint16_t address) const { return mapper ? mapper->romWriteEnabled(address) : false; }
         inline bool romReadHandledByMapper(uint16_t address) const { return mapper ? mapper->romReadHandledByMapper(address) : false; }
 
         inline bool cpuMemoryHandledByMapper(uint16_t address) const { return mapper ? mapper->cpuMemoryHandledByMapper(address) : false;}
+        inline bool hasCpuMemoryOverrides() const { return mapper ? mapper->hasCpuMemoryOverrides() : false; }
 
     protected:
         // Cartridge LO/HI location constants
@@ -185,6 +192,7 @@ class Cartridge
         static constexpr size_t CART_HI_START1 = 0xE000;
 
         std::vector<chipSection> chipSections;  // vector for ROM chip banks
+        std::array<std::vector<size_t>, 256> bankSections; // chipSections indices by bank number
         std::vector<uint8_t> romData;           // vector to store the Cartridge rom
         std::vector<uint8_t> ramData;           // vector for Cartridge ram if supported
         bool hasRAM;                            // Set for Cartridges that have RAM
@@ -225,6 +233,7 @@ class Cartridge
 
         // Helper functions
         bool processChipSections();
+        void releaseChipSections();
         void determineWiringMode();
 
         #pragma pack(push,1)
@@ -52,6 +52,9 @@ class CartridgeMapper
 
         virtual void tick(uint32_t elapsedCycles) { (void)elapsedCycles; }
 
+        // Only mappers with timed hardware (capacitors, freeze delays) are ticked
+        inline bool isClocked() const { return clocked; }
+
         // EEPROM API
         virtual bool hasPersistence() const { return false; }
         virtual bool savePersistence(const std::string& path) const { return false; }
@@ -65,10 +68,19 @@ class CartridgeMapper
         // CPU RAM
         virtual bool cpuMemoryHandledByMapper(uint16_t address) const;
 
+        // Mappers that claim CPU addresses outside the cartridge banks keep Memory off its page map
+        inline bool hasCpuMemoryOverrides() const { return claimsCpuMemory; }
+
     protected:
         Cartridge* cart = nullptr;
         Memory* mem = nullptr;
 
+        // Set by mappers that override tick()
+        bool clocked = false;
+
+        // Set by mappers that override cpuMemoryHandledByMapper()
+        bool claimsCpuMemory = false;
+
         // Cartridge LO/HI location constants
         static constexpr size_t CART_LO_START = 0x8000;
         static constexpr size_t CART_HI_START = 0xA000;
@@ -47,6 +47,10 @@ class Cassette
         // Tick with the emulator loop
         void tick();
 
+        // Run several cycles at once, and how many can pass before getData() changes
+        void advance(uint32_t cycles);
+        uint32_t cyclesUntilDataChange() const;
+
         // Data access
         inline bool getData() const { return data; }
         inline void setData(bool dataLevel) { data = dataLevel; }
@@ -25,6 +25,7 @@ inline uint8_t asciiToPetscii(char c)
         case ' ': return 0x20;
         case '.': return 0x2E;
         case '"': return 0x22;
+        case '$': return 0x24;
         case '*': return 0x2A;
         case ',': return 0x2C;
         case ':': return 0x3A;
@@ -0,0 +1,132 @@
+// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#ifndef COMPONENT_PROFILER_H
+#define COMPONENT_PROFILER_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+// Sampling host-time profiler for the per-cycle machine loop.
+//
+// Reading the clock around every component on every cycle would cost more
+// than the components themselves, so only one cycle in sampleInterval is
+// timed. Each mark() charges the time since the previous mark to the given
+// component, which lets nested callers (the IEC bus ticking drives) split
+// their own time without a stack.
+class ComponentProfiler
+{
+    public:
+        enum class Component : uint8_t
+        {
+            VIC,
+            CPU,
+            SID,
+            CIA,
+            Expansion,
+            IECBus,
+            Drives,
+            Cartridge,
+            Count
+        };
+
+        static constexpr size_t COMPONENT_COUNT = static_cast<size_t>(Component::Count);
+
+        explicit ComponentProfiler(uint32_t sampleInterval = 64) :
+            sampleInterval_(sampleInterval ? sampleInterval : 1),
+            countdown_(sampleInterval_),
+            sampling_(false),
+            sampledCycles_(0),
+            nanos_{}
+        {
+
+        }
+
+        // Returns true when this cycle should be timed
+        inline bool beginCycle()
+        {
+            if (--countdown_ != 0)
+                return false;
+
+            countdown_ = sampleInterval_;
+            sampling_ = true;
+            ++sampledCycles_;
+            last_ = Clock::now();
+            return true;
+        }
+
+        inline void endCycle() { sampling_ = false; }
+
+        inline bool isSampling() const { return sampling_; }
+
+        inline void mark(Component c)
+        {
+            const Clock::time_point now = Clock::now();
+            nanos_[static_cast<size_t>(c)] += static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(now - last_).count());
+            last_ = now;
+        }
+
+        inline void reset()
+        {
+            countdown_ = sampleInterval_;
+            sampling_ = false;
+            sampledCycles_ = 0;
+            nanos_.fill(0);
+        }
+
+        inline uint32_t getSampleInterval() const { return sampleInterval_; }
+        inline uint64_t getSampledCycles() const { return sampledCycles_; }
+        inline uint64_t getNanos(Component c) const { return nanos_[static_cast<size_t>(c)]; }
+
+        inline uint64_t getTotalNanos() const
+        {
+            uint64_t total = 0;
+            for (uint64_t n : nanos_) total += n;
+            return total;
+        }
+
+        // Share of the sampled time spent in a component, 0.0 - 1.0
+        inline double getShare(Component c) const
+        {
+            const uint64_t total = getTotalNanos();
+            return total ? static_cast<double>(getNanos(c)) / static_cast<double>(total) : 0.0;
+        }
+
+        static inline const char* componentName(Component c)
+        {
+            switch (c)
+            {
+                case Component::VIC:        return "vic";
+                case Component::CPU:        return "cpu";
+                case Component::SID:        return "sid";
+                case Component::CIA:        return "cia";
+                case Component::Expansion:  return "expansion";
+                case Component::IECBus:     return "iecbus";
+                case Component::Drives:     return "drives";
+                case Component::Cartridge:  return "cartridge";
+                default:                    return "unknown";
+            }
+        }
+
+    protected:
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        uint32_t sampleInterval_;
+        uint32_t countdown_;
+        bool sampling_;
+
+        uint64_t sampledCycles_;
+        std::array<uint64_t, COMPONENT_COUNT> nanos_;
+
+        Clock::time_point last_;
+};
+
+#endif // COMPONENT_PROFILER_H
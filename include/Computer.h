@@ -15,11 +15,13 @@
 #include <string>
 #include "Cartridge/ICartridgeHost.h"
 #include "CPUTiming.h"
+#include "HeadlessConfig.h"
 #include "MachineComponents.h"
 #include "MachineRomConfig.h"
 #include "MachineRuntimeState.h"
 
 // Forward declarations
+class ComponentProfiler;
 class DebugManager;
 class MLMonitor;
 class ResetController;
@@ -29,7 +31,7 @@ class UIBridge;
 class Computer : public ICartridgeHost
 {
     public:
-        Computer();
+        explicit Computer(bool headless = false);
         ~Computer() noexcept;
 
         // State Management
@@ -44,8 +46,15 @@ class Computer : public ICartridgeHost
         // Main emulation loop
         bool boot();
 
+        // Run without SDL video/audio/input until a stop condition is met
+        bool runHeadless(const HeadlessConfig& config, HeadlessResult& result);
+        inline bool isHeadless() const { return headless_; }
+
         void tickCycle();
 
+        // Catch lazily clocked chips and idle drives up to the current cycle, e.g. at frame boundaries
+        void syncScheduledDevices();
+
         // Reset methods
         void warmReset();
         void coldReset();
@@ -54,6 +63,20 @@ class Computer : public ICartridgeHost
         void setVideoMode(const std::string& mode);
         void setSIDModel(const std::string& model);
 
+        // Run the disk drives on their own host threads
+        void setDriveThreads(bool enabled);
+
+        // Synthesise the SID's audio on its own host thread
+        void setSIDThread(bool enabled);
+
+        // Host audio rate (44100, 48000, 96000) and SID output band limiting (fast, high)
+        void setAudioSampleRate(int rate);
+        void setSIDResampler(const std::string& quality);
+
+        // Extra SIDs (2SID/3SID) and stereo position, -1 left to 1 right
+        bool addSID(uint16_t baseAddress, const std::string& model, double pan);
+        void setSIDPan(double pan);
+
         // Attachments
         inline void setCartridgeAttached(bool flag) { if (components_.media) components_.media->setCartAttached(flag); }
         inline void setCartridgePath(const std::string& path) { if (components_.media) components_.media->setCartPath(path); }
@@ -132,6 +155,12 @@ class Computer : public ICartridgeHost
         VideoMode videoMode_ = VideoMode::NTSC;
         const CPUConfig* cpuCfg_ = &NTSC_CPU;
 
+        // No SDL context, window or audio device
+        bool headless_;
+
+        // Optional per-component timing, only set for headless runs
+        ComponentProfiler* profiler_;
+
         // Graphics loop threading
         std::atomic<bool> running;
 
@@ -161,6 +190,10 @@ class Computer : public ICartridgeHost
 
         // Wire all the components together
         void wireUp();
+
+        // Cycle body, the profiled variant marks time after each component
+        template <bool Profiled>
+        void tickCycleImpl();
 };
 
 #endif // COMPUTER_H
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#ifndef DEBUGHOOKS_H
+#define DEBUGHOOKS_H
+
+// Define NO_DEBUG_HOOKS in release builds to compile watchpoint and trace
+// checks out of the CPU and memory paths entirely.
+
+#include <array>
+#include <cstdint>
+
+// Forward declarations
+class Memory;
+
+// Registry of armed debug hooks on the CPU memory path.
+//
+// Watchpoints set a bit per address and bump a per-page count, and enabling
+// tracing arms every page. Memory only sends armed pages down its slow path,
+// so with nothing armed a RAM or ROM access pays nothing for the debugger.
+class DebugHooks
+{
+    public:
+        DebugHooks();
+        virtual ~DebugHooks();
+
+        enum Access : uint8_t
+        {
+            HOOK_READ  = 0x01,
+            HOOK_WRITE = 0x02
+        };
+
+        inline void attachMemoryInstance(Memory* mem) { this->mem = mem; }
+
+        // Watchpoints
+        void arm(uint16_t address, Access access);
+        void disarm(uint16_t address, Access access);
+        void disarmAll(Access access);
+
+        // Tracing needs to see every access while it is enabled
+        void setTracing(bool on);
+
+        // Memory path
+        inline bool isArmed(uint16_t address, Access access) const { return (flags[address] & access) != 0; }
+        inline bool isPageArmed(uint8_t page) const { return tracing || pageArmCount[page] != 0; }
+
+    protected:
+
+    private:
+        // Non-owning pointers
+        Memory* mem;
+
+        std::array<uint8_t, 0x10000> flags;
+        std::array<uint16_t, 256> pageArmCount;
+        bool tracing;
+
+        void pageChanged();
+};
+
+#endif // DEBUGHOOKS_H
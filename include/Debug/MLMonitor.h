@@ -22,6 +22,7 @@
 
 // Forward declarations
 class Computer;
+class DebugHooks;
 class MLMonitorBackend;
 class MonitorCommand;
 
@@ -39,6 +40,7 @@ class MLMonitor
         inline void attachMLMonitorBackendInstance(MLMonitorBackend* monbackend) { this->monbackend = monbackend; }
         inline MLMonitorBackend* mlmonitorbackend() const { return monbackend; }
         void attachTraceManagerInstance(class TraceManager* tm);
+        inline void attachDebugHooksInstance(DebugHooks* hooks) { this->hooks = hooks; }
 
         // Breakpoint management
         inline void addBreakpoint(uint16_t bp) { breakpoints.insert(bp); }
@@ -88,6 +90,7 @@ class MLMonitor
 
     private:
         // Pointers
+        DebugHooks* hooks;
         MLMonitorBackend* monbackend;
 
         std::unordered_map<std::string, std::unique_ptr<MonitorCommand>> commands;
@@ -241,6 +241,9 @@ class MLMonitorBackend
         std::string vicDumpBadlineState() const;
         std::string vicDumpBorderState() const;
         std::string vicDumpMemory(uint16_t address, int count) const;
+        std::string vicDebugCaptureStatus() const;
+        inline void vicSetDebugCapture(bool enabled) { if (vic) vic->setDebugCaptureEnabled(enabled); }
+        inline void vicCaptureNextFrame() { if (vic) vic->captureNextFrameForDebug(); }
         void vicFFRaster(uint8_t targetRaster);
 
     private:
@@ -8,12 +8,14 @@
 #ifndef TRACEMANAGER_H
 #define TRACEMANAGER_H
 
+#include <atomic>
 #include <bit>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <memory>
 
@@ -22,6 +24,7 @@ class Cartridge;
 class CIA1;
 class CIA2;
 class CPU;
+class DebugHooks;
 class Memory;
 class PLA;
 class SID;
@@ -37,6 +40,7 @@ class TraceManager
         inline void attachCIA1Instance(CIA1* cia1object) { this->cia1object = cia1object; }
         inline void attachCIA2Instance(CIA2* cia2object) { this->cia2object = cia2object; }
         inline void attachCPUInstance(CPU* processor) { this->processor = processor; }
+        inline void attachDebugHooksInstance(DebugHooks* hooks) { this->hooks = hooks; }
         inline void attachMemoryInstance(Memory* mem) { this->mem = mem; }
         inline void attachPLAInstance(PLA* pla) { this->pla = pla; }
         inline void attachSIDInstance(SID* sidchip) { this->sidchip = sidchip; }
@@ -142,6 +146,9 @@ class TraceManager
         void dumpBuffer();
         void clearBuffer();
 
+        // Records lost because the file writer fell a full ring behind
+        inline uint64_t getDroppedRecords() const { return droppedRecords.load(std::memory_order_relaxed); }
+
         // Standard stamping for logging
         struct Stamp
         {
@@ -205,6 +212,7 @@ class TraceManager
         CIA1* cia1object;
         CIA2* cia2object;
         CPU* processor;
+        DebugHooks* hooks;
         Memory* mem;
         PLA* pla;
         SID* sidchip;
@@ -213,7 +221,52 @@ class TraceManager
         // Status
         bool tracing;
         std::ofstream file;
-        std::vector<std::string> buffer;
+
+        // Binary trace records. Events are stored unformatted in a fixed ring and
+        // only turned into text when the monitor dumps them or the file writer
+        // thread streams them out.
+        enum class RecordKind : uint8_t
+        {
+            Text,
+            StampedText,
+            CartBank,
+            CiaTimer,
+            CiaICR,
+            CPUExec,
+            MemRead,
+            MemWrite,
+            PlaMode,
+            PlaPort,
+            PlaResolve,
+            SidWrite,
+            VicRaster,
+            VicIrq
+        };
+
+        static constexpr size_t RECORD_TEXT_SIZE = 120;
+
+        struct TraceRecord
+        {
+            Stamp stamp;
+            RecordKind kind;
+            uint8_t byte[7];            // Small operands (values, registers, flags)
+            uint16_t word[4];           // Addresses, PCs, raster positions
+            const char* name;           // Static string: text prefix or PLA bank name
+            char text[RECORD_TEXT_SIZE]; // Pre-formatted event text, truncated to fit
+        };
+
+        static constexpr size_t RING_SIZE = 1u << 15;
+        static constexpr uint64_t RING_MASK = RING_SIZE - 1;
+
+        std::unique_ptr<TraceRecord[]> ring; // About 5.5 MB, allocated when tracing is first enabled
+        std::atomic<uint64_t> ringHead;    // Next record to write, only advanced by the emulation thread
+        uint64_t dumpTail;                 // Oldest record not yet dumped by the monitor
+
+        // File writer thread
+        std::thread writerThread;
+        std::atomic<bool> writerRunning;
+        std::atomic<uint64_t> droppedRecords;
+        uint64_t writerTail;
 
         // Categories
         uint32_t chipCats;
@@ -244,6 +297,17 @@ class TraceManager
         struct AddrRange { uint16_t lo, hi; bool contains(uint16_t a) const { return a>=lo && a<=hi; } };
         std::vector<AddrRange> memRanges;
         std::string makeStamp(const Stamp& stamp) const;
+
+        // Ring access
+        TraceRecord& beginRecord(RecordKind kind, const Stamp& stamp);
+        inline void commitRecord() { ringHead.store(ringHead.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+        void recordText(const char* prefix, const std::string& text, const Stamp* stamp);
+        bool copyRecord(uint64_t& tail, TraceRecord& out);
+        std::string formatRecord(const TraceRecord& rec) const;
+
+        void startWriter();
+        void stopWriter();
+        void writerLoop();
 };
 
 #endif // TRACEMANAGER_H
@@ -25,6 +25,7 @@ class VICCommand : public MonitorCommand
         std::string shortHelp() const override;
         std::string regsUsage() const;
         std::string borderUsage() const;
+        std::string captureUsage() const;
         std::string cycleUsage() const;
         std::string eventsUsage() const;
         std::string mapUsage() const;
@@ -35,6 +35,7 @@ class SID;
 class UserPort;
 class Vic;
 
+class DebugHooks;
 class MLMonitor;
 class MLMonitorBackend;
 class TraceManager;
@@ -87,6 +88,7 @@ class DebugManager
         bool handleEvent(const SDL_Event& ev);
 
         // Accessors for other systems
+        DebugHooks& hooks();
         MLMonitor& monitor();
         MLMonitorBackend& backend();
         TraceManager& trace();
@@ -97,6 +99,7 @@ class DebugManager
     private:
          std::atomic<bool>& uiPaused_;
 
+        std::unique_ptr<DebugHooks>       hooks_;
         std::unique_ptr<MLMonitor>        monitor_;
         std::unique_ptr<MLMonitorBackend> backend_;
         std::unique_ptr<TraceManager>     trace_;
@@ -40,7 +40,7 @@ class D1541 : public Drive, public IDriveIndicatorView, public IDrivePositionVie
         std::string getCurrentDiskPath() const override { return isDiskLoaded() ? loadedDiskName : std::string{}; }
 
         // Compatibility check
-        inline bool canMount(DiskFormat fmt) const override { return fmt == DiskFormat::D64; }
+        inline bool canMount(DiskFormat fmt) const override { return fmt == DiskFormat::D64 || fmt == DiskFormat::G64; }
 
         // IRQ handling
         void updateIRQ() override;
@@ -152,6 +152,7 @@ class D1541 : public Drive, public IDriveIndicatorView, public IDrivePositionVie
 
         // Floppy factory
         std::unique_ptr<Disk> diskImage;
+        G64* gcrImage; // Non-owning view of diskImage when it is a raw GCR image
 
         // Track sectors for UI
         std::vector<uint8_t> gcrSectorAtPos;
@@ -185,12 +186,14 @@ class D1541 : public Drive, public IDriveIndicatorView, public IDrivePositionVie
         uint8_t currentTrack;
         uint8_t currentSector;
         uint8_t densityCode; // 0..3
+        uint8_t gcrTrackZone; // Speed zone of the loaded G64 track
 
         // GCR
         std::vector<uint8_t> gcrTrackStream;
         std::vector<uint8_t> gcrSync;
         int  gcrBitCounter; // Used to rate limit bits
         size_t gcrPos;
+        size_t gcrPosLength; // Track length gcrPos counts in, kept over unformatted G64 half-tracks
         bool gcrDirty;
 
         // Raw GCR track cache. Once written, the raw track is authoritative
@@ -212,9 +215,14 @@ class D1541 : public Drive, public IDriveIndicatorView, public IDrivePositionVie
         uint8_t uiSector;
         bool uiLedWasOn;
 
+        bool canSkipIdle() const override;
+        void runOwedIdleCycles(uint32_t cycles) override;
+
         bool gcrTick();
         void gcrAdvance(uint32_t dc);
         void rebuildGCRTrackStream();
+        void loadGCRTrackFromImage();
+        void startBlankGCRTrack();
         void saveCurrentRawTrackToCache();
         void loadCurrentRawTrackFromCacheOrBuild();
         void invalidateRawGcrCache();
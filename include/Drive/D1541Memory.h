@@ -17,6 +17,7 @@
 #include "Drive/DriveChips.h"
 #include "IRQLine.h"
 #include "Peripheral.h"
+#include "RomCache.h"
 #include "StateReader.h"
 #include "StateWriter.h"
 
@@ -31,6 +32,7 @@ class D1541Memory : public DriveMemoryBase
 
         // Tick to advance the VIA chips
         void tick(uint32_t cycles);
+        uint32_t getQuietCycles() const override;
 
         // State Management
         void saveState(StateWriter& wrtr) const;
@@ -65,8 +67,8 @@ class D1541Memory : public DriveMemoryBase
 
         // Memory vectors
         std::vector<uint8_t> D1541RAM;
-        std::vector<uint8_t> D1541ROM1;
-        std::vector<uint8_t> D1541ROM2;
+        RomSpan D1541ROM1;
+        RomSpan D1541ROM2;
 
         // RAM constants
         static constexpr size_t RAM_SIZE = 0x0800; // 2K RAM
@@ -87,7 +89,7 @@ class D1541Memory : public DriveMemoryBase
         static const uint16_t VIA2_END =  0x1FFF;
 
         // ROM Loader
-        bool loadROM(const std::string& filename, std::vector<uint8_t>& targetBuffer, size_t expectedSize, const std::string& romName);
+        bool loadROM(const std::string& filename, RomSpan& target, size_t expectedSize, const std::string& romName);
 };
 
 #endif // D1541MEMORY_H
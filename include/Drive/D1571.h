@@ -47,7 +47,7 @@ class D1571 : public Drive, public FloppyControllerHost, public IDriveIndicatorV
         std::string getCurrentDiskPath() const override { return isDiskLoaded() ? loadedDiskName : std::string{}; }
 
         // Compatibility check
-        inline bool canMount(DiskFormat fmt) const override { return fmt == DiskFormat::D64 || fmt == DiskFormat::D71; }
+        inline bool canMount(DiskFormat fmt) const override { return fmt == DiskFormat::D64 || fmt == DiskFormat::D71 || fmt == DiskFormat::G64; }
 
         // IEC getters
         inline bool getAtnLineLow()  const  override { return bus ? !bus->readAtnLine() : atnLineLow; }
@@ -149,6 +149,9 @@ class D1571 : public Drive, public FloppyControllerHost, public IDriveIndicatorV
         D1571Memory d1571mem;
         IRQLine IRQ;
 
+        // CPU cycles the VIAs, CIA and FDC have not been advanced by yet
+        uint32_t pendingChipCycles = 0;
+
         static constexpr uint8_t GCR5[16] =
         {
             0x0A, 0x0B, 0x12, 0x13,
@@ -216,6 +219,10 @@ class D1571 : public Drive, public FloppyControllerHost, public IDriveIndicatorV
 
         bool gcrTick();
         void gcrAdvance(uint32_t dc);
+        void runCPUCycle();
+        void flushChipCycles();
+        bool canSkipIdle() const override;
+        void runOwedIdleCycles(uint32_t cycles) override;
         void rebuildGCRTrackStream();
         void gcrEncode4Bytes(const uint8_t in[4], uint8_t out[5]);
         void gcrEncodeBytes(const uint8_t* in, size_t len, std::vector<uint8_t>& out);
@@ -21,6 +21,7 @@ class D1571;
 #include "Drive/D1571VIA.h"
 #include "Drive/DriveChips.h"
 #include "Drive/FDC177x.h"
+#include "RomCache.h"
 #include "StateReader.h"
 #include "StateWriter.h"
 
@@ -41,6 +42,7 @@ class D1571Memory : public DriveMemoryBase
 
         void reset();
         void tick(uint32_t cycles);
+        uint32_t getQuietCycles() const override;
 
         bool initialize(const std::string& fileName);
 
@@ -98,7 +100,8 @@ class D1571Memory : public DriveMemoryBase
 
         // Memory chips
         std::vector<uint8_t> D1571RAM;
-        std::vector<uint8_t> D1571ROM;
+        RomSpan D1571ROM;
+        uint16_t romBase; // 16K ROMs only fill $C000-$FFFF
 
         bool loadROM(const std::string& filename);
 };
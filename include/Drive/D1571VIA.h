@@ -27,6 +27,15 @@ class D1571VIA : public DriveVIA6522
         uint8_t readRegister(uint16_t address);
         void writeRegister(uint16_t address, uint8_t value);
 
+        // Reading port A also hands a pending disk byte to the drive
+        inline bool isQuietRead(uint16_t address) const override
+        {
+            if ((address & 0x0F) == 0x01 && mechBytePending)
+                return false;
+
+            return DriveVIA6522::isQuietRead(address);
+        }
+
         // Drive mechanics
         inline bool isLedOn() const { return ledOn; }
         inline void setLed(bool on) { ledOn = on; }
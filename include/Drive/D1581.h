@@ -157,6 +157,9 @@ class D1581 : public Drive, public FloppyControllerHost, public IDriveIndicatorV
         D1581Memory d1581mem;
         IRQLine     irq;
 
+        // CPU cycles the CIA and FDC have not been advanced by yet
+        uint32_t pendingChipCycles = 0;
+
         std::unique_ptr<Disk> diskImage;
 
         uint8_t currentSide;
@@ -198,6 +201,9 @@ class D1581 : public Drive, public FloppyControllerHost, public IDriveIndicatorV
 
         void resetForMediaChange();
         void syncLiveIECInputs();
+        void runCPUCycle();
+        void flushChipCycles();
+        void runOwedIdleCycles(uint32_t cycles) override;
 };
 
 #endif // D1581_H
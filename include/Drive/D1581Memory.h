@@ -22,6 +22,7 @@ class D1581;
 #include "Peripheral.h"
 #include "Drive/D1581CIA.h"
 #include "Drive/FDC177x.h"
+#include "RomCache.h"
 #include "StateReader.h"
 #include "StateWriter.h"
 
@@ -45,6 +46,7 @@ class D1581Memory : public DriveMemoryBase
 
         void reset();
         void tick(uint32_t cycles);
+        uint32_t getQuietCycles() const override;
 
         bool initialize(const std::string& fileName);
 
@@ -84,7 +86,8 @@ class D1581Memory : public DriveMemoryBase
 
         // CHIPS
         std::vector<uint8_t> D1581RAM;
-        std::vector<uint8_t> D1581ROM;
+        RomSpan D1581ROM;
+        uint16_t romBase; // 16K ROMs only fill $C000-$FFFF
 
         bool loadROM(const std::string& filename);
 };
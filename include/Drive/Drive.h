@@ -16,6 +16,7 @@ class FDC177x;
 #include "Common/DriveTypes.h"
 #include "cpu.h"
 #include "Drive/DriveChips.h"
+#include "Drive/DriveIdleTracker.h"
 #include "Floppy/DiskFactory.h"
 #include "Peripheral.h"
 
@@ -71,6 +72,9 @@ class Drive : public Peripheral
         // Timing simulation.
         virtual void tick(uint32_t cycles) = 0; // Called each emulation cycle
 
+        // Run the cycles a skipped idle loop still owes so the drive state is current
+        void syncIdle();
+
         // IRQ handling
         virtual void updateIRQ() = 0;
 
@@ -138,6 +142,44 @@ class Drive : public Peripheral
     protected:
         std::unique_ptr<Disk> diskImage;
 
+        // Skips the DOS idle loop while nothing can change its outcome. Each drive
+        // attaches its CPU and memory, calls skipIdleCycle() before and
+        // observeIdle() after every drive CPU cycle, and resets the tracker on a
+        // reset or state load.
+        DriveIdleTracker idleTracker;
+
+        void attachIdleTracking(CPU* cpu, DriveMemoryBase* memory);
+
+        // While a loop is skipped the cycle is only counted, returns false when the CPU has to run it
+        inline bool skipIdleCycle()
+        {
+            if (!idleTracker.isIdle())
+                return false;
+
+            if (idleTracker.oweCycle())
+                skipIdleIteration();
+
+            return true;
+        }
+
+        // Start skipping once the CPU completed a repeatable iteration that no chip interrupts
+        inline void observeIdle()
+        {
+            if (idleTracker.observe(*idleCPU, idleMemory->getSideEffectCount()) &&
+                canSkipIdle() &&
+                idleMemory->getQuietCycles() >= idleTracker.getPeriod())
+            {
+                idleTracker.suspend();
+            }
+        }
+
+        // Drive specific: mechanics that still need every cycle (a turning disk under the head)
+        virtual bool canSkipIdle() const { return true; }
+
+        // Drive specific: execute the cycles of a skipped iteration that were only counted so far,
+        // and leave the chips current, whoever called syncIdle() is about to look at them
+        virtual void runOwedIdleCycles(uint32_t cycles) = 0;
+
         // Talking state
         int currentSecondaryAddress;
         bool waitingForAck;
@@ -157,6 +199,12 @@ class Drive : public Peripheral
     private:
         // Serial receiver state (legacy bit-shift state)
         bool lastClkHigh;
+
+        // Non owning, the drive's own CPU and memory
+        CPU* idleCPU;
+        DriveMemoryBase* idleMemory;
+
+        void skipIdleIteration();
 };
 
 #endif // DRIVE_H
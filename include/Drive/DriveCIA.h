@@ -35,6 +35,15 @@ class DriveCIA : public DriveCIABase
 
         inline bool checkIRQActive() const { return (interruptStatus & registers.interruptEnable & 0x1F) != 0; }
 
+        // Idle detection: accesses an idle loop may repeat without changing the chip,
+        // and the cycles tick() can run before a timer interrupts or shifts a bit out
+        bool isQuietRead(uint16_t address) const;
+        bool isQuietWrite(uint16_t address, uint8_t value) const;
+        uint32_t getQuietCycles() const;
+
+        // A byte is being shifted out, so timer A underflows reach the serial pins
+        inline bool isSerialOutputActive() const { return (registers.controlRegisterA & CRA_SPMODE) != 0 && serialOutputLoaded; }
+
         // ML Monitor
         inline uint8_t getPortAPinsDebug() const { return portAPins; }
         inline uint8_t getPortBPinsDebug() const { return portBPins; }
@@ -176,6 +185,9 @@ class DriveCIA : public DriveCIABase
         bool serialOutputLoaded;
 
         void handleSerialInputEdge(bool oldCntLevel, bool newCntLevel, bool newSpLevel);
+
+        // One PHI2 cycle of both timers and the serial output, tick() runs the quiet stretches in bulk
+        void stepCycle();
 };
 
 #endif // DRIVECIA_H
@@ -10,6 +10,25 @@ class DriveMemoryBase : public CPUBus
         ~DriveMemoryBase() override = default;
 
         virtual void tick(uint32_t cycles) { (void)cycles; }
+
+        // Idle detection: bumped by every access the CPU could not repeat without
+        // changing something (I/O with side effects, RAM writes of a new value)
+        inline uint32_t getSideEffectCount() const { return sideEffectCount; }
+
+        // Chip cycles that can pass before a chip raises an interrupt or drives the bus
+        virtual uint32_t getQuietCycles() const { return 0; }
+
+    protected:
+        uint32_t sideEffectCount = 0;
+
+        inline void storeRAM(uint8_t& cell, uint8_t value)
+        {
+            if (cell != value)
+            {
+                cell = value;
+                ++sideEffectCount;
+            }
+        }
 };
 
 class DriveCIABase
@@ -0,0 +1,80 @@
+﻿// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#ifndef DRIVEIDLETRACKER_H
+#define DRIVEIDLETRACKER_H
+
+#include <cstdint>
+
+class CPU;
+
+// Spots a drive CPU spinning in a loop that only looks at unchanged RAM
+// (the DOS idle loop waiting for ATN or a job) and lets the drive skip
+// whole iterations of it instead of executing them.
+//
+// An iteration qualifies when the CPU comes back to the same instruction
+// boundary with the same registers, the drive memory saw no side effect
+// (see DriveMemoryBase) and the IRQ line kept its level. Repeating such an
+// iteration can only give the same result, so the drive only has to count
+// the cycles and advance its chips, as long as none of them is about to
+// raise an interrupt. Any input change must wake the tracker first.
+class DriveIdleTracker
+{
+    public:
+        DriveIdleTracker();
+        ~DriveIdleTracker();
+
+        // Forget the loop seen so far and leave the idle state
+        void reset();
+
+        // Call after every drive CPU cycle while not idle, returns true when the
+        // CPU has just completed an iteration that can be repeated by skipIteration()
+        bool observe(const CPU& cpu, uint32_t sideEffects);
+
+        // Start skipping the loop found by observe()
+        inline void suspend() { idle = true; owed = 0; }
+
+        // While idle, count one drive CPU cycle, returns true once a whole iteration is owed
+        inline bool oweCycle() { return ++owed >= period; }
+
+        // Account the owed iteration in the CPU counters, the caller advances the chips
+        void skipIteration(CPU& cpu);
+
+        // Leave the idle state, returns the cycles of the current iteration the caller still has to run
+        uint32_t resume();
+
+        inline bool isIdle() const { return idle; }
+        inline uint32_t getPeriod() const { return period; }
+
+        // ML Monitor
+        inline uint64_t getSkippedCycles() const { return skippedCycles; }
+
+    protected:
+
+    private:
+        // Loops longer than this are not worth tracking, the anchor moves on instead
+        static constexpr uint32_t MAX_PERIOD = 256;
+
+        // Instruction boundary the current candidate loop started at
+        bool anchorValid;
+        uint64_t anchorSignature;
+        uint32_t anchorSideEffects;
+        uint32_t anchorCycles;
+        uint64_t anchorInstructions;
+
+        // Iteration being skipped
+        bool idle;
+        uint32_t period;
+        uint32_t instructions;
+        uint32_t owed;
+
+        uint64_t skippedCycles;
+
+        void setAnchor(uint64_t signature, uint32_t sideEffects, const CPU& cpu);
+};
+
+#endif // DRIVEIDLETRACKER_H
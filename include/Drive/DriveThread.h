@@ -0,0 +1,137 @@
+﻿// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#ifndef DRIVETHREAD_H
+#define DRIVETHREAD_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class Drive;
+
+// Runs one drive on its own host thread, lagging the C64 by a bounded number of cycles.
+//
+// The emulator thread hands over a target cycle and timestamped changes of the C64's IEC
+// outputs through a lock-free queue, so the drive sees them at the exact cycle they were
+// made. The drive answers with timestamped changes of its own outputs, which the bus
+// collects at a barrier: every time the C64 samples the bus, and at the latest once the
+// drive falls too far behind. Lines driven by the other peripherals are only refreshed at
+// those barriers.
+class DriveThread
+{
+    public:
+        // IEC line bits of the pull-low masks
+        static constexpr uint8_t LINE_ATN  = 0x01;
+        static constexpr uint8_t LINE_CLK  = 0x02;
+        static constexpr uint8_t LINE_DATA = 0x04;
+        static constexpr uint8_t LINE_SRQ  = 0x08;
+
+        struct OutputEvent
+        {
+            uint64_t cycle;
+            uint8_t line;
+            bool low;       // For SRQ: asserted
+        };
+
+        // clockCycle advances the drive by one host cycle
+        DriveThread(Drive& drive, std::function<void()> clockCycle, uint64_t startCycle);
+        ~DriveThread();
+
+        DriveThread(const DriveThread&) = delete;
+        DriveThread& operator=(const DriveThread&) = delete;
+
+        // The drive thread whose drive is running on this host thread, nullptr otherwise
+        static inline DriveThread* current() { return currentThread; }
+
+        inline Drive& getDrive() const { return drive; }
+
+        // Emulator thread: let the drive run up to (not including) cycle
+        void runTo(uint64_t cycle);
+
+        // Emulator thread: runTo() and wait until the drive got there. The drive stays
+        // stopped afterwards until the next runTo(), so its state may be touched directly.
+        void waitFor(uint64_t cycle);
+
+        inline uint64_t completed() const { return done.load(std::memory_order_acquire); }
+
+        // Emulator thread: the C64 pulls the lines in lowMask low from cycle on,
+        // false when the queue is full and the drive has to be synced first
+        bool postC64Lines(uint64_t cycle, uint8_t lowMask);
+
+        // Emulator thread while stopped: output changes since the last call
+        inline std::vector<OutputEvent>& getOutputs() { return outputs; }
+
+        // Emulator thread while stopped: replace the line levels the drive sees, the drive is
+        // told about lines that changed when notify is set
+        void setView(uint8_t c64Low, uint8_t othersLow, uint8_t ownLow, bool srqHigh, bool notify);
+
+        // Drive side: the drive changed one of its outputs
+        void driveLine(uint8_t line, bool low);
+        void driveSrq(bool asserted);
+
+        // Drive side: resolved levels as seen by the drive
+        inline bool isLineLow(uint8_t line) const { return ((c64Low | othersLow | ownLow) & line) != 0; }
+        inline bool isSrqHigh() const { return srqHigh; }
+
+    protected:
+
+    private:
+
+        struct LineEvent
+        {
+            uint64_t cycle;
+            uint8_t lowMask;
+        };
+
+        static constexpr uint32_t QUEUE_SIZE  = 1024;   // Power of two
+        static constexpr int SPIN_WAITS       = 4000;
+        static constexpr int YIELD_WAITS      = 20000;
+
+        static thread_local DriveThread* currentThread;
+
+        Drive& drive;
+        std::function<void()> clockCycle;
+
+        // Cycle the drive is working on, used to stamp its output changes
+        uint64_t cycle;
+
+        // Line view, pull-low masks
+        uint8_t c64Low;
+        uint8_t othersLow;
+        uint8_t ownLow;
+        bool srqHigh;
+
+        std::vector<OutputEvent> outputs;
+
+        // C64 line changes, single producer (emulator) and single consumer (drive)
+        std::array<LineEvent, QUEUE_SIZE> queue;
+        std::atomic<uint32_t> queueHead;
+        std::atomic<uint32_t> queueTail;
+
+        // Handshake
+        std::atomic<uint64_t> target;
+        std::atomic<uint64_t> done;
+        std::atomic<bool> stopping;
+        std::atomic<bool> sleeping;
+        std::mutex wakeMutex;
+        std::condition_variable wake;
+
+        std::thread worker;
+
+        void run();
+        bool awaitTarget(uint64_t from, uint64_t& goal);
+        void applyQueuedLines(uint64_t upTo);
+        void applyView(uint8_t newC64Low, uint8_t newOthersLow, uint8_t newOwnLow);
+};
+
+#endif // DRIVETHREAD_H
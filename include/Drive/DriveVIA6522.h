@@ -35,6 +35,12 @@ class DriveVIA6522 : public DriveVIABase
 
         bool checkIRQActive() const override;
 
+        // Idle detection: accesses an idle loop may repeat without changing the chip,
+        // and the cycles tick() can run before a timer raises an enabled interrupt
+        virtual bool isQuietRead(uint16_t address) const;
+        bool isQuietWrite(uint16_t address, uint8_t value) const;
+        uint32_t getQuietCycles() const;
+
         inline VIARole getRole() const { return viaRole; }
 
         // ML Monitor
@@ -162,6 +168,10 @@ class DriveVIA6522 : public DriveVIABase
 
         void timer1Tick();
         void timer2Tick();
+
+        // Catch up N cycles, single stepping only the reload and underflow ticks
+        void advanceTimer1(uint32_t cycles);
+        void advanceTimer2(uint32_t cycles);
         void syncTimer1Registers();
         void syncTimer2Registers();
 };
@@ -9,6 +9,7 @@
 #define FDC177X_H
 
 #include <cstdint>
+#include <limits>
 #include "Peripheral.h"
 #include "Drive/DriveChips.h"
 #include "Drive/FloppyControllerHost.h"
@@ -30,6 +31,15 @@ class FDC177x : public DriveFDCBase
         void reset();
         void tick(uint32_t cycles);
 
+        // Idle detection: cycles tick() can run before a pending command step fires
+        inline uint32_t getQuietCycles() const
+        {
+            if (cyclesUntilEvent <= 0)
+                return std::numeric_limits<uint32_t>::max();
+
+            return static_cast<uint32_t>(cyclesUntilEvent - 1);
+        }
+
         uint8_t readRegister(uint16_t address);
         void writeRegister(uint16_t address, uint8_t value);
 
@@ -157,6 +167,9 @@ class FDC177x : public DriveFDCBase
         void startCommand(uint8_t cmd);
         void finishCommand(bool interrupt);
 
+        // Runs the command step that was due when cyclesUntilEvent reached zero
+        void handleEvent();
+
         void setDRQ(bool on);
         void setBusy(bool on);
         void setINTRQ(bool on);
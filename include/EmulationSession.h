@@ -53,6 +53,7 @@ private:
     bool initializeMachine();
     void processEvents();
     bool runFrame();
+    bool runFrameCycles(bool& framePresented);
     bool finalizeFrame();
     void shutdown();
 
@@ -93,7 +94,11 @@ private:
     bool audioStarted_;
     bool audioCatchupMode_;
 
+    // Unthrottled, silent running while the cassette motor is on
+    bool tapeWarp_;
+
     void syncTimingFromRuntimeMode();
+    void updateTapeWarp();
 };
 
 #endif // EMULATION_SESSION_H
@@ -96,6 +96,7 @@ class EmulatorUI
             bool diskAttached                   = false;       std::string diskPath;
             bool cartAttached                   = false;       std::string cartPath;
             bool tapeAttached                   = false;       std::string tapePath;
+            bool tapeWarp                       = false;
             bool prgAttached                    = false;       std::string prgPath;
 
             bool reuEnabled                     = false;       uint32_t reuSizeKB = 0;
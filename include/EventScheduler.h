@@ -0,0 +1,85 @@
+// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#ifndef EVENT_SCHEDULER_H
+#define EVENT_SCHEDULER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// A device that runs lazily: it only catches up to the current cycle
+// when its scheduled event comes due or when something reads or writes it.
+class IScheduledDevice
+{
+    public:
+        virtual ~IScheduledDevice() = default;
+
+        // Bring internal state up to the scheduler clock and schedule the next event
+        virtual void catchUp() = 0;
+};
+
+// Cycle-stamped event list for the host machine.
+//
+// Every client owns one slot holding the absolute cycle of its next
+// interesting event (timer underflow, TOD tick, ...). advance() is called
+// once per host cycle and only dispatches when the earliest slot comes due,
+// so an idle device costs a compare per cycle instead of a full update.
+class EventScheduler
+{
+    public:
+        enum class Slot : uint8_t
+        {
+            CIA1,
+            CIA2,
+            Count
+        };
+
+        static constexpr uint64_t NEVER = std::numeric_limits<uint64_t>::max();
+
+        EventScheduler();
+        ~EventScheduler();
+
+        void attach(Slot slot, IScheduledDevice* client);
+        void detach(Slot slot);
+
+        // Current host cycle, counted in completed advance() calls
+        inline uint64_t now() const { return now_; }
+
+        // Called once per host cycle after the CPU
+        inline void advance()
+        {
+            if (++now_ >= nextDue_)
+                dispatch();
+        }
+
+        // Request a catch up at an absolute cycle, replacing any earlier request
+        void schedule(Slot slot, uint64_t cycle);
+
+        // Bring every client up to date, e.g. before the UI or monitor looks at them
+        void syncAll();
+
+        // ML Monitor
+        inline uint64_t getDue(Slot slot) const { return due_[static_cast<size_t>(slot)]; }
+
+    protected:
+
+    private:
+        static constexpr size_t SLOT_COUNT = static_cast<size_t>(Slot::Count);
+
+        uint64_t now_;
+        uint64_t nextDue_;
+
+        std::array<uint64_t, SLOT_COUNT> due_;
+        std::array<IScheduledDevice*, SLOT_COUNT> clients_;
+
+        void dispatch();
+        void recomputeNextDue();
+};
+
+#endif // EVENT_SCHEDULER_H
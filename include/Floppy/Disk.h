@@ -47,7 +47,7 @@ class Disk
 
         // Reading/writing
         std::vector<uint8_t> readSector(uint8_t track, uint8_t sector);
-        bool writeSector(uint8_t track, uint16_t sector, const std::vector<uint8_t>& data);
+        virtual bool writeSector(uint8_t track, uint16_t sector, const std::vector<uint8_t>& data);
 
         // BAM Management and maintenance
         virtual bool formatDisk(const std::string& volumeName, const std::string& volumeID) = 0;
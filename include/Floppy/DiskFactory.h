@@ -37,6 +37,8 @@ class DiskFactory
                   return std::make_unique<D71>();
               case DiskFormat::D81:
                   return std::make_unique<D81>();
+              case DiskFormat::G64:
+                  return std::make_unique<G64>();
               default:
                   return nullptr;
             }
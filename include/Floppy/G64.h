@@ -8,16 +8,85 @@
 #ifndef G64_H
 #define G64_H
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "D64.h"
+#include "Drive/GCRCodec.h"
 
-class G64
+// Raw GCR image ("GCR-1541"). The file is read once and every half-track is
+// handed to the drive as stored, so protected and custom formats survive.
+// A decoded D64 sector view is kept for sector level users (directory, 1571).
+class G64 : public D64
 {
     public:
         G64();
         virtual ~G64();
 
+        // Loading/saving
+        bool loadDisk(const std::string& filePath) override;
+        bool saveDisk(const std::string& filePath) override;
+
+        // Sector writes are also patched into the GCR data of the track
+        bool writeSector(uint8_t track, uint16_t sector, const std::vector<uint8_t>& data) override;
+
+        // Raw track access, halfTrack 0 = track 1, 1 = track 1.5, ...
+        inline size_t getHalfTrackCount() const { return halfTracks.size(); }
+        const uint8_t* getTrackData(size_t halfTrack, size_t& length) const;
+        uint8_t getSpeedZone(size_t halfTrack) const;
+
+        // Store a written half-track. Tracks missing from the image and tracks whose length or
+        // speed zone changed are appended to the image when it is saved.
+        bool writeTrack(size_t halfTrack, const uint8_t* data, size_t length, uint8_t speedZone);
+
+        static constexpr size_t MAX_HALF_TRACKS = 84;
+
     protected:
 
     private:
+
+        static constexpr size_t HEADER_SIZE     = 0x0C;
+
+        struct HalfTrack
+        {
+            size_t offset = 0;              // File offset of the track length word, 0 = no track
+            uint16_t length = 0;
+            uint8_t speedZone = 0;
+            uint32_t speedEntry = 0;        // Speed table value as stored, above 3 a zone map offset
+            std::vector<uint8_t> modified;  // Copy of the track once it has been written
+            bool dirty = false;
+            bool relocated = false;         // Needs a new slot at the end of the image
+        };
+
+        // The image as loaded, changed tracks live in their HalfTrack until saved. A private
+        // copy, so the file may change on disk while the image is mounted.
+        std::string imagePath;
+        std::vector<uint8_t> image;
+
+        std::vector<HalfTrack> halfTracks;
+        uint16_t maxTrackSize;
+
+        // Set when the track tables change, the image is then rewritten as a whole
+        bool layoutChanged;
+
+        GCRCodec gcrCodec;
+
+        bool readFile(const std::string& filePath);
+        std::vector<uint8_t> buildImage() const;
+
+        bool parseHeader();
+        void buildSectorView();
+
+        // Position of the GCR data block (after its sync) for every sector found on a track
+        struct SectorPos
+        {
+            uint8_t track;
+            uint8_t sector;
+            size_t dataPos;
+        };
+        void scanSectors(const uint8_t* data, size_t length, std::vector<SectorPos>& out) const;
+        bool decodeAt(const uint8_t* data, size_t length, size_t pos, size_t gcrSize, std::vector<uint8_t>& out) const;
 };
 
 #endif // G64_H
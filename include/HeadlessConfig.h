@@ -0,0 +1,99 @@
+// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#ifndef HEADLESS_CONFIG_H
+#define HEADLESS_CONFIG_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Common/REUModel.h"
+
+class ComponentProfiler;
+
+struct HeadlessConfig
+{
+    // Frames run before measurement starts, they do not count towards the
+    // limits below or the reported results
+    uint64_t warmupFrames = 0;
+
+    // Stop limits, 0 = no limit
+    uint64_t maxFrames = 0;
+    uint64_t maxCycles = 0;
+
+    // Stop when the CPU reaches this PC at an instruction boundary
+    bool stopOnPC = false;
+    uint16_t stopPC = 0x0000;
+
+    // Stop when a memory location holds this value at an instruction boundary
+    bool stopOnMemory = false;
+    uint16_t stopMemoryAddress = 0x0000;
+    uint8_t stopMemoryValue = 0x00;
+
+    // Optional 16-bit stereo WAV capture, empty = discard audio
+    std::string audioCapturePath;
+
+    // Optional disk image attached to device 8 before the run starts
+    std::string diskPath;
+    bool createBlankDisk = false;   // create diskPath as an empty image first
+
+    // Optional REU attached before the run starts
+    REUModel reuModel = REUModel::None;
+
+    // Machine code copied into RAM once warmup ends, the CPU jumps to
+    // programAddress at the next instruction boundary
+    std::vector<uint8_t> program;
+    uint16_t programAddress = 0xC000;
+
+    // Text placed in the KERNAL keyboard buffer once warmup ends (max 10 chars)
+    std::string typedText;
+
+    // Optional per-component timing of the measured frames
+    ComponentProfiler* profiler = nullptr;
+
+    inline bool hasStopCondition() const { return maxFrames || maxCycles || stopOnPC || stopOnMemory; }
+    inline bool hasMatchCondition() const { return stopOnPC || stopOnMemory; }
+};
+
+enum class HeadlessStopReason
+{
+    None,
+    FrameLimit,
+    CycleLimit,
+    PCMatch,
+    MemoryMatch,
+    Error
+};
+
+inline const char* headlessStopReasonToString(HeadlessStopReason reason)
+{
+    switch (reason)
+    {
+        case HeadlessStopReason::None:          return "none";
+        case HeadlessStopReason::FrameLimit:    return "frames";
+        case HeadlessStopReason::CycleLimit:    return "cycles";
+        case HeadlessStopReason::PCMatch:       return "pc";
+        case HeadlessStopReason::MemoryMatch:   return "memory";
+        case HeadlessStopReason::Error:         return "error";
+        default: return "none";
+    }
+}
+
+struct HeadlessResult
+{
+    HeadlessStopReason reason = HeadlessStopReason::None;
+
+    uint64_t frames = 0;
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t audioSamples = 0;
+
+    double hostSeconds = 0.0;
+    double emulatedSeconds = 0.0;
+};
+
+#endif // HEADLESS_CONFIG_H
@@ -0,0 +1,95 @@
+// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#ifndef HEADLESS_SESSION_H
+#define HEADLESS_SESSION_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include "HeadlessConfig.h"
+
+class AudioOutput;
+class CIA1;
+class CIA2;
+class Computer;
+class CPU;
+class DataBusLatch;
+class IECBUS;
+class MediaManager;
+class Memory;
+class PLA;
+class SID;
+class Vic;
+
+struct MachineComponents;
+struct MachineRuntimeState;
+struct MachineRomConfig;
+
+// Runs the machine without SDL video, audio or input. There is no frame
+// pacing, the session runs as fast as the host allows until one of the
+// configured stop conditions is met.
+class HeadlessSession
+{
+public:
+    HeadlessSession(Computer& host, MachineComponents& components,
+                    MachineRuntimeState& runtime,
+                    MachineRomConfig& roms,
+                    const HeadlessConfig& config);
+    ~HeadlessSession();
+
+    bool run();
+
+    inline const HeadlessResult& getResult() const { return result_; }
+
+private:
+    bool initializeMachine();
+    void startMeasurement();
+    bool runFrame();
+    bool checkInstructionConditions();
+    void drainAudio();
+    void shutdown();
+
+    // Audio capture
+    bool openAudioCapture();
+    void closeAudioCapture();
+    void writeWavHeader(uint32_t dataBytes);
+
+private:
+    Computer& host_;
+    MachineComponents& components_;
+    MachineRuntimeState& runtime_;
+    MachineRomConfig& roms_;
+    const HeadlessConfig& config_;
+
+    // Cached hot references
+    AudioOutput& audioOutput_;
+    CIA1& cia1_;
+    CIA2& cia2_;
+    CPU& cpu_;
+    DataBusLatch& dataBus_;
+    IECBUS& bus_;
+    MediaManager& media_;
+    Memory& mem_;
+    PLA& pla_;
+    SID& sid_;
+    Vic& vic_;
+
+    HeadlessResult result_;
+
+    // Warmup frames are run before measuring starts
+    bool measuring_;
+    bool pendingJump_;
+    std::chrono::steady_clock::time_point hostStart_;
+    uint64_t instructionStart_;
+
+    std::ofstream audioFile_;
+    uint32_t audioDataBytes_;
+};
+
+#endif // HEADLESS_SESSION_H
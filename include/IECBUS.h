@@ -10,10 +10,14 @@
 
 // Forward declarations
 class CIA2;
+class ComponentProfiler;
+class Drive;
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 #include <map>
+#include "Drive/DriveThread.h"
 #include "IECTypes.h"
 #include "Peripheral.h"
 #include "StateReader.h"
@@ -59,6 +63,7 @@ class IECBUS
 
         // Pointers
         inline void attachCIA2Instance(CIA2* cia2) { this->cia2 = cia2; }
+        inline void attachProfilerInstance(ComponentProfiler* profiler) { this->profiler = profiler; }
 
         // State management
         void saveState(StateWriter& wrtr) const;
@@ -68,9 +73,9 @@ class IECBUS
         void reset();
 
         // Bus state getters
-        inline bool getAtnLine() const { return busLines.atn; }
-        inline bool getClkLine() const { return busLines.clk; }
-        inline bool getDataLine() const { return busLines.data; }
+        inline bool getAtnLine() const { return readAtnLine(); }
+        inline bool getClkLine() const { return readClkLine(); }
+        inline bool getDataLine() const { return readDataLine(); }
 
         // Line state management
         void setClkLine(bool state); // CLK line state (via CIA1 Port B bit 7)
@@ -80,11 +85,11 @@ class IECBUS
 
         void setC64IECOutputs(bool atnReleased, bool clkReleased, bool dataReleased);
 
-        // Return value: true=high/released, false=low/asserted
-        inline bool readDataLine() const { return busLines.data; } // Reads final DATA state (for CIA1 Port B bit 6 read)
-        inline bool readClkLine() const { return busLines.clk; }   // Reads final CLK state (for CIA1 Port B bit 7 read)
-        inline bool readAtnLine() const { return busLines.atn; }   // Reads final ATN state
-        inline bool readSrqLine() const { return line_srqin; }  // Reads final SRQ state (for CIA2 Port A bit 2 read)
+        // Return value: true=high/released, false=low/asserted. A threaded drive reads its own view of the bus.
+        inline bool readDataLine() const { const DriveThread* t = driveThread(); return t ? !t->isLineLow(DriveThread::LINE_DATA) : busLines.data; } // Reads final DATA state (for CIA1 Port B bit 6 read)
+        inline bool readClkLine() const { const DriveThread* t = driveThread(); return t ? !t->isLineLow(DriveThread::LINE_CLK) : busLines.clk; }     // Reads final CLK state (for CIA1 Port B bit 7 read)
+        inline bool readAtnLine() const { const DriveThread* t = driveThread(); return t ? !t->isLineLow(DriveThread::LINE_ATN) : busLines.atn; }     // Reads final ATN state
+        inline bool readSrqLine() const { const DriveThread* t = driveThread(); return t ? t->isSrqHigh() : line_srqin; }  // Reads final SRQ state (for CIA2 Port A bit 2 read)
 
         // Peripheral Interaction (Called by Peripheral instances)
         void peripheralControlClk(Peripheral* device, bool state);
@@ -108,6 +113,14 @@ class IECBUS
 
         void setHostCpuHz(double hz);
 
+        // Run every registered drive on its own host thread, see DriveThread
+        void setThreadedDrives(bool enabled);
+        inline bool getThreadedDrives() const { return threadedDrives; }
+
+        // Let threaded drives catch up to the current cycle and exchange their line changes.
+        // Needed before the C64 samples the bus and before drives are accessed from outside.
+        inline void syncDrives() { if (!driveThreads.empty() && pausedDepth == 0) syncDriveThreads(); }
+
         // ML Monitor Functions
         inline IECBusLines getBusLines() const { return busLines; }
         inline bool getSRQLine() const { return line_srqin; }
@@ -134,11 +147,58 @@ class IECBUS
 
         // Non-owning pointers
         CIA2* cia2;
+        ComponentProfiler* profiler;
         Peripheral* currentTalker;
 
         // Clock
         double hostCpuHz;
-        std::map<Peripheral*, double> driveCycleAccumulators;
+
+        // Registered drives in device number order. Each slot advances its
+        // drive by a 32.32 fixed-point number of drive cycles per host cycle.
+        struct DriveSlot
+        {
+            Drive* drive;
+            uint64_t step;
+            uint64_t acc;
+        };
+
+        static constexpr uint64_t DRIVE_CLOCK_ONE = 1ULL << 32;
+
+        std::vector<DriveSlot> driveSlots;
+
+        // Threaded drives: one worker per drive slot. The C64 side counts host cycles,
+        // hands the count over every DRIVE_PUBLISH_CYCLES and waits for the drives once
+        // they fall DRIVE_MAX_SKEW cycles behind.
+        static constexpr uint64_t DRIVE_PUBLISH_CYCLES = 64;
+        static constexpr uint64_t DRIVE_MAX_SKEW       = 2048;
+
+        bool threadedDrives;
+        std::vector<std::unique_ptr<DriveThread>> driveThreads;
+        uint64_t hostCycle;
+        uint64_t publishedCycle;
+        int pausedDepth;
+
+        struct PendingOutput
+        {
+            uint64_t cycle;
+            Peripheral* device;
+            uint8_t line;
+            bool low;
+        };
+
+        std::vector<PendingOutput> pendingOutputs;
+
+        // Keeps threaded drives stopped while the emulator thread works on them and the bus directly
+        class DrivePause
+        {
+            public:
+                explicit DrivePause(IECBUS& bus);
+                ~DrivePause();
+
+            private:
+                IECBUS& bus;
+                bool active;
+        };
 
         // Internal state
         IECBusLines busLines;
@@ -167,9 +227,23 @@ class IECBUS
         std::vector<Peripheral*> currentListeners;
 
         // Helper Methods
+        bool isRegistered(const Peripheral* device) const;
+        uint64_t driveClockStep(const Drive* drive) const;
         void updateBusState();
         void updateSrqLine();  // Polls peripherals for SRQ status
         void recalcAndNotify();
+        void applySrq(Peripheral* device, bool state);
+
+        // Threaded drives
+        inline const DriveThread* driveThread() const { return driveThreads.empty() ? nullptr : DriveThread::current(); }
+        inline DriveThread* workerThread() { return driveThreads.empty() ? nullptr : DriveThread::current(); }
+        uint8_t c64LowMask() const;
+        void postC64Lines();
+        void startDriveThreads();
+        void stopDriveThreads();
+        void syncDriveThreads();
+        bool collectDriveOutputs();
+        void refreshDriveViews(bool notify);
 
         // Debug
         void debugDumpDevices(const char* tag);
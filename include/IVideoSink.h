@@ -23,6 +23,9 @@ class IVideoSink
 
         virtual void setPixel(int x, int y, uint8_t color, int hardwareX) = 0;
 
+        // colors[x] for x in [x0, x1), palette indices of one finished raster line
+        virtual void setPixelRow(int y, const uint8_t* colors, int x0, int x1) = 0;
+
         virtual void setScreenDimensions(int visibleW, int visibleH, int border) = 0;
 
     protected:
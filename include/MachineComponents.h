@@ -18,6 +18,7 @@
 #include "CPU.h"
 #include "DataBusLatch.h"
 #include "EmulatorUI.h"
+#include "EventScheduler.h"
 #include "ExpansionManager.h"
 #include "Common/ExecutionHistory.h"
 #include "IECBUS.h"
@@ -28,6 +29,7 @@
 #include "MediaManager.h"
 #include "Memory.h"
 #include "NMILine.h"
+#include "NullVideoSink.h"
 #include "PLA.h"
 #include "REU.h"
 #include "SDLContext.h"
@@ -60,6 +62,7 @@ struct MachineComponents
     std::unique_ptr<DebugManager> debug;
     std::array<std::unique_ptr<Drive>, 16> drives;
     std::unique_ptr<EmulatorUI> ui;
+    std::unique_ptr<EventScheduler> scheduler;
     std::unique_ptr<ExecutionHistory> executionHistory;
     std::unique_ptr<ExpansionManager> expansionManager;
     std::unique_ptr<IECBUS> bus;
@@ -70,6 +73,7 @@ struct MachineComponents
     std::unique_ptr<MediaManager> media;
     std::unique_ptr<Memory> mem;
     std::unique_ptr<NMILine> nmiLine;
+    std::unique_ptr<NullVideoSink> nullVideoSink;
     std::unique_ptr<PLA> pla;
     std::unique_ptr<ResetController> resetCtl;
     std::unique_ptr<REU> reu;
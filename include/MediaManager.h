@@ -54,6 +54,7 @@ public:
         // Tape
         bool        tapeAttached = false;
         std::string tapePath;
+        bool        tapeWarp     = false;
 
         // PRG
         bool        prgAttached = false;
@@ -136,6 +137,10 @@ public:
     void tapeRewind();
     void tapeEject();
 
+    // Tape warp: run unthrottled and silent while PLAY is held and the motor runs
+    void setTapeWarp(bool enabled) { state_.tapeWarp = enabled; }
+    bool isTapeWarpActive() const;
+
     // Command line autostart
     void applyBootAttachments();
 
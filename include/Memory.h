@@ -15,6 +15,7 @@ class CIA1;
 class CIA2;
 class CPU;
 class DataBusLatch;
+class DebugHooks;
 class DebugManager;
 class MLMonitor;
 class PLA;
@@ -25,6 +26,8 @@ class TraceManager;
 class Turbo232;
 class Vic;
 
+#include <algorithm>
+#include <array>
 #include <bitset>
 #include <cstdint>
 #include <cstdio>
@@ -36,6 +39,7 @@ class Vic;
 #include <vector>
 #include "Common/CartridgeTypes.h"
 #include "CPUBus.h"
+#include "RomCache.h"
 #include "StateReader.h"
 #include "StateWriter.h"
 
@@ -53,6 +57,7 @@ class Memory : public CPUBus
         inline void attachCIA2Instance(CIA2* cia2) { this->cia2 = cia2; }
         inline void attachCPUInstance(CPU* cpu) { this->cpu = cpu; }
         inline void attachDataBusLatchInstance(DataBusLatch* dataBus) { this->dataBus = dataBus; }
+        inline void attachDebugHooksInstance(DebugHooks* hooks) { this->hooks = hooks; invalidatePageMap(); }
         inline void attachDebugManagerInstance(DebugManager* debugManager) { this->debugManager = debugManager; }
         inline void attachMonitorInstance(MLMonitor* monitor) { this->monitor = monitor; }
         inline void attachPLAInstance(PLA* pla) { this->pla = pla; }
@@ -82,26 +87,47 @@ class Memory : public CPUBus
         void writeDirect(uint16_t address, uint8_t value);
         void writeForDMA(uint16_t address, uint8_t value);
 
+        // Bulk DMA: host pointer to plain memory at address and how many of length bytes
+        // follow it contiguously. Stops at I/O, cartridge space, page zero and watched pages.
+        size_t getDMAReadSpan(uint16_t address, size_t length, const uint8_t*& data);
+        size_t getDMAWriteSpan(uint16_t address, size_t length, uint8_t*& data);
+
+        // True when the VIC fetches from any part of the range in its current bank
+        bool isVisibleToVIC(uint16_t address, size_t length) const;
+
         // Cartridge API
         uint8_t readCartridge(uint16_t address, cartLocation location) const;
         void writeCartridge(uint16_t address, uint8_t value, cartLocation location);
 
+        // Zero-copy bank switching: point a cartridge window at 8K of chip data (nullptr = empty $FF bank)
+        void mapCartridgeBank(cartLocation location, const uint8_t* data);
+
+        // Copy mapped chip data into the cartridge buffers before the chip data is released
+        void detachCartridgeBanks();
+
         // Setters for cartridge
-        inline void setCartridgeAttached(bool flag) { cartridgeAttached = flag; }
+        inline void setCartridgeAttached(bool flag) { cartridgeAttached = flag; invalidatePageMap(); }
         inline void setROMLOverlayIsRAM(bool flag) { romLOverlayIsRAM = flag; }
         inline void setROMHOverlayIsRAM(bool flag) { romHOverLayIsRAM = flag; }
 
         // Getter/Setter for cassette
         inline bool getCassetteSenseLow() { return cassetteSenseLow; }
-        inline void setCassetteSenseLow(bool pressed) { cassetteSenseLow = pressed; }
+        void setCassetteSenseLow(bool pressed);
         inline bool isCassetteMotorOn() const  { return (port1OutputLatch & 0x20) == 0; }
 
+        // CIA1 only samples the tape at pulse edges, bring it up to date before
+        // anything it samples (motor, PLAY, tape position) changes
+        void syncCassetteLine();
+
         // Load all ROMS
         bool Initialize(const std::string& basic, const std::string& kernal, const std::string& character);
 
         // Helpers for certain cartridge types
-        inline uint8_t getCartLOByte(uint16_t offset) const { return (offset < cart_lo.size()) ? cart_lo[offset] : 0xFF; }
-        inline uint8_t getCartHIByte(uint16_t offset) const { return (offset < cart_hi.size()) ? cart_hi[offset] : 0xFF; }
+        inline uint8_t getCartLOByte(uint16_t offset) const { return (offset < cart_lo.size()) ? cartLoView[offset] : 0xFF; }
+        inline uint8_t getCartHIByte(uint16_t offset) const { return (offset < cart_hi.size()) ? cartHiView[offset] : 0xFF; }
+
+        // Force a page map rebuild on the next access (cartridge lines or mapper changed)
+        inline void invalidatePageMap() { pageMapGeneration = 0; }
 
     private:
         // Non-owning pointers
@@ -111,6 +137,7 @@ class Memory : public CPUBus
         Cassette* cass;
         CPU* cpu;
         DataBusLatch* dataBus;
+        DebugHooks* hooks;
         DebugManager* debugManager;
         MLMonitor* monitor;
         PLA* pla;
@@ -123,13 +150,22 @@ class Memory : public CPUBus
 
         // RAM/ROM
         std::vector<uint8_t> mem;
-        std::vector<uint8_t> basicROM;
-        std::vector<uint8_t> charROM;
-        std::vector<uint8_t> kernalROM;
+        RomSpan basicROM;
+        RomSpan charROM;
+        RomSpan kernalROM;
         std::vector<uint8_t> colorRAM;
         std::vector<uint8_t> cart_lo;
         std::vector<uint8_t> cart_hi;
         std::vector<uint8_t> cart_hi_e000;
+        std::vector<uint8_t> cart_empty;
+
+        // Cartridge windows, either the buffers above or 8K of mapped chip data
+        const uint8_t* cartLoView;
+        const uint8_t* cartHiView;
+        const uint8_t* cartHiE000View;
+
+        // Copy a mapped window into its buffer so single bytes can be written
+        void ownCartridgeBank(std::vector<uint8_t>& buffer, const uint8_t*& view);
 
         // Rom constants
         static constexpr size_t BASIC_ROM_SIZE      = 0x2000;
@@ -163,10 +199,27 @@ class Memory : public CPUBus
         uint8_t dataDirectionRegister;
         uint8_t port1OutputLatch;
 
+        // Page map: one entry per 256 byte page with direct pointers for plain RAM and
+        // system ROM. A null pointer sends the access down the full PLA decode path.
+        struct PageEntry
+        {
+            const uint8_t* read;
+            uint8_t* write;
+        };
+
+        std::array<PageEntry, 256> pageMap;
+        uint64_t pageMapGeneration; // PLA mapping generation the map was built from, 0 = stale
+
+        const PageEntry* lookupPage(uint16_t address);
+        void rebuildPageMap();
+
+        // True when tracing or a watchpoint needs to see accesses to this page
+        bool pageHooked(uint16_t address) const;
+
         uint8_t readIO(uint16_t address);
         void writeIO(uint16_t address, uint8_t value);
 
-        bool load_ROM(const std::string& filename, std::vector<uint8_t>& targetBuffer, size_t expectedSize, const std::string& romName);
+        bool load_ROM(const std::string& filename, RomSpan& target, size_t expectedSize, const std::string& romName);
 
         uint8_t computeEffectivePort1(uint8_t latch, uint8_t ddr);
         void applyPort1SideEffects(uint8_t effective);
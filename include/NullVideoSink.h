@@ -0,0 +1,39 @@
+// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#ifndef NULLVIDEOSINK_H
+#define NULLVIDEOSINK_H
+
+#include <cstdint>
+#include "IVideoSink.h"
+
+// Video sink used by headless runs. The VIC still composes every pixel,
+// the output simply goes nowhere.
+class NullVideoSink final : public IVideoSink
+{
+    public:
+        NullVideoSink() = default;
+        ~NullVideoSink() override = default;
+
+        inline void renderBackgroundLine(int, uint8_t, int, int) override {}
+
+        inline void renderBorderLine(int, uint8_t, int, int) override {}
+
+        inline void setPixel(int, int, uint8_t) override {}
+
+        inline void setPixel(int, int, uint8_t, int) override {}
+
+        inline void setPixelRow(int, const uint8_t*, int, int) override {}
+
+        inline void setScreenDimensions(int, int, int) override {}
+
+    protected:
+
+    private:
+};
+
+#endif // NULLVIDEOSINK_H
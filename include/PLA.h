@@ -58,13 +58,18 @@ class PLA
         // Allow memory class to query PLA for current status
         memoryAccessInfo getMemoryAccess(uint16_t address);
 
+        // Page map support, bumped whenever the decode for any address may have changed
+        inline uint64_t getMappingGeneration() const { return mappingGeneration; }
+        inline memoryBank getPageBank(uint8_t page) const { return resolveBank(static_cast<uint16_t>(page << 8)); }
+        void syncCartridgeLines();
+
         // Memory control register getters
         bool getLORAM() const { return loram; }
         bool getHIRAM() const { return hiram; }
         bool getCHAREN() const { return charen; }
 
         // Cartridge setter
-        void setCartridgeAttached(bool flag) { cartridgeAttached = flag; }
+        void setCartridgeAttached(bool flag) { cartridgeAttached = flag; ++mappingGeneration; }
 
         // Getters
         bool getExROMLine() const { return exROMLine; }
@@ -112,6 +117,9 @@ class PLA
         // Memory control register $0001
         uint8_t memoryControlRegister;
 
+        // Invalidates Memory's page map
+        uint64_t mappingGeneration;
+
         // Tracing
         uint8_t lastModeIndex;
         bool lastloram;
@@ -41,6 +41,11 @@ class REU
         uint8_t readIO(uint16_t addr);
         void writeIO(uint16_t addr, uint8_t value);
 
+        // DMA engine: while a transfer runs the CPU is held off the bus and
+        // tickDMA() is called for every cycle the VIC leaves free
+        inline bool isDMAActive() const { return dma.active; }
+        void tickDMA();
+
         inline bool isEnabled() const    { return model != REUModel::None && !ram.empty(); }
         inline REUModel getModel() const { return model; }
         void setModel(REUModel reuModel);
@@ -115,6 +120,19 @@ class REU
 
         REURegisters regs;
 
+        // Transfer in progress, one byte per stolen cycle (two for a swap)
+        struct DMAState
+        {
+            bool active         = false;
+            bool preloaded      = false;    // Block already moved as one span, only the stolen cycles remain
+            bool verifyError    = false;
+            bool swapWritePhase = false;    // Second cycle of a swapped byte
+            uint8_t type        = 0x00;
+            uint32_t remaining  = 0;        // Bytes left, or cycles left when preloaded
+        };
+
+        DMAState dma;
+
         REUModel model;
 
         // Helpers
@@ -127,11 +145,15 @@ class REU
 
         bool shouldIncrementC64Address() const;
         bool shouldIncrementREUAddress() const;
-        void incrementREUAddress();
+        void incrementREUAddress(uint32_t count = 1);
 
         void updateIRQStatus();
 
         void startTransfer();
+        bool transferByte();
+        bool transferBlock();
+        void finishTransfer();
+        void completeTransfer();
 
         static const char* transferTypeName(uint8_t command);
 };
@@ -0,0 +1,95 @@
+﻿// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#ifndef ROM_CACHE_H
+#define ROM_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// A ROM file read into memory. Every machine and drive that loads the same
+// contents shares one image, it is freed when the last user lets go.
+class RomImage
+{
+    public:
+        RomImage(const RomImage&) = delete;
+        RomImage& operator=(const RomImage&) = delete;
+
+        inline const uint8_t* data() const { return bytes.data(); }
+        inline size_t size() const { return bytes.size(); }
+        inline uint64_t getHash() const { return hash; }
+
+    private:
+        friend class RomCache;
+
+        RomImage();
+
+        // A copy, so the file may change on disk while a machine runs from it
+        std::vector<uint8_t> bytes;
+        uint64_t hash;
+
+        bool readFile(const std::string& filePath);
+};
+
+// Read-only view of a cached ROM that keeps the image alive. A span that has
+// no image attached reads as blankSize zero bytes.
+class RomSpan
+{
+    public:
+        static constexpr size_t MAX_BLANK_SIZE = 0x8000;
+
+        explicit RomSpan(size_t blankSize = 0);
+        explicit RomSpan(std::shared_ptr<const RomImage> image);
+
+        inline const uint8_t* data() const { return ptr; }
+        inline size_t size() const { return length; }
+        inline uint8_t operator[](size_t offset) const { return ptr[offset]; }
+
+        inline bool isLoaded() const { return image != nullptr; }
+
+    private:
+        std::shared_ptr<const RomImage> image;
+        const uint8_t* ptr;
+        size_t length;
+};
+
+// Process-wide ROM cache, keyed by path and by content hash
+class RomCache
+{
+    public:
+        static RomCache& instance();
+
+        // Returns the cached image for the file, reading it on first use or when
+        // the file changed on disk. An unloaded span means the file could not be read.
+        RomSpan acquire(const std::string& filePath);
+
+        // Images currently held by at least one user
+        size_t getImageCount() const;
+
+    private:
+        RomCache() = default;
+
+        struct PathEntry
+        {
+            std::weak_ptr<const RomImage> image;
+            uintmax_t fileSize = 0;
+            int64_t modified = 0;
+        };
+
+        mutable std::mutex cacheMut;
+        std::unordered_map<std::string, PathEntry> byPath;
+        std::unordered_multimap<uint64_t, std::weak_ptr<const RomImage>> byHash;
+
+        std::shared_ptr<const RomImage> findByContent(const RomImage& image);
+};
+
+#endif // ROM_CACHE_H
@@ -31,10 +31,10 @@ class Envelope
         void trigger(); // Trigger the envelope (key pressed), attack phase
         void release(); // Release the envelope (key pressed), release phase
 
-        double processSample();
         bool isIdle() const;
 
-        void clock(double sidCycles);
+        // Run the rate counter for a number of cycles, jumping straight from one envelope step to the next
+        void clock(uint32_t sidCycles);
         double output() const;
 
         // Getters
@@ -87,12 +87,15 @@ class Envelope
         uint8_t sustainRate;
         uint8_t releaseRate;
 
+        // Rate counter and step periods in SID cycles, 16.16 fixed point so PAL scaled periods stay exact
+        static constexpr int RATE_FRACTION_BITS = 16;
+
         uint8_t envCounter;
-        double stepAccumulator;
+        uint64_t rateCounter;
 
-        double attackStepCycles;
-        double decayStepCycles;
-        double releaseStepCycles;
+        uint64_t attackPeriod;
+        uint64_t decayPeriod;
+        uint64_t releasePeriod;
 
         uint32_t exponentialCounter;
         uint32_t exponentialPeriod;
@@ -102,6 +105,8 @@ class Envelope
         // Helpers
         void syncLevelFromCounter();
         void updateExponentialPeriod();
+        void stepEnvelope();
+        static uint64_t toRatePeriod(double stepCycles);
 };
 
 #endif // ENVELOPE_H
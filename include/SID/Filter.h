@@ -11,6 +11,7 @@
 #define _USE_MATH_DEFINES
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <math.h>
 #include "Common/SIDModel.h"
@@ -22,8 +23,8 @@ class Filter
         Filter(double sampleRate);
         virtual ~Filter();
 
-        // Process one audio sample through the filter.
-        double processSample(double input);
+        // Run a block of samples through the filter, in and out may be the same buffer
+        void processBlock(const float* in, float* out, size_t count);
 
         // Reset function
         void reset();
@@ -60,6 +61,8 @@ class Filter
         double resonance;   // normalized resonance
         double f;           // Filter coefficient
         double q;           // Filter coefficient
+        float drive;        // Input drive from the model profile
+        float asymmetry;
         double lowPassOut;
         double bandPassOut;
         double highPassOut;
@@ -68,6 +71,9 @@ class Filter
 
         // Helper to recalculate filter coefficients when parameters change
         void calculateCoefficients();
+
+        // tanh by table, the input saturation is the only transcendental call per sample
+        static float tanhApprox(float x);
 };
 
 #endif // FILTER_H
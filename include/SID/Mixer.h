@@ -9,20 +9,39 @@
 #define MIXER_H
 
 #include <algorithm>
-#include <cmath>
-#include <vector>
+#include <cstddef>
+#include <cstdint>
 
+// Splits the three voice blocks into the filter input and the direct path.
+// Routing and gains only change on register or model changes.
 class Mixer
 {
     public:
         Mixer();
         virtual ~Mixer();
 
-        double mixSamples(const std::vector<double>& voiceSamples);
+        // $D417 bits 0-2 select the filtered voices, $D418 bit 7 cuts voice 3 from the direct path
+        void setRouting(uint8_t filterBits, bool voice3DirectOff);
+        void setGains(double filterInputGain, double directGain);
+
+        inline bool anyFiltered() const { return filterBits != 0; }
+
+        // Both sums are clamped to +-1 before the gains
+        void mixBlock(const float* const voices[3], size_t count, float* filtered, float* direct) const;
 
     protected:
 
     private:
+        static constexpr float PER_VOICE_GAIN = 0.5f;
+
+        uint8_t filterBits;
+
+        float filterInputGain;
+        float directGain;
+
+        // Per voice weights into each path, 0 or PER_VOICE_GAIN
+        float toFilter[3];
+        float toDirect[3];
 };
 
 #endif // MIXER_H
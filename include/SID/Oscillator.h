@@ -22,7 +22,7 @@ class Oscillator
 
         // Getters
         inline uint32_t getNoiseLFSR() const { return noiseLFSR; }
-        inline double getPhase() const { return phase; }
+        inline double getPhase() const { return getAccumulatorPhase(); }
         inline bool getPhaseOverflow() const { return phaseOverflow; }
         inline uint8_t getControl() const { return control; }
         inline double getFrequency() const { return frequency; }
@@ -31,9 +31,11 @@ class Oscillator
         inline void setPhaseOverflow(bool value) { phaseOverflow = value; }
         inline void setNoiseLFSR(uint32_t value) { noiseLFSR = value & 0x7FFFFF; }
         inline void setSampleRate(double sample) { sampleRate = sample; }
-        inline void setPulseWidth(double width) { pulseWidth = width; }
+        void setPulseWidth(double width);
         inline void setSyncSource(Oscillator* source) { syncSource  = source; }
         inline void setRingSource(Oscillator* source) { ringSource = source; }
+        inline Oscillator* getSyncSource() const { return syncSource; }
+        inline bool isSyncEnabled() const { return (control & 0x02) && syncSource; }
         void setAccumulator24(uint32_t value);
         void setPhase(double value);
         void setSIDClockFrequency(double frequency);
@@ -46,9 +48,6 @@ class Oscillator
         bool hasCombinedWaveform() const;
         bool hasNoiseCombinedWithOtherWaveform() const;
 
-        // Generate the sample for output
-        double generateMixedSample();
-
         // Reset function
         void reset();
 
@@ -57,10 +56,11 @@ class Oscillator
         // Reset the phase
         void resetPhase();
 
-        // Update the phase accumulator for the next cycle
-        void updatePhase();
+        // Run the accumulator for a number of cycles, hard sync is applied by the caller
+        void clock(uint32_t sidCycles);
+        uint32_t cyclesToOverflow() const;
+        inline void hardSync() { accumulator24 = 0; }
 
-        void clock(double sidCycles);
         double outputSample();
 
         uint32_t getAccumulator24() const { return accumulator24 & 0x00FFFFFF; }
@@ -81,10 +81,10 @@ class Oscillator
 
         uint32_t noiseLFSR;
         double sampleRate;
-        double phase; // Phase accumulator, normalized to [0, 1)
         double sidClockFrequency;
         double frequency; // Frequency in Hz
         double pulseWidth; // Pulse width for pulse waveform
+        uint32_t pulseWidth24; // Same, as the accumulator value the pulse goes low at
         bool phaseOverflow;
         uint8_t control; // Control value from relevant voice
 
@@ -12,11 +12,11 @@
 #include <atomic>
 #include <cstddef>
 
-template<std::size_t N>
+template<std::size_t N, typename T = double>
 class RingBuffer {
     static_assert((N & (N - 1)) == 0, "Capacity must be a power of two");
 
-    std::array<double, N> buf{};
+    std::array<T, N> buf{};
     std::atomic<std::size_t> head{0};     // next write position
     std::atomic<std::size_t> tail{0};     // next read position
 
@@ -24,7 +24,7 @@ class RingBuffer {
 
 public:
     /* producer â€” returns false if the buffer is full */
-    bool push(double sample) noexcept
+    bool push(const T& sample) noexcept
     {
         auto h = head.load(std::memory_order_relaxed);
         auto next = (h + 1) & mask;
@@ -36,7 +36,7 @@ public:
     }
 
     /* consumer â€” returns false if the buffer is empty */
-    bool pop(double &sample) noexcept
+    bool pop(T &sample) noexcept
     {
         auto t = tail.load(std::memory_order_relaxed);
         if (t == head.load(std::memory_order_acquire))
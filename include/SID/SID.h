@@ -15,14 +15,17 @@
 #include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <queue>
 #include <sstream>
+#include <vector>
 #include "Common/VideoMode.h"
 #include "Debug/TraceManager.h"
 #include "SID/Filter.h"
 #include "SID/Mixer.h"
 #include "SID/RingBuffer.h"
 #include "SID/SIDModelProfile.h"
+#include "SID/SIDResampler.h"
 #include "SID/Voice.h"
 #include "StateReader.h"
 #include "StateWriter.h"
@@ -30,6 +33,7 @@
 // Forward declarations
 class CPU;
 class DataBusLatch;
+class SIDThread;
 class Vic;
 
 class SID
@@ -54,15 +58,42 @@ class SID
         void setMode(VideoMode mode);
         void setSampleRate(double sample);
 
+        // Band limiting of the output, High runs the chip's output stage 4x oversampled
+        void setResamplerQuality(SIDResampler::Quality quality);
+        inline SIDResampler::Quality getResamplerQuality() const { return resampler.getQuality(); }
+
         // Register read/write
         uint8_t readRegister(uint16_t address);
         void writeRegister(uint16_t address, uint8_t value);
 
-        double generateAudioSample();
-
+        // Cycles are only counted here, the voices run in one batch when a resampler block is due or the chip is accessed
         void tick(uint32_t cycles);
+        void sync();
+
+        // Audio thread: one host frame, popSample() is its mono mix
+        void popFrame(double& left, double& right);
         double popSample();
 
+        // Extra chips (2SID/3SID) at a 32 byte window in $D420-$D7FF or $DE00-$DFFF. They run in this
+        // chip's batches and are mixed into its output, so they cost nothing per cycle.
+        static constexpr size_t MAX_LINKED_CHIPS = 2;
+        bool addLinkedChip(uint16_t baseAddress, SIDModel model, double pan);
+
+        // -1 is left, 0 centre, 1 right
+        void setPan(double pan);
+
+        // The chip answering at address, nullptr when none does
+        SID* chipForAddress(uint16_t address);
+
+        // Audio thread chip: replay a write to this chip (0) or a linked one (1, 2)
+        void writeChipRegister(uint8_t chipIndex, uint16_t address, uint8_t value);
+
+        // Keep the chip running but produce no samples (tape warp)
+        void setAudioMuted(bool muted);
+
+        // Synthesise the audio on its own host thread, only OSC3/ENV3 are still modelled here
+        void setAudioThread(bool enabled);
+
         // Full reset to default power on state
         void reset();
 
@@ -72,7 +103,11 @@ class SID
 
         // ML Monitor access
         std::string dumpRegisters(const std::string& group);
-        inline int getAudioBufferedSamples() const { return audioBufferedSamples.load(std::memory_order_relaxed); }
+        inline int getAudioBufferedSamples() const
+        {
+            return threadedOutput.load(std::memory_order_acquire) ? synth->getAudioBufferedSamples() :
+                audioBufferedSamples.load(std::memory_order_relaxed);
+        }
         std::string dumpAudioStats() const;
         std::string dumpCutoffTable() const;
         void resetAudioStats();
@@ -102,9 +137,16 @@ class SID
         };
 
         AnalogProfile getAnalogProfile() const;
+        AnalogProfile analogProfile;    // Cached on model change
+
+        struct AudioFrame
+        {
+            float left;
+            float right;
+        };
 
         // buffer
-        RingBuffer<8192> audioBuf;
+        RingBuffer<8192, AudioFrame> audioBuf;
 
         VideoMode mode_;
 
@@ -112,9 +154,10 @@ class SID
         double hpPrevOut;
         static constexpr double HP_ALPHA = 0.9997;
 
-        double lastOutputSample;
-        double underrunOutputSample;
-        double recoveryStartSample;
+        // Per channel, left and right
+        double lastOutputSample[2];
+        double underrunOutputSample[2];
+        double recoveryStartSample[2];
 
         bool audioWasUnderrunning;
         int underrunRecoverySamples;
@@ -124,7 +167,24 @@ class SID
         double sidCyclesPerAudioSample;
         double sampleRate;
 
-        double sidCycleCounter;
+        // Oversampled output, decimated to the host rate a block at a time, right only used in stereo
+        SIDResampler resampler;
+        SIDResampler resamplerRight;
+
+        // Oversampled sample clock in SID cycles, 16.16 fixed point
+        static constexpr int SAMPLE_CLOCK_FRACTION_BITS = 16;
+        static constexpr uint32_t MAX_PENDING_CYCLES = 0x10000; // Catch up bound while no samples are due
+
+        uint64_t sampleClock;
+        uint64_t sampleClockPeriod;
+
+        uint32_t pendingCycles;     // Ticked but not yet run by the voices
+        uint32_t cyclesUntilSync;   // Pending cycles that make the next batch due
+        bool audioMuted;
+
+        // Voice outputs at the sample points not yet run through the output stage
+        std::array<std::array<float, SIDResampler::BLOCK_SIZE>, 3> voiceBlock;
+        size_t blockFill;
 
         std::atomic<uint64_t> audioGeneratedSamples {0};
         std::atomic<uint64_t> audioConsumedSamples  {0};
@@ -138,6 +198,31 @@ class SID
         Filter filterobj;
         Mixer mixerobj;
 
+        // Threaded mode: synth is the complete chip the audio thread runs, the voices here only
+        // keep OSC3/ENV3 readable. synth outlives the mode, the audio callback may still read it.
+        std::unique_ptr<SID> synth;
+        std::unique_ptr<SIDThread> audioThread;
+        std::atomic<bool> threadedOutput {false};
+        uint64_t threadCycle;       // Cycles ticked since the audio thread started
+        uint64_t threadTarget;      // Next cycle handed over to the audio thread
+
+        // Linked chips have an owner, which clocks, samples and mixes them
+        struct LinkedChip
+        {
+            std::unique_ptr<SID> chip;
+            uint16_t baseAddress;
+        };
+
+        SID* owner;
+        uint8_t linkIndex;          // 1 based position in the owner's list
+        std::vector<LinkedChip> linkedChips;
+        double pan;                 // -1 left to 1 right
+
+        // Output gains from the pans, chip 0 is this one
+        float leftGain[1 + MAX_LINKED_CHIPS];
+        float rightGain[1 + MAX_LINKED_CHIPS];
+        bool stereo;
+
         // Voice structure
         struct voiceRegisters
         {
@@ -175,6 +260,22 @@ class SID
         void updateCutoffFromRegisters();
         void applyVoiceControl(Voice& voice, uint8_t oldControl, uint8_t newControl);
         void configureOscillatorSources();
+        void updateSampleClockPeriod();
+        void applyOversampledRate();
+        void renderBlock();
+        void renderChipBlock(size_t count, float* out);
+        void captureVoices(size_t index);
+        void updateOutputRouting();
+        void updatePanGains();
+        void decayDataBus(uint32_t cycles);
+        void postToAudioThread(uint8_t chipIndex, uint8_t reg, uint8_t value);
+        bool isShadowOnly() const;
+        void clockVoices(uint32_t cycles);
+        void clockOscillators(uint32_t cycles);
+        void scheduleNextSync();
+        SID* haltAudioThread() const;
+        void takeBusLatch(const SID& from);
+        static void copyChipState(const SID& from, SID& to);
 
         // Monitor helpers
         std::string decodeControlRegister(uint8_t control) const;
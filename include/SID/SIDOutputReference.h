@@ -0,0 +1,957 @@
+// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#ifndef SID_OUTPUT_REFERENCE_H
+#define SID_OUTPUT_REFERENCE_H
+
+#include <cstdint>
+
+// Reference render for the sid-output benchmark. The script in BenchmarkSuite.cpp was played
+// on a bare PAL SID for 100 frames at 44.1 kHz by the per-sample, double precision output
+// stage that the block output stage replaced. Every 32nd sample is kept, as 16-bit.
+static constexpr uint32_t SID_OUTPUT_REFERENCE_FRAMES = 100;
+static constexpr uint32_t SID_OUTPUT_REFERENCE_STRIDE = 32;
+static constexpr uint32_t SID_OUTPUT_REFERENCE_SEED = 7;
+static constexpr double SID_OUTPUT_REFERENCE_SAMPLE_RATE = 44100.0;
+
+static constexpr int16_t SID_OUTPUT_REFERENCE_6581_FAST[] =
+{
+    2538, 2614, 2681, 1707, 3231, 914, 3694, 1156, 3165, 2660, 1010, 4242,
+    -1091, 5095, -1472, 4784, 542, 2315, 3902, -1611, 5951, -3580, 6403, -2451,
+    4488, 1640, 449, 5042, -2751, 6101, -3223, 5396, -1051, 2982, 2907, -743,
+    5149, -2692, 5440, -2314, 4242, 394, 1505, 3583, -1275, 4880, -2402, 4742,
+    -1472, 3241, 1492, 283, 4073, -1988, 4900, -2411, 4262, -713, 2177, 2488,
+    -829, 4453, -2436, 4746, -2159, 3596, 250, 903, 3276, -1718, 4650, -2630,
+    4420, -1638, 2721, 1328, -300, 3862, -2327, 4670, -2573, 3912, -838, -777,
+    -45, -1166, 2130, -160, 3572, 1429, 3903, 2884, 2876, 3657, 1159, 3218,
+    -573, 1796, -1586, -266, -1134, -2211, 216, -2376, 1633, -874, 2624, 1421,
+    2710, 3434, 7596, 11904, 6129, -9813, -12398, -1171, 10288, 10099, -548, -11016,
+    -8854, 5056, 10660, 6896, -7132, -11401, -3690, 8809, 10154, 1572, -10447, -9684,
+    3536, 10465, 7768, -5742, -11382, -5203, 8052, 10365, 3203, -9774, -10228, 2031,
+    10210, 8616, -3995, -11312, -6688, 7132, 10583, 4720, -8952, -10755, 113, 9810,
+    9284, -1993, -11113, -7941, 6008, 10638, 5715, -8207, -11044, -9021, -7449, -5587,
+    -3394, -843, 1541, 3524, 5157, 6483, 7540, 8358, 8964, 9375, 9608, 9672,
+    9573, 9313, 8891, 8300, 7531, 6570, 5401, 4002, 2347, 410, -1836, -4231,
+    -6252, -10822, -13657, -13825, -9740, -2315, 5818, 8635, 7532, 4990, -6111, -9411,
+    -14016, -10700, -8727, 2548, 7304, 8678, 9033, 528, -2198, -13266, -10326, -12646,
+    -3159, 1949, 7719, 10117, 4305, 4588, 7316, 3153, 3884, -3415, -1377, -7375,
+    -8102, -4504, -4856, 2286, 3052, 8231, 5945, 5120, -3208, -5673, -8032, -9966,
+    -4123, -1561, 5467, 6761, 8779, 5622, 5443, -1960, -8134, -7707, -10209, -6208,
+    -4044, 6161, 7946, 10509, 6873, 3511, -2159, -10347, -9773, -10154, -2269, 657,
+    6841, 6721, 9113, 6757, 848, -913, -8441, -8632, -10770, -4658, 265, 8303,
+    6350, 5173, 4512, -9383, -8795, -10565, -6954, -8382, -6855, -11442, -10925, -10735,
+    -11698, -7679, -7529, -3948, -8409, -6774, -8590, -2842, -750, -9062, -6629, -10255,
+    -8306, -10651, -6563, 2218, 2450, 2643, 2800, 2927, 3022, 3089, 3060, 3028,
+    2928, 2818, 2702, 2531, 2400, -6524, -6652, -6680, -6608, -6413, -6116, -5720,
+    -5369, -4713, -3946, -3063, -2049, -954, 7223, 4384, 6282, -18028, 2505, -7302,
+    -1676, -8040, -3962, -4191, 14674, 10511, 2906, 6948, 14792, 3806, -4266, -19826,
+    -12746, 7438, 1185, 267, -517, -9849, 12536, 11324, -17500, -174, 8683, -14303,
+    13840, -19670, 17481, -15139, 6284, 5008, -17052, 17602, -19392, 14642, -5185, 7253,
+    17120, -16539, 17254, -18890, 14462, -5104, 9045, 17059, -19970, 15774, -15121, 6474,
+    9676, -18921, 16938, -19763, 12022, -9645, -12905, 11530, -19812, 17278, -17047, 7191,
+    -11066, -19446, 14228, -19429, 17336, -14157, -1670, 3374, -19233, 17873, -17601, 12786,
+    -553, -5067, 17889, -19253, 17113, -5294, 17610, -13131, 15556, -14395, -10234, -4778,
+    -13142, -4397, -14425, 16337, -523, 17375, -16582, 17705, -10228, -14718, -6601, -627,
+    -7594, -11725, 14219, -5900, 15860, -17120, 14488, 536, -17086, -6449, -14970, 10560,
+    -427, 14978, -12467, 17279, -10030, 17676, -4319, -12395, -8624, -12737, 5655, -15819,
+    15974, -12550, 18240, -3041, 15297, 2445, -16554, 8488, -17407, 10318, -17114, 16100,
+    173, -11161, 7690, 13580, 13406, -14216, -7652, -9466, -5835, 6902, 3093, 287,
+    -262, 9016, 13261, 5596, -15197, -8914, -10503, -6851, 7626, -2993, -2437, 9665,
+    14351, 17112, 9260, -18206, -2036, -945, 5332, 4293, 6587, 1803, 4495, 6961,
+    12692, 3159, -12076, -4605, -5908, 5128, 6392, -3664, -10401, 7030, 9534, 14186,
+    -9434, -14924, -8544, 7972, -10390, -11417, -13799, -325, 10071, 17459, -15171, -8764,
+    11005, 15172, 6930, 13688, 13381, 6013, 11961, 7019, 14069, 9294, 8281, 14514,
+    5706, 11406, 2995, 13390, 8034, 6055, 10845, 8456, 16218, -2997, 2791, 15832,
+    -6228, 8012, 11900, 13996, 4204, -1305, 14366, -4511, 6088, 11091, -12267, 14105,
+    1732, -8554, 13198, 5108, -5583, 1715, 9857, 5904, 4249, 9657, 6688, 5993,
+    1492, -5983, 14946, -10322, 8127, 13483, -3187, 1441, -17369, -5218, 11156, 5550,
+    3542, 7745, -1602, 5174, -10843, 10413, 5866, -671, 10327, -2411, 8123, 4214,
+    -7322, 11357, -4149, -2381, 8730, 20, 8440, -9191, 8407, 8093, -12084, 8016,
+    -18310, 7912, 4893, -7932, 11173, 28, -7282, -13643, -8459, 1772, -1581, -2988,
+    3299, -7825, -6835, -18233, 4405, 1087, -14695, -4556, -15108, -16069, -22876, -16586,
+    5021, -16583, -15568, -6319, -15788, 7805, -20167, -6371, -13242, -17042, 6001, -9209,
+    4297, -18089, -16258, 6032, -12676, -11949, -7251, -17681, -717, -3169, -13589, -10115,
+    -8031, -7022, -14622, -15827, -6841, 2750, -13115, -15839, 1014, -3452, 4763, -9599,
+    -14861, -4815, -2846, -12929, -10152, 9543, -10837, -14096, -641, 1554, -13012, -8657,
+    -10963, -16327, 198, 2834, -13561, -1890, 2356, -13105, -5609, 7808, -7343, -12511,
+    115, 3337, -4775, 5886, -6498, -11528, -2088, -1037, -10405, -2115, -12048, -5261,
+    4666, -8932, -11679, 7708, -12703, -9664, 5441, 7921, -8832, -7645, 9624, -16534,
+    3230, 9558, 3350, -3279, 13923, 13713, -3463, 17145, 10048, -7048, 10234, 16081,
+    5454, -4571, 14260, -2035, 609, 12613, 5967, -11374, -1812, -7835, 4158, 12818,
+    13293, -14684, -14927, 9895, -10328, -18636, -11367, -3373, -4396, -12656, -13094, -11506,
+    -9814, -2779, 8703, -11683, -16325, 777, 16199, -10811, -11713, -4262, -5239, -12458,
+    16407, -6747, -14465, 10451, 13453, -9108, -9419, 4775, 10206, 14713, 5197, 11059,
+    -7210, -1160, 18790, 16672, 20110, 494, 4859, -4085, -7404, 11908, -5660, 8225,
+    15276, 16159, 7099, -10120, 19064, 10965, -15283, -1506, -5068, -15644, -13689, 13068,
+    -4335, -19745, -10010, 8896, 316, -14365, 4835, 4043, -19431, -11676, -933, -16725,
+    -12751, 11821, 8722, 1402, 9226, 2671, 8694, 1888, 16112, 9116, -5417, -15900,
+    334, 17814, 3087, -17060, -7542, 19544, -6531, 5624, 12704, 7739, 7897, -1652,
+    -8228, 16327, 11098, -11247, -11246, 7739, -1155, 8851, 11419, 8763, -6984, 3163,
+    5822, 7941, -8392, -4868, -17056, 19324, -6296, 471, 11931, -1915, -7122, -5903,
+    19282, -17415, -397, -1515, 15741, -15348, 10358, 11962, -18689, 14423, 1190, 7216,
+    -15692, 16863, -12063, -572, 15789, 8552, 16416, 7041, -1663, -19056, -7483, -15124,
+    9339, -1178, 16927, 8524, -7357, 13540, 744, 16462, 7114, 15978, -17526, -8908,
+    -18459, -14581, 6297, -8894, 15714, -15232, 4230, -17033, 15823, -17465, 17176, 4571,
+    -5666, 15073, -7329, 7843, 440, -2405, 5097, 9350, -6420, -9905, 10196, -9327,
+    10723, -10428, 12744, -12927, 12503, -11771, 15259, 399, -2143, -9060, 9422, 17268,
+    10648, 16895, -9155, 6196, -13559, -13246, 3438, -12609, 8796, -10022, 12964, 2701,
+    13173, -6694, 11661, -8427, -12530, 123, -18974, -6120, -13530, 12708, 7090, 16492,
+    3199, 16651, 16623, -7589, 7456, 7211, -8696, 14120, 2758, -7979, -4764, 1421,
+    5050, -1855, 2944, 14302, -4091, -6092, -5682, -977, 5597, -10017, 591, 15988,
+    -10428, 8019, 10787, -8202, 6590, -843, 3678, -12187, 12175, 2887, -12768, 13108,
+    8223, -18662, 15504, 3813, -19379, 16227, -3429, -17647, 17228, -6637, -16212, 18017,
+    -11896, -12568, 15562, -13524, 7850, 7042, -10861, 7788, -3737, -3152, 9817, 529,
+    12458, 10240, 7095, 10898, 10594, 12576, 6136, 8004, 11228, 6101, 7906, 10605,
+    -975, 2827, 5108, -1480, 6741, -8547, -4904, 13439, -5550, -3689, 5279, -2767,
+    -6893, 13804, -14416, -6458, 14346, -15755, 4153, 11589, -18430, 17249, -18002, -10554,
+    13576, -12730, 4399, -8554, -3281, 11220, -17298, 7629, -14479, 12259, 4835, -6990,
+    4270, -9540, 13876, -12853, -1266, -5812, -631, -14181, -11789, -8177, -2759, -15364,
+    -12544, -10631, -3838, -15968, -19874, -17978, -15162, -16801, -15103, -10815, -2973, -14480,
+    -10730, -1846, 7970, 12323, -8737, 11227, 14359, 16454, 7847, 12750, 14868, 11400,
+    1441, 6906, 10741, 12802, 3189, 3519, -3044, 2274, -10586, -1349, 2538, -959,
+    -5530, -3483, -1772, 1053, -12993, -11449, 3128, 7613, -12452, -9456, -15497, 3603,
+    13291, 2258, 6018, 14625, 15783, 8522, 9046, 8876, 10256, -322, 490, 2720,
+    -4681, -16013, -14543, -17109, -15517, -20781, -17043, -6803, -767, -21095, -17739, -14811,
+    -16465, -17524, -16962, -12944, 5813, 7842, -4059, 5362, 18354, 18908, 14841, 10128,
+    13764, 12102, 9544, 12924, 14953, 16793, 10726, 14177, 12702, 14303, 6393, 12248,
+    13473, 14896, -530, 2047, 11928, 11606, -11338, -14029, -12260, -18336, -22184, -20899,
+    -15683, -4087, 2391, 5021, 11021, 11513, 16255, 10134, 4862, 4941, 4779, -11479,
+    -15464, -14107, 5927, -17575, -14732, 4508, 3194, -10737, -1400, -5977, 6482, -14198,
+    -5248, -1505, 2293, -9445, -10022, 2209, 6158, -16892, -10136, 10085, 556, -16511,
+    -7734, 10086, -1756, -4248, 1284, 9356, -11747, 11791, 1870, -11951, -6845, 16317,
+    5069, -7486, -11950, -8761, -2392, 8149, -9838, 18201, -21158, 15986, -16002, -14526,
+    12979, -16635, 17075, -4736, 12924, -4463, 13005, -6734, -2811, 9296, -20541, 17754,
+    -17413, 13046, 9045, -16801, 14631, 10630, 13109, -18666, -19576, 4148, 10578, 1082,
+    -2914, 10165, 14459, 11773, 1164, -710, 9599, -9007, -7532, -14973, -5823, -3205,
+    10991, -10414, -1359, 18145, -4085, 2382, -7316, 725, 3093, -13077, -7791, 225,
+    -11092, 10500, -7540, 13272, 5128, 7842, -5545, 3773, 5814, -14952, 7442, -16303,
+    3787, -6708, -808, 8927, 1226, 13043, 2273, 7518, -257, -4802, 6156, -15940,
+    2424, 15058, 8940, -10590, -9851, 8674, 1033, 3936, -3405, -8246, 15383, -7742,
+    -16894, 12221, 17429, -3187, -16941, -10251, 14209, 273, -19230, -11170, 18306, 17476,
+    -14998, -5295, 13125, -1663, 11582, 14885, -14712, -13119, 6802, -10476, -2174, -12150,
+    8927, 15071, -7167, -14898, 14046, 11810, -20961, 2553, 13991, 2629, -9647, -2077,
+    13209, -6719, -13276, 983, 9368, 12057, -14934, 11257, 17321, -3064, -11358, -6309,
+    -9054, -8751, 70, 7691, 12852, 12973, -2349, 7195, 4775, -15839, -556, 16326,
+    1433, -4344, 16127, 8325, -17307, -14279, -4557, 8265, -3320, -10610, 14388, 14290,
+    -15007, -13383, 15323, -17274, -19863, 1910, -14570, -20008, -15659, -6167, -432, -5871,
+    -10364, 9481, 15319, -14030, -15348, 15604, 15507, -1502, 15023, 18158, 16466, 14933,
+    8274, 15242, 16951, -2415, -7910, 18166, 17173, -1586, 3038, 11280, -5574, -18285,
+    -19358, -15368, -2736, -18724, -19785, 7887, 2171, -20590, -17719, -7723, -14259, -15634,
+    -11033, 10988, 18627, 10965, -3645, 18538, 3106, 15428, 11944, -3475, -10724, -7722,
+    11520, -17043, 8473, -14532, 10805, -6800, -10696, 6184, -11643, -2840, 8974, -7685,
+    14294, 3830, 12500, 17791, 10583, 16616, -12498, -13836, -5486, 2730, 1306, 6279,
+    -13360, 9788, 9391, 5212, -14388, 2223, 2679, -15686, -12839, -4784, -20474, 10825,
+    14772, -2001, -7045, -11425, -1447, -16930, 8839, 11446, -19770, -1910, 3048, 12760,
+    4488, -10560, 3346, -7059, 7113, 15891, 210, 17075, 17976, 2400, -2256, -19389,
+    -8737, 10118, -15070, -20857, -7141, -15939, -9354, -14940, 13817, 16740, -5465, 17310,
+    18395, 11908, 11301, -11839, 17222, 15251, -21289, -18018, -18074, -17148, -14485, -15874,
+    7501, 13655, -13536, 18879, 17778, -7054, 14506, 14987, 18252, 12282, -20119, 9264,
+    -14657, -18702, -15037, -19910, -3327, -14343, -18348, 18461, 15040, -11115, 14599, 16753,
+    18504, 16888, -14748, 15981, -4872, -18463, -11675, -19657, -7325, -17587, -18081, 14489,
+    -10979, -16311, 11399, 16087, 18762, 10501, -7273, 17058, 9636, 5515, 334, -16444,
+    -12134, -6787, -9525, 877, -4479, 5240, 10813, 3164, 5167, 12219, -1996, 1143,
+    -9507, -1441, 5017, -6610, -19511, 6962, 5812, 13362, -11244, -15388, 3657, 4346,
+    11826, 8036, -11440, 4494, 6003, -7549, 11402, 11245, 16239, 12985, -15955, -876,
+    -12199, -11191, 2228, -8150, 13515, -4962, -13903, 3639, -9048, 6640, -15939, -15102,
+    8424, 12358, 18585, -3954, 6005, 6846, -17761, 2693, 6076, 16771, 16613, -2435,
+    -13795, -14526, -16213, 3629, 6468, 7275, 8727, -1456, 11093, -1480, -4520, 9819,
+    462, 15343, 15086, 15755, 7927, -13334, -10904, -12931, 8637, 15040, 15666, 8018,
+    -18767, -9927, -19117, -18366, -1845, -4795, 18863, 18683, 13288, 18373, 10546, -8463,
+    -5901, -20221, -20500, -19741, -20432, -108, -6247, 16903, 17294, 16033, 18010, -6543,
+    -15262, -1988, -16340, -10855, 5572, -2136, 18689, 9869, 17599, 16913, -2848, 1652,
+    -14949, -20832, -20633, -20285, -18433, 11911, 7521, 18848, 18667, 16189, 17871, -9328,
+    -17163, -3731, -18398, -10947, 5538, -2240, 16800, 3328, 14623, 15205, -10843, -3308,
+    -11765, -19488, -17579, -17982, -11215, 17706, 14428, 18719, 18540, 11195, 12222, -18458,
+    -19710, -20092, -20357, -10490, -14493, 681, 16479, 16892, 17281, 17206, -9972, 541,
+    -17680, -16765, -10158, -13817, 15778, 18841, 11012, 18125, 12205, -5877, -2890, -20850,
+    -14208, -20479, -20283, -1772, -6336, 9901, 18646, 18441, 18576, 17129, -9134, 1493,
+    -11459, 10661, -18723, 8110, 7611, 9130, 14322, -13803, -11828, -17103, -7120, 7254,
+    -17261, 12227, 9422, -16529, 11853, 5914, 7499, 18165, -2011, -11728, 7709, -8395,
+    1344, 16637, -15923, 1386, -14175, -10426, -16820, 4934, -7265, 2813, -6584, 18084,
+    9913, -16589, 13936, -16536, 12150, 14857, -6627, 17689, -10099, -16620, -9591, -12656,
+    -376, 7633, 3074, 2358, -10926, 15635, -16189, 8463, -2819, 18650, 2831, 7996,
+    14668, -18090, 9885, -16478, 2315, 16867, -12603, 11729, -11287, -20337, 15675, -20140,
+    7242, 15544, -16252, 11419, 4051, -3251, 18598, 334, 11798, 13747, -10075, -5344,
+    268, -7127, -15632, -13432, -2136, -12397, -454, -5022, -4366, 8442, -6213, 18233,
+    625, 9699, 13782, 6536, 12964, -17735, -7173, 7761, 8096, -11660, 2822, -11850,
+    -20264, 1947, 16369, 3208, 1825, 9407, -17230, 3295, -751, 13210, 13431, -609,
+    11248, -19947, 12309, 7531, -5940, 18618, -13536, 3514, -18762, 7703, 3339, -9128,
+    18069, -9418, -17913, -18343, 7100, -4427, -20425, -17918, 6444, 11547, 3286, 12598,
+    18776, 17682, 2177, 18512, -10500, -17175, -19985, -8595, -4920, -20296, 18569, 17049,
+    9366, 11874, 16393, 18420, -15487, 11302, 6167, -20372, -16613, -18085, -17376, -10950,
+    -19529, -7126, -14797, 10003, 191, -9171, 14971, 12687, 18210, 17767, 11916, 17359,
+    18715, 18545, 18380, 13591, 17995, 13058, 16811, 6522, -11473, 1617, -14000, -5127,
+    -19656, -15300, -18162, -10970, -19299, -19115, -18937, -13117, -15143, -5545, -13216, 7744,
+    -3927, 14249, 8116, 17474, 13676, 18689, 16095, 18343, 18167, 18003, 17831, 17597,
+    17504, 15574, 17198, 12026, 15307, 6433, 11099, -5180, 5218, -13125, -3227, -16505,
+    -9949, -16469, -10413, -16415, -7454, -15607, -3998, 8978, 2693, 10196, 5240, 13400,
+    -13440, 4399, -4850, 11450, 6858, 15369, 12316, 17081, 6013, 16858, 3459, 16645,
+    463, 16441, -3177, 16243, -8975, 15396, -14823, 12433, 2413, 7422, -8941, -1453,
+    -15474, -22172, 474, -22710, -5634, -22398, -7121, -22100, -4911, -21695, 1253, -21573,
+    -10849, -21288, -3925, -19635, 7262, -15500, 13701, -7914, 2649, -1350, 5738, 3160,
+    9096, 7232, 11821, 10190, 13642, 11964, 14650, 12727, 14906, 12544, 14424, 17041,
+    280, 16186, 16688, 14360, 7769, 9462, -1575, -18921, -13544, -11875, -21000, -18007,
+    -5404, -14780, -10397, 11608, 8945, 6650, 15189, 13975, 4373, 9876, 8308, -12306,
+    -9907, -526, -15725, -16529, -6807, -20628, -9316, 17468, 5403, -21682, 2574, 17466,
+    2955, -4039, -8810, -10511, 5325, 5905, -15123, -10305, 12175, 7117, -13490, 2929,
+    11516, -5036, -8607, 8002, 4231, -10528, -5066, 872, 474, 1673, -15439, 8248,
+    6071, 1188, -2977, -2406, 12255, -11960, 8447, -9082, 10461, -14159, -4897, 4696,
+    51, -6727, -12203, 12254, -4436, 8342, -10962, 9883, 3625, -3116, -2133, 2616,
+    -5376, -13562, 5314, -21476, -17807, -21234, -19182, -15557, -9086, 2409, 12534, 17853,
+    14333, 17908, 14172, 15061, 9747, 6140, -1486, -11976, -10356, -17387, -16854, -21361,
+    -16647, -19196, -10088, -7505, -8852, 14250, 14820, -15466, -21284, 16984, 12926, 17218,
+    -12082, -14374, 11124, 11039, 17782, -8315, -15086, -21379, 17869, 17743, -3064, 4816,
+    -21547, 13983, 12777, 3980, 6434, -21677, -436, 14184, -63, -21564, 7420, 17776,
+    -21380, 7050, 14453, -4358, -21460, 504, 17873, -20116, -9430, 10917, 10931, -21372,
+    -2534, 17965, -19695, -16261, 14651, 13602, -15515, -11131, 18047, -20193, -16321, -15753,
+    2421, 16247, -13617, 13, 8013, 3703, -18478, 16726, 13818, -20842, 13788, 12606,
+    -15341, -16428, 18250, 990, -21115, 18278, 6718, -16247, 135, 14785, -16245, -18559,
+    18282, -14425, -16041, -20962, -21013, -2837, -4395, 12308, -4623, 13446, -15757, 6690,
+    -3505, -20347, 13329, -12235, 2066, 15050, 13826, 14409, 14858, 16488, -13650, 14247,
+    12867, -11629, 16715, 6960, 16077, 13291, -13765, 10458, -2938, 15660, 15020, 17706,
+    -11581, 11515, -10086, -20865, -7816, 1160, 15454, 5984, 15735, -1676, -20779, -12352,
+    -20860, 888, 6795, 4084, 15980, 1960, -11136, -21017, -9904, -9897, -5785, 18148,
+    11018, 18212, -17896, -4904, -20984, -20825, 14164, 5315, 18479, 7395, 18215, -19886,
+    -20722, 9214, -20769, 14613, 12815, 18384, 15117, 12407, -15032, -21046, 7999, -20310,
+    15304, 18419, 14899, 12290, 4617, -16299, -21053, 7924, -5262, 6072, 18294, 14799,
+    6696, -9052, -21190, -16059, -9462, 7417, 8261, 18270, 14640, -17451, -659, -15792,
+    -15923, -5910, 13684, 10608, 13373, 3103, -20963, 1416, -19424, 18370, 13382, 15011,
+    15823, -6938, 3136, -20966, 13977, 16581, 12653, 17205, 14492, 18353, -10975, -3458,
+    11690, 7422, 18366, 9361, 14764, -3665, 18375, -13061, -20940, 13135, 13413, 18355,
+    4025, 10862, -2266, 3680, -15979, -20940, 15572, 15005, 14961, 10563, -16244, -16054,
+    -16248, -16051, -20044, 5115, 18340, 14965, 4449, -18910, -16071, -20950, -21006, -16068,
+    -375, -7979, -15345, -7103, -17746, -18887, 2792, -16603, -4626, -15589, 15967, 12890,
+    -19883, 7526, -21009, -11854, -16258, -10077, -3133, -17552, 2226, -12271, 6623, -7123,
+    -9881, -5163, -21036, 16400, 15510, 17926, 15170, 14822, 17363, -4740, 167, -15875,
+    -19840, -21382, -15200, -20423, -20848, 12665, 9427, 13375, 18339, 16424, 14664, 17861,
+    754, 3616, 15957, -21458, -17543, -16769, -20983, -19876, -16671, -7519, 7759, 16433,
+    13394, 17743, 18057, 15642, 9748, 14015, 12839, -17916, -9534, -20692, -19169, -17824,
+    -20661, -18499, 7655, 5614, 15362, 18627, 13089, 18305, 13665, 10369, 14395, -18835,
+    5130, -20521, -14688, -20861, -20662, -13247, -14083, 15922, 1768, 13876, 18578, 13747,
+    18077, 12175, 3222, 4197, -11582, -5217, -21055, -20854, -15089, -20531, 4228, -19446,
+    -121, 18845, 11810, 18595, 11133, 18307, 17498, -10807, 13252, -16174, -15016, -15854,
+    -20599, -15496, -16018, -14091, 12593, 15712, 18199, 15431, 18634, 18456, 13141, 12630,
+    -16716, 5671, -12131, -20805, -15718, -20485, -11095, -20042, -9181, 19089, -7503, 17968,
+    -257, 12798, 15713, 10539, 13046, -4633, 3831, -2202, -13102, -5114, -13282, -18648,
+    15160, -5074, 17891, 15003, 7813, 18122, -15013, 7402, -15196, 15000, 14935, -631,
+    12964, -6770, -8947, -6945, -16963, 2033, -19033, -7514, -3425, 3884, 11494, -8767,
+    7051, 6152, -13102, 12037, -6326, 11386, 9158, -12409, 15001, -5065, 8130, 8024,
+    -5630, 13229, -56, 14287, -38, -1931, 10243, -1170, 16019, 9477, 11398, 18461,
+    11562, 6789, -9600, -7154, 12430, -2310, 13859, -166, -20316, -13608, -20211, -10466,
+    -17563, -14672, 9075, -15298, 3194, -13262, 7649, 9623, -7151, 12559, -18586, -9877,
+    -9627, -17970, -4964, -15013, 6388, 19198, 15688, 18874, 15351, 18555, 18378, 14875,
+    7284, -18085, -13388, -15863, -20602, -15503, -20269, -2943, 6492, -5841, 15751, 9695,
+    18918, 14227, -7714, 9166, -11908, 5205, -14198, -14625, 16403, 9592, 18265, 11805,
+    11576, 17659, 7922, -2306, -20011, -20969, -15876, -20629, -15517, -20295, -13859, 11409,
+    4010, 18383, 14685, 18675, 18497, 8514, 16575, 4738, 13909, 11831, -9812, 5941,
+    6184, 15548, 14913, 1690, 11569, -9287, 7141, -16678, -21412, -16303, -21064, -15935,
+    -15782, -20522
+};
+
+static constexpr int16_t SID_OUTPUT_REFERENCE_6581_HIGH[] =
+{
+    0, 2451, 2794, 1649, 2573, 1838, 1523, 3037, 235, 3963, -686, 3822,
+    -221, 2075, 2208, -918, 4431, -2871, 5252, -2996, 4113, -424, 328, 3602,
+    -3510, 5446, -4249, 5227, -2671, 2812, 1012, -1469, 3885, -3775, 4906, -3576,
+    4056, -1361, 1122, 1903, -2398, 3814, -3497, 4158, -2587, 2808, -239, -315,
+    2410, -2914, 3773, -3372, 3692, -2015, 1817, 755, -1555, 2932, -3432, 3808,
+    -3197, 3171, -1187, 587, 1621, -2576, 3305, -3668, 3687, -2748, 2452, -194,
+    -709, 2319, -3289, 3525, -3636, 3395, -2021, 1502, 848, -1868, 2852, -3761,
+    235, -2431, 1145, 52, 1266, 2336, 923, 3300, 438, 2913, -121, 1255,
+    -392, -1447, -381, -3492, -332, -3732, -138, -2170, -18, 590, 28, 2652,
+    424, 3435, 792, -12948, -11666, 3594, 10827, 7696, -7424, -12687, -6171, 7398,
+    9787, 2505, -10553, -10945, 1443, 9770, 8161, -4585, -11903, -7241, 6784, 10266,
+    4351, -9443, -11224, -121, 9603, 8982, -2482, -11536, -8210, 5903, 10485, 5750,
+    -8336, -11444, -2146, 9195, 9651, -221, -11112, -9202, 4653, 10497, 6954, -7046,
+    -11611, -4138, 8585, 10113, 1809, -10557, -9814, 3590, 10434, 7744, -6410, -3736,
+    -923, 1489, 3282, 4598, 5536, 6166, 6538, 6692, 6654, 6444, 6076, 5560,
+    4901, 4102, 3163, 2084, 863, -499, -2000, -3631, -5225, -6528, -7556, -8333,
+    -8881, -9616, -12444, -12017, -8586, 655, 6631, 10351, 8500, 6521, -2954, -8273,
+    -10837, -10357, -3343, 1520, 10334, 8733, 10469, 2529, -1537, -9840, -11094, -7224,
+    -5663, 7594, 6446, 11801, 6332, -6019, -2512, -6257, -7068, -202, -755, 3589,
+    1951, 6416, 3666, 4964, -1926, -4134, -5007, -7577, -2266, -648, 6154, 5267,
+    6311, 1872, 2156, -5156, -9071, -5709, -5885, 698, 892, 6462, 6192, 8519,
+    4478, -31, -2754, -9094, -7875, -7929, 1746, 4102, 8263, 6183, 6386, 3509,
+    -4393, -4526, -8098, -4797, -6192, 357, 1928, 7905, 7472, 5762, 5431, -2628,
+    -3255, -6215, -249, 491, 9759, 7866, 8358, 8473, 5406, 7696, 7444, 10067,
+    7995, 8117, 3225, 4629, 3875, 2981, 5930, 2981, 2987, -4731, 3841, 3372,
+    6591, 6063, 6778, -3266, -3303, -3232, -3087, -2871, -2589, -2238, -1851, -1377,
+    -950, -507, -45, 450, 949, -19311, 6871, 6601, 6253, 5828, 5318, 4727,
+    4055, 3473, 2658, 1747, 747, -309, -1382, -5728, -9814, 15601, 1849, 7990,
+    3345, -7909, 17072, -12575, 1430, 6935, -12600, 12407, 3656, 7430, -2874, -15575,
+    1035, 4949, -3542, 12330, -10318, -2498, 8569, -12594, 11110, 9431, -1006, 13307,
+    -16071, 8619, -5829, -16144, 17780, -18964, 16749, -9830, 5111, 13419, -17509, 17538,
+    -19449, 13568, -1206, 8274, 16814, -16243, 15895, -20077, 10372, 5834, -12641, 16187,
+    -20144, 13123, -12378, -5945, 9364, -19820, 17220, -17615, 10291, -8209, -15441, 13458,
+    -18616, 18334, -14457, 8312, -3842, -18050, 18806, -17015, 16986, -6263, -3327, 15520,
+    -18200, 18425, -15233, 11945, 8741, -17475, 10696, 9455, 7367, -15706, 10312, -17647,
+    5855, -15244, 17189, -10541, 10082, 4485, 8216, 6515, -18060, 9995, -14191, 14168,
+    -12475, 18638, -10988, 2059, 5137, 650, 7246, -16658, 11497, -11724, 13806, -11715,
+    18157, -11189, -1383, 9021, 1286, 12882, -17515, 14857, -16463, 15097, -14949, 16817,
+    -11569, -1576, 12730, -4834, 14816, -16293, 16081, -15733, 13481, -14652, 13695, -12420,
+    -12085, 15529, 12532, 3228, -9251, -6769, 7693, 3476, 3866, -721, -9752, -2817,
+    10579, 5840, -1983, -7052, -464, 9951, 4937, 3815, -1346, -10374, -165, 7793,
+    5178, -8913, -1932, 3407, 5209, -9177, 604, 2730, -6482, -3677, 7997, 2270,
+    292, -2065, 5527, 7022, -4055, -1418, 1648, -8999, 4108, 8319, 4540, -4607,
+    7839, 9882, 8535, -7070, -4022, 8856, -1810, 1938, 16939, -8915, 11968, 16032,
+    14463, 6332, 11223, 12651, 4212, 11790, 3241, 11628, 8014, 4912, 10830, 4851,
+    3829, -5751, 9497, 6338, -62, 9505, 5247, 1373, -15747, -9124, 12042, -12334,
+    2296, 9840, -7302, 3517, -12268, 10123, -292, -5252, 10627, -6044, 5481, 3020,
+    -8562, 8561, 4879, -10386, 10400, -983, 4403, -1490, 5840, 1641, 467, 1394,
+    2768, 7771, -6814, -9160, 9678, -13539, -9080, 9181, 4294, 8008, 4370, -11694,
+    4110, 3685, -3287, -5451, 8390, -5707, -3365, 2995, -1402, 2966, -9149, -2045,
+    5597, -9188, -4690, 4559, -6743, 2912, -15509, 5425, 3973, -18649, 8550, -915,
+    -7724, 6912, -18441, 9189, -5713, -13918, 11339, -4124, 5711, -5118, -12735, 3692,
+    -13985, -3817, 6015, 6872, 5991, -12490, -12511, -9384, -17976, -789, -14628, 6776,
+    -9976, -18620, 5873, -8537, -14610, -16724, -12666, 2229, -10719, -3181, -3524, -14210,
+    -9028, -8734, 9321, -5174, -13903, 2884, -4478, -8522, 3062, -12662, -3714, 5682,
+    -9248, -2240, -6799, -7930, 6870, -3934, -10081, -4230, 6980, -4984, -14544, 307,
+    5715, -7445, -8597, 3123, 7134, -11090, -8650, 10639, 2875, -8831, -4841, 10401,
+    -4516, -11336, 5095, 9827, 7851, -8811, -6655, 9348, -6929, -6304, 8313, 4919,
+    -7954, -4497, 11504, 1987, -8020, -2685, 9441, -1549, -8243, -130, 8806, 1336,
+    -7892, -2046, 9922, -1542, -5637, 450, 14525, 2840, -6973, 1954, 11237, -3741,
+    -15167, 8543, 15879, -449, 3726, 16326, 13113, -10340, 8341, 16128, 4452, -3528,
+    12660, 14412, -5852, 7936, 14895, -525, -10981, 6135, 10143, 10009, -3726, 8984,
+    4121, 2674, -7399, -16172, -7694, -19882, -17946, -8228, -12236, 340, -5979, -8622,
+    -8135, -4787, -13996, -13958, 10674, 4153, 4414, 4770, -1612, 4039, 7106, -9228,
+    -10457, 16774, -7526, 18, 15204, -525, -5354, 1166, -4939, 12445, 11177, 9025,
+    5878, 14652, 3976, -2785, -4636, -13616, 14795, 14861, -10053, -4047, 4321, -11995,
+    10319, 17571, 10259, 2717, 8293, -11128, 7896, 8540, 2123, -2721, 2352, -17157,
+    -8559, 10609, -4114, -18547, -9748, 8834, -9298, -11479, 18406, 4131, -18471, 8645,
+    2591, -12228, -2692, 463, -1817, 826, 12635, 15542, -7927, 2960, 472, 19216,
+    -232, -14728, 19910, -16236, -946, 17337, -4299, -7810, 10156, -10593, -5397, 13773,
+    -7329, 11790, -9331, 12307, 9453, -20612, 9928, 3919, -17988, -1496, 15488, -18583,
+    2970, 1372, 2193, 1613, 13184, -7812, -10984, 17958, -18130, 13221, -6056, 5856,
+    -19412, 18635, 3726, -16207, 16634, -14717, -11529, -914, 15669, -19631, 16463, -8186,
+    -17850, 6157, 2492, 3024, -10522, 16015, -6471, 8466, -20890, -15164, -14562, -17717,
+    7817, 3408, 19717, 15435, 16355, 6732, 15422, 6640, 7279, 14530, -923, -12735,
+    -21283, -10612, -16335, 3750, -3669, 13716, -1436, -18207, 15645, -8467, 7791, 6185,
+    -4900, 3724, 7962, -11980, -2820, 9100, -10340, 8509, -6085, 9798, -7588, 8040,
+    -6978, 1061, 6064, -14844, 14110, -12770, 10319, -10135, 6815, -7080, 7573, 6229,
+    15982, 14123, -14625, 4829, -14781, 4618, -12439, 6472, -11046, 10390, -7648, -1540,
+    14317, -8735, 10212, -11410, 7172, -10677, 1055, -14740, 6434, 11738, 1907, 15430,
+    -5627, 12182, -2775, -4827, 8627, -18684, 2553, 10453, -18078, 11137, 10074, -14678,
+    10072, 10443, -10602, 10203, -17871, 8271, 11404, -15851, 5609, 12601, -9355, -7153,
+    -4607, -5032, 5114, -708, 5598, 5191, -3144, 14506, -14216, -5512, 13318, -14243,
+    -11748, 12839, -7474, -6724, 11704, -4315, -3254, 9911, -2934, -8251, 8734, 94,
+    -8252, 8069, -2939, 8767, -4737, -1529, 5100, -6408, 11821, -574, 2364, 10898,
+    8650, 2686, 8275, 7993, 6756, 4181, 5304, 11467, 3444, 5220, 9987, 2152,
+    4573, 5525, -5847, 536, 2000, -9100, 9867, -10121, -5325, 7787, -8105, 424,
+    10702, -7779, -4274, -20714, 11431, -11637, 202, 4963, -15262, 2897, 15148, -22612,
+    11164, -1791, 4323, -1075, -13541, 8633, 5475, -12411, -7387, -5537, 13665, -17079,
+    7065, -10716, 12520, -3343, -13883, -8498, -4012, -15644, -13426, -10337, -5875, -17735,
+    -13936, -12069, -7715, 1250, -20193, -18032, -15179, -1215, -13531, -10031, -563, 5870,
+    -8825, 2434, 8692, 13780, -5840, 4547, 15152, 16789, 7191, 10923, 14368, 13522,
+    3080, 7584, 10968, 13260, 1247, 1128, 4771, -2445, 2689, -12836, -7010, -10224,
+    -7233, -8810, -8315, -4047, 1705, -14054, -11727, 5486, 4539, -11233, -7356, 1544,
+    12986, 1189, 3761, 13578, 13861, 4477, 4378, 5795, 5468, -8421, -6084, -4526,
+    -10481, -19924, -15709, -17160, -14087, -10483, -14030, -10901, 4977, -14621, -17434, -8894,
+    -10802, -1403, -6966, -5469, 14647, 17120, 3295, 9726, 14199, 19999, 14256, 15507,
+    10342, 7275, -5954, 8370, 11055, 12580, 3593, 8311, 9472, 7199, 9600, -2973,
+    6014, 8310, 9435, -11971, 4590, 5092, 5188, -18564, -15667, -16499, -18109, -21439,
+    -17649, -8220, -3607, -6064, 12603, 12445, 13471, 8895, 2376, 3620, 3535, -12111,
+    -12026, -14182, 5959, -12749, -14848, 3761, 8642, 8192, -2582, 1549, 2696, 13012,
+    -8791, -3219, 13813, 611, -6680, 4251, -9816, 13840, -754, -14016, 6482, 16914,
+    -10471, -5428, 7802, 2452, -8654, -1507, -1804, 8894, -12455, 6928, -7340, -3323,
+    12422, -11724, -11733, 14402, -12866, 10302, 11934, -13630, 14883, 6019, 3489, -3543,
+    7456, -17959, 17253, -18176, 15288, 4787, -16401, 18411, -19911, 7197, 6518, -13367,
+    15299, -3978, 14179, -1123, 8059, -5697, -423, -20839, -15067, 4665, -7981, 12544,
+    13821, 5420, -1661, 14622, 7521, -4566, 2585, -1933, -9480, 550, 2782, -10199,
+    -8613, -9665, 11925, 18194, 13566, 11540, 7279, -9419, -11789, -3362, -8169, -11519,
+    6402, -9782, 10025, 8308, 6072, 11482, 573, 902, 8175, -14851, 7487, -15856,
+    -66, -6384, -2477, 7269, 2199, 11075, 4902, 7214, 2974, -6228, 3406, -11703,
+    -9187, 6945, -8088, -17950, 10305, 13191, -16162, -9787, 11430, 5891, -7709, -5547,
+    1076, 7918, 8989, -18761, 856, 17238, -837, -9653, 13594, 8212, -1954, -14258,
+    -19657, 10502, 13165, -14128, -10049, -12334, -5490, 9747, 14332, 3874, -8701, 17886,
+    -1065, -18184, 10779, -1464, 7365, -5894, -3073, 14395, -11857, -14193, -1009, 14456,
+    2094, -11663, 17438, 6609, -20904, 1770, 14301, -12125, -16439, -13565, 14789, 14422,
+    -5244, 2065, 16376, -1511, -19609, -4446, 3663, -11864, 3012, 12556, 1396, -5701,
+    -7498, -9911, -8174, -11738, 5821, 17733, 2901, -12364, 13410, 9894, -19538, 11943,
+    -11423, -15815, 13794, 10342, -20282, -17635, -4660, -15610, -16587, -13754, 2837, 14936,
+    4131, -9544, 16394, 15748, -14034, -6167, 18434, 15864, 10612, 15825, 15125, 16551,
+    8720, -9011, 11761, 11652, -15133, -7595, 15182, 9639, -10730, -9680, -8298, -11970,
+    -17538, -20184, -10586, -10197, -18039, 8286, 12402, -17993, -17508, 10104, -6459, -15253,
+    1004, 17552, 19238, 16958, 8193, 17658, 15895, -11476, -1502, 8208, 458, -3211,
+    -15899, 4973, -13243, -11155, -292, -14267, 3560, -12646, 6206, 13522, -13454, 3768,
+    7694, -12880, 3356, 1126, 15238, -9955, 14281, -15868, 7131, -11623, 10860, -5105,
+    17436, -16269, 17658, 15329, 9738, -1841, 5361, -9880, 7566, -17695, 15364, -3485,
+    2824, -7446, -788, -1692, -7879, -2487, 11585, -18463, 9442, 5537, -14313, 4645,
+    -22885, -13934, 9616, 11320, 17742, 14935, -8117, 994, 17022, 13735, -12233, -14553,
+    -14455, 5173, -16100, -20696, -7877, -15282, -7504, 7432, -1322, 17322, -5770, 6607,
+    18708, 17762, 7897, 5386, 2601, 13026, -17662, -21189, -4127, -16651, -12845, -5976,
+    -10017, 16352, -11877, -964, 19506, 12533, 13037, 10120, 11845, 16948, -16713, -16818,
+    2520, -16709, -14731, -15734, -15092, 9926, -16268, 12462, 20148, 11073, 14549, 953,
+    16040, 17649, -19664, -3923, 10262, -13699, -13296, -15720, -17497, -406, -17172, 3375,
+    20329, 3963, 12840, 8410, 17753, 16978, -12784, 16317, 15793, -18267, -6128, -14918,
+    -13495, 2146, 12182, -3443, 8891, -5806, -16904, 6335, 5838, -7431, -11961, -9371,
+    1110, 16493, 10947, -15451, 10686, 8201, 7835, 14400, -15449, -6185, 18715, -15679,
+    18799, 6992, -15122, -7119, -841, 8971, 1923, 14348, 13476, 15248, -18139, -5117,
+    -5379, -14982, 3619, -13977, 8748, 13942, -15350, 6781, -735, -2701, 2422, -17295,
+    -1323, 6173, 14918, 4145, 9393, 7529, -4467, 9471, 4731, -12661, -19106, -13203,
+    -8136, 5107, -12436, 3220, -4575, -17541, 7037, -1725, 11507, 1716, 5809, 11377,
+    806, -4080, -9059, -19288, 452, 12013, 2557, 3616, -16230, -21370, 8618, 10840,
+    -18356, -10336, -8623, -18066, -5478, -8288, 11883, 19006, 14074, 17760, 17069, -6016,
+    -1458, -20712, -20650, -19583, -19626, -962, 13066, 8890, 17569, 16465, 11595, 12954,
+    -16035, -4774, -2888, -15502, 2855, -5402, 10673, 18205, 8857, 16118, 13506, -16445,
+    -13676, -21208, -20424, -18172, -18496, 11730, 14469, 13757, 18970, 16828, 16967, 12281,
+    -17264, -5519, -18307, -18258, 3872, -4970, 17155, 16210, 14766, 14056, -11343, -18480,
+    -13678, -19692, -17763, -11832, -11840, 18561, 14318, 15881, 18404, 12999, 13276, -1523,
+    -20086, -10836, -19836, -19301, 5078, -3956, 17020, 16969, 15464, 16824, -10323, -17292,
+    -9504, -16989, -12224, 3366, -1369, 19489, 12887, 18292, 16972, -1472, 2084, -15012,
+    -20705, -20020, -19279, -9914, 13553, 9799, 19122, 18663, 15937, 16889, -9842, 4941,
+    -5393, 10291, 6093, -2085, 5723, -20089, 3093, -11686, -12206, 10219, -13153, -14319,
+    -1966, 9414, -10229, 17734, 3299, 12778, -7791, -8172, 6023, -2433, 13138, -1037,
+    4950, 6551, -17216, 3655, -8042, -16937, 15740, -6935, -7929, 17198, -7258, -1601,
+    -17288, 12031, 14079, 15756, 15003, 11028, -6999, -12698, -9957, -10960, 14957, -13211,
+    -9834, 673, -19584, 5297, 12908, -6710, 4753, 15416, -17510, 18908, -416, -10899,
+    18037, -17263, 11291, 14328, -19855, 7775, -9382, -18180, 15311, -14682, 7223, 2550,
+    -15462, 7971, -15407, 4987, 18979, -4278, 18719, -338, -16884, 18070, -8451, 6675,
+    4032, -3352, -7524, -10854, -1250, 16869, -11871, 3847, -6690, -6557, -2543, 18898,
+    -163, 3084, 13886, 3997, 1630, 1561, -14293, 6113, 12818, 14378, -12214, 2048,
+    -16591, -21153, 4470, 14446, -13024, 14076, 2247, -7236, -45, 5013, 15160, 5723,
+    10498, -14177, -15965, 12998, 5667, 16573, 12959, -4964, -14946, -14194, 18197, -10220,
+    14686, 11098, -10008, -11999, 4615, -5433, -8420, -19524, -11306, 12017, 13153, 15588,
+    16968, 17753, -11546, -7778, 8161, -15808, -17704, -12925, 5366, -19222, -13256, 19988,
+    16653, 15151, 16351, 17691, -6378, -18956, 8603, -11585, -17763, -17763, -7718, -12319,
+    -550, -8807, -13785, 8470, -5115, 17682, 11723, -636, 18415, 12613, 16864, 13552,
+    11788, 16777, 10357, 15089, 8120, 7575, 6787, -10580, -1172, -15378, -5584, -14405,
+    -22117, -18096, -20473, -12054, -18203, -17649, -17559, -14381, 15679, 609, 18596, 11857,
+    20224, 15419, 19118, 16386, 17851, 16243, 16590, 14748, 15412, 11860, 14379, 8865,
+    12373, 3910, 8993, -4777, 4012, -14390, -3384, -12866, -11212, -272, -14362, -1618,
+    -15181, -2409, -13241, 2764, -7652, 7219, -2783, 9779, 2748, 9819, 3548, 11676,
+    6824, 54, -7353, 7636, 3203, 10866, 7277, 11380, 12003, 12812, 8606, 10854,
+    5578, 10065, 2595, 8906, -1584, 5807, -9920, 361, -16747, -8849, -19994, -14924,
+    -21142, -17145, -21052, -16842, -20124, -16482, -18504, -16483, -16102, 12140, -12834, 6175,
+    -16313, 10931, -13220, 15298, -7558, 18900, 8592, 12976, 16936, -5063, 5688, -1741,
+    7785, 1709, 8983, 3801, 9824, 4598, 10017, 3971, 13428, 1789, 14785, -2486,
+    14248, -9185, 11951, 10618, -1389, -3999, -2091, -20831, -21324, -12878, -19257, -20864,
+    -10649, -8357, -13895, 7516, 13739, 6885, 12252, 15998, 7674, 3097, 8895, -8575,
+    -16017, -6987, -11268, -17830, -10582, -16956, -18225, 18869, 18980, -14966, -14863, 19231,
+    14856, -3198, -5987, -10345, -3762, 9328, -6269, -13482, 9215, 14522, -4733, -7163,
+    12946, 7287, -10210, 1940, 8267, -7907, -9403, 979, 2628, 1349, -8653, -7388,
+    13981, -4628, 9599, -10547, 12800, -1533, -2987, -196, 3909, 3239, -15045, 11141,
+    -6161, 6392, -13689, 8414, 7331, 3859, -956, -3263, 12075, -8720, 6428, -7328,
+    9298, 5057, 7699, 3146, 17168, 18269, 16214, 18388, 5958, 10108, -15687, -14326,
+    -18491, -18646, -17076, -16112, -7646, -12672, 9679, -783, 14165, 11198, 14297, 17686,
+    17494, 18138, 13447, 14023, -12337, 14950, 17519, -12434, -14864, -10176, 18126, 17970,
+    -11319, -13933, -20775, 17756, 13079, 16042, 6081, -21181, 13479, 12194, 16958, -13987,
+    -17582, -6958, 12336, 17436, -11055, -7690, -21265, 7337, 16847, -22359, 19483, -21641,
+    16096, -18221, -3382, 12193, -19343, 19508, -22498, 18960, -21636, 5468, 3683, 2173,
+    8352, -16121, 18262, -20946, 18178, -13542, -3944, 12727, -17571, 17061, -4511, -11966,
+    -12981, 8731, 17156, -19979, 7290, 18138, -15114, -8221, 8386, 13671, -17332, 12961,
+    15354, -14384, 4272, -180, 10973, -12284, 760, 10834, -8794, 7518, -11377, 12528,
+    -5873, -16051, 10045, 17, 8921, -17114, -14426, -19834, -20253, -11934, 3113, 14902,
+    -2023, 19019, 7699, -13797, 15631, -12686, -10660, 1423, 14050, 6674, 15824, 18569,
+    5190, 17897, 1469, 3757, 10502, -9553, 5546, -9841, 13277, 15905, 17492, 9010,
+    -7780, -9063, -20935, -9065, -4755, 12914, 15305, 7209, 2733, -19835, -11518, -20653,
+    -15642, 14973, 1370, 15715, 4276, -8818, -20107, -19473, -13895, -12742, 4783, 14066,
+    17288, -12274, 3534, -9546, -19342, -14776, 9327, 9011, 14706, 8038, 2691, -8435,
+    -9544, -18382, -12001, 19734, -2428, 17854, 14595, -3598, -15832, -10268, -5445, -17771,
+    19551, 4814, 15775, 14151, -7284, -10899, -18889, 2302, -15598, 19378, 7559, 7316,
+    17676, -19726, -14452, -18799, 10068, -13819, 15476, 18516, -12653, 14656, -20229, -15382,
+    -17867, 577, 9478, 14719, 18260, -14418, 17160, 6130, -9425, -6923, -18973, -16015,
+    -12918, -414, 5813, 14314, 15196, -12602, -15854, -16102, -11609, -5921, -18160, 17492,
+    5791, 11462, -17095, -16079, 4886, -8107, -9559, -16578, 18223, -3725, 8155, -9688,
+    -20987, 11366, 1050, 2755, -6030, 15846, 8629, -19458, -14003, -21485, 16040, 10618,
+    -456, 17854, 14871, 5942, -21173, -14131, -12706, 12954, 18007, 15066, 18112, 13673,
+    11236, 9369, 8360, -4025, 8868, 16032, 2582, 16134, -10333, 6993, 3017, -9755,
+    2038, 8859, 14024, 18364, 8636, 18097, 8894, -7280, 5964, 14054, 13245, -8766,
+    15204, 9971, 18441, 5374, 17562, 16423, 13708, 14908, 14415, -20454, 2156, -21976,
+    -22114, -8637, -19967, -17702, 1259, -8045, 610, 17508, 12672, 16484, 17661, 14398,
+    15006, 4339, -3635, -22017, -17003, -15771, -19570, -10644, -14710, -8878, 10043, 6077,
+    13241, 18998, 16105, 17040, 17073, -7402, 8461, -18997, -21211, -19339, -17284, -18053,
+    -13023, -7263, -10367, 9667, 14196, 16290, 15742, 18153, 14269, 8977, 15466, -22530,
+    -10293, -21839, -20781, -8772, -19406, -1903, -15446, -9940, 16503, 14667, 18615, 13591,
+    12990, 15571, 9654, -7392, -19697, -21464, -15265, -20417, -10699, -18194, -14692, 9056,
+    -7009, 20035, 7943, 18960, 18139, 8791, 17239, -19513, 2277, -13470, -21027, -15430,
+    -19354, -10513, -8461, -6151, 9522, 17154, 17080, 19109, 15275, 17995, 14136, 13089,
+    9819, -19646, -16614, -20831, -12673, -14048, -16341, 11098, -11438, 20018, -8638, 6538,
+    13878, 6470, 18304, 4104, 10749, 9352, -6870, -6225, -16318, -18868, 2771, -6380,
+    -1433, 11199, 1432, 17796, -1950, 14597, -20084, -16600, 5194, -16198, 13529, -3702,
+    13916, 10807, -9056, -7546, -17205, -1319, 3637, -18822, -5862, -15356, 12216, 10563,
+    -11101, 7399, -12282, 7051, 12170, -1873, 11815, -9599, 7023, 14571, -7607, 5950,
+    -8313, 12448, 1779, -215, 14001, -855, 14814, -8111, -900, 15892, 8994, 18179,
+    10866, 16167, 6915, -10266, 10714, -5549, -3325, 13446, -18919, -11312, -20074, -19684,
+    -9797, -17329, 1981, 9018, -9972, 4851, -11559, 9842, -7171, 14200, -6851, -17349,
+    -5114, -15400, 2404, 7440, -7779, 20160, 16115, 18864, 18205, 14210, 16945, 10027,
+    -1584, -13357, -21861, -16226, -20466, -14838, -13846, -12820, 11135, -584, 17750, 11869,
+    12947, 18371, -8163, 8802, -11878, -13429, 3938, -14224, 3552, 8251, 9696, 16797,
+    7931, 14958, 1971, -4250, -14307, -21928, -16248, -20590, -20033, -14242, -17814, 16279,
+    9742, 15328, 18964, 14979, 17705, 13789, 14018, 11597, -8075, 7370, -14651, 823,
+    -3462, -414, 12009, -6108, 8020, 6133, -14980, 1001, -21483, -15722, -15397, -19358,
+    -13829, -18159
+};
+
+static constexpr int16_t SID_OUTPUT_REFERENCE_8580_FAST[] =
+{
+    484, 890, 127, 1297, -1291, 2058, -1296, 1231, 601, 433, 1662, -2120,
+    4209, -4315, 4093, -2187, 1061, 694, -633, 3944, -5216, 6738, -6009, 4518,
+    -1494, 706, 1108, -2471, 5288, -5968, 6085, -4235, 2461, -106, 267, 2261,
+    -3628, 5565, -5279, 4545, -2280, 956, 239, -677, 3250, -4126, 5273, -4107,
+    2985, -786, 273, 858, -2120, 4373, -4662, 4928, -3028, 1693, 20, -83,
+    2022, -3458, 5050, -4593, 4048, -1704, 661, 208, -1163, 3300, -4439, 5164,
+    -3925, 2819, -489, 290, 970, -2545, 4360, -4860, 4713, -2767, 1557, 4675,
+    -11032, 12229, -5825, -8602, 14239, -16000, 15875, -15063, 9877, 809, -9669, 13708,
+    -15671, 15857, -16081, 13923, -9027, -355, 9204, -13434, 15278, -16046, 15881, -14771,
+    10624, -2389, 15916, 7403, -12555, 2992, 11753, -8882, -7602, 11530, 868, -11122,
+    7666, 8675, -10810, -1441, 11404, -6448, -8885, 10721, 3304, -11423, 5992, 9609,
+    -10228, -3787, 11643, -4607, -10036, 9971, 5350, -11542, 4029, 10471, -9377, -5942,
+    11495, -2379, -10717, 8991, 7046, -11368, 1651, 11017, -8256, -7583, 11215, 315,
+    -11221, 7743, 8397, -11009, -1134, 11361, -7010, -8797, 10820, 6714, 8202, 8937,
+    8989, 8376, 7068, 4985, 2009, -1900, -5283, -7683, -9233, -10046, -10191, -9690,
+    -8519, -6607, -3845, -104, 3622, 6296, 8068, 9066, 9375, 9031, 8024, 6293,
+    3739, -6806, -11030, -3155, 7186, 6763, -5115, -10967, -4114, 5524, 9975, -6721,
+    -8067, -9244, 7075, 7318, -2022, -8940, -8499, 9845, 2712, 6922, -11737, -367,
+    -1886, 4571, -1036, -6167, -6323, 5904, 5000, -8254, -2711, 6950, -1196, -9019,
+    2490, 6538, -6796, -6032, 6022, 4071, -8165, -344, 7656, -1895, -7286, 4195,
+    6731, -6761, -5145, 5040, 3287, -7620, -778, 6649, -2613, -6751, 3058, 6314,
+    -5561, -3781, 6238, 2659, -7625, 113, 7196, -3177, -6547, 3727, 5304, -6670,
+    -3112, 6655, 2329, -6988, 858, 7457, -3657, -5566, 5134, 4966, -7186, -2834,
+    6501, -248, -7379, -3138, 8380, -1486, -7862, 3864, 8084, -6105, -5695, 8010,
+    4022, -7822, -1515, 8556, -3041, -8167, 4192, 7393, -6835, -5096, 405, 4439,
+    -930, -4035, 3874, -3182, -1894, 3891, 978, -3918, 728, 3942, -1645, -3300,
+    2877, 2700, -3372, -1448, 3882, 4706, -8691, -1399, 8957, -1797, -8640, 4968,
+    7760, -6844, -6021, 8229, 3729, -8943, -403, 9750, 7396, -14873, -10250, 2916,
+    9913, -5823, 2600, 4410, 11603, 10553, -6388, -7321, 8011, 9657, 9006, -16123,
+    -9240, 10093, 9629, 6879, -10874, -4352, 12693, 9603, -14548, -9684, -6178, -2438,
+    -776, -810, 12572, 7648, -67, 12246, -8315, -12506, -782, -10226, -8246, -4551,
+    5596, 9268, 3062, 6537, 3849, -6953, -1577, -4368, -2578, 8209, 3084, -611,
+    12412, -10245, -9589, 1595, -11337, -8132, -5819, 7017, 8765, 5036, 10672, 4022,
+    -1321, 3517, -10696, -8341, 9414, 224, -2193, 4459, -3874, 1943, -339, -9068,
+    -1143, -7590, -3251, 12329, 3519, -9478, 13332, 2900, -10790, -13127, -15632, 803,
+    540, 11875, 12391, 12940, -923, 1957, -8451, -5696, -7072, -9727, 13632, -10514,
+    9181, 8357, 14686, -8510, -452, -8293, 6707, -6360, -11910, 11741, 6582, 1863,
+    -1204, 15138, -10237, -7160, -13200, 13466, 9391, -13785, 2476, 11036, 10072, -8183,
+    -6759, -10933, 6340, -12616, 3278, 7829, 6004, 10590, -2190, -9691, 3573, 6449,
+    -14555, -6166, -198, 16080, -8474, -11254, 13261, 9028, -5449, -12685, -7643, 1864,
+    3870, -11017, 10775, 10364, 6992, 1152, -2708, 2311, -12733, -10177, 2589, 13025,
+    5712, 10522, 5969, 4288, 8136, -3995, -8210, -11581, -425, 10, 7061, 3480,
+    12709, 8746, -1089, -7319, -4650, -528, -13255, -5858, 6952, 13201, 1072, 10519,
+    12602, 4135, -9510, -17045, -9612, 6551, 1505, 8637, 8255, 7674, 4784, 12283,
+    11302, 1268, 15330, 3379, 9887, 13007, 5796, 13561, 799, 11325, 9511, 64,
+    13011, 2974, 5806, 12561, -5009, 10927, 8747, -4873, 15188, -2870, 1885, 13407,
+    -10384, 12390, 1791, -10767, 14019, -3491, 2529, 13019, -10594, 11367, 4250, -4888,
+    13767, -5774, 9618, 5412, -3698, 12163, -6695, 8419, 7590, -6024, 12275, -2066,
+    -12165, 10125, -9860, 12795, -4825, 5214, 9067, -9360, 8300, 2334, -2075, 10148,
+    -7156, 6613, 5655, -6350, 7074, 6090, -6060, 9874, -4233, 3520, 9099, -10523,
+    7949, -1322, -3251, 8855, -9589, 5147, 2519, -8622, 10529, -9631, 4081, 6314,
+    -12443, 10916, -8290, 1154, 8492, -12850, 8840, -5878, -3199, 5261, -12698, 5942,
+    -5252, -8269, 6861, -13798, 1359, 3260, -17523, 3580, -14923, -11807, 7915, -16091,
+    -7346, -2800, -16950, 1123, -13260, -11822, 2808, -15948, 150, -10955, -12791, 182,
+    -15024, -1360, -9106, -12898, 2145, -14191, -5424, -4883, -13868, 1821, -11992, -9462,
+    2528, -9378, -17095, -11603, 4505, -5817, -14660, -7474, 5109, -10951, -2344, -3294,
+    -11549, -8961, -1974, -6862, -9949, 2160, -12607, -9913, 5686, -4662, -12970, -2047,
+    -6226, -15298, -3274, 7065, -13282, -4305, 6733, -11272, 1034, 5522, -9359, -9000,
+    4944, -1564, -1408, 5683, -7756, -9630, 2131, -1550, -10359, -3649, -9744, -2711,
+    2510, -8175, -8709, 6952, -7752, -10284, 8166, 9142, -10123, -7347, 11546, -11104,
+    -7004, 10018, 6631, -6476, 9878, 14410, -2618, 10403, 10011, -1525, 4607, 12247,
+    5276, -3770, 11063, -3041, 2276, 10720, 2307, -8702, 3668, -3966, 4916, 8277,
+    -1957, -14764, -8410, 10002, -10559, -16488, -6548, 4515, -10262, -13723, -5025, -3919,
+    -11868, 1200, 7580, -11972, -13031, 6999, 14299, -12057, -10626, 6225, -3733, -12015,
+    13501, -823, -14253, -2150, 15387, -6919, -9722, 9488, 9071, 753, 1472, 15763,
+    -4437, -2333, 17247, 13064, 13537, -6973, 7285, 6441, 136, 14386, -1669, -4679,
+    10769, 16575, -2619, -7213, 16861, 8574, -13979, -9284, 7481, -6204, -14414, 11488,
+    702, -16997, -3951, 9917, -6267, -12783, 6905, 4302, -16410, -8677, 10065, -13493,
+    -9397, 12489, 9476, -8421, 2354, 10464, 8242, -4577, 15125, 5632, -9092, -11782,
+    6429, 13886, -6930, -12297, 6482, 15959, -11036, 9100, 14189, -4601, 1155, 5054,
+    -2821, 6680, 6903, -6101, -8403, 6254, 5905, 1424, 11422, 4829, -7819, 4147,
+    9938, 1879, -10916, 7170, -11644, 13314, -7359, 6752, 10323, -4397, -2087, -7656,
+    16643, -13213, 322, 2212, 13873, -15122, 1616, 14373, -14786, 5691, 2188, 11214,
+    -14726, 12952, -9044, 3262, 13284, -12208, 13517, -12383, 13628, -6549, 6758, -4760,
+    4578, -2477, 2688, 10405, -9327, 10025, -8467, 9603, -8643, 9530, -13768, 14317,
+    -13875, 5203, -5296, 6788, -6700, -5359, 6580, -4086, 2692, 7352, -2566, 5770,
+    4376, -1970, -11221, 15769, -14195, 7040, 5105, -4219, -8111, 555, 2595, -6979,
+    11552, -12546, 11603, -6141, 1922, -2565, 10462, 452, -690, 5933, -7430, 11825,
+    -13602, 5520, -1509, 5267, -10744, -3166, 10539, -9766, 4891, -280, 10907, -12965,
+    3051, 2254, 11877, -14541, -9309, 12901, -11639, -4201, 3244, 11498, -13474, 5987,
+    -621, 3774, 4168, -1946, 1864, -10626, -7895, -6115, -14074, -8873, -15708, -11007,
+    -579, -9954, 1683, 14752, 10012, 15390, 9708, 14246, 16694, 9795, 11111, 12643,
+    -5095, -2851, -219, -12445, -11726, -16776, -10893, -13658, -12767, -1666, -11032, -4689,
+    10706, -3075, 9473, 12258, 56, 12266, 10809, -173, 11246, 4907, -3996, 7627,
+    -5681, -7960, 4328, -8852, -6195, -1112, -10812, -4306, -2504, -9957, 6348, 8895,
+    10817, 12322, 11859, 12268, 12830, 10783, 11367, 11685, 11890, 11484, 10907, 9717,
+    4899, 3306, 357, -470, -2724, -2199, -2288, -2171, -5260, -7217, -11290, -10416,
+    -11619, -13406, -15496, 4507, 14441, 9949, -14741, -14985, -3895, 13541, 2143, -7163,
+    -9169, -4357, -8171, 6676, 627, -5107, -14584, 2621, 12626, 8908, -5846, -16069,
+    -277, 10238, 13529, -6660, -12112, 11679, 5941, -13523, 2116, 9631, -1076, -11771,
+    6492, 5153, -3611, -6252, 10480, 4582, -10938, -9146, 12673, -1836, -9927, -1980,
+    8067, -10688, -1714, 13250, -9925, -14092, 12704, 14327, -14982, -12567, 13681, 6653,
+    -15028, 3022, 12111, 90, -13122, 6300, 10511, -10703, -12951, 12904, 6527, -11519,
+    -9325, 4077, -6306, -4149, 2379, 4023, -9574, -9401, 3195, 6663, -15735, -3276,
+    17546, 13551, 14774, 15941, 16847, 11087, 9861, 8225, 7535, -6636, -7821, -8200,
+    -11500, -17732, -16953, -16188, -14465, -18512, -15952, -10595, -6643, -18139, -13357, -8998,
+    -7655, -9624, -5969, 3333, 13160, 14857, 10568, 13549, 16932, 17819, 13780, 11807,
+    12708, 10053, 3231, 4302, 4988, 6535, -8664, -6150, -8801, -7753, -15570, -12831,
+    -11294, -8675, -16641, -14915, -8716, -5483, -14386, 11605, -7957, 3392, 4738, -13166,
+    12638, -2448, 10469, 4699, -8791, 12744, 4548, -3675, 8561, -7778, 13480, -10539,
+    -2222, 9088, -10481, 9248, -9847, -4191, 14435, -15826, 10679, -3100, -8891, -1509,
+    7717, -10196, -3245, 7481, -3384, -10731, 7749, 384, -10606, -4242, 9772, -745,
+    -12217, 3625, 10810, 1600, -10764, 8892, 6016, 3885, -8498, 3783, 3893, 5566,
+    -1437, 7905, 4100, -11689, 7439, -2572, 10438, 5509, -13435, 14620, -8602, -13866,
+    12313, -1110, 3376, 3979, -3373, 15845, -5498, -15853, 17491, -1725, -17251, 5578,
+    10232, 8709, -4219, -9982, 14845, 14866, -8066, -16960, -2345, 8254, 4941, -8793,
+    5150, 13262, 7460, -2223, 7494, 9911, -3500, -12031, 1649, -8222, -11464, -4184,
+    7664, -11216, 4016, 17291, -4749, -8098, 5395, 7381, -9676, -14227, -9873, -3451,
+    4694, 9644, 13507, 13901, 13685, 10042, -4212, -11054, -14730, -16216, -16336, -13353,
+    -5878, 2303, 6667, 9563, 11304, 12107, 10244, 6420, -20, -6140, -9239, -10841,
+    4830, -6948, 10345, 2801, -5247, -2654, -9354, 14202, -7222, 2695, -5660, -4205,
+    2476, 11739, 12403, -15106, -3033, 9718, -7093, 9119, -3519, -9404, -514, 6830,
+    5909, -8340, -680, -6418, -10635, 13569, -8397, 5622, -7852, 2849, -2296, 6531,
+    -3284, -2561, -7132, 3035, 4272, 2899, -5530, -309, -6799, 4060, 6469, -115,
+    -13532, 10803, 2217, -3543, 4557, 2234, -14040, 6610, 15784, 8082, -5055, -7450,
+    -3261, -1482, 8106, 8199, 7123, -5302, -5045, 9001, -8, -7521, 7060, -525,
+    -9356, 5912, 2584, -9938, 9480, 8777, -12159, 2031, 14299, -3933, -3736, 3335,
+    -10981, 2982, 18179, -1683, -13473, 631, -8664, -13672, 7500, 15436, 14582, 8931,
+    -12490, -12970, -8372, -16159, -10710, 17793, 15821, 4671, 2715, -1367, -13271, -13586,
+    -14596, 4620, 16429, 9958, 4336, 15178, 3523, -17809, -14064, -4203, 190, 5980,
+    9871, 13421, 15792, -7998, -16737, -3811, -6051, -15923, 577, 16838, 12968, 7797,
+    -2045, -6743, -5606, -14845, -16753, 10741, 13253, -12040, 4570, 166, 17654, 2303,
+    12000, -4973, 9680, 12454, 11012, 6375, 15351, 7124, 11666, 4260, 10082, -15043,
+    4851, 5365, 1797, 6569, 9519, -5975, -7265, 10156, -8975, -1506, 3326, -11441,
+    -13362, -9428, -8097, 9181, 1716, 11123, -10153, -4605, 5807, -6327, -744, 11480,
+    -14842, -7611, 6116, 13979, 3009, 10397, -17381, -7087, 11761, 4427, -10146, -1273,
+    -11475, 2537, -2816, 3998, -143, -12707, -3091, 15950, -3171, 2883, -10725, -12743,
+    13842, -4857, 8645, 10803, -11561, 12894, -1958, -4380, 12830, -11887, 4769, 14748,
+    -13248, 9733, -10067, -10515, 16016, -5501, 1667, 8914, -16501, 15094, -4730, -1665,
+    11013, -11088, 10738, 16948, -13238, 3600, -11018, 6071, 14058, -13610, 5085, 12530,
+    -16270, 11261, -6427, -40, 8745, -16405, 10982, 14294, -12696, 6025, -12187, 9181,
+    12231, -12522, 5425, 7666, -15600, 11523, -8213, 4527, 5724, -14791, 11121, 10058,
+    -17627, 6334, -13441, 11500, 9973, -13255, 5666, -1155, -13977, 16817, -9998, -14514,
+    -2053, 15241, 4458, -3989, -12980, -12994, 3190, -89, -7482, 12553, -14344, 5853,
+    10135, 4030, 9816, 3921, -11722, 4223, 4300, -7032, -10793, 9837, -6915, 14667,
+    12496, -17029, -4113, 6528, 10433, 314, -11703, 10743, 17708, 7508, 7454, 8166,
+    4427, -9529, -3095, -12415, -12028, -11088, -6637, 718, -6843, 2319, -3027, 5781,
+    -7096, -5396, 15542, 16307, 10134, 8206, 7678, 10364, 12356, 14754, 2417, -6363,
+    -14981, -12314, 11076, 4005, 9221, 5595, -13704, -5888, 1238, 6690, 17300, 9227,
+    7514, -14465, -8045, 8797, 9264, 9144, 3643, -10029, -17657, -8481, 13392, -11302,
+    -1784, 7191, -3107, -1943, 8322, 7795, 1064, 13522, 11570, -6773, 318, -1091,
+    -1472, 380, -13179, 1919, 4137, -14287, -13019, 8063, 12439, 8209, -9554, -3552,
+    8388, -3309, 1779, 10700, 12433, 9352, -8943, -5019, 1230, 3165, -7382, -9807,
+    3580, 6832, -5985, -16345, 2100, -2645, -3090, 4075, 4503, 11211, 5765, -1692,
+    -2249, 5231, 10928, 1145, 2469, 4377, -7440, -10223, -15784, -13932, 9930, 3709,
+    -7406, -12483, 5748, 11234, -6852, 5012, 13216, 12655, 10201, -4185, -3789, 8626,
+    -9457, -13193, -4599, 3928, -8659, -13767, -12860, 5697, 14271, -9764, 9250, 10771,
+    -6167, -83, -4812, 11893, 12217, 1996, 4293, -9894, -2905, -6263, -11895, -3257,
+    1476, 9339, -1891, -14863, -3686, 6622, -8209, -10029, 5009, 10549, 6959, 256,
+    15058, 11540, 3057, 843, -6311, -10228, -10513, -10076, -11449, -6170, -3, -851,
+    14738, 15675, 10513, 15446, 9251, 8401, 6048, -10777, -2238, -13926, -15111, -7907,
+    -10183, -5363, -4468, -12582, -8137, -10276, -14026, -7258, -9441, -6861, 4698, 9043,
+    -4107, 7063, 7877, 5674, 11744, 996, 973, 9470, -4560, 6993, 4255, -11388,
+    -967, -10541, -8800, 6151, -5200, 12956, 15269, -7352, 15363, -4823, 6018, 11336,
+    -5447, 11438, 3685, -6097, 5896, -11963, 4107, -6045, -13762, 4252, -12792, -9964,
+    5008, 2891, 1024, 8775, -6032, 10168, 8180, 10519, -1708, 2275, -4321, -4484,
+    5249, -2353, -15397, -11135, 412, -1956, -2230, 2375, 8570, -8269, -4537, 16999,
+    -733, -11190, 8632, 9553, 6294, 11466, -3619, 194, 10666, 1624, 1255, -13094,
+    -16608, 4856, 15721, -16005, 8497, 11332, -7498, 12448, -11042, -1179, -215, -16608,
+    7320, 2955, 2421, -1012, 3726, 7710, -13915, 10389, -1821, -2351, 26, -13086,
+    14440, 3500, 4484, -7918, -3861, 3916, -14115, 12688, 5341, -6385, 6778, -13419,
+    3206, 4409, 10220, 9792, -15859, 11764, -951, -9668, 10987, 1749, 15020, -11841,
+    5271, -3942, -3958, 7816, 6350, 6671, -3036, -8558, 9846, 6917, -8340, -5661,
+    -15718, -3548, -3857, 12040, 5090, -10783, -8581, -13109, -2044, 124, -287, 12424,
+    11110, 11466, -2587, -10687, 4993, 8910, 16729, 12695, 2904, 2316, -10634, -2600,
+    -8819, 8090, 9065, 12357, -12393, -6342, -9841, 13299, 10902, 15192, 4751, 4987,
+    -10669, -219, -2798, 12447, 9852, 12579, -1266, -2485, 3092, -2420, 11983, 11787,
+    15496, 9260, 7804, -8335, -665, -2193, 11749, 11314, 14360, 6660, 5113, -9400,
+    177, 248, 12145, 10547, 12916, 2550, 181, 2160, -423, 9323, 10242, 13618,
+    -4266, 1703, -3767, 8303, 6537, 10996, 3471, 6652, -17303, 3698, -15860, 10894,
+    -10903, 12256, -15299, 5708, -19000, 4185, -15942, 10873, 2663, 9954, -7548, 620,
+    -12724, -14958, 11227, -7294, 13151, -10675, 7407, -16753, 3490, -14362, 10503, -8618,
+    13075, -5547, 7859, -16622, -5435, -16918, 5968, -6838, 1082, -11676, -6659, -5372,
+    9332, 8603, 10836, -1928, -5389, -14024, -6330, -4950, 10030, 6436, 8558, 6487,
+    -17437, -4373, 13164, -12681, 5201, -9477, 11260, -16855, 10162, -4824, 819, -10148,
+    11905, -10334, -1046, 4766, 942, -9338, 4053, 3914, -12221, 5544, -1069, -183,
+    -9646, 11940, -12448, 6424, -6274, 14592, -18963, 16053, -10708, -8932, 9777, -10258,
+    9163, -13153, 12461, -9467, -5694, 10668, -12114, 7247, -9272, 9201, -10516, -3016,
+    11024, -15008, 10571, -5539, 2503, -3339, -2151, 9657, -15602, 13540, -12797, 5626,
+    3145, -10447, 11961, -14488, 12512, -12153, 7779, -1294, -6699, 7861, -9713, 6102,
+    -3533, -3468, 5254, -7474, 4472, -2644, -2407, 6360, -10556, 10806, -11798, 8312,
+    -9561, -16085, 10958, 4650, 16855, -3749, -15872, -12130, 13122, 11714, -17836, -13744,
+    5934, 17361, -7719, -13703, 2592, 15554, 9231, -17398, -12687, 8308, 16009, -18783,
+    -14357, 6591, 16154, -622, -8919, 8228, 3886, -12277, 9329, 10102, -13900, 16161,
+    -17283, -3737, 18523, -18162, 14451, -7310, -11761, -5973, 16819, -5074, 7003, 2453,
+    -19297, 18079, -14359, -8268, 15125, -18823, 4005, 12072, 2312, -18824, 6911, 17796,
+    -18362, -1016, 12285, 5645, -18797, 3730, 17821, -17491, -8963, 12101, 10911, -18770,
+    -3234, 17850, -16331, -13069, 12349, 14827, -13037, -11943, 17882, -14293, -13037, 6406,
+    13863, -1605, -16712, 12406, 11645, 6391, -18684, -1694, 17176, 5002, -1213, -15234,
+    9673, 3356, 8447, -4474, -14307, 14939, 9944, 1772, -18648, -10125, 17223, -2010,
+    -5543, -13453, 7341, -17633, -18659, -10704, -18636, 6091, -17140, -7653, 11352, 10425,
+    -9847, 6857, 18001, -11289, 17723, -8607, -16431, -5154, -12506, 14731, -8444, 7283,
+    16984, -16657, -12824, -11045, -7807, -15133, 16784, 11682, -2741, 9209, -13261, 2503,
+    -2611, 12415, 14766, 11717, 5525, -6511, 8796, -18449, -7688, 6557, -14850, 9121,
+    8191, 4333, -11102, -7713, -10614, -17028, 5143, -13014, 7177, 12633, 12611, 17449,
+    -11365, -3472, -16289, -12803, -17762, 9255, 11348, 12594, 18138, -11942, -6586, -17516,
+    -18497, 10455, 12593, 12571, 12614, 18127, -9734, -16572, -4413, -16267, 9357, 12605,
+    11447, 12128, 6046, -10863, -17387, 1057, -5761, 11159, 18126, -1959, -62, -12007,
+    -12787, -16973, -7504, 16724, 5814, 18115, -1114, -9440, -14857, -18527, -12615, 5622,
+    17750, -2811, 18088, 6909, -8807, -12805, 12588, 11722, -18503, 4753, 11138, -16862,
+    16439, -12408, -9993, -112, -6693, 4536, 10374, 2462, -17401, 10728, -12391, 17655,
+    -12452, 4944, 16649, -14262, 13899, 12586, -9646, 17832, 9986, 1355, -3545, -9094,
+    10367, 2030, -9198, -406, 6584, -18520, 15859, -17763, -13134, -10699, -2214, 8147,
+    -16035, -7195, 12175, -8070, 14994, 10428, 11245, 9988, 11053, 12576, 62, 15108,
+    12561, 18077, -15113, -12852, -6771, -725, 16302, -13260, 10458, 10575, -12637, -12820,
+    9943, 18098, -18521, 12182, 10537, 7333, -12809, -13664, 3432, 209, 17016, -13507,
+    -12171, 2240, 12566, -15819, 8225, -13373, 9219, -7030, -1662, 15355, -16916, 13523,
+    4050, -17782, 18576, -16945, 11590, 2859, 10023, -9305, 9288, -7745, -12343, 18133,
+    -17308, 14986, -4875, -90, 9403, -13180, 14229, -16544, 17485, -13535, 15572, -11716,
+    10466, 1571, -534, 11394, -16053, 17289, -14161, 7342, 10937, -14638, 16125, -14633,
+    12918, -15649, 16856, -18386, 16442, -2381, -5790, 12578, -15173, 12621, -15706, 1900,
+    10762, -11427, 18606, -19327, 7086, -10702, 10472, -10916, 10699, -15501, 13096, -2697,
+    -11394, 11201, -19154, 16245, -11378, 13060, 3193, -17213, 12895, -18559, 18222, -18773,
+    12290, -5303, 160, 11518, -18587, 18024, -12954, 12144, -1342, 11674, 3592, 11383,
+    -14501, 5370, 8159, -12885, 17969, -16072, 14267, -7094, -12842, 17976, -18588, 18004,
+    -18660, 18034, -12277, 12548, -11941, 7458, -2898, -14488, 10136, -7836, 10799, -7698,
+    -4910, 315, -12078, 12535, -12825, 12151, -16483, 13031, -7758, 123, 7016, -18474,
+    18049, -18560, 18092, -13030, 5406, 8040, -15084, 17113, 12496, 9689, -11118, -3596,
+    16407, -13994, -328, -7912, 8950, 12984, -16012, 12767, 14584, 6684, -2270, -14010,
+    13107, 13466, -14759, -9975, 11935, 10523, -12876, -4271, 18063, -15494, -12835, 4309,
+    9537, 6700, -16552, 11830, 6314, -13686, 5793, 12558, 103, -18557, 9050, 18069,
+    -18539, -3743, -13710, 6395, 11087, -16126, 7510, 7730, -18515, -8103, 12573, 11285,
+    -18541, -2744, 18072, -11112, 15462, -10260, -6491, 13224, 1410, -6638, -16913, 18169,
+    10762, -18488, 13688, 12523, -12284, 6898, 6987, 2019, -14805, 14257, 11649, -15871,
+    -4816, 12606, 5596, -12803, 8832, 17589, -18544, 9637, 15094, -13682, -2272, 6389,
+    9643, -16145, -11235, 18111, -13728, -12723, 12115, 8177, -7673, -2258, 14293, -14816,
+    -11984, 15431, -8688, -12780, -6198, 12634, -8080, -18042, 18201, 2385, -15521, 7739,
+    6417, 13319, -12731, -7204, 5503, -10582, 7360, -4737, 10254, 7099, -10542, 6765,
+    10688, 15781, 3440, -16191, -2999, 1106, 15824, -8498, -18492, 6880, 12573, 16630,
+    -4956, -18569
+};
+
+static constexpr int16_t SID_OUTPUT_REFERENCE_8580_HIGH[] =
+{
+    0, 447, -120, 787, 549, 489, 985, -853, 2603, -3016, 3176, -2090,
+    1210, 398, 113, 2445, -3764, 5420, -5501, 4322, -2297, 776, 559, -1784,
+    4651, -6140, 6455, -5367, 3339, -986, 598, 1377, -3245, 5310, -5891, 5179,
+    -3464, 1531, -225, -197, 2553, -4113, 5192, -4856, 3477, -1651, 412, 133,
+    -1529, 3624, -4657, 4957, -3822, 2185, -633, 167, 1119, -2962, 4560, -4894,
+    4346, -2602, 1036, -260, -639, 2430, -4163, 4987, -4504, 3299, -1314, 381,
+    209, -1954, 3670, -4878, 4832, -3575, 2056, -378, 125, 1301, -3348, 4723,
+    -3312, -7180, 14630, -16228, 15437, -10567, -1038, 10323, -14548, 15553, -16205, 15458,
+    -12214, 4890, 5923, -11856, 14436, -15967, 15822, -15904, 12607, -6532, -3974, 10646,
+    -14196, 15462, -16120, 12939, -8909, -7425, 12362, 452, -11352, 8234, 8591, -10898,
+    -695, 11382, -6513, -8802, 10799, 2489, -11436, 6052, 9555, -10511, -3296, 11345,
+    -4758, -9946, 10144, 4728, -11592, 3763, 10341, -9674, -5477, 11311, -2513, -10759,
+    9087, 6535, -11448, 1574, 10866, -8452, -7292, 11130, -216, -11233, 7778, 8105,
+    -11150, -753, 11181, -6906, -8754, 10770, 1906, -11515, 6310, 9273, 10496, 8933,
+    6652, 3517, -651, -4978, -7845, -9547, -10327, -10331, -9631, -8226, -6045, -2948,
+    1271, 5357, 8113, 9796, 10609, 10689, 10105, 8865, 6917, 4146, 386, -4102,
+    -7354, -12080, 2531, 9076, 2356, -11984, -10508, -319, 11549, 3377, -9489, -11104,
+    555, 11075, 3601, -3346, -12403, 5384, 5036, 8152, -8847, -10062, 3066, 4876,
+    7640, -8336, 3524, -6971, 8229, 5670, -6212, 5914, -6118, 4157, -2659, 1788,
+    -785, -1353, 3276, -3772, 4626, -6036, 7002, -7300, 6412, -5787, 5703, -4496,
+    2693, -1006, 573, 3405, -4777, 6572, -7159, 7039, -7384, 7635, -6666, 5342,
+    -4365, 2589, -1204, -794, 2972, -3792, 4891, -6366, 7398, -7322, 7200, -6466,
+    6321, -5197, 3400, -1904, 1086, 927, -2926, 4386, -4971, 5473, -6597, 7365,
+    -5796, -162, 5302, -6438, -210, 4016, -5250, 2564, 2884, -6424, 3762, 3174,
+    -7014, 4525, 1004, -4393, 5022, -1719, -2397, 5559, -4108, -1916, 10100, -9197,
+    430, 7826, -9814, 7929, 1187, -9253, 9678, -2270, -7007, 10512, -5507, -4049,
+    10234, -8164, -651, 8922, -9994, 8096, -8435, 2315, 5978, -9188, 4980, 3451,
+    -8905, 7036, 577, -7601, 8455, -2377, -5580, 3520, -4924, -9706, 942, 1123,
+    12116, 5128, 6317, -6176, -9249, -2137, 5557, 13677, 2421, -2897, -8216, -9156,
+    -7405, 10028, 10090, 14286, 13838, -11105, -4018, -10899, 11946, 1043, -7150, 4352,
+    9918, 1761, -375, -613, -7490, -3906, 4573, -2359, 2702, 9716, -6285, -5535,
+    52, -8845, -8422, -1917, 1860, 5909, 9265, 5110, 6562, 8741, -10415, -8082,
+    -1046, -9157, -3753, 4335, -1121, 3477, 8402, -7031, -4066, 5016, -10071, 650,
+    8888, 2359, 4061, 11224, 5404, -10116, -2423, -9308, -10166, 28, -8050, 2694,
+    12025, 3181, -1107, 9986, -3110, 15932, 7065, 7838, 7251, 12130, 13172, -7454,
+    -4867, 10141, -2651, -6952, -1972, 1446, -4293, -2865, 3094, 10682, -11678, -1627,
+    4408, 7764, -516, -10162, 7829, -983, 9, 4247, 12583, -6757, 6749, 5138,
+    12059, 4644, -10965, 9527, 2350, -2319, 3076, 10432, -4907, 5255, -1317, 11830,
+    5683, -11001, 8673, 1040, -2184, -2361, 5314, -3173, 754, -7658, 10689, 5262,
+    -12385, 9777, -9022, 13582, -14883, 15062, -8207, 2708, 5670, 4291, 6881, -2218,
+    -5169, 2064, 7081, -13306, 13649, -9151, 3575, 2648, 2496, 7299, -1974, -10638,
+    7002, -4722, -9219, 9845, -6125, 365, 3323, -3759, 10133, -9627, -5531, 2375,
+    -3839, -5755, 5402, -10141, 8311, -4858, -3922, 8433, -13574, 660, -4959, -5263,
+    -4653, 4659, -12274, 13303, -9687, 1725, -565, 4943, 12499, -1553, 10723, 12604,
+    1404, 13654, 1761, 9423, 10781, -1312, 11698, 991, 7836, 8612, -1351, 9832,
+    2787, -2301, 10521, -4527, 6019, 7351, -10823, 10057, 370, -10050, 12236, -12634,
+    6047, 6593, -9668, 9427, -2459, -6147, 11860, -15316, 8192, 3629, -4415, 11072,
+    -9140, 4674, 5364, -6849, 8446, -2842, 2705, 7427, -10229, 8490, -2128, -5218,
+    9696, -12564, 9750, -3527, -4316, 10269, -11516, 7547, 10186, -17214, 7897, -2919,
+    -3082, 7356, -11238, 6211, 2208, -7236, 8320, -9305, 3390, 5667, -18378, 7688,
+    -3444, -5885, 7181, -11833, 4877, 1127, -17102, 8401, -7697, -2430, 7694, -13733,
+    7434, -1335, -8103, 9854, -13150, 4861, 3658, -10782, 6746, -12089, -1684, 2554,
+    -13763, 6648, -7585, -12966, 8575, -13576, -5557, -5848, -16265, 5126, -14382, -11028,
+    1673, -16032, 3670, -9635, -11506, 7803, -15375, 298, -5644, -12280, 7373, -11787,
+    -9654, -1065, -12027, 7030, -9589, -6396, 4378, -11509, 891, -2750, -10307, 8336,
+    -9598, -709, -791, -1288, -1249, -1625, -547, -945, -1096, -1107, -10507, -10438,
+    -10376, -10192, -9605, -9425, -8556, 2313, 2951, 3670, 4022, 5276, 5491, 5994,
+    5721, 4715, 4910, 4638, 5969, 6380, 6305, -6090, -4821, -4781, -4529, -4367,
+    -4516, -4475, -3561, 688, 1381, 2263, 1953, 2699, 3073, 3623, 10373, 10373,
+    10541, 10741, 10664, 10249, 13937, -554, -1115, -1348, -1635, -3689, -4159, -4903,
+    2982, 3337, 11502, 11710, 11816, 11602, 11468, 13488, 12468, 11577, 11084, 10329,
+    9770, 8724, -3908, -4781, -5340, -8987, -9055, -9351, -9698, -557, -1408, -9441,
+    10191, 4124, -13513, -1925, -9881, -14799, -7806, -12654, -3269, 1288, -1780, -12026,
+    -5158, -10472, -13056, 3555, -5964, 38, 8568, -10711, 8849, 3353, -11271, -1701,
+    11057, -4388, 9535, 9348, -7776, 7110, 3702, -8859, 3011, 696, 8092, 17219,
+    8923, -5940, 9539, 7369, 7655, 15447, -4079, 10298, 14833, -4900, 6829, -1068,
+    -1089, 5453, 13841, 1324, 7803, 10791, -10222, 8242, 6005, -18773, 2017, 602,
+    -6625, -6715, 6056, -13203, 4397, 4635, -2382, -8704, 8659, -12860, 9722, -309,
+    -14058, -6534, 6647, -8719, 3682, 6956, -5559, -3033, 13873, -2478, -2147, 13818,
+    -7686, -5241, 19332, -11643, -13042, 7961, -9731, -6575, 11078, -4611, -1610, 6162,
+    -402, -4855, 14396, -5988, -5692, -5522, 5389, 5300, -11052, -9595, 5208, 7992,
+    -9161, -11687, 16576, 81, -15571, 19860, -5108, -3045, -4172, 15599, -15654, 15278,
+    -2907, -4331, 6959, 2500, 3941, -13873, 10357, -12447, 9824, -4859, 6070, -9350,
+    -2061, -2439, -2403, 13879, -14499, -778, -4789, 6273, -14872, 13972, -762, 2581,
+    -2372, 3148, -3168, 3792, 8759, -8336, 7430, -7351, -11309, 10367, -10586, 14619,
+    -14228, 14260, -15489, 15039, -13217, 12234, 4402, -11358, -1193, -759, 8404, -12005,
+    11016, -7161, 3125, -2860, 2255, -5832, 3350, 9946, -14580, 12258, -7100, 2142,
+    -1429, 5260, -5767, 891, 4813, -9871, 12060, -11764, 6347, 1344, 3797, -4048,
+    -163, 5921, 2504, -413, -6370, 12460, -14158, 11389, -4330, -1129, -3082, -5974,
+    150, -5024, 11912, -12990, 8409, -4057, -3570, 5508, 7363, -5175, 5406, 3380,
+    -12086, 11809, -9245, -2854, 2809, -9097, -193, 6570, -2220, 4337, 9657, -6487,
+    336, 7277, -10270, -11356, -17758, -14914, -10960, -16319, -12351, -2937, -11007, 2575,
+    -2204, 8952, 14381, 10505, 15264, 17227, 13071, 14479, 1995, 10396, 5848, -8194,
+    -105, -9332, -13309, -2311, -12703, -12534, 443, -11142, -5895, 5325, -7112, 5376,
+    9785, -1267, 11202, 8461, -732, 10520, 7244, 370, 11514, 1146, 5865, 2695,
+    -500, -3184, -1777, -3262, -3230, 1997, 687, -331, -262, 228, 1501, 3183,
+    4299, 1420, 3794, 4765, 4954, 5542, 5089, 4738, 6372, 6124, 6243, 8566,
+    9731, 6571, -19983, -4908, 11363, 10783, 3415, -15688, -11080, 9027, 14566, -6430,
+    -10006, -8930, 6153, 4459, 2746, -6283, -3799, -9317, 10157, 11230, 152, -17824,
+    -10652, 9623, 12480, -2964, -11429, -12007, 12085, -14112, -1300, 3655, -6458, 4045,
+    -14187, 7968, 812, 1546, -1382, -7545, 9046, 2747, -720, -6673, -44, 9932,
+    -11121, 2954, 1211, 3456, 7090, -11142, 3113, 7892, -11792, 3820, -2660, 11654,
+    -11681, -3807, 5811, -5473, 2986, -10818, 6022, 6537, 3885, 1050, -1831, -81,
+    9982, -3979, 7792, -9032, 11560, -7848, -4155, 10053, 2710, -5121, -289, -3398,
+    -379, -11914, -10287, -1685, 1838, -9506, -7299, -3597, -69, -7952, -3529, 1658,
+    2737, -8590, -258, 1548, 7961, 11717, 7191, 10583, 14936, 8626, -939, 8822,
+    6763, 9759, 2639, 1915, 8821, 9246, -6371, -4613, -1969, 7383, -9872, -8531,
+    -12740, -14101, -17797, -13610, -10703, -6769, -12321, -6898, -1447, 1434, 8598, -1491,
+    8724, 12601, 14755, 5337, 12749, 13755, 14184, -27, -2098, -9624, 13674, -16158,
+    5772, -1224, -8727, 4552, -13440, 7126, 5361, -14986, 9205, -11448, 11457, -9002,
+    -8638, 10920, -6598, 3545, -7012, -2046, 11053, -2966, 6149, -8291, 7418, 8350,
+    4314, -9596, 1394, 14143, -7592, -12564, 9744, 11308, -17432, 1863, 12007, -7934,
+    -7835, 4813, -224, -1902, -2488, 2296, -4240, 2848, -5304, -10068, 1022, 8063,
+    6487, -8828, -1666, -8162, -6091, 15764, 4965, -16826, 14955, 14613, -14678, 7835,
+    1326, -5105, -2183, -11435, 16896, 13149, -13981, 2489, 2521, -4787, 203, -9004,
+    14197, 8520, -15434, 9016, 13825, -10369, -12967, -7332, 3255, -7503, -8203, 13273,
+    7549, -7512, 8938, 15788, 1539, -4793, 7388, 2535, -14993, -939, 4062, -12472,
+    -3977, 13920, -5592, -5312, 17542, 6137, -8819, -40, 7233, 10835, 6472, 2750,
+    964, -890, -2883, -7184, -6516, -5364, -4643, 1871, 5061, 8485, 10366, 9806,
+    6658, 3446, 2535, 1989, 1253, 985, -2397, -5790, -6427, -6327, -5396, -5854,
+    -5439, 3744, -3980, 6195, -5159, 11272, -11557, -1736, 11307, 1716, -4137, -6340,
+    4183, -5424, 12300, -7574, -6657, 2153, -1753, 7990, -3169, -8269, -2372, 12667,
+    -7604, 2595, 4207, -11703, -1497, 1114, 1798, -8459, 11751, 2036, -7190, -319,
+    5165, 83, 5970, -1397, -4606, -2728, 7340, 1079, 3064, -5505, -359, 3806,
+    3560, 1571, 7576, -8941, -6524, 6953, -1201, -3727, 16990, 12676, -12959, -6460,
+    5321, 715, -846, 3851, -3317, -7029, 841, 4963, -2462, -8225, 4018, 6250,
+    -7144, -2749, 4894, -8163, -32, 12026, -8344, -11665, 11208, 772, -10527, -5915,
+    -11449, -8025, 17167, 16147, -12572, -12946, -4710, -10827, -5454, 11539, 13439, 15970,
+    -3724, -17810, -11351, -8184, -14005, 4615, 18251, 13944, 2584, -5774, -10771, -10417,
+    -12815, -10766, 14890, 18071, 6438, 6539, 11473, -10867, -15922, -11306, -973, 11530,
+    11644, 9221, 14805, 3686, -15729, -7691, -615, -15180, -8640, 18039, 14898, 4458,
+    5553, 1033, -7960, -12744, -15643, 4006, -440, 1743, 4450, -12155, 1770, 938,
+    13227, -8018, -12759, -4687, 4092, -7681, 11862, 1429, -12130, -10847, 15135, -2731,
+    9111, 742, -2296, -6527, 13753, 12571, 11183, -10845, -2909, -11885, 5925, -46,
+    15734, -11621, -12960, -13178, -151, 1438, 14571, -9091, -11611, -8358, 16489, 14879,
+    13719, -6504, -7663, -10922, 12574, 16691, 12632, 10181, 328, -10272, 4080, 9956,
+    -3423, 13253, -4640, 9230, 17644, -14369, -17142, 10909, 5968, -5905, 10198, -17256,
+    16107, -1391, -12443, 3296, -3854, -12131, 15995, -13154, 11782, -11947, -16401, 11825,
+    3335, -3336, 11835, -16526, 16265, -7708, -12599, 6407, -9083, -7542, 15320, -13265,
+    12997, -12593, -13642, 11315, -5696, -10204, 11552, -16160, 16260, -7333, -5583, 11571,
+    -11994, -298, 14706, -13654, 13184, -12498, -8234, 16456, -6428, -5053, 10559, -16391,
+    16091, -7114, -11787, 13833, -11842, 7206, 13826, -13655, 12664, -12555, 1453, 15992,
+    -6042, 3489, 9122, -15023, 15666, -14890, -2628, 14012, -11446, 2460, 12520, -14096,
+    -1293, -8824, 6631, -5545, 8329, 1391, -1244, 7902, -3379, 12452, -3110, 869,
+    6490, -13062, 6412, -10355, -1184, -1107, -6727, 9283, -3165, 1769, -862, -1372,
+    6638, -3740, 10584, 3964, 10669, -4826, 12614, 11506, -9310, 8511, -4246, -8512,
+    10629, -6845, -9136, 4944, -13277, -2620, -3064, -13956, -9745, 1707, -10410, 7176,
+    10397, -1511, 12360, 12212, 4370, 11891, -6999, 162, 14654, 9979, 9595, -1727,
+    -16875, -11981, -8577, 13169, 11024, -6748, -5133, -13249, -5734, 8409, 12208, 12220,
+    8923, -10278, -7107, 7570, 5715, 14079, -7274, -7032, -17457, -13254, -17734, -12810,
+    10394, -6191, -7596, 11080, -7218, -4396, 9658, 4383, 2882, 1764, 9640, 4937,
+    -8864, -4635, -4679, -25, -9909, -8135, 7956, 3552, -14080, -14740, 5503, 2811,
+    4187, 4725, 13423, 13502, -5750, -5545, 3838, 5532, -799, -9811, -2000, 7110,
+    -9312, -14567, -17920, 4118, 8153, -9639, 6341, 9810, 824, 6642, 7104, 7718,
+    12468, 3409, -10759, -2411, -3546, 1261, -2310, -4085, -836, 2442, -11341, -14288,
+    -6072, 11954, 11027, -12186, 10733, 3683, -2597, 2333, -5412, 11381, 10031, -784,
+    -528, -793, 6839, -10745, -16187, 285, 7706, -3326, -12908, -10670, 5132, -11759,
+    -5007, 11930, 11260, 11800, 3021, -3908, 6229, 5719, -5666, 1132, 288, 4634,
+    -9615, -15518, -11281, 4102, 4827, -4277, -5609, 5347, 14647, -5705, 9763, 13708,
+    1438, -6410, -1072, -2981, -5859, -2663, -545, -5040, -7004, -7203, -12364, -6959,
+    -7687, -15637, -8816, -14261, -12320, 3381, -5372, 15301, 15394, 8484, 14205, 6606,
+    2428, 6777, -5084, 2548, 1961, -8102, 3080, 5117, 6161, 10120, 8861, 7084,
+    12554, 13449, 8324, 11032, 5789, -6783, 1929, -11806, -11664, -5296, -14298, -5770,
+    -11487, -13368, -3033, -11082, -7, 3405, -12507, 9451, -11439, 17455, -2939, 2665,
+    14233, -12244, 10327, 2691, -4738, 5846, -7845, -8600, -8195, -8644, -9998, 5699,
+    -5049, 8178, 5259, -822, 127, 11397, -10900, 13026, 9583, -4171, 10239, -5956,
+    -1174, -4293, 219, -10779, -2978, -1241, 1762, 4051, 4883, -4635, -4333, -729,
+    -234, 7051, 3287, 5288, -564, -3148, 12465, 773, 7715, -3360, -6420, -2125,
+    -10202, -326, -7127, 4802, -14234, -2174, 4070, 5693, 9807, -4886, 9562, -4076,
+    3705, 6990, -10954, 9309, -19848, 4200, 370, 8740, 3597, -548, 10491, -4438,
+    6372, 4684, -8476, 918, -17445, 8439, 6336, -8904, 9922, -15547, 10357, 7059,
+    4578, -641, -3125, -2211, -7800, 7376, 9239, 2574, -1671, 384, -5263, -6762,
+    1391, 12263, 4084, -6241, 2874, -2088, 1242, -1671, 5560, 6443, 8369, -7530,
+    -9325, -11261, -10981, 7374, -129, 8233, -8950, -16331, -7698, -9040, 9877, 9128,
+    10363, 12291, -3746, 1957, -4506, 8369, 13738, 12057, 12637, 2282, 543, -8044,
+    -14531, -663, -1472, 10866, -12621, -9621, -14182, 295, 16318, 11780, 13801, 2881,
+    5644, -6181, 7918, 5694, 13295, 8248, 9908, -4804, 657, -8918, 6239, 4603,
+    11046, 4603, 5421, -10723, -4971, -9793, 5134, 6342, 9510, 9894, 2197, 2669,
+    -5577, 5337, 5301, 10773, 7820, 8012, -2888, -497, -7924, 2598, 2355, 8323,
+    2634, -6224, -10586, 3004, 1499, 6231, -2219, -3625, -2728, -3254, -11691, 5886,
+    -1525, 8251, -9790, 814, -16308, -1309, -10857, 7751, -1557, 6885, -11252, -4718,
+    -15586, -3072, -8529, 7122, -2112, 3499, -12605, -10105, -14764, 8843, -6668, 12625,
+    -606, 13254, -11331, 3645, -17598, 4116, -3893, 2937, 11234, -13809, -10689, -12314,
+    7049, 6932, 12892, -128, -3205, -16556, -10307, -12003, 13774, 5781, 16552, -7872,
+    5702, -17575, 629, 10107, -11906, 7756, -2155, 7674, -13817, 15122, -12944, 6676,
+    -9628, 13510, -17674, 13650, -10328, 8675, -13944, 15891, -14942, 10008, -7341, 11061,
+    -14980, 13010, -9238, 2045, -7641, -701, -6263, -11418, 17676, -17272, 14512, -8154,
+    6791, -6142, -2572, 10796, -15283, 11657, -5063, -3120, 3405, -1744, 9005, -12902,
+    13548, -7146, -5655, 9662, -8951, 6009, -10187, 11014, -8626, -4644, 10203, -13471,
+    14299, -14305, 12401, -7072, -911, 7786, -10490, 10880, -9718, 6664, -2865, -1109,
+    3075, -5429, 4534, -987, -3001, 7447, -8946, 9042, -6384, 764, 7113, -10270,
+    12207, -13451, -3021, 11075, 15224, 13281, -17533, -12438, 1258, 15796, -10942, -15124,
+    -4600, 15659, 12748, -13995, -10346, 10847, 18110, -12004, -14570, -5664, 14527, 2382,
+    -16542, -10250, 12439, 17050, -13160, -9680, 14976, -17114, 1074, 11202, -10527, 15808,
+    -11270, -10336, 2657, 14072, -14943, 17511, -1232, -17866, 18837, -15153, 11625, 153,
+    -14095, 10183, 10349, -8088, 6522, 6325, -18695, 11745, -12796, -21078, -4729, -201,
+    18114, 15121, 10672, 8456, -12016, -12921, -21895, -8284, -2757, 8320, 20804, 12846,
+    12621, -7750, -10073, -18311, -16928, 2432, 7591, 21605, 8200, 5720, -4936, -11443,
+    17562, -2944, -5384, -12436, 13664, 14068, -10533, -7106, -13315, 15995, 9061, 625,
+    -9055, -4283, 16203, -10319, -7007, -8725, 11032, 13506, -12973, -7841, -10099, 15965,
+    3215, -15659, -4828, -17952, -10694, -13131, 6687, -8146, -8584, 17803, 5624, 170,
+    8389, 15688, -16977, -3548, 10909, -13704, 9665, -5714, 11426, 3657, -9805, 13192,
+    -13051, -7263, -768, -5556, -8281, -4236, -3467, -6614, 13963, 2702, 15773, 16005,
+    -7594, 4708, -10312, -11450, -11880, 12371, 5804, 3505, 16434, -12850, -2966, -12266,
+    -17942, -6767, -1692, 7559, 160, 15849, -9816, -15761, -3269, -18233, -12740, -18506,
+    -7715, 7609, -2391, 18113, 12643, 7841, -13837, -9769, -16766, -17254, 17548, -1287,
+    18158, 12722, -2726, -8243, -16138, -12797, -5409, 18095, -475, 15354, 17820, -17182,
+    -9431, -13191, 1969, -8735, 18463, 12179, -7356, 10636, -18252, -10088, -10707, 11009,
+    13749, 12494, 11900, -14973, -3831, -18604, -18523, 15413, 10315, 12989, 12452, 13952,
+    -17416, -14829, -12781, -18702, 12843, -18055, -9404, 11308, -11004, -7736, 859, 15459,
+    -11550, 16142, -12200, 7806, 6522, -14238, 14054, -3800, -12054, 17122, -6233, -468,
+    632, 3987, 4317, -1232, 6692, 2091, 5409, -13490, 17232, -13811, 15601, 3676,
+    4969, 12694, -15466, 7050, -1897, -14812, 7597, -15397, -2859, -7907, -8901, -2879,
+    -12915, 5097, -6786, 8670, -14330, 16683, -6090, 9033, 11608, -4053, 17364, 4721,
+    -1145, 155, -12503, -13919, -2198, 16556, -16151, 11440, 11727, -5392, 15292, -18142,
+    12764, 6535, -13551, 18734, 1405, -1567, -8692, -7755, 9809, 2949, 7209, 8678,
+    -11029, -18060, 15307, -5940, 10402, 8270, -12648, 12861, 1285, -13996, 17622, -16570,
+    13432, -2917, 3540, 5406, -4694, 14735, -17719, 17986, -17300, 14301, -12110, 14630,
+    -10206, 9354, 9356, -16937, 17999, -13762, 8320, 9300, -7761, 13634, -13685, 10444,
+    -16339, 17371, -17782, 15684, -6615, -1017, 9919, -14185, 13461, -16010, 14446, -9858,
+    9662, 8361, -13940, 4224, -11852, 12572, -15493, 16673, -15483, 9023, 12181, -18682,
+    18283, -19594, 11363, -1580, 10781, -1669, 2475, -17559, 9224, 4066, -11142, 10871,
+    -17326, 14756, -7144, -11357, 11221, -18760, 18297, -19254, 18349, -19021, 12910, -11071,
+    -3765, 13232, -18697, 18163, -7459, 6136, 6982, -16729, 17624, -12952, 10211, -13042,
+    12245, -12744, 17918, -17553, 13359, -4906, -12791, 17645, -18595, 16583, -11160, 11406,
+    15490, -16754, 12473, -18218, 17915, -15387, 12489, -12845, 12680, -10376, -12068, 4410,
+    -12564, 12365, -8017, 6627, -11788, 8312, 6777, -12582, 12626, -18574, 18131, -18590,
+    15964, -7573, -14644, 15975, -18497, 18016, -18706, 13262, -6305, 4204, -925, -2746,
+    4373, 10009, -9863, 4501, -7204, 9078, 2157, -8034, 6375, -4642, 14404, -5028,
+    9375, -9733, 9452, -8722, 13870, 1203, -741, 1100, -255, 13022, -11474, 9639,
+    4093, -3389, 6500, -13492, 13030, -12751, 12992, -14707, 5003, -5589, 6148, -5633,
+    5249, -3485, 3194, -1254, -447, 2580, -14680, 14551, -3737, 5280, -6974, -7111,
+    5847, -4167, 2853, 3188, 2237, -5611, -8085, 14855, -11975, -1920, 2347, -2746,
+    11365, -12026, 6753, 12562, -9117, 14004, -5181, -6179, 9747, 4651, -972, -13077,
+    3301, 11269, -4442, 611, -7008, 12737, 5549, 4925, 8042, -15620, 11112, 4141,
+    -14191, 1876, -10702, 12934, -6070, -12734, 9986, -472, 2875, 5228, -9546, -6208,
+    181, 13007, -15103, -10253, 6069, 1413, 7473, -12814, -3842, 11385, -12413, 14605,
+    -1554, -10206, -6535, -8532, 14820, 1825, -12067, -6177, 7122, 18361, -4828, -11513,
+    -8984, 13208, 18105, -8546, -6987, -8554, -6639, 16615, -12171, -679, 8874, 3808,
+    11931, -11619
+};
+
+#endif // SID_OUTPUT_REFERENCE_H
@@ -0,0 +1,75 @@
+﻿// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#ifndef SIDRESAMPLER_H
+#define SIDRESAMPLER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Brings the SID output from its oversampled rate down to the host rate.
+//
+// The chip renders its output a block of oversampled sample points at a time. Each block is
+// run through a windowed-sinc low pass in one pass, computing only the samples that are kept,
+// 8 or 4 taps at a time where AVX2 or SSE2 is available.
+class SIDResampler
+{
+    public:
+        enum class Quality : uint8_t
+        {
+            Fast,       // One sample per host sample, no filtering
+            High        // 4x oversampled, band limited to the host rate
+        };
+
+        static constexpr size_t BLOCK_SIZE = 256;
+
+        SIDResampler();
+
+        void setQuality(Quality quality);
+        inline Quality getQuality() const { return quality; }
+
+        // Oversampled samples per host sample
+        inline uint32_t getFactor() const { return factor; }
+
+        // Drop the history, the next samples start from silence
+        void reset();
+
+        // Oversampled side: the chip renders up to BLOCK_SIZE samples straight into the input
+        // block and commits them, process() then decimates them into out (room for BLOCK_SIZE)
+        // and returns the number of host samples
+        inline float* inputBlock() { return buffer.data() + fill; }
+        inline void commit(size_t count) { fill += count; }
+        size_t process(float* out);
+
+        static bool parseQuality(const std::string& name, Quality& out);
+        static const char* qualityName(Quality quality);
+        static const char* backendName();
+
+    protected:
+
+    private:
+        static constexpr uint32_t HIGH_FACTOR = 4;
+        static constexpr size_t HIGH_TAPS = 128;    // Multiple of 8
+
+        Quality quality;
+        uint32_t factor;
+        uint32_t phase;             // Samples since the last kept one
+
+        // Coefficients in reverse order, so a kept sample is a straight dot product
+        std::vector<float> taps;
+
+        // The last taps - 1 samples of the previous block, then the current block
+        std::vector<float> buffer;
+        size_t fill;
+
+        void buildTaps();
+        static float dot(const float* a, const float* b, size_t n);
+};
+
+#endif // SIDRESAMPLER_H
@@ -0,0 +1,90 @@
+﻿// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#ifndef SIDTHREAD_H
+#define SIDTHREAD_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+class SID;
+
+// Synthesises a SID's audio on its own host thread.
+//
+// The emulator thread only counts cycles and logs register writes with the cycle they were
+// made at. The audio thread replays the log into its own copy of the chip, running it up to
+// each write before applying it, and fills that chip's sample buffer in whole batches.
+class SIDThread
+{
+    public:
+        // Cycles the emulator thread lets pass before it hands over a new target
+        static constexpr uint32_t BATCH_CYCLES = 512;
+
+        SIDThread(SID& chip, uint64_t startCycle);
+        ~SIDThread();
+
+        SIDThread(const SIDThread&) = delete;
+        SIDThread& operator=(const SIDThread&) = delete;
+
+        // Emulator thread: let the chip run up to cycle
+        void runTo(uint64_t cycle);
+
+        // Emulator thread: runTo() and wait until the chip got there. The chip stays
+        // stopped afterwards until the next runTo(), so its state may be touched directly.
+        void waitFor(uint64_t cycle);
+
+        // Emulator thread: the C64 wrote value to register reg of chip (0, or a linked chip)
+        // at cycle, false when the log is full and the chip has to catch up first
+        bool postWrite(uint64_t cycle, uint8_t chipIndex, uint8_t reg, uint8_t value);
+
+    protected:
+
+    private:
+
+        struct RegisterWrite
+        {
+            uint64_t cycle;
+            uint8_t chipIndex;
+            uint8_t reg;
+            uint8_t value;
+        };
+
+        static constexpr uint32_t QUEUE_SIZE  = 4096;   // Power of two
+        static constexpr int SPIN_WAITS       = 4000;
+        static constexpr int YIELD_WAITS      = 20000;
+
+        SID& chip;
+
+        // Cycle the chip has been run up to
+        uint64_t cycle;
+
+        // Register writes, single producer (emulator) and single consumer (audio thread)
+        std::array<RegisterWrite, QUEUE_SIZE> queue;
+        std::atomic<uint32_t> queueHead;
+        std::atomic<uint32_t> queueTail;
+
+        // Handshake
+        std::atomic<uint64_t> target;
+        std::atomic<uint64_t> done;
+        std::atomic<bool> stopping;
+        std::atomic<bool> sleeping;
+        std::mutex wakeMutex;
+        std::condition_variable wake;
+
+        std::thread worker;
+
+        void run();
+        bool awaitTarget(uint64_t from, uint64_t& goal);
+        void runChip(uint64_t upTo);
+        void applyQueuedWrites(uint64_t upTo);
+};
+
+#endif // SIDTHREAD_H
@@ -21,7 +21,7 @@ class Voice
         void trigger();
         void release();
 
-        void clockEnvelope(double sidCycles);
+        void clockEnvelope(uint32_t sidCycles);
 
         // Getters
         const Oscillator& getOscillator() const;
@@ -44,7 +44,7 @@ class Voice
         // Reset function for clean startup
         void reset();
 
-        inline void clockOscillator(double sidCycles) {  osc.clock(sidCycles); }
+        inline void clockOscillator(uint32_t sidCycles) { osc.clock(sidCycles); }
 
         inline void setSIDModel(SIDModel model) { osc.setSIDModel(model); }
 
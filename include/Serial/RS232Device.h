@@ -107,6 +107,9 @@ class RS232Device
         void queueTransmitByte(uint8_t value);
         bool isTransmitIdle() const;
 
+        // No endpoint to poll and both shifters at rest, tick() would be a no-op
+        bool isIdle() const;
+
         // Receive
         bool hasReceivedByte() const;
         bool popReceivedByte(uint8_t& value);
@@ -8,6 +8,7 @@
 #ifndef TAP_H
 #define TAP_H
 
+#include <algorithm>
 #include "TapeImage.h"
 
 class TAP : public TapeImage
@@ -20,6 +21,10 @@ class TAP : public TapeImage
         void simulateLoading() override;
         bool currentBit() const override;
 
+        // Pulse-level stepping, whole pulses are skipped between edges
+        void advance(uint32_t cycles) override;
+        uint32_t cyclesUntilLevelChange() const override;
+
         // State management
         void saveState(StateWriter& wrtr) const override;
         bool loadState(const StateReader::Chunk& chunk, StateReader& rdr) override;
@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <string>
 #include <vector>
 #include "Common/VideoMode.h"
@@ -30,6 +31,14 @@ class TapeImage
         virtual bool currentBit() const = 0;
         virtual bool isT64() const;
 
+        static constexpr uint32_t NO_EDGE = std::numeric_limits<uint32_t>::max();
+
+        // Run several cycles of simulateLoading() at once
+        virtual void advance(uint32_t cycles) { while (cycles--) simulateLoading(); }
+
+        // Cycles until currentBit() can next change, NO_EDGE if it never will
+        virtual uint32_t cyclesUntilLevelChange() const { return 1; }
+
         // Debug API (default no-op)
         virtual uint8_t debugTapeVersion() const { return 0; }
         virtual size_t debugPulseIndex() const { return 0; }
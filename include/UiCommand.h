@@ -68,6 +68,7 @@ struct UiCommand
         CassStop,
         CassRewind,
         CassEject,
+        CassToggleWarp,
 
         AssignPad1ToPort1,
         AssignPad1ToPort2,
@@ -33,6 +33,9 @@ class UserPort
 
         bool getFlag2() const;
 
+        // Nothing to clock, CIA2 can skip ticking the port until the next register write
+        bool isIdle() const;
+
         std::string debugString() const;
         std::string debugRS232String() const;
         std::string selfTestRS232(uint8_t value, RS232Device::Parity parity);
@@ -34,6 +34,9 @@ public:
     virtual std::string selfTestUserPortRS232Errors() { return "RS-232 not supported by attached User Port device\n"; }
 
     virtual bool getFlag2() const { return true; }
+
+    // True when tick() would change nothing, devices that don't know are clocked every cycle
+    virtual bool isIdle() const { return false; }
 };
 
 #endif // USERPORTDEVICE_H
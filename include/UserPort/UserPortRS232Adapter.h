@@ -37,6 +37,7 @@ class UserPortRS232Adapter : public UserPortDevice
         void postLoadState();
 
         bool getFlag2() const override;
+        bool isIdle() const override;
 
         std::string debugString() const override;
         std::string debugRS232String() const override;
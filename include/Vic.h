@@ -543,6 +543,14 @@ class Vic
         inline const std::vector<RasterRowStateSnapshot>& getCurrentRasterRowsForDebug() const { return rasterRowStates; }
         inline const std::vector<RasterRowStateSnapshot>& getLastFrameRasterRowsForDebug() const { return lastFrameRasterRowStates; }
 
+        // Raster event log and row/pixel snapshots are only recorded while a debugger asks for them
+        static constexpr const char* DEBUG_CAPTURE_HINT = "Capture is off unless armed, 'vic capture frame' records the next frame.\n";
+        inline void setDebugCaptureEnabled(bool enabled) { debugCaptureContinuous = enabled; }
+        inline bool isDebugCaptureEnabled() const { return debugCaptureContinuous; }
+        inline void captureNextFrameForDebug() { debugCaptureOneShot = true; }
+        inline bool isDebugCapturePending() const { return debugCaptureOneShot; }
+        inline bool isDebugCaptureActive() const { return debugCaptureFrame; }
+
         inline int getBackgroundMatrixColumnsForDebug() const { return BACKGROUND_MATRIX_COLUMNS; }
         inline int getBackground40ColX0ForDebug() const { return BACKGROUND_40COL_X0; }
         inline uint16_t getColorMemoryStartForDebug() const { return COLOR_MEMORY_START; }
@@ -805,6 +813,7 @@ class Vic
         std::vector<uint8_t> borderVerticalStart_per_raster;
 
         std::array<uint8_t, 512> borderMaskLine{};
+        std::array<uint8_t, 512> spritePriorityLine{}; // D01B bits active at each pixel
         std::array<uint8_t, 512> finalColorLine{};
 
         // Caches for ML Monitor
@@ -1269,6 +1278,11 @@ class Vic
         std::vector<RasterRowStateSnapshot> lastFrameRasterRowStates;
         std::vector<RasterEventRecord> rasterEventLog;
         std::vector<RasterEventRecord> lastFrameRasterEventLog;
+
+        // Debug capture arming, a frame is captured whole from its first raster line
+        bool debugCaptureContinuous = false;
+        bool debugCaptureOneShot = false;
+        bool debugCaptureFrame = false;
         std::vector<RasterSpriteXEvent> rasterSpriteXEvents;
         std::vector<RasterSpriteEnableEvent> rasterSpriteEnableEvents;
         std::vector<RasterSpriteXExpansionEvent> rasterSpriteXExpansionEvents;
@@ -1278,6 +1292,40 @@ class Vic
         std::vector<std::vector<RasterEventRecord>> rasterEventsByRaster;
         std::vector<std::vector<RasterEventRecord>> lastFrameRasterEventsByRaster;
 
+        // D011/D016/D018 across a raster line as a step function, kept up to date as the
+        // writes are recorded. Spans are sorted by pixel X, a write replaces everything
+        // from its X on, so the value at a pixel is the last span starting at or before it.
+        struct RegisterSpan
+        {
+            int x = 0;
+            uint8_t value = 0;
+        };
+
+        struct RasterRegisterSpans
+        {
+            std::vector<RegisterSpan> d011;
+            std::vector<RegisterSpan> d016;
+            std::vector<RegisterSpan> d018;
+        };
+
+        // Remembers where the last lookup in a span list ended, pixels are mostly asked for left to right
+        struct RegisterSpanCursor
+        {
+            const std::vector<RegisterSpan>* spans = nullptr;
+            uint32_t revision = 0;
+            int px = 0;
+            size_t next = 0;
+        };
+
+        std::vector<RasterRegisterSpans> rasterSpansByRaster;
+        std::vector<RasterRegisterSpans> lastFrameRasterSpansByRaster;
+        uint32_t registerSpanRevision = 0; // Bumped whenever any span list changes
+        mutable RegisterSpanCursor registerSpanCursors[3][2]; // [D011, D016, D018][this frame, previous frame]
+
+        void addRegisterSpan(RasterRegisterSpans& spans, const RasterEventRecord& e);
+        void rebuildRegisterSpans();
+        uint8_t registerValueAtPixelX(const std::vector<RegisterSpan>& spans, RegisterSpanCursor& cursor, uint8_t base, int px) const;
+
         void resetBackgroundGraphicsLatches();
         void fetchStandardTextGraphicsByte(int raster, int column, uint8_t d011, uint8_t d016, uint8_t d018);
         void loadActiveStandardTextPixelStateFromLatch(int raster,  int column, int px);
@@ -1296,7 +1344,7 @@ class Vic
         void snapshotRasterRowState(int raster);
 
         bool initialSpritePriorityForRaster(int raster, uint8_t& value) const;
-        bool spriteBehindBackgroundAtPixel(int sprite, int px) const;
+        void buildSpritePriorityLine(int raster);
 
         SpriteFetchPhase spriteFetchPhaseForCycle(int sprite, int cycle) const;
         bool spriteFetchPhaseStealsCpu(SpriteFetchPhase phase) const;
@@ -1380,8 +1428,6 @@ class Vic
 
         void buildBorderMaskLine(int raster);
         void composeFinalRasterLine(int raster);
-        BackgroundPixel sampleBackgroundPixelAtX(int raster, int px) const;
-        uint8_t compositePixelAtX(int raster, int px) const;
 
         int rasterPixelToCycle(int px) const;
         int rasterEventPixelX(int cycle) const;
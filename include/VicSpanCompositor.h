@@ -0,0 +1,40 @@
+// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#ifndef VIC_SPAN_COMPOSITOR_H
+#define VIC_SPAN_COMPOSITOR_H
+
+#include <cstdint>
+
+// Line buffers the VIC-II has built for one raster line, indexed by pixel X.
+// Opaque and mask bytes are 0 or non zero, spriteBehind holds the D01B bits
+// that are active at each pixel.
+struct VicLineLayers
+{
+    const uint8_t* bgColor = nullptr;
+    const uint8_t* bgOpaque = nullptr;
+    const uint8_t* borderMask = nullptr;
+    const uint8_t* spriteBehind = nullptr;
+    const uint8_t* spriteOpaque[8] = {};
+    const uint8_t* spriteColor[8] = {};
+    uint8_t borderColor = 0;
+};
+
+// Merges background, the 8 sprite layers, sprite priority and the border mask
+// into final color indices, 32 or 16 pixels at a time where AVX2 or SSE2 is available.
+class VicSpanCompositor
+{
+    public:
+        static void compose(const VicLineLayers& layers, uint8_t* out, int x0, int x1);
+
+        static const char* backendName();
+
+    private:
+        static void composeScalar(const VicLineLayers& layers, uint8_t* out, int x0, int x1);
+};
+
+#endif // VIC_SPAN_COMPOSITOR_H
@@ -38,6 +38,7 @@ class VideoOutput final : public IVideoSink
 
         void setPixel(int x, int y, uint8_t color) override;
         void setPixel(int x, int y, uint8_t color, int hardwareX) override;
+        void setPixelRow(int y, const uint8_t* colors, int x0, int x1) override;
 
         void finishFrameAndSignal();
         void renderFrame(std::atomic<bool>& running);
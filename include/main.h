@@ -13,9 +13,20 @@
 #include <vector>
 
 #include "Common/JoystickMapping.h"
+#include "HeadlessConfig.h"
+
+class Computer;
 
 boost::program_options::options_description get_options();
 boost::program_options::options_description get_config_file_options();
 
+void configureComputer(Computer& c64, const boost::program_options::variables_map& vmConfig,
+                       const boost::program_options::variables_map& vmCmdLine);
+
 JoystickMapping parseJoystickConfig(const std::string& config);
 std::vector<std::string> splitCSV(const std::string& input);
+
+// Headless batch runs
+uint32_t parseHexValue(const std::string& text, uint32_t maxValue);
+HeadlessConfig parseHeadlessConfig(const boost::program_options::variables_map& vm);
+void printHeadlessResult(const HeadlessResult& result);
@@ -37,7 +37,8 @@ namespace
 
 AudioOutput::AudioOutput() :
     sid(nullptr),
-    stream(nullptr)
+    stream(nullptr),
+    sampleRate(44100)
 {
 
 }
@@ -57,17 +58,18 @@ void AudioOutput::fillAudioBuffer(Uint8* outputBuffer, int len)
 
     for (int i = 0; i < numSamplesPerChannel; ++i)
     {
-        double s = 0.0;
+        // Both channels carry the same sample unless extra SIDs are panned
+        double s[CHANNELS] = { 0.0, 0.0 };
         if (sid)
-            s = sid->popSample();
+            sid->popFrame(s[0], s[1]);
 
-        if (s > 1.0) s = 1.0;
-        else if (s < -1.0) s = -1.0;
+        for (int ch = 0; ch < CHANNELS; ++ch)
+        {
+            if (s[ch] > 1.0) s[ch] = 1.0;
+            else if (s[ch] < -1.0) s[ch] = -1.0;
 
-        const auto sample16 = static_cast<Sint16>(s * 32767.0);
-
-        buffer[i * CHANNELS + 0] = sample16;
-        buffer[i * CHANNELS + 1] = sample16;
+            buffer[i * CHANNELS + ch] = static_cast<Sint16>(s[ch] * 32767.0);
+        }
     }
 }
 
@@ -77,7 +79,7 @@ bool AudioOutput::playAudio()
         return true;
 
     SDL_AudioSpec spec{};
-    spec.freq = SAMPLE_RATE;
+    spec.freq = sampleRate;
     spec.format = SDL_AUDIO_S16;
     spec.channels = CHANNELS;
 
@@ -121,3 +123,12 @@ void AudioOutput::resumeAudio()
             SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Couldn't resume audio: %s", SDL_GetError());
     }
 }
+
+bool AudioOutput::setSampleRate(int rate)
+{
+    if (rate != 44100 && rate != 48000 && rate != 96000)
+        return false;
+
+    sampleRate = rate;
+    return true;
+}
@@ -0,0 +1,652 @@
+// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include "BenchmarkSuite.h"
+#include "ComponentProfiler.h"
+#include "Computer.h"
+#include "CPU.h"
+#include "CPUBus.h"
+#include "CPUTiming.h"
+#include "SID/SID.h"
+#include "SID/SIDOutputReference.h"
+#include "Version.h"
+#include "VicSpanCompositor.h"
+
+namespace
+{
+    // Plain 64K of RAM, enough to run the CPU on its own
+    class FlatRAMBus : public CPUBus
+    {
+        public:
+            std::array<uint8_t, 0x10000> data{};
+
+            uint8_t read(uint16_t address) override { return data[address]; }
+            void write(uint16_t address, uint8_t value) override { data[address] = value; }
+            uint8_t peek(uint16_t address) const override { return data[address]; }
+    };
+
+    // The sid-output script: voice setup, then random notes, cutoff changes and volume steps per
+    // frame. The LCG keeps it the same on every platform. SIDOutputReference.h was rendered from it.
+    void startSidOutputScript(SID& sid)
+    {
+        auto write = [&sid](uint8_t reg, uint8_t value) { sid.writeRegister(0xD400 + reg, value); };
+
+        write(0x18, 0x1F);
+        write(0x17, 0xF3);
+        write(0x15, 0x00);
+        write(0x16, 0x40);
+
+        for (uint8_t v = 0; v < 3; ++v)
+        {
+            write(v * 7 + 5, 0x22);
+            write(v * 7 + 6, 0xA8);
+            write(v * 7 + 2, 0x00);
+            write(v * 7 + 3, 0x08);
+        }
+    }
+
+    void playSidOutputFrame(SID& sid, uint32_t frame, uint32_t& seed)
+    {
+        auto write = [&sid](uint8_t reg, uint8_t value) { sid.writeRegister(0xD400 + reg, value); };
+        auto next = [&seed]() { seed = seed * 1103515245u + 12345u; return (seed >> 16) & 0x7FFF; };
+
+        static constexpr uint8_t waveforms[4] = { 0x11, 0x21, 0x41, 0x81 };
+
+        for (uint8_t v = 0; v < 3; ++v)
+        {
+            if (next() % 4 != 0)
+                continue;
+
+            const uint32_t freq = next() % 0x4000 + 0x200;
+            const uint8_t control = waveforms[next() % 4];
+
+            write(v * 7, freq & 0xFF);
+            write(v * 7 + 1, freq >> 8);
+            write(v * 7 + 4, control - 1);
+            write(v * 7 + 4, control);
+        }
+
+        if (next() % 2 == 0)
+            write(0x16, next() % 256);
+
+        if (frame % 25 == 0)
+            write(0x18, ((next() % 8) << 4) | 0x0F);
+    }
+
+    struct SidOutputVariant
+    {
+        SIDModel model;
+        SIDResampler::Quality quality;
+        const char* name;
+        const int16_t* reference;
+        size_t referenceCount;
+    };
+
+    constexpr SidOutputVariant SID_OUTPUT_VARIANTS[] =
+    {
+        { SIDModel::MOS6581, SIDResampler::Quality::Fast, "6581-fast",
+            SID_OUTPUT_REFERENCE_6581_FAST, std::size(SID_OUTPUT_REFERENCE_6581_FAST) },
+        { SIDModel::MOS6581, SIDResampler::Quality::High, "6581-high",
+            SID_OUTPUT_REFERENCE_6581_HIGH, std::size(SID_OUTPUT_REFERENCE_6581_HIGH) },
+        { SIDModel::MOS8580, SIDResampler::Quality::Fast, "8580-fast",
+            SID_OUTPUT_REFERENCE_8580_FAST, std::size(SID_OUTPUT_REFERENCE_8580_FAST) },
+        { SIDModel::MOS8580, SIDResampler::Quality::High, "8580-high",
+            SID_OUTPUT_REFERENCE_8580_HIGH, std::size(SID_OUTPUT_REFERENCE_8580_HIGH) }
+    };
+}
+
+BenchmarkSuite::BenchmarkSuite(MachineFactory factory, uint64_t frames, const std::string& diskPath) :
+    factory_(std::move(factory)),
+    frames_(frames ? frames : 1),
+    diskPath_(diskPath)
+{
+
+}
+
+BenchmarkSuite::~BenchmarkSuite() = default;
+
+const std::vector<std::string>& BenchmarkSuite::getWorkloadNames()
+{
+    static const std::vector<std::string> names =
+    {
+        "idle",       // BASIC READY prompt, cursor blinking
+        "cpu",        // ALU/indexed/RMW/branch mix on a bare CPU, the interpreter core shared with the drives
+        "cpu-micro",  // Same mix through the cycle-exact micro-op path used by the C64 CPU
+        "raster",     // 8 expanded multicolor sprites over badlines, border/background writes
+        "split",      // D011/D016/D018 rewritten several times per raster line, split screen/FLI style
+        "sid",        // 3 gated voices through the filter with constant frequency sweeps
+        "sid-output", // Scripted notes and filter sweeps on a bare SID, compared with the old per-sample output stage
+        "disk",       // LOAD from a true-emulated 1541 on device 8
+        "reu",        // back to back 4K stash/fetch DMA through screen RAM, one byte per cycle
+        "reu-bulk"    // 8K stash/fetch/swap/verify outside the VIC bank, moved as spans
+    };
+
+    return names;
+}
+
+bool BenchmarkSuite::isWorkload(const std::string& name)
+{
+    if (name == "all")
+        return true;
+
+    const auto& names = getWorkloadNames();
+    return std::find(names.begin(), names.end(), name) != names.end();
+}
+
+bool BenchmarkSuite::run(const std::string& workload, std::ostream& out)
+{
+    if (workload != "all")
+        return runWorkload(workload, out);
+
+    bool ok = true;
+    for (const auto& name : getWorkloadNames())
+    {
+        // A correctness check, not a timing run
+        if (name == "sid-output")
+            continue;
+
+        ok = runWorkload(name, out) && ok;
+    }
+
+    return ok;
+}
+
+bool BenchmarkSuite::runWorkload(const std::string& name, std::ostream& out)
+{
+    if (name == "cpu" || name == "cpu-micro")
+        return runCpuWorkload(name, out);
+
+    if (name == "sid-output")
+        return runSidOutputWorkload(name, out);
+
+    std::string blankDiskPath;
+    HeadlessConfig config = makeConfig(name, blankDiskPath);
+
+    ComponentProfiler profiler(PROFILE_INTERVAL);
+    config.profiler = &profiler;
+
+    HeadlessResult result;
+    bool ok = false;
+    std::string error;
+
+    try
+    {
+        std::unique_ptr<Computer> machine = factory_();
+        ok = machine->runHeadless(config, result);
+
+        if (!ok)
+            error = "run stopped with an error";
+    }
+    catch (const std::exception& e)
+    {
+        error = e.what();
+
+        while (!error.empty() && (error.back() == '\n' || error.back() == ' '))
+            error.pop_back();
+    }
+
+    if (!blankDiskPath.empty())
+    {
+        std::error_code ec;
+        std::filesystem::remove(blankDiskPath, ec);
+    }
+
+    std::ostringstream line;
+    line << std::setprecision(6);
+
+    line << "{\"benchmark\":\"" << name << "\""
+         << ",\"version\":\"" << VersionInfo::VERSION << "\"";
+
+    if (!ok)
+    {
+        line << ",\"status\":\"error\""
+             << ",\"message\":\"" << jsonEscape(error) << "\"}";
+
+        out << line.str() << std::endl;
+        return false;
+    }
+
+    const double hostSeconds = result.hostSeconds > 0.0 ? result.hostSeconds : 1e-9;
+
+    line << ",\"status\":\"ok\""
+         << ",\"vic_compositor\":\"" << VicSpanCompositor::backendName() << "\""
+         << ",\"frames\":" << result.frames
+         << ",\"cycles\":" << result.cycles
+         << ",\"emulated_s\":" << result.emulatedSeconds
+         << ",\"host_s\":" << result.hostSeconds
+         << ",\"instructions\":" << result.instructions
+         << ",\"cycles_per_s\":" << static_cast<double>(result.cycles) / hostSeconds
+         << ",\"instructions_per_s\":" << static_cast<double>(result.instructions) / hostSeconds
+         << ",\"frames_per_s\":" << static_cast<double>(result.frames) / hostSeconds
+         << ",\"speed\":" << result.emulatedSeconds / hostSeconds
+         << ",\"profile_interval\":" << profiler.getSampleInterval()
+         << ",\"profile_samples\":" << profiler.getSampledCycles()
+         << ",\"components\":{";
+
+    for (size_t i = 0; i < ComponentProfiler::COMPONENT_COUNT; ++i)
+    {
+        const auto c = static_cast<ComponentProfiler::Component>(i);
+
+        if (i) line << ",";
+        line << "\"" << ComponentProfiler::componentName(c) << "\":" << profiler.getShare(c);
+    }
+
+    line << "}}";
+
+    out << line.str() << std::endl;
+    return true;
+}
+
+bool BenchmarkSuite::runCpuWorkload(const std::string& name, std::ostream& out)
+{
+    FlatRAMBus ram;
+
+    const std::vector<uint8_t> program = cpuProgram();
+    std::copy(program.begin(), program.end(), ram.data.begin() + 0xC000);
+
+    // Reset vector
+    ram.data[0xFFFC] = 0x00;
+    ram.data[0xFFFD] = 0xC0;
+
+    CPU cpu;
+    cpu.attachMemoryInstance(&ram);
+    cpu.reset();
+    cpu.setUseMicroOps(name == "cpu-micro");
+
+    const uint64_t cycles = frames_ * static_cast<uint64_t>(PAL_CPU.cyclesPerFrame());
+
+    const auto hostStart = std::chrono::steady_clock::now();
+
+    for (uint64_t i = 0; i < cycles; ++i)
+        cpu.tick();
+
+    const auto hostEnd = std::chrono::steady_clock::now();
+
+    double hostSeconds = std::chrono::duration<double>(hostEnd - hostStart).count();
+    if (hostSeconds <= 0.0)
+        hostSeconds = 1e-9;
+
+    const double emulatedSeconds = static_cast<double>(cycles) / PAL_CPU.clockSpeedHz;
+
+    std::ostringstream line;
+    line << std::setprecision(6);
+
+    line << "{\"benchmark\":\"" << name << "\""
+         << ",\"version\":\"" << VersionInfo::VERSION << "\""
+         << ",\"status\":\"ok\""
+         << ",\"cycles\":" << cycles
+         << ",\"emulated_s\":" << emulatedSeconds
+         << ",\"host_s\":" << hostSeconds
+         << ",\"instructions\":" << cpu.getInstructionCount()
+         << ",\"cycles_per_s\":" << static_cast<double>(cycles) / hostSeconds
+         << ",\"instructions_per_s\":" << static_cast<double>(cpu.getInstructionCount()) / hostSeconds
+         << ",\"speed\":" << emulatedSeconds / hostSeconds
+         << "}";
+
+    out << line.str() << std::endl;
+    return true;
+}
+
+bool BenchmarkSuite::runSidOutputWorkload(const std::string& name, std::ostream& out)
+{
+    std::ostringstream line;
+    line << std::setprecision(6);
+
+    line << "{\"benchmark\":\"" << name << "\""
+         << ",\"version\":\"" << VersionInfo::VERSION << "\"";
+
+    std::ostringstream variants;
+    variants << std::setprecision(6);
+
+    bool ok = true;
+    double hostSeconds = 0.0;
+
+    for (const auto& variant : SID_OUTPUT_VARIANTS)
+    {
+        SID sid(SID_OUTPUT_REFERENCE_SAMPLE_RATE);
+        sid.setMode(VideoMode::PAL);
+        sid.reset();
+        sid.setSIDModel(variant.model);
+        sid.setResamplerQuality(variant.quality);
+
+        startSidOutputScript(sid);
+
+        uint32_t seed = SID_OUTPUT_REFERENCE_SEED;
+        size_t sample = 0;
+        size_t compared = 0;
+        double signal = 0.0;
+        double noise = 0.0;
+        double maxError = 0.0;
+
+        const uint32_t cyclesPerFrame = PAL_CPU.cyclesPerFrame();
+        const auto hostStart = std::chrono::steady_clock::now();
+
+        for (uint32_t frame = 0; frame < SID_OUTPUT_REFERENCE_FRAMES; ++frame)
+        {
+            playSidOutputFrame(sid, frame, seed);
+
+            for (uint32_t c = 0; c < cyclesPerFrame; ++c)
+                sid.tick(1);
+
+            sid.sync();
+
+            while (sid.getAudioBufferedSamples() > 0)
+            {
+                const double s = sid.popSample();
+
+                // The reference keeps every SID_OUTPUT_REFERENCE_STRIDE-th sample
+                if (sample % SID_OUTPUT_REFERENCE_STRIDE == 0 && compared < variant.referenceCount)
+                {
+                    const double ref = variant.reference[compared++] / 32767.0;
+                    const double error = std::clamp(s, -1.0, 1.0) - ref;
+
+                    signal += ref * ref;
+                    noise += error * error;
+                    maxError = std::max(maxError, std::abs(error));
+                }
+
+                ++sample;
+            }
+        }
+
+        hostSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - hostStart).count();
+
+        const double snr = noise > 0.0 ? 10.0 * std::log10(signal / noise) : 999.0;
+        const bool match = compared == variant.referenceCount && snr >= SID_OUTPUT_MIN_SNR_DB &&
+            maxError <= SID_OUTPUT_MAX_ERROR;
+        ok = ok && match;
+
+        if (variants.tellp() > 0) variants << ",";
+        variants << "\"" << variant.name << "\":{\"match\":" << (match ? "true" : "false")
+                 << ",\"samples\":" << sample
+                 << ",\"compared\":" << compared
+                 << ",\"snr_db\":" << snr
+                 << ",\"max_error\":" << maxError
+                 << "}";
+    }
+
+    line << ",\"status\":\"" << (ok ? "ok" : "mismatch") << "\""
+         << ",\"frames\":" << SID_OUTPUT_REFERENCE_FRAMES
+         << ",\"host_s\":" << hostSeconds
+         << ",\"outputs\":{" << variants.str() << "}}";
+
+    out << line.str() << std::endl;
+    return ok;
+}
+
+HeadlessConfig BenchmarkSuite::makeConfig(const std::string& name, std::string& blankDiskPath) const
+{
+    HeadlessConfig config;
+    config.warmupFrames = WARMUP_FRAMES;
+    config.maxFrames = frames_;
+
+    if (name == "idle")
+    {
+        // Nothing to add, the machine sits at the READY prompt
+    }
+    else if (name == "raster")
+    {
+        config.program = rasterProgram();
+    }
+    else if (name == "split")
+    {
+        config.program = splitProgram();
+    }
+    else if (name == "sid")
+    {
+        config.program = sidProgram();
+    }
+    else if (name == "disk")
+    {
+        if (!diskPath_.empty())
+        {
+            config.diskPath = diskPath_;
+            config.typedText = "LOAD\"*\",8\n";
+        }
+        else
+        {
+            // No image given, list the directory of a freshly formatted disk
+            blankDiskPath = (std::filesystem::temp_directory_path() / "c64-benchmark.d64").string();
+
+            config.diskPath = blankDiskPath;
+            config.createBlankDisk = true;
+            config.typedText = "LOAD\"$\",8\n";
+        }
+    }
+    else if (name == "reu")
+    {
+        config.reuModel = REUModel::Commodore1750;
+        config.program = reuProgram();
+    }
+    else if (name == "reu-bulk")
+    {
+        config.reuModel = REUModel::Commodore1750;
+        config.program = reuBulkProgram();
+    }
+    else
+    {
+        throw std::runtime_error("Unknown benchmark workload: " + name);
+    }
+
+    return config;
+}
+
+std::vector<uint8_t> BenchmarkSuite::cpuProgram()
+{
+    return
+    {
+        0x78,                   // C000  SEI
+        0xA9, 0x00,             // C001  LDA #$00
+        0x85, 0xFD,             // C003  STA $FD
+        0xA9, 0xC1,             // C005  LDA #$C1
+        0x85, 0xFE,             // C007  STA $FE        ($FD) points at $C100
+        0xA2, 0x00,             // C009  LDX #$00
+        0xBD, 0x00, 0xC1,       // C00B  LDA $C100,X
+        0x49, 0x5A,             // C00E  EOR #$5A
+        0x65, 0xFB,             // C010  ADC $FB
+        0x9D, 0x00, 0xC2,       // C012  STA $C200,X
+        0x26, 0xFC,             // C015  ROL $FC
+        0xFE, 0x00, 0xC3,       // C017  INC $C300,X
+        0xA4, 0xFC,             // C01A  LDY $FC
+        0xC0, 0x80,             // C01C  CPY #$80
+        0x90, 0x02,             // C01E  BCC $C022
+        0xC6, 0xFB,             // C020  DEC $FB
+        0x20, 0x2B, 0xC0,       // C022  JSR $C02B
+        0xE8,                   // C025  INX
+        0xD0, 0xE3,             // C026  BNE $C00B
+        0x4C, 0x09, 0xC0,       // C028  JMP $C009
+        0xB1, 0xFD,             // C02B  LDA ($FD),Y
+        0x19, 0x00, 0xC1,       // C02D  ORA $C100,Y
+        0x60                    // C030  RTS
+    };
+}
+
+std::vector<uint8_t> BenchmarkSuite::rasterProgram()
+{
+    return
+    {
+        0x78,                   // C000  SEI
+        0xA9, 0xFF,             // C001  LDA #$FF
+        0x8D, 0x15, 0xD0,       // C003  STA $D015      all sprites on
+        0x8D, 0x1C, 0xD0,       // C006  STA $D01C      multicolor
+        0x8D, 0x17, 0xD0,       // C009  STA $D017      Y expand
+        0x8D, 0x1D, 0xD0,       // C00C  STA $D01D      X expand
+        0xA0, 0x3F,             // C00F  LDY #$3F
+        0xA9, 0xAA,             // C011  LDA #$AA
+        0x99, 0x40, 0x03,       // C013  STA $0340,Y    sprite data at $0340
+        0x88,                   // C016  DEY
+        0x10, 0xFA,             // C017  BPL $C013
+        0xA0, 0x07,             // C019  LDY #$07
+        0xA9, 0x0D,             // C01B  LDA #$0D
+        0x99, 0xF8, 0x07,       // C01D  STA $07F8,Y    sprite pointers
+        0x88,                   // C020  DEY
+        0x10, 0xFA,             // C021  BPL $C01D
+        0xA2, 0x0E,             // C023  LDX #$0E
+        0x8A,                   // C025  TXA
+        0x0A,                   // C026  ASL A
+        0x0A,                   // C027  ASL A
+        0x0A,                   // C028  ASL A
+        0x69, 0x30,             // C029  ADC #$30
+        0x9D, 0x00, 0xD0,       // C02B  STA $D000,X    sprite X
+        0xA9, 0x64,             // C02E  LDA #$64
+        0x9D, 0x01, 0xD0,       // C030  STA $D001,X    sprite Y
+        0xCA,                   // C033  DEX
+        0xCA,                   // C034  DEX
+        0x10, 0xEE,             // C035  BPL $C025
+        0xA9, 0x1B,             // C037  LDA #$1B
+        0x8D, 0x11, 0xD0,       // C039  STA $D011      display on, badlines
+        0xEE, 0x20, 0xD0,       // C03C  INC $D020
+        0xEE, 0x21, 0xD0,       // C03F  INC $D021
+        0x4C, 0x3C, 0xC0        // C042  JMP $C03C
+    };
+}
+
+std::vector<uint8_t> BenchmarkSuite::splitProgram()
+{
+    return
+    {
+        0x78,                   // C000  SEI
+        0xA9, 0x1B,             // C001  LDA #$1B
+        0x8D, 0x11, 0xD0,       // C003  STA $D011      text mode, display on
+        0x49, 0x20,             // C006  EOR #$20
+        0x8D, 0x11, 0xD0,       // C008  STA $D011      bitmap mode
+        0xEE, 0x16, 0xD0,       // C00B  INC $D016      X scroll, CSEL and MCM
+        0xEE, 0x18, 0xD0,       // C00E  INC $D018      screen and character base
+        0x49, 0x20,             // C011  EOR #$20
+        0x4C, 0x03, 0xC0        // C013  JMP $C003      about 9 register changes per line
+    };
+}
+
+std::vector<uint8_t> BenchmarkSuite::sidProgram()
+{
+    return
+    {
+        0x78,                   // C000  SEI
+        0xA9, 0x1F,             // C001  LDA #$1F
+        0x8D, 0x18, 0xD4,       // C003  STA $D418      low pass, volume 15
+        0xA9, 0xF7,             // C006  LDA #$F7
+        0x8D, 0x17, 0xD4,       // C008  STA $D417      max resonance, filter all voices
+        0xA2, 0x00,             // C00B  LDX #$00
+        0xA0, 0x0E,             // C00D  LDY #$0E       voice 3, 2, 1
+        0xA9, 0x08,             // C00F  LDA #$08
+        0x99, 0x03, 0xD4,       // C011  STA $D403,Y    pulse width
+        0xA9, 0x09,             // C014  LDA #$09
+        0x99, 0x05, 0xD4,       // C016  STA $D405,Y    attack/decay
+        0xA9, 0xF0,             // C019  LDA #$F0
+        0x99, 0x06, 0xD4,       // C01B  STA $D406,Y    sustain/release
+        0xBD, 0x3F, 0xC0,       // C01E  LDA $C03F,X
+        0x99, 0x04, 0xD4,       // C021  STA $D404,Y    waveform + gate
+        0xE8,                   // C024  INX
+        0x98,                   // C025  TYA
+        0x38,                   // C026  SEC
+        0xE9, 0x07,             // C027  SBC #$07
+        0xA8,                   // C029  TAY
+        0x10, 0xE3,             // C02A  BPL $C00F
+        0xE8,                   // C02C  INX
+        0x8E, 0x01, 0xD4,       // C02D  STX $D401      voice 1 frequency
+        0x8E, 0x16, 0xD4,       // C030  STX $D416      filter cutoff
+        0x8A,                   // C033  TXA
+        0x4A,                   // C034  LSR A
+        0x8D, 0x08, 0xD4,       // C035  STA $D408      voice 2 frequency
+        0x4A,                   // C038  LSR A
+        0x8D, 0x0F, 0xD4,       // C039  STA $D40F      voice 3 frequency
+        0x4C, 0x2C, 0xC0,       // C03C  JMP $C02C
+        0x15, 0x21, 0x41        // C03F  triangle+ring, sawtooth, pulse
+    };
+}
+
+std::vector<uint8_t> BenchmarkSuite::reuProgram()
+{
+    return
+    {
+        0x78,                   // C000  SEI
+        0xA2, 0x00,             // C001  LDX #$00
+        0xA9, 0x00,             // C003  LDA #$00
+        0x8D, 0x02, 0xDF,       // C005  STA $DF02      C64 address $0400
+        0x8D, 0x04, 0xDF,       // C008  STA $DF04      REU address $xx0000
+        0x8D, 0x05, 0xDF,       // C00B  STA $DF05
+        0x8D, 0x07, 0xDF,       // C00E  STA $DF07      length $1000
+        0xA9, 0x04,             // C011  LDA #$04
+        0x8D, 0x03, 0xDF,       // C013  STA $DF03
+        0x8E, 0x06, 0xDF,       // C016  STX $DF06      REU bank
+        0xA9, 0x10,             // C019  LDA #$10
+        0x8D, 0x08, 0xDF,       // C01B  STA $DF08
+        0xA9, 0xB0,             // C01E  LDA #$B0
+        0x8D, 0x01, 0xDF,       // C020  STA $DF01      stash, autoload
+        0xA9, 0xB1,             // C023  LDA #$B1
+        0x8D, 0x01, 0xDF,       // C025  STA $DF01      fetch, autoload
+        0xE8,                   // C028  INX
+        0x8A,                   // C029  TXA
+        0x29, 0x07,             // C02A  AND #$07       1750 has 8 banks
+        0xAA,                   // C02C  TAX
+        0x4C, 0x03, 0xC0        // C02D  JMP $C003
+    };
+}
+
+std::vector<uint8_t> BenchmarkSuite::reuBulkProgram()
+{
+    return
+    {
+        0x78,                   // C000  SEI
+        0xA2, 0x00,             // C001  LDX #$00
+        0xA0, 0xB0,             // C003  LDY #$B0       stash first
+        0xA9, 0x00,             // C005  LDA #$00
+        0x8D, 0x02, 0xDF,       // C007  STA $DF02      C64 address $4000
+        0x8D, 0x04, 0xDF,       // C00A  STA $DF04      REU address $xx0000
+        0x8D, 0x05, 0xDF,       // C00D  STA $DF05
+        0x8D, 0x07, 0xDF,       // C010  STA $DF07      length $2000
+        0xA9, 0x40,             // C013  LDA #$40
+        0x8D, 0x03, 0xDF,       // C015  STA $DF03
+        0xA9, 0x20,             // C018  LDA #$20
+        0x8D, 0x08, 0xDF,       // C01A  STA $DF08
+        0x8E, 0x06, 0xDF,       // C01D  STX $DF06      REU bank
+        0x8C, 0x01, 0xDF,       // C020  STY $DF01      stash, fetch, swap, verify
+        0xC8,                   // C023  INY
+        0xC0, 0xB4,             // C024  CPY #$B4
+        0xD0, 0xDD,             // C026  BNE $C005
+        0xE8,                   // C028  INX
+        0x8A,                   // C029  TXA
+        0x29, 0x07,             // C02A  AND #$07       1750 has 8 banks
+        0xAA,                   // C02C  TAX
+        0x4C, 0x03, 0xC0        // C02D  JMP $C003
+    };
+}
+
+std::string BenchmarkSuite::jsonEscape(const std::string& text)
+{
+    std::string out;
+    out.reserve(text.size());
+
+    for (char c : text)
+    {
+        switch (c)
+        {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                    out += ' ';
+                else
+                    out += c;
+                break;
+        }
+    }
+
+    return out;
+}
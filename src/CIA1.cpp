@@ -6,6 +6,7 @@
 // of this code in whole or in part for any other purpose is
 // strictly prohibited without the prior written consent of the author.
 #include "cia1.h"
+#include <algorithm>
 #include <cstring>
 #include <sstream>
 #include <stdexcept>
@@ -234,43 +235,79 @@ uint8_t CIA1::readPortB()
 
 void CIA1::postTimerUpdates(uint32_t cyclesElapsed)
 {
-    // Cassette handler (FLAG falling-edge detection)
-    for (uint32_t i = 0; i < cyclesElapsed; ++i)
+    if (cyclesElapsed == 0)
+        return;
+
+    // Cassette handler (FLAG falling-edge detection). The gate can only change between
+    // calls, Memory and Cassette sync us first through syncCassetteLine()
+    const bool motorOn  = mem ? mem->isCassetteMotorOn()
+                              : (cass ? cass->motorOn() : false);
+    const bool senseLow = mem ? mem->getCassetteSenseLow() : false;
+    const bool allow    = motorOn && senseLow;
+
+    if (allow && !gateWasOpenPrev)
     {
-        const bool motorOn  = mem ? mem->isCassetteMotorOn()
-                                  : (cass ? cass->motorOn() : false);
-        const bool senseLow = mem ? mem->getCassetteSenseLow() : false;
-        const bool allow    = motorOn && senseLow;
+        prevReadLevel = true; // prime so the next low becomes a falling edge
+    }
+    gateWasOpenPrev = allow;
 
-        if (allow && !gateWasOpenPrev)
-        {
-            prevReadLevel = true; // prime so the next low becomes a falling edge
-        }
-        gateWasOpenPrev = allow;
+    if (!allow || !cass)
+    {
+        // Gate closed or no device: line is pulled up; DO NOT touch prevReadLevel
+        cassetteReadLineLevel = true;
+        return;
+    }
 
-        if (allow && cass)
-        {
-            // Advance tape by one CPU cycle and sample READ
-            cass->tick();
-            const bool level = cass->getData(); // true = high (idle), false = low (pulse)
-            cassetteReadLineLevel = level;
+    // The READ line holds its level between pulse edges, so run the tape edge to edge.
+    // cyclesUntilLineEvent() keeps every falling edge at the end of a call.
+    while (cyclesElapsed > 0)
+    {
+        const bool before = cass->getData();
 
-            if (prevReadLevel && !level)
-            {
-                triggerInterrupt(INTERRUPT_FLAG_LINE);
-            }
+        uint32_t step = 1;
+        if (!(prevReadLevel && !before))
+            step = std::min(cyclesElapsed, cass->cyclesUntilDataChange());
 
-            // Remember for next cycle (only when gate open)
-            prevReadLevel = level;
-        }
-        else
+        cass->advance(step);
+        const bool level = cass->getData(); // true = high (idle), false = low (pulse)
+        cassetteReadLineLevel = level;
+
+        // Inside a run the line sat at its old level
+        const bool prev = (step > 1) ? before : prevReadLevel;
+        if (prev && !level)
         {
-            // Gate closed or no device: line is pulled up; DO NOT touch prevReadLevel
-            cassetteReadLineLevel = true;
+            triggerInterrupt(INTERRUPT_FLAG_LINE);
         }
+
+        // Remember for next cycle (only when gate open)
+        prevReadLevel = level;
+        cyclesElapsed -= step;
     }
 }
 
+uint32_t CIA1::cyclesUntilLineEvent()
+{
+    const bool motorOn  = mem ? mem->isCassetteMotorOn()
+                              : (cass ? cass->motorOn() : false);
+    const bool senseLow = mem ? mem->getCassetteSenseLow() : false;
+
+    if (!motorOn || !senseLow || !cass)
+        return std::numeric_limits<uint32_t>::max();
+
+    // A line that is already low is a falling edge on the first cycle after priming
+    const bool prev = gateWasOpenPrev ? prevReadLevel : true;
+    if (prev && !cass->getData())
+        return 1;
+
+    return cass->cyclesUntilDataChange();
+}
+
+void CIA1::syncCassetteLine()
+{
+    syncClock();
+    requestReschedule();
+}
+
 void CIA1::irqLineChanged(bool active)
 {
     if (!IRQ) return;
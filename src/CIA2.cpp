@@ -176,6 +176,9 @@ uint8_t CIA2::readPortA()
     // Always sample IEC input wires for PA6/PA7 (BIT $DD00 polls these)
     if (bus)
     {
+        // Threaded drives have to be where the C64 is before the wires can be sampled
+        bus->syncDrives();
+
         const bool clkHigh  = bus->readClkLine();   // true = wire high (released)
         const bool dataHigh = bus->readDataLine();  // true = wire high (released)
 
@@ -243,6 +246,13 @@ void CIA2::postTimerUpdates(uint32_t cyclesElapsed)
         flag2Changed(userPort->getFlag2());
     }
 }
+
+bool CIA2::needsEveryCycle()
+{
+    // An idle user port device has nothing to clock and holds /FLAG2 steady
+    return userPort && !userPort->isIdle();
+}
+
 void CIA2::irqLineChanged(bool active)
 {
     nmiAsserted = active;
@@ -12,7 +12,10 @@
 
 CIA6526::CIA6526() :
     dataBus(nullptr),
+    scheduler(nullptr),
     traceMgr(nullptr),
+    schedulerSlot(EventScheduler::Slot::CIA1),
+    syncedCycle(0),
     portA(0xFF),
     portB(0xFF),
     ddrA(0x00),
@@ -46,8 +49,21 @@ CIA6526::CIA6526() :
 
 CIA6526::~CIA6526() = default;
 
+void CIA6526::attachSchedulerInstance(EventScheduler* scheduler, EventScheduler::Slot slot)
+{
+    this->scheduler = scheduler;
+    schedulerSlot = slot;
+    syncedCycle = scheduler ? scheduler->now() : 0;
+
+    if (scheduler)
+        scheduler->attach(slot, this);
+}
+
 void CIA6526::reset()
 {
+    // Cycles before the reset are dropped, not replayed
+    syncedCycle = scheduler ? scheduler->now() : 0;
+
     portA               = 0xFF;
     portB               = 0xFF;
     ddrA                = 0x00;
@@ -100,16 +116,24 @@ void CIA6526::reset()
 
     shiftReg            = 0;
     shiftCount          = 0;
+
+    requestReschedule();
 }
 
 void CIA6526::setMode(VideoMode mode)
 {
+    syncClock();
+
     mode_ = mode;
     todIncrementThreshold = (mode_ == VideoMode::NTSC) ? 102273 : 98525;
+
+    requestReschedule();
 }
 
 void CIA6526::setCNTLine(bool level)
 {
+    syncClock();
+
     const bool falling = cntLevel && !level;
 
     if (traceMgr && traceMgr->ciaDetailOn(getCIANumber(), TraceManager::TraceDetail::CIA_CNT))
@@ -131,6 +155,78 @@ void CIA6526::setCNTLine(bool level)
 
     cntChangedA();
     cntChangedB();
+
+    requestReschedule();
+}
+
+void CIA6526::catchUp()
+{
+    syncClock();
+    scheduleNextEvent();
+}
+
+void CIA6526::syncClock()
+{
+    if (!scheduler)
+        return;
+
+    const uint64_t now = scheduler->now();
+    if (now == syncedCycle)
+        return;
+
+    uint64_t elapsed = now - syncedCycle;
+
+    // Mark the cycles as applied first, updateTimers() can call back out to the machine
+    syncedCycle = now;
+
+    while (elapsed > 0)
+    {
+        const uint32_t step = elapsed > 0xFFFFFFFFu ? 0xFFFFFFFFu : static_cast<uint32_t>(elapsed);
+        updateTimers(step);
+        elapsed -= step;
+    }
+}
+
+void CIA6526::requestReschedule()
+{
+    // Run one ordinary cycle next, catchUp() then finds the real next event
+    if (scheduler)
+        scheduler->schedule(schedulerSlot, scheduler->now() + 1);
+}
+
+uint32_t CIA6526::cyclesUntilNextEvent()
+{
+    if (needsEveryCycle())
+        return 1;
+
+    // TOD tick, also where the alarm can next match
+    uint32_t next = (todTicks < todIncrementThreshold) ? todIncrementThreshold - todTicks : 1;
+
+    // External line edges
+    const uint32_t line = cyclesUntilLineEvent();
+    if (line < next) next = line;
+
+    // Timer A counting Phi2
+    if ((timerAControl & 0x21) == 0x01)
+    {
+        const uint32_t cur = timerA ? timerA : 0x10000u;
+        if (cur < next) next = cur;
+    }
+
+    // Timer B counting Phi2, CNT and cascade modes are driven from elsewhere
+    if ((timerBControl & 0x61) == 0x01)
+    {
+        const uint32_t cur = timerB ? timerB : 0x10000u;
+        if (cur < next) next = cur;
+    }
+
+    return next;
+}
+
+void CIA6526::scheduleNextEvent()
+{
+    if (scheduler)
+        scheduler->schedule(schedulerSlot, syncedCycle + cyclesUntilNextEvent());
 }
 
 void CIA6526::updateTimers(uint32_t cyclesElapsed)
@@ -156,6 +252,8 @@ void CIA6526::updateTimers(uint32_t cyclesElapsed)
 
 uint8_t CIA6526::readRegister(uint16_t address)
 {
+    syncClock();
+
     const uint8_t reg = static_cast<uint8_t>(address & 0x0F);
     uint8_t result = 0xFF;
 
@@ -290,6 +388,9 @@ uint8_t CIA6526::readRegister(uint16_t address)
             interruptStatus = 0;
 
             updateIRQLine();
+
+            // A still matching TOD alarm fires again
+            requestReschedule();
             break;
         }
 
@@ -317,6 +418,11 @@ uint8_t CIA6526::readRegister(uint16_t address)
 
 void CIA6526::writeRegister(uint16_t address, uint8_t value)
 {
+    syncClock();
+
+    // Any write can move the next underflow, TOD alarm or wake a port device
+    requestReschedule();
+
     uint8_t reg = address & 0x0F;
 
     switch(reg)
@@ -1053,6 +1159,9 @@ bool CIA6526::loadBaseState(StateReader& rdr)
     for (int i = 0; i < 4; ++i)
         if (!rdr.readU8(todAlarm[i]))       return false;
 
+    syncedCycle = scheduler ? scheduler->now() : 0;
+    requestReschedule();
+
     return true;
 }
 
@@ -1124,6 +1233,9 @@ bool CIA6526::loadBaseRuntimeState(StateReader& rdr)
     if (!rdr.readU8(shiftReg))              return false;
     if (!rdr.readU8(shiftCount))            return false;
 
+    syncedCycle = scheduler ? scheduler->now() : 0;
+    requestReschedule();
+
     return true;
 }
 
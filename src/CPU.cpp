@@ -28,6 +28,7 @@ CPU::CPU() :
     microSequenceType(CpuMicroSequenceType::None),
     microInterruptVectorAddress(0),
     microInterruptSPBefore(0),
+    microProgram(nullptr),
     microOpCount(0),
     microOpIndex(0),
     microInstructionActive(false),
@@ -65,6 +66,7 @@ CPU::CPU() :
     pendingOpcodeAddress(0),
     cycles(0),
     totalCycles(0),
+    instructionCount(0),
     elapsedCycles(0),
     lastCycleCount(0),
     A(0),
@@ -84,7 +86,6 @@ CPU::CPU() :
     lastMicroOpIndexAtEnd(0)
 {
     currentBusCycle = {};
-    initializeOpcodeTable();
 }
 
 CPU::~CPU() = default;
@@ -249,7 +250,7 @@ void CPU::reset()
     microSequenceType           = CpuMicroSequenceType::None;
     microInterruptVectorAddress = 0;
     microInterruptSPBefore      = 0;
-    microOps                    = {};
+    microProgram                = nullptr;
     microOpCount                = 0;
     microOpIndex                = 0;
     microAddress                = 0;
@@ -313,7 +314,7 @@ void CPU::setNMILine(bool asserted)
     {
         nmiPending = true;
 
-        if (traceMgr)
+        if (traceActive())
             traceMgr->recordCPUNMI("NMI rising edge -> pending set", makeCpuStamp());
     }
 
@@ -341,7 +342,7 @@ void CPU::handleIRQ()
     if (!IRQ || !IRQ->isIRQActive())
         return;
 
-    if (traceMgr)
+    if (traceActive())
         traceMgr->recordCPUIRQ("IRQ line active", makeCpuStamp());
 
     executeIRQ();
@@ -352,7 +353,7 @@ void CPU::handleNMI()
     if (!nmiPending)
         return;
 
-    if (traceMgr)
+    if (traceActive())
         traceMgr->recordCPUNMI("NMI pending consumed", makeCpuStamp());
 
     nmiPending = false;
@@ -361,7 +362,7 @@ void CPU::handleNMI()
 
 void CPU::pulseNMI()
 {
-    if (traceMgr)
+    if (traceActive())
         traceMgr->recordCPUNMI("pulseNMI()", makeCpuStamp());
 
     setNMILine(true);
@@ -388,7 +389,7 @@ void CPU::executeIRQ()
     const uint16_t irqReturnPC = PC;
     const uint8_t spBefore = SP;
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "IRQ accepted at PC=$"
@@ -410,7 +411,7 @@ void CPU::executeIRQ()
     status &= ~0x10; // clear B
     status |= 0x20;  // set U / unused bit
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "IRQ pushed return=$"
@@ -443,7 +444,7 @@ void CPU::executeIRQ()
     lastInterruptEntry.vectorTarget = irqVector;
     lastInterruptEntry.totalCycles = totalCycles;
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "IRQ vector -> PC=$"
@@ -462,7 +463,7 @@ void CPU::executeNMI()
     const uint16_t nmiReturnPC = PC;
     const uint8_t spBefore = SP;
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "NMI accepted at PC=$"
@@ -481,7 +482,7 @@ void CPU::executeNMI()
     status &= ~0x10; // B=0 for hardware interrupt
     status |= 0x20;  // U/bit 5 set in pushed status
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "NMI pushed return=$"
@@ -512,7 +513,7 @@ void CPU::executeNMI()
     lastInterruptEntry.vectorTarget = nmiVector;
     lastInterruptEntry.totalCycles = totalCycles;
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "NMI vector -> PC=$"
@@ -531,15 +532,13 @@ uint8_t CPU::cpuRead(uint16_t address, CpuBusCycleType type)
     currentBusCycle = { type, address, 0 };
     busCycleActive = true;
 
-    if (shouldRDYStallForBusCycle(type))
+    // The RDY/AEC checks below only feed the trace
+    if (traceActive())
     {
-        if (traceMgr)
+        if (shouldRDYStallForBusCycle(type))
             traceMgr->recordCPUBA("RDY/BA low during read-like CPU bus cycle", makeCpuStamp());
-    }
 
-    if (shouldAECBlockBusCycle(type))
-    {
-        if (traceMgr)
+        if (shouldAECBlockBusCycle(type))
             traceMgr->recordCPUBA("AEC low during CPU read bus cycle", makeCpuStamp());
     }
 
@@ -556,11 +555,8 @@ void CPU::cpuWrite(uint16_t address, uint8_t value, CpuBusCycleType type)
     currentBusCycle = { type, address, value };
     busCycleActive = true;
 
-    if (shouldAECBlockBusCycle(type))
-    {
-        if (traceMgr)
-            traceMgr->recordCPUBA("AEC low during CPU write bus cycle", makeCpuStamp());
-    }
+    if (traceActive() && shouldAECBlockBusCycle(type))
+        traceMgr->recordCPUBA("AEC low during CPU write bus cycle", makeCpuStamp());
 
     if (dataBus)
         dataBus->drive(value, DataBusLatch::Driver::CPU);
@@ -636,268 +632,6 @@ CPU::CPUState CPU::getState() const
     return st;
 }
 
-void CPU::initializeOpcodeTable()
-{
-    opcodeTable.fill([this]() { NOP(0xEA); }); // Default to NOP
-
-    opcodeTable[0x00] = [this]() { BRK(); };
-    opcodeTable[0x01] = [this]() { ORA(0x01); };
-    opcodeTable[0x02] = [this]() { JAM(); };
-    opcodeTable[0x03] = [this]() { SLO(0x03); };
-    opcodeTable[0x04] = [this]() { NOP(0x04); };
-    opcodeTable[0x05] = [this]() { ORA(0x05); };
-    opcodeTable[0x06] = [this]() { ASL(0x06); };
-    opcodeTable[0x07] = [this]() { SLO(0x07); };
-    opcodeTable[0x08] = [this]() { PHP(); };
-    opcodeTable[0x09] = [this]() { ORA(0x09); };
-    opcodeTable[0x0A] = [this]() { ASL(0x0A); };
-    opcodeTable[0x0B] = [this]() { AAC(); };
-    opcodeTable[0x0C] = [this]() { NOP(0x0C); };
-    opcodeTable[0x0D] = [this]() { ORA(0x0D); };
-    opcodeTable[0x0E] = [this]() { ASL(0x0E); };
-    opcodeTable[0x0F] = [this]() { SLO(0x0F); };
-    opcodeTable[0x10] = [this]() { BPL(); };
-    opcodeTable[0x11] = [this]() { ORA(0x11); };
-    opcodeTable[0x12] = [this]() { JAM(); };
-    opcodeTable[0x13] = [this]() { SLO(0x13); };
-    opcodeTable[0x14] = [this]() { NOP(0x14); };
-    opcodeTable[0x15] = [this]() { ORA(0x15); };
-    opcodeTable[0x16] = [this]() { ASL(0x16); };
-    opcodeTable[0x17] = [this]() { SLO(0x17); };
-    opcodeTable[0x18] = [this]() { CLC(); };
-    opcodeTable[0x19] = [this]() { ORA(0x19); };
-    opcodeTable[0x1A] = [this]() { NOP(0x1A); };
-    opcodeTable[0x1B] = [this]() { SLO(0x1B); };
-    opcodeTable[0x1C] = [this]() { NOP(0x1C); };
-    opcodeTable[0x1D] = [this]() { ORA(0x1D); };
-    opcodeTable[0x1E] = [this]() { ASL(0x1E); };
-    opcodeTable[0x1F] = [this]() { SLO(0x1F); };
-    opcodeTable[0x20] = [this]() { JSR(); };
-    opcodeTable[0x21] = [this]() { AND(0x21); };
-    opcodeTable[0x22] = [this]() { JAM(); };
-    opcodeTable[0x23] = [this]() { RLA(0x23); };
-    opcodeTable[0x24] = [this]() { BIT(0x24); };
-    opcodeTable[0x25] = [this]() { AND(0x25); };
-    opcodeTable[0x26] = [this]() { ROL(0x26); };
-    opcodeTable[0x27] = [this]() { RLA(0x27); };
-    opcodeTable[0x28] = [this]() { PLP(); };
-    opcodeTable[0x29] = [this]() { AND(0x29); };
-    opcodeTable[0x2A] = [this]() { ROL(0x2A); };
-    opcodeTable[0x2B] = [this]() { AAC(); };
-    opcodeTable[0x2C] = [this]() { BIT(0x2C); };
-    opcodeTable[0x2D] = [this]() { AND(0x2D); };
-    opcodeTable[0x2E] = [this]() { ROL(0x2E); };
-    opcodeTable[0x2F] = [this]() { RLA(0x2F); };
-    opcodeTable[0x30] = [this]() { BMI(); };
-    opcodeTable[0x31] = [this]() { AND(0x31); };
-    opcodeTable[0x32] = [this]() { JAM(); };
-    opcodeTable[0x33] = [this]() { RLA(0x33); };
-    opcodeTable[0x34] = [this]() { NOP(0x34); };
-    opcodeTable[0x35] = [this]() { AND(0x35); };
-    opcodeTable[0x36] = [this]() { ROL(0x36); };
-    opcodeTable[0x37] = [this]() { RLA(0x37); };
-    opcodeTable[0x38] = [this]() { SEC(); };
-    opcodeTable[0x39] = [this]() { AND(0x39); };
-    opcodeTable[0x3A] = [this]() { NOP(0x3A); };
-    opcodeTable[0x3B] = [this]() { RLA(0x3B); };
-    opcodeTable[0x3C] = [this]() { NOP(0x3C); };
-    opcodeTable[0x3D] = [this]() { AND(0x3D); };
-    opcodeTable[0x3E] = [this]() { ROL(0x3E); };
-    opcodeTable[0x3F] = [this]() { RLA(0x3F); };
-    opcodeTable[0x40] = [this]() { RTI(); };
-    opcodeTable[0x41] = [this]() { EOR(0x41); };
-    opcodeTable[0x42] = [this]() { JAM(); };
-    opcodeTable[0x43] = [this]() { SRE(0x43); };
-    opcodeTable[0x44] = [this]() { NOP(0x44); };
-    opcodeTable[0x45] = [this]() { EOR(0x45); };
-    opcodeTable[0x46] = [this]() { LSR(0x46); };
-    opcodeTable[0x47] = [this]() { SRE(0x47); };
-    opcodeTable[0x48] = [this]() { PHA(); };
-    opcodeTable[0x49] = [this]() { EOR(0x49); };
-    opcodeTable[0x4A] = [this]() { LSR(0x4A); };
-    opcodeTable[0x4B] = [this]() { ALR(); };
-    opcodeTable[0x4C] = [this]() { JMP(0x4C); };
-    opcodeTable[0x4D] = [this]() { EOR(0x4D); };
-    opcodeTable[0x4E] = [this]() { LSR(0x4E); };
-    opcodeTable[0x4F] = [this]() { SRE(0x4F); };
-    opcodeTable[0x50] = [this]() { BVC(); };
-    opcodeTable[0x51] = [this]() { EOR(0x51); };
-    opcodeTable[0x52] = [this]() { JAM(); };
-    opcodeTable[0x53] = [this]() { SRE(0x53); };
-    opcodeTable[0x54] = [this]() { NOP(0x54); };
-    opcodeTable[0x55] = [this]() { EOR(0x55); };
-    opcodeTable[0x56] = [this]() { LSR(0x56); };
-    opcodeTable[0x57] = [this]() { SRE(0x57); };
-    opcodeTable[0x58] = [this]() { CLI(); };
-    opcodeTable[0x59] = [this]() { EOR(0x59); };
-    opcodeTable[0x5A] = [this]() { NOP(0x5A); };
-    opcodeTable[0x5B] = [this]() { SRE(0x5B); };
-    opcodeTable[0x5C] = [this]() { NOP(0x5C); };
-    opcodeTable[0x5D] = [this]() { EOR(0x5D); };
-    opcodeTable[0x5E] = [this]() { LSR(0x5E); };
-    opcodeTable[0x5F] = [this]() { SRE(0x5F); };
-    opcodeTable[0x60] = [this]() { RTS(); };
-    opcodeTable[0x61] = [this]() { ADC(0x61); };
-    opcodeTable[0x62] = [this]() { JAM(); };
-    opcodeTable[0x63] = [this]() { RRA(0x63); };
-    opcodeTable[0x64] = [this]() { NOP(0x64); };
-    opcodeTable[0x65] = [this]() { ADC(0x65); };
-    opcodeTable[0x66] = [this]() { ROR(0x66); };
-    opcodeTable[0x67] = [this]() { RRA(0x67); };
-    opcodeTable[0x68] = [this]() { PLA(); };
-    opcodeTable[0x69] = [this]() { ADC(0x69); };
-    opcodeTable[0x6A] = [this]() { ROR(0x6A); };
-    opcodeTable[0x6B] = [this]() { ARR(); };
-    opcodeTable[0x6C] = [this]() { JMP(0x6C); };
-    opcodeTable[0x6D] = [this]() { ADC(0x6D); };
-    opcodeTable[0x6E] = [this]() { ROR(0x6E); };
-    opcodeTable[0x6F] = [this]() { RRA(0x6F); };
-    opcodeTable[0x70] = [this]() { BVS(); };
-    opcodeTable[0x71] = [this]() { ADC(0x71); };
-    opcodeTable[0x72] = [this]() { JAM(); };
-    opcodeTable[0x73] = [this]() { RRA(0x73); };
-    opcodeTable[0x74] = [this]() { NOP(0x74); };
-    opcodeTable[0x75] = [this]() { ADC(0x75); };
-    opcodeTable[0x76] = [this]() { ROR(0x76); };
-    opcodeTable[0x77] = [this]() { RRA(0x77); };
-    opcodeTable[0x78] = [this]() { SEI(); };
-    opcodeTable[0x79] = [this]() { ADC(0x79); };
-    opcodeTable[0x7A] = [this]() { NOP(0x7A); };
-    opcodeTable[0x7B] = [this]() { RRA(0x7B); };
-    opcodeTable[0x7C] = [this]() { NOP(0x7C); };
-    opcodeTable[0x7D] = [this]() { ADC(0x7D); };
-    opcodeTable[0x7E] = [this]() { ROR(0x7E); };
-    opcodeTable[0x7F] = [this]() { RRA(0x7F); };
-    opcodeTable[0x80] = [this]() { NOP(0x80); };
-    opcodeTable[0x81] = [this]() { STA(0x81); };
-    opcodeTable[0x82] = [this]() { NOP(0x82); };
-    opcodeTable[0x83] = [this]() { SAX(0x83); };
-    opcodeTable[0x84] = [this]() { STY(0x84); };
-    opcodeTable[0x85] = [this]() { STA(0x85); };
-    opcodeTable[0x86] = [this]() { STX(0x86); };
-    opcodeTable[0x87] = [this]() { SAX(0x87); };
-    opcodeTable[0x88] = [this]() { DEY(); };
-    opcodeTable[0x89] = [this]() { NOP(0x89); };
-    opcodeTable[0x8A] = [this]() { TXA(); };
-    opcodeTable[0x8B] = [this]() { XAA(); };
-    opcodeTable[0x8C] = [this]() { STY(0x8C); };
-    opcodeTable[0x8D] = [this]() { STA(0x8D); };
-    opcodeTable[0x8E] = [this]() { STX(0x8E); };
-    opcodeTable[0x8F] = [this]() { SAX(0x8F); };
-    opcodeTable[0x90] = [this]() { BCC(); };
-    opcodeTable[0x91] = [this]() { STA(0x91); };
-    opcodeTable[0x92] = [this]() { JAM(); };
-    opcodeTable[0x93] = [this]() { AHX(0x93); };
-    opcodeTable[0x94] = [this]() { STY(0x94); };
-    opcodeTable[0x95] = [this]() { STA(0x95); };
-    opcodeTable[0x96] = [this]() { STX(0x96); };
-    opcodeTable[0x97] = [this]() { SAX(0x97); };
-    opcodeTable[0x98] = [this]() { TYA(); };
-    opcodeTable[0x99] = [this]() { STA(0x99); };
-    opcodeTable[0x9A] = [this]() { TXS(); };
-    opcodeTable[0x9B] = [this]() { TAS(); };
-    opcodeTable[0x9C] = [this]() { SHY(); };
-    opcodeTable[0x9D] = [this]() { STA(0x9D); };
-    opcodeTable[0x9E] = [this]() { SHX(); };
-    opcodeTable[0x9F] = [this]() { AHX(0x9F); };
-    opcodeTable[0xA0] = [this]() { LDY(0xA0); };
-    opcodeTable[0xA1] = [this]() { LDA(0xA1); };
-    opcodeTable[0xA2] = [this]() { LDX(0xA2); };
-    opcodeTable[0xA3] = [this]() { LAX(0xA3); };
-    opcodeTable[0xA4] = [this]() { LDY(0xA4); };
-    opcodeTable[0xA5] = [this]() { LDA(0xA5); };
-    opcodeTable[0xA6] = [this]() { LDX(0xA6); };
-    opcodeTable[0xA7] = [this]() { LAX(0xA7); };
-    opcodeTable[0xA8] = [this]() { TAY(); };
-    opcodeTable[0xA9] = [this]() { LDA(0xA9); };
-    opcodeTable[0xAA] = [this]() { TAX(); };
-    opcodeTable[0xAB] = [this]() { LAX(0xAB); };
-    opcodeTable[0xAC] = [this]() { LDY(0xAC); };
-    opcodeTable[0xAD] = [this]() { LDA(0xAD); };
-    opcodeTable[0xAE] = [this]() { LDX(0xAE); };
-    opcodeTable[0xAF] = [this]() { LAX(0xAF); };
-    opcodeTable[0xB0] = [this]() { BCS(); };
-    opcodeTable[0xB1] = [this]() { LDA(0xB1); };
-    opcodeTable[0xB2] = [this]() { JAM(); };
-    opcodeTable[0xB3] = [this]() { LAX(0xB3); };
-    opcodeTable[0xB4] = [this]() { LDY(0xB4); };
-    opcodeTable[0xB5] = [this]() { LDA(0xB5); };
-    opcodeTable[0xB6] = [this]() { LDX(0xB6); };
-    opcodeTable[0xB7] = [this]() { LAX(0xB7); };
-    opcodeTable[0xB8] = [this]() { CLV(); };
-    opcodeTable[0xB9] = [this]() { LDA(0xB9); };
-    opcodeTable[0xBA] = [this]() { TSX(); };
-    opcodeTable[0xBB] = [this]() { LAS(); };
-    opcodeTable[0xBC] = [this]() { LDY(0xBC); };
-    opcodeTable[0xBD] = [this]() { LDA(0xBD); };
-    opcodeTable[0xBE] = [this]() { LDX(0xBE); };
-    opcodeTable[0xBF] = [this]() { LAX(0xBF); };
-    opcodeTable[0xC0] = [this]() { CPY(0xC0); };
-    opcodeTable[0xC1] = [this]() { CMP(0xC1); };
-    opcodeTable[0xC2] = [this]() { NOP(0xC2); };
-    opcodeTable[0xC3] = [this]() { DCP(0xC3); };
-    opcodeTable[0xC4] = [this]() { CPY(0xC4); };
-    opcodeTable[0xC5] = [this]() { CMP(0xC5); };
-    opcodeTable[0xC6] = [this]() { DEC(0xC6); };
-    opcodeTable[0xC7] = [this]() { DCP(0xC7); };
-    opcodeTable[0xC8] = [this]() { INY(); };
-    opcodeTable[0xC9] = [this]() { CMP(0xC9); };
-    opcodeTable[0xCA] = [this]() { DEX(); };
-    opcodeTable[0xCB] = [this]() { AXS(); };
-    opcodeTable[0xCC] = [this]() { CPY(0xCC); };
-    opcodeTable[0xCD] = [this]() { CMP(0xCD); };
-    opcodeTable[0xCE] = [this]() { DEC(0xCE); };
-    opcodeTable[0xCF] = [this]() { DCP(0xCF); };
-    opcodeTable[0xD0] = [this]() { BNE(); };
-    opcodeTable[0xD1] = [this]() { CMP(0xD1); };
-    opcodeTable[0xD2] = [this]() { JAM(); };
-    opcodeTable[0xD3] = [this]() { DCP(0xD3); };
-    opcodeTable[0xD4] = [this]() { NOP(0xD4); };
-    opcodeTable[0xD5] = [this]() { CMP(0xD5); };
-    opcodeTable[0xD6] = [this]() { DEC(0xD6); };
-    opcodeTable[0xD7] = [this]() { DCP(0xD7); };
-    opcodeTable[0xD8] = [this]() { CLD(); };
-    opcodeTable[0xD9] = [this]() { CMP(0xD9); };
-    opcodeTable[0xDA] = [this]() { NOP(0xDA); };
-    opcodeTable[0xDB] = [this]() { DCP(0xDB); };
-    opcodeTable[0xDC] = [this]() { NOP(0xDC); };
-    opcodeTable[0xDD] = [this]() { CMP(0xDD); };
-    opcodeTable[0xDE] = [this]() { DEC(0xDE); };
-    opcodeTable[0xDF] = [this]() { DCP(0xDF); };
-    opcodeTable[0xE0] = [this]() { CPX(0xE0); };
-    opcodeTable[0xE1] = [this]() { SBC(0xE1); };
-    opcodeTable[0xE2] = [this]() { NOP(0xE2); };
-    opcodeTable[0xE3] = [this]() { ISC(0xE3); };
-    opcodeTable[0xE4] = [this]() { CPX(0xE4); };
-    opcodeTable[0xE5] = [this]() { SBC(0xE5); };
-    opcodeTable[0xE6] = [this]() { INC(0xE6); };
-    opcodeTable[0xE7] = [this]() { ISC(0xE7); };
-    opcodeTable[0xE8] = [this]() { INX(); };
-    opcodeTable[0xE9] = [this]() { SBC(0xE9); };
-    opcodeTable[0xEA] = [this]() { NOP(0xEA); };
-    opcodeTable[0xEB] = [this]() { SBC(0xEB); };
-    opcodeTable[0xEC] = [this]() { CPX(0xEC); };
-    opcodeTable[0xED] = [this]() { SBC(0xED); };
-    opcodeTable[0xEE] = [this]() { INC(0xEE); };
-    opcodeTable[0xEF] = [this]() { ISC(0xEF); };
-    opcodeTable[0xF0] = [this]() { BEQ(); };
-    opcodeTable[0xF1] = [this]() { SBC(0xF1); };
-    opcodeTable[0xF2] = [this]() { JAM(); };
-    opcodeTable[0xF3] = [this]() { ISC(0xF3); };
-    opcodeTable[0xF4] = [this]() { NOP(0xF4); };
-    opcodeTable[0xF5] = [this]() { SBC(0xF5); };
-    opcodeTable[0xF6] = [this]() { INC(0xF6); };
-    opcodeTable[0xF7] = [this]() { ISC(0xF7); };
-    opcodeTable[0xF8] = [this]() { SED(); };
-    opcodeTable[0xF9] = [this]() { SBC(0xF9); };
-    opcodeTable[0xFA] = [this]() { NOP(0xFA); };
-    opcodeTable[0xFB] = [this]() { ISC(0xFB); };
-    opcodeTable[0xFC] = [this]() { NOP(0xFC); };
-    opcodeTable[0xFD] = [this]() { SBC(0xFD); };
-    opcodeTable[0xFE] = [this]() { INC(0xFE); };
-    opcodeTable[0xFF] = [this]() { ISC(0xFF); };
-}
-
 uint8_t CPU::readABS()
 {
     uint16_t address = absAddress();
@@ -1216,7 +950,7 @@ void CPU::branchIf(bool condition, const char* mnemonic, uint8_t opcode)
 
     if (!condition)
     {
-        if (traceMgr)
+        if (traceActive())
         {
             std::ostringstream oss;
             oss << mnemonic << " not taken at PC=$"
@@ -1264,7 +998,7 @@ void CPU::branchIf(bool condition, const char* mnemonic, uint8_t opcode)
     lastBranch.extraCycles = extraCycles;
     lastBranch.totalCycles = totalCycles;
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << mnemonic << " taken at PC=$"
@@ -1324,7 +1058,7 @@ void CPU::tick()
 
     if (halted)
     {
-        if (traceMgr)
+        if (traceActive())
             traceMgr->recordCPUJam("CPU halted/jammed", makeCpuStamp());
 
         totalCycles++;
@@ -1349,6 +1083,7 @@ void CPU::tick()
             const uint16_t pcExec = PC;
 
             recordExecutionHistory(pcExec);
+            ++instructionCount;
 
             const uint8_t opcode = fetchOpcode();
 
@@ -1363,7 +1098,7 @@ void CPU::tick()
 
             decodeAndExecute(opcode);
 
-            if (traceMgr && traceMgr->isEnabled() &&
+            if (traceActive() &&
                 traceMgr->catOn(TraceManager::TraceCat::CPU) &&
                 traceMgr->cpuDetailOn(TraceManager::TraceDetail::CPU_EXEC))
             {
@@ -1393,6 +1128,30 @@ uint32_t CPU::getElapsedCycles()
     return elapsedCycles;
 }
 
+uint64_t CPU::getLoopSignature() const
+{
+    const bool irqActive = IRQ && IRQ->isIRQActive();
+
+    return (static_cast<uint64_t>(PC) << 48) |
+           (static_cast<uint64_t>(A)  << 40) |
+           (static_cast<uint64_t>(X)  << 32) |
+           (static_cast<uint64_t>(Y)  << 24) |
+           (static_cast<uint64_t>(SP) << 16) |
+           (static_cast<uint64_t>(SR) << 8)  |
+           (irqSuppressOne ? 0x01u : 0x00u)  |
+           (nmiPending     ? 0x02u : 0x00u)  |
+           (nmiLine        ? 0x04u : 0x00u)  |
+           (irqActive      ? 0x08u : 0x00u)  |
+           (halted         ? 0x10u : 0x00u);
+}
+
+void CPU::skipIdleCycles(uint32_t cycleCount, uint32_t instructions)
+{
+    totalCycles += cycleCount;
+    lastCycleCount += cycleCount;
+    instructionCount += instructions;
+}
+
 uint8_t CPU::fetchOpcode()
 {
     const uint8_t byte = cpuRead(PC, CpuBusCycleType::OpcodeFetch);
@@ -1407,10 +1166,47 @@ uint8_t CPU::fetchOperand()
     return byte;
 }
 
+// One plain member function pointer per opcode. Handlers taking an opcode are
+// instantiated for it, so their addressing mode is resolved at compile time.
+const std::array<CPU::OpcodeHandler, 256> CPU::OPCODE_HANDLERS =
+{{
+    &CPU::BRK,       &CPU::ORA<0x01>, &CPU::JAM,       &CPU::SLO<0x03>, &CPU::NOP<0x04>, &CPU::ORA<0x05>, &CPU::ASL<0x06>, &CPU::SLO<0x07>,   // $00
+    &CPU::PHP,       &CPU::ORA<0x09>, &CPU::ASL<0x0A>, &CPU::AAC,       &CPU::NOP<0x0C>, &CPU::ORA<0x0D>, &CPU::ASL<0x0E>, &CPU::SLO<0x0F>,   // $08
+    &CPU::BPL,       &CPU::ORA<0x11>, &CPU::JAM,       &CPU::SLO<0x13>, &CPU::NOP<0x14>, &CPU::ORA<0x15>, &CPU::ASL<0x16>, &CPU::SLO<0x17>,   // $10
+    &CPU::CLC,       &CPU::ORA<0x19>, &CPU::NOP<0x1A>, &CPU::SLO<0x1B>, &CPU::NOP<0x1C>, &CPU::ORA<0x1D>, &CPU::ASL<0x1E>, &CPU::SLO<0x1F>,   // $18
+    &CPU::JSR,       &CPU::AND<0x21>, &CPU::JAM,       &CPU::RLA<0x23>, &CPU::BIT<0x24>, &CPU::AND<0x25>, &CPU::ROL<0x26>, &CPU::RLA<0x27>,   // $20
+    &CPU::PLP,       &CPU::AND<0x29>, &CPU::ROL<0x2A>, &CPU::AAC,       &CPU::BIT<0x2C>, &CPU::AND<0x2D>, &CPU::ROL<0x2E>, &CPU::RLA<0x2F>,   // $28
+    &CPU::BMI,       &CPU::AND<0x31>, &CPU::JAM,       &CPU::RLA<0x33>, &CPU::NOP<0x34>, &CPU::AND<0x35>, &CPU::ROL<0x36>, &CPU::RLA<0x37>,   // $30
+    &CPU::SEC,       &CPU::AND<0x39>, &CPU::NOP<0x3A>, &CPU::RLA<0x3B>, &CPU::NOP<0x3C>, &CPU::AND<0x3D>, &CPU::ROL<0x3E>, &CPU::RLA<0x3F>,   // $38
+    &CPU::RTI,       &CPU::EOR<0x41>, &CPU::JAM,       &CPU::SRE<0x43>, &CPU::NOP<0x44>, &CPU::EOR<0x45>, &CPU::LSR<0x46>, &CPU::SRE<0x47>,   // $40
+    &CPU::PHA,       &CPU::EOR<0x49>, &CPU::LSR<0x4A>, &CPU::ALR,       &CPU::JMP<0x4C>, &CPU::EOR<0x4D>, &CPU::LSR<0x4E>, &CPU::SRE<0x4F>,   // $48
+    &CPU::BVC,       &CPU::EOR<0x51>, &CPU::JAM,       &CPU::SRE<0x53>, &CPU::NOP<0x54>, &CPU::EOR<0x55>, &CPU::LSR<0x56>, &CPU::SRE<0x57>,   // $50
+    &CPU::CLI,       &CPU::EOR<0x59>, &CPU::NOP<0x5A>, &CPU::SRE<0x5B>, &CPU::NOP<0x5C>, &CPU::EOR<0x5D>, &CPU::LSR<0x5E>, &CPU::SRE<0x5F>,   // $58
+    &CPU::RTS,       &CPU::ADC<0x61>, &CPU::JAM,       &CPU::RRA<0x63>, &CPU::NOP<0x64>, &CPU::ADC<0x65>, &CPU::ROR<0x66>, &CPU::RRA<0x67>,   // $60
+    &CPU::PLA,       &CPU::ADC<0x69>, &CPU::ROR<0x6A>, &CPU::ARR,       &CPU::JMP<0x6C>, &CPU::ADC<0x6D>, &CPU::ROR<0x6E>, &CPU::RRA<0x6F>,   // $68
+    &CPU::BVS,       &CPU::ADC<0x71>, &CPU::JAM,       &CPU::RRA<0x73>, &CPU::NOP<0x74>, &CPU::ADC<0x75>, &CPU::ROR<0x76>, &CPU::RRA<0x77>,   // $70
+    &CPU::SEI,       &CPU::ADC<0x79>, &CPU::NOP<0x7A>, &CPU::RRA<0x7B>, &CPU::NOP<0x7C>, &CPU::ADC<0x7D>, &CPU::ROR<0x7E>, &CPU::RRA<0x7F>,   // $78
+    &CPU::NOP<0x80>, &CPU::STA<0x81>, &CPU::NOP<0x82>, &CPU::SAX<0x83>, &CPU::STY<0x84>, &CPU::STA<0x85>, &CPU::STX<0x86>, &CPU::SAX<0x87>,   // $80
+    &CPU::DEY,       &CPU::NOP<0x89>, &CPU::TXA,       &CPU::XAA,       &CPU::STY<0x8C>, &CPU::STA<0x8D>, &CPU::STX<0x8E>, &CPU::SAX<0x8F>,   // $88
+    &CPU::BCC,       &CPU::STA<0x91>, &CPU::JAM,       &CPU::AHX<0x93>, &CPU::STY<0x94>, &CPU::STA<0x95>, &CPU::STX<0x96>, &CPU::SAX<0x97>,   // $90
+    &CPU::TYA,       &CPU::STA<0x99>, &CPU::TXS,       &CPU::TAS,       &CPU::SHY,       &CPU::STA<0x9D>, &CPU::SHX,       &CPU::AHX<0x9F>,   // $98
+    &CPU::LDY<0xA0>, &CPU::LDA<0xA1>, &CPU::LDX<0xA2>, &CPU::LAX<0xA3>, &CPU::LDY<0xA4>, &CPU::LDA<0xA5>, &CPU::LDX<0xA6>, &CPU::LAX<0xA7>,   // $A0
+    &CPU::TAY,       &CPU::LDA<0xA9>, &CPU::TAX,       &CPU::LAX<0xAB>, &CPU::LDY<0xAC>, &CPU::LDA<0xAD>, &CPU::LDX<0xAE>, &CPU::LAX<0xAF>,   // $A8
+    &CPU::BCS,       &CPU::LDA<0xB1>, &CPU::JAM,       &CPU::LAX<0xB3>, &CPU::LDY<0xB4>, &CPU::LDA<0xB5>, &CPU::LDX<0xB6>, &CPU::LAX<0xB7>,   // $B0
+    &CPU::CLV,       &CPU::LDA<0xB9>, &CPU::TSX,       &CPU::LAS,       &CPU::LDY<0xBC>, &CPU::LDA<0xBD>, &CPU::LDX<0xBE>, &CPU::LAX<0xBF>,   // $B8
+    &CPU::CPY<0xC0>, &CPU::CMP<0xC1>, &CPU::NOP<0xC2>, &CPU::DCP<0xC3>, &CPU::CPY<0xC4>, &CPU::CMP<0xC5>, &CPU::DEC<0xC6>, &CPU::DCP<0xC7>,   // $C0
+    &CPU::INY,       &CPU::CMP<0xC9>, &CPU::DEX,       &CPU::AXS,       &CPU::CPY<0xCC>, &CPU::CMP<0xCD>, &CPU::DEC<0xCE>, &CPU::DCP<0xCF>,   // $C8
+    &CPU::BNE,       &CPU::CMP<0xD1>, &CPU::JAM,       &CPU::DCP<0xD3>, &CPU::NOP<0xD4>, &CPU::CMP<0xD5>, &CPU::DEC<0xD6>, &CPU::DCP<0xD7>,   // $D0
+    &CPU::CLD,       &CPU::CMP<0xD9>, &CPU::NOP<0xDA>, &CPU::DCP<0xDB>, &CPU::NOP<0xDC>, &CPU::CMP<0xDD>, &CPU::DEC<0xDE>, &CPU::DCP<0xDF>,   // $D8
+    &CPU::CPX<0xE0>, &CPU::SBC<0xE1>, &CPU::NOP<0xE2>, &CPU::ISC<0xE3>, &CPU::CPX<0xE4>, &CPU::SBC<0xE5>, &CPU::INC<0xE6>, &CPU::ISC<0xE7>,   // $E0
+    &CPU::INX,       &CPU::SBC<0xE9>, &CPU::NOP<0xEA>, &CPU::SBC<0xEB>, &CPU::CPX<0xEC>, &CPU::SBC<0xED>, &CPU::INC<0xEE>, &CPU::ISC<0xEF>,   // $E8
+    &CPU::BEQ,       &CPU::SBC<0xF1>, &CPU::JAM,       &CPU::ISC<0xF3>, &CPU::NOP<0xF4>, &CPU::SBC<0xF5>, &CPU::INC<0xF6>, &CPU::ISC<0xF7>,   // $F0
+    &CPU::SED,       &CPU::SBC<0xF9>, &CPU::NOP<0xFA>, &CPU::ISC<0xFB>, &CPU::NOP<0xFC>, &CPU::SBC<0xFD>, &CPU::INC<0xFE>, &CPU::ISC<0xFF>,   // $F8
+}};
+
 void CPU::decodeAndExecute(uint8_t opcode)
 {
-    if (opcodeTable[opcode])
-        opcodeTable[opcode]();
+    (this->*OPCODE_HANDLERS[opcode])();
 }
 
 void CPU::setFlag(flags flag, bool sc)
@@ -1425,7 +1221,7 @@ void CPU::push(uint8_t value)
 {
     const uint16_t address = uint16_t(0x0100 | SP);
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "PUSH addr=$"
@@ -1450,7 +1246,7 @@ uint8_t CPU::pop()
 
     const uint8_t value = cpuRead(address, CpuBusCycleType::StackRead);
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "POP addr=$"
@@ -1477,7 +1273,8 @@ void CPU::AAC()
     setFlag(N, A & 0x80);
 }
 
-void CPU::ADC(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::ADC()
 {
     uint8_t value = 0;
 
@@ -1516,7 +1313,8 @@ void CPU::ADC(uint8_t opcode)
     adcValue(value);
 }
 
-void CPU::AHX(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::AHX()
 {
     uint16_t base = 0;
     uint16_t address = 0;
@@ -1580,7 +1378,8 @@ void CPU::ALR()
     setFlag(N, A & 0x80);
 }
 
-void CPU::AND(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::AND()
 {
     uint8_t value = 0;
 
@@ -1658,7 +1457,8 @@ void CPU::ARR()
     setFlag(N, A & 0x80);
 }
 
-void CPU::ASL(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::ASL()
 {
     if (opcode == 0x0A) // Accumulator
     {
@@ -1723,7 +1523,8 @@ void CPU::BEQ()
     branchIf(getFlag(Z), "BEQ", 0xF0);
 }
 
-void CPU::BIT(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::BIT()
 {
     uint8_t value = 0;
 
@@ -1759,7 +1560,7 @@ void CPU::BRK()
     const uint16_t newPC = uint16_t(PC + 1); // BRK is treated as a 2-byte instruction
     const uint8_t spBefore = SP;
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "BRK accepted at PC=$"
@@ -1778,7 +1579,7 @@ void CPU::BRK()
 
     const uint8_t pushedStatus = SR | 0x30; // B=1, U=1
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "BRK pushed SR=$"
@@ -1809,7 +1610,7 @@ void CPU::BRK()
     lastInterruptEntry.vectorTarget = vector;
     lastInterruptEntry.totalCycles = totalCycles;
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "BRK vector -> PC=$"
@@ -1831,7 +1632,8 @@ void CPU::BVS()
     branchIf(getFlag(V), "BVS", 0x70);
 }
 
-void CPU::CMP(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::CMP()
 {
     uint8_t value = 0;
 
@@ -1871,7 +1673,8 @@ void CPU::CMP(uint8_t opcode)
     setFlag(C, A >= value);
 }
 
-void CPU::CPX(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::CPX()
 {
     uint8_t value = 0;
 
@@ -1888,7 +1691,8 @@ void CPU::CPX(uint8_t opcode)
     setFlag(C, X >= value);
 }
 
-void CPU::CPY(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::CPY()
 {
     uint8_t value = 0;
 
@@ -1905,7 +1709,8 @@ void CPU::CPY(uint8_t opcode)
     setFlag(C, Y >= value);
 }
 
-void CPU::DCP(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::DCP()
 {
     uint16_t address = 0;
 
@@ -1933,7 +1738,8 @@ void CPU::DCP(uint8_t opcode)
     setFlag(N, diff & 0x80);
 }
 
-void CPU::DEC(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::DEC()
 {
     uint16_t address = 0;
 
@@ -1966,7 +1772,8 @@ void CPU::DEY()
     setFlag(N, Y & 0x80);
 }
 
-void CPU::EOR(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::EOR()
 {
      uint8_t value = 0;
 
@@ -2004,7 +1811,8 @@ void CPU::EOR(uint8_t opcode)
     setFlag(N, A & 0x80);
 }
 
-void CPU::INC(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::INC()
 {
     uint16_t address = 0;
 
@@ -2037,7 +1845,8 @@ void CPU::INY()
     setFlag(N, Y & 0x80);
 }
 
-void CPU::ISC(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::ISC()
 {
     uint16_t address = 0;
 
@@ -2092,7 +1901,8 @@ void CPU::JAM()
     }
 }
 
-void CPU::JMP(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::JMP()
 {
     const uint16_t jmpPC = uint16_t(PC - 1); // opcode address, since opcode fetch already advanced PC
 
@@ -2124,7 +1934,7 @@ void CPU::JMP(uint8_t opcode)
             lastJMP.finalPC = PC;
             lastJMP.totalCycles = totalCycles;
 
-            if (traceMgr)
+            if (traceActive())
             {
                 std::ostringstream oss;
                 oss << "JMP abs at PC=$"
@@ -2177,7 +1987,7 @@ void CPU::JMP(uint8_t opcode)
             lastJMP.finalPC = PC;
             lastJMP.totalCycles = totalCycles;
 
-            if (traceMgr)
+            if (traceActive())
             {
                 std::ostringstream oss;
                 oss << "JMP indirect at PC=$"
@@ -2240,7 +2050,7 @@ void CPU::JSR()
     lastJSR.spAfter = spAfter;
     lastJSR.totalCycles = totalCycles;
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "JSR at PC=$"
@@ -2270,7 +2080,8 @@ void CPU::LAS()
     setFlag(N, result & 0x80);
 }
 
-void CPU::LAX(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::LAX()
 {
     uint8_t value = 0;
 
@@ -2316,7 +2127,8 @@ void CPU::LAX(uint8_t opcode)
     setFlag(N, value & 0x80);
 }
 
-void CPU::LDA(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::LDA()
 {
     uint8_t value = 0;
 
@@ -2358,7 +2170,8 @@ void CPU::LDA(uint8_t opcode)
     setFlag(N, A & 0x80); // Negative flag
 }
 
-void CPU::LDX(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::LDX()
 {
     switch(opcode)
     {
@@ -2378,7 +2191,8 @@ void CPU::LDX(uint8_t opcode)
     setFlag(N, X & 0x80);
 }
 
-void CPU::LDY(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::LDY()
 {
     switch(opcode)
     {
@@ -2398,7 +2212,8 @@ void CPU::LDY(uint8_t opcode)
     setFlag(N, Y & 0x80);
 }
 
-void CPU::LSR(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::LSR()
 {
     if (opcode == 0x4A)
     {
@@ -2432,7 +2247,8 @@ void CPU::LSR(uint8_t opcode)
 
 }
 
-void CPU::NOP(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::NOP()
 {
     switch (opcode)
     {
@@ -2477,7 +2293,8 @@ void CPU::NOP(uint8_t opcode)
     }
 }
 
-void CPU::ORA(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::ORA()
 {
     uint8_t value = 0;
 
@@ -2536,7 +2353,7 @@ void CPU::PHA()
     lastPHA.spAfter = spAfter;
     lastPHA.totalCycles = totalCycles;
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "PHA at PC=$"
@@ -2575,7 +2392,7 @@ void CPU::PHP()
     lastPHP.spAfter = spAfter;
     lastPHP.totalCycles = totalCycles;
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "PHP at PC=$"
@@ -2618,7 +2435,7 @@ void CPU::PLA()
     lastPLA.spAfter = spAfter;
     lastPLA.totalCycles = totalCycles;
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "PLA at PC=$"
@@ -2667,7 +2484,7 @@ void CPU::PLP()
     lastPLP.irqSuppressSet = suppress;
     lastPLP.totalCycles = totalCycles;
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "PLP at PC=$"
@@ -2688,7 +2505,8 @@ void CPU::PLP()
         irqSuppressOne = true;
 }
 
-void CPU::RLA(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::RLA()
 {
     uint16_t address = 0;
 
@@ -2720,7 +2538,8 @@ void CPU::RLA(uint8_t opcode)
     setFlag(N, A & 0x80);
 }
 
-void CPU::ROL(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::ROL()
 {
 
     if (opcode == 0x2A)
@@ -2758,7 +2577,8 @@ void CPU::ROL(uint8_t opcode)
     setFlag(C, carry);
 }
 
-void CPU::ROR(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::ROR()
 {
     if (opcode == 0x6A)
     {
@@ -2797,7 +2617,8 @@ void CPU::ROR(uint8_t opcode)
     setFlag(C, newCarry);
 }
 
-void CPU::RRA(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::RRA()
 {
     uint16_t address = 0;
 
@@ -2874,7 +2695,7 @@ void CPU::RTI()
     lastRTI.irqSuppressSet = false;
     lastRTI.totalCycles = totalCycles;
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "RTI at PC=$"
@@ -2917,7 +2738,7 @@ void CPU::RTS()
     lastRTS.spAfter = spAfter;
     lastRTS.totalCycles = totalCycles;
 
-    if (traceMgr)
+    if (traceActive())
     {
         std::ostringstream oss;
         oss << "RTS at PC=$"
@@ -2932,7 +2753,8 @@ void CPU::RTS()
     }
 }
 
-void CPU::SAX(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::SAX()
 {
     uint16_t ea = 0;
 
@@ -2961,7 +2783,8 @@ void CPU::SAX(uint8_t opcode)
     cpuWrite(ea, uint8_t(A & X), CpuBusCycleType::Write);
 }
 
-void CPU::SBC(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::SBC()
 {
     uint8_t value = 0;
 
@@ -3029,7 +2852,8 @@ void CPU::SHY()
     cpuWrite(address, value, CpuBusCycleType::Write);
 }
 
-void CPU::SLO(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::SLO()
 {
     uint16_t address = 0;
 
@@ -3057,7 +2881,8 @@ void CPU::SLO(uint8_t opcode)
     setFlag(N, A & 0x80);
 }
 
-void CPU::SRE(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::SRE()
 {
     uint16_t address = 0;
 
@@ -3085,7 +2910,8 @@ void CPU::SRE(uint8_t opcode)
     setFlag(N, A & 0x80);
 }
 
-void CPU::STA(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::STA()
 {
     uint16_t ea = 0;
 
@@ -3159,7 +2985,8 @@ void CPU::STA(uint8_t opcode)
     }
 }
 
-void CPU::STX(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::STX()
 {
     uint16_t ea = 0;
 
@@ -3174,7 +3001,8 @@ void CPU::STX(uint8_t opcode)
     cpuWrite(ea, X, CpuBusCycleType::Write);
 }
 
-void CPU::STY(uint8_t opcode)
+template <uint8_t opcode>
+void CPU::STY()
 {
     uint16_t ea = 0;
 
@@ -3293,7 +3121,7 @@ bool CPU::tryFetchOpcode(uint8_t& opcode)
 
     if (vicBusArbitrationEnabled && !aecLine)
     {
-        if (traceMgr)
+        if (traceActive())
             traceMgr->recordCPUBA("AEC low blocks opcode fetch", makeCpuStamp());
 
         busCycleActive = false;
@@ -3303,7 +3131,7 @@ bool CPU::tryFetchOpcode(uint8_t& opcode)
 
     if (vicBusArbitrationEnabled && !rdyLine)
     {
-        if (traceMgr)
+        if (traceActive())
             traceMgr->recordCPUBA("RDY low stalls opcode fetch", makeCpuStamp());
 
         busCycleActive = false;
@@ -3355,7 +3183,7 @@ bool CPU::isWriteLikeBusCycle(CpuBusCycleType type) const
 
 void CPU::clearMicroOps()
 {
-    microOps = {};
+    microProgram = nullptr;
     microOpCount = 0;
     microOpIndex = 0;
     microInstructionActive = false;
@@ -3363,21 +3191,11 @@ void CPU::clearMicroOps()
     microSequenceType = CpuMicroSequenceType::None;
 }
 
-void CPU::pushMicroOp(const CpuMicroOp& op)
+void CPU::startMicroProgram(const CpuMicroProgram& program)
 {
-    if (microOpCount >= microOps.size())
-    {
-        #ifdef Debug
-        std::cerr << "[CPU MICRO-OP OVERFLOW] opcode=$"
-                  << std::hex << std::uppercase << int(activeOpcode)
-                  << " PC=$" << activeOpcodePC
-                  << " capacity=" << microOps.size()
-                  << "\n";
-        #endif
-        return;
-    }
-
-    microOps[microOpCount++] = op;
+    microProgram = &program;
+    microOpCount = program.count;
+    microOpIndex = 0;
 }
 
 bool CPU::executeCurrentMicroOp()
@@ -3385,9 +3203,9 @@ bool CPU::executeCurrentMicroOp()
     if (microOpIndex >= microOpCount)
         return true;
 
-    CpuMicroOp& op = microOps[microOpIndex];
+    const CpuMicroOp& op = microProgram->ops[microOpIndex];
 
-    const uint16_t effectiveAddress = op.useMicroAddress ? microAddress : op.address;
+    const uint16_t effectiveAddress = microOpAddress(op);
 
     currentBusCycle = {op.busType, effectiveAddress, op.value};
 
@@ -3396,7 +3214,7 @@ bool CPU::executeCurrentMicroOp()
 
     if (shouldAECBlockBusCycle(op.busType))
     {
-        if (traceMgr)
+        if (traceActive())
             traceMgr->recordCPUBA("AEC low blocks CPU external bus cycle", makeCpuStamp());
 
         executingMicroOp = false;
@@ -3406,7 +3224,7 @@ bool CPU::executeCurrentMicroOp()
 
     if (shouldRDYStallForBusCycle(op.busType))
     {
-        if (traceMgr)
+        if (traceActive())
             traceMgr->recordCPUBA("RDY/BA low stalls CPU read-like micro-op", makeCpuStamp());
 
         executingMicroOp = false;
@@ -3514,14 +3332,14 @@ bool CPU::executeCurrentMicroOp()
 
         case CpuMicroOpKind::MemoryRead:
         {
-            const uint16_t address = op.useMicroAddress ? microAddress : op.address;
+            const uint16_t address = microOpAddress(op);
             microTemp = mem->read(address);
             break;
         }
 
         case CpuMicroOpKind::MemoryWrite:
         {
-            const uint16_t address = op.useMicroAddress ? microAddress : op.address;
+            const uint16_t address = microOpAddress(op);
             uint8_t value = op.value;
 
             switch (op.action)
@@ -3544,28 +3362,28 @@ bool CPU::executeCurrentMicroOp()
 
                 case CpuMicroAction::StoreYAndHighPlusOne:
                 {
-                    const uint16_t address = op.useMicroAddress ? microAddress : op.address;
+                    const uint16_t address = microOpAddress(op);
                     value = uint8_t(Y & uint8_t(((address >> 8) + 1) & 0xFF));
                     break;
                 }
 
                 case CpuMicroAction::StoreXAndHighPlusOne:
                 {
-                    const uint16_t address = op.useMicroAddress ? microAddress : op.address;
+                    const uint16_t address = microOpAddress(op);
                     value = uint8_t(X & uint8_t(((address >> 8) + 1) & 0xFF));
                     break;
                 }
 
                 case CpuMicroAction::StoreAAndXAndHighPlusOne:
                 {
-                    const uint16_t address = op.useMicroAddress ? microAddress : op.address;
+                    const uint16_t address = microOpAddress(op);
                     value = uint8_t(A & X & uint8_t(((address >> 8) + 1) & 0xFF));
                     break;
                 }
 
                 case CpuMicroAction::StoreSPFromAAndXAndHighPlusOne:
                 {
-                    const uint16_t address = op.useMicroAddress ? microAddress : op.address;
+                    const uint16_t address = microOpAddress(op);
                     SP = uint8_t(A & X);
                     value = uint8_t(SP & uint8_t(((address >> 8) + 1) & 0xFF));
                     break;
@@ -3581,7 +3399,7 @@ bool CPU::executeCurrentMicroOp()
 
         case CpuMicroOpKind::MemoryRMWDummyWriteAndCompute:
         {
-            const uint16_t address = op.useMicroAddress ? microAddress : op.address;
+            const uint16_t address = microOpAddress(op);
             microRMWOldValue = microTemp;
             microRMWNewValue = applyRMWAction(op.action, microTemp);
 
@@ -3593,7 +3411,7 @@ bool CPU::executeCurrentMicroOp()
 
         case CpuMicroOpKind::MemoryRMWFinalWrite:
         {
-            const uint16_t address = op.useMicroAddress ? microAddress : op.address;
+            const uint16_t address = microOpAddress(op);
 
             mem->write(address, microRMWNewValue);
             microTemp = microRMWNewValue;
@@ -3602,9 +3420,9 @@ bool CPU::executeCurrentMicroOp()
 
         case CpuMicroOpKind::DummyRead:
         {
-            uint16_t address = op.useMicroAddress ? microAddress : op.address;
+            uint16_t address = microOpAddress(op);
 
-            if (!op.useMicroAddress && op.address == 0 && microBaseAddress != 0)
+            if (op.source == CpuMicroAddressSource::Fixed && op.address == 0 && microBaseAddress != 0)
                 address = uint16_t((microBaseAddress & 0xFF00) |(microAddress & 0x00FF));
 
             (void)mem->read(address);
@@ -3613,7 +3431,7 @@ bool CPU::executeCurrentMicroOp()
 
         case CpuMicroOpKind::DummyWrite:
         {
-            mem->write(op.address, op.value);
+            mem->write(microOpAddress(op), op.value);
             break;
         }
 
@@ -4489,11 +4307,8 @@ bool CPU::executeCurrentMicroOp()
     return true;
 }
 
-void CPU::buildMicroOpsForOpcode(uint8_t opcode)
+constexpr void CPU::buildMicroOpsForOpcode(CpuMicroProgram& program, uint8_t opcode)
 {
-    microOpCount = 0;
-    microOpIndex = 0;
-
     switch (opcode)
     {
         case 0xEA: // NOP implied
@@ -4501,11 +4316,11 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp op;
             op.kind = CpuMicroOpKind::DummyRead;
             op.busType = CpuBusCycleType::DummyRead;
-            op.address = PC;
+            op.address = 0;
             op.value = 0;
-            op.useMicroAddress = false;
+            op.source = CpuMicroAddressSource::PC;
             op.action = CpuMicroAction::FinishNOP;
-            pushMicroOp(op);
+            program.push(op);
             break;
         }
 
@@ -4519,12 +4334,12 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp nop;
             nop.kind = CpuMicroOpKind::DummyRead;
             nop.busType = CpuBusCycleType::DummyRead;
-            nop.address = PC;
+            nop.address = 0;
             nop.value = 0;
-            nop.useMicroAddress = false;
+            nop.source = CpuMicroAddressSource::PC;
             nop.index = CpuIndexReg::None;
             nop.action = CpuMicroAction::FinishNOP;
-            pushMicroOp(nop);
+            program.push(nop);
             break;
         }
 
@@ -4535,22 +4350,22 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp readZp;
             readZp.kind = CpuMicroOpKind::OperandReadToZP;
             readZp.busType = CpuBusCycleType::Read;
-            readZp.address = PC;
+            readZp.address = 0;
             readZp.value = 0;
-            readZp.useMicroAddress = false;
+            readZp.source = CpuMicroAddressSource::PC;
             readZp.index = CpuIndexReg::None;
             readZp.action = CpuMicroAction::None;
-            pushMicroOp(readZp);
+            program.push(readZp);
 
             CpuMicroOp readIgnored;
             readIgnored.kind = CpuMicroOpKind::MemoryRead;
             readIgnored.busType = CpuBusCycleType::Read;
             readIgnored.address = 0;
             readIgnored.value = 0;
-            readIgnored.useMicroAddress = true;
+            readIgnored.source = CpuMicroAddressSource::Micro;
             readIgnored.index = CpuIndexReg::None;
             readIgnored.action = CpuMicroAction::None;
-            pushMicroOp(readIgnored);
+            program.push(readIgnored);
 
             break;
         }
@@ -4564,12 +4379,12 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp readIgnored;
             readIgnored.kind = CpuMicroOpKind::OperandRead;
             readIgnored.busType = CpuBusCycleType::Read;
-            readIgnored.address = PC;
+            readIgnored.address = 0;
             readIgnored.value = 0;
-            readIgnored.useMicroAddress = false;
+            readIgnored.source = CpuMicroAddressSource::PC;
             readIgnored.index = CpuIndexReg::None;
             readIgnored.action = CpuMicroAction::None;
-            pushMicroOp(readIgnored);
+            program.push(readIgnored);
 
             break;
         }
@@ -4587,12 +4402,12 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp readZp;
             readZp.kind = CpuMicroOpKind::OperandReadToZP;
             readZp.busType = CpuBusCycleType::Read;
-            readZp.address = PC;
+            readZp.address = 0;
             readZp.value = 0;
-            readZp.useMicroAddress = false;
+            readZp.source = CpuMicroAddressSource::PC;
             readZp.index = CpuIndexReg::None;
             readZp.action = CpuMicroAction::None;
-            pushMicroOp(readZp);
+            program.push(readZp);
 
             /*
              * Cycle 3: Dummy-read the unindexed zero-page address,
@@ -4607,10 +4422,10 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
 
             dummyAndIndex.address = 0;
             dummyAndIndex.value = 0;
-            dummyAndIndex.useMicroAddress = true;
+            dummyAndIndex.source = CpuMicroAddressSource::Micro;
             dummyAndIndex.index = CpuIndexReg::X;
             dummyAndIndex.action = CpuMicroAction::None;
-            pushMicroOp(dummyAndIndex);
+            program.push(dummyAndIndex);
 
             /*
              * Cycle 4: Read and discard the final indexed value.
@@ -4620,10 +4435,10 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             readIgnored.busType = CpuBusCycleType::Read;
             readIgnored.address = 0;
             readIgnored.value = 0;
-            readIgnored.useMicroAddress = true;
+            readIgnored.source = CpuMicroAddressSource::Micro;
             readIgnored.index = CpuIndexReg::None;
             readIgnored.action = CpuMicroAction::None;
-            pushMicroOp(readIgnored);
+            program.push(readIgnored);
 
             break;
         }
@@ -4633,32 +4448,32 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp readLo;
             readLo.kind = CpuMicroOpKind::OperandReadToAddress;
             readLo.busType = CpuBusCycleType::Read;
-            readLo.address = PC;
+            readLo.address = 0;
             readLo.value = 0;
-            readLo.useMicroAddress = false;
+            readLo.source = CpuMicroAddressSource::PC;
             readLo.index = CpuIndexReg::None;
             readLo.action = CpuMicroAction::None;
-            pushMicroOp(readLo);
+            program.push(readLo);
 
             CpuMicroOp readHi;
             readHi.kind = CpuMicroOpKind::OperandReadHighToAddress;
             readHi.busType = CpuBusCycleType::Read;
             readHi.address = 0;
             readHi.value = 0;
-            readHi.useMicroAddress = false;
+            readHi.source = CpuMicroAddressSource::Fixed;
             readHi.index = CpuIndexReg::None;
             readHi.action = CpuMicroAction::None;
-            pushMicroOp(readHi);
+            program.push(readHi);
 
             CpuMicroOp readIgnored;
             readIgnored.kind = CpuMicroOpKind::MemoryRead;
             readIgnored.busType = CpuBusCycleType::Read;
             readIgnored.address = 0;
             readIgnored.value = 0;
-            readIgnored.useMicroAddress = true;
+            readIgnored.source = CpuMicroAddressSource::Micro;
             readIgnored.index = CpuIndexReg::None;
             readIgnored.action = CpuMicroAction::None;
-            pushMicroOp(readIgnored);
+            program.push(readIgnored);
 
             break;
         }
@@ -4673,574 +4488,574 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp readLo;
             readLo.kind = CpuMicroOpKind::OperandReadToAddress;
             readLo.busType = CpuBusCycleType::Read;
-            readLo.address = PC;
+            readLo.address = 0;
             readLo.value = 0;
-            readLo.useMicroAddress = false;
+            readLo.source = CpuMicroAddressSource::PC;
             readLo.index = CpuIndexReg::None;
             readLo.action = CpuMicroAction::None;
-            pushMicroOp(readLo);
+            program.push(readLo);
 
             CpuMicroOp readHiAndApplyX;
             readHiAndApplyX.kind =
                 CpuMicroOpKind::OperandReadHighToAddressAndApplyAbsoluteIndex;
             readHiAndApplyX.busType = CpuBusCycleType::Read;
-            readHiAndApplyX.address = PC;
+            readHiAndApplyX.address = 0;
             readHiAndApplyX.value = 0;
-            readHiAndApplyX.useMicroAddress = false;
+            readHiAndApplyX.source = CpuMicroAddressSource::PC;
             readHiAndApplyX.index = CpuIndexReg::X;
             readHiAndApplyX.action = CpuMicroAction::None;
-            pushMicroOp(readHiAndApplyX);
+            program.push(readHiAndApplyX);
 
             CpuMicroOp dummyRead;
             dummyRead.kind = CpuMicroOpKind::ConditionalPageCrossDummyRead;
             dummyRead.busType = CpuBusCycleType::DummyRead;
             dummyRead.address = 0;
             dummyRead.value = 0;
-            dummyRead.useMicroAddress = true;
+            dummyRead.source = CpuMicroAddressSource::Micro;
             dummyRead.index = CpuIndexReg::None;
             dummyRead.action = CpuMicroAction::None;
-            pushMicroOp(dummyRead);
+            program.push(dummyRead);
 
             CpuMicroOp readIgnored;
             readIgnored.kind = CpuMicroOpKind::MemoryRead;
             readIgnored.busType = CpuBusCycleType::Read;
             readIgnored.address = 0;
             readIgnored.value = 0;
-            readIgnored.useMicroAddress = true;
+            readIgnored.source = CpuMicroAddressSource::Micro;
             readIgnored.index = CpuIndexReg::None;
             readIgnored.action = CpuMicroAction::None;
-            pushMicroOp(readIgnored);
+            program.push(readIgnored);
 
             break;
         }
 
         case 0x0D: // ORA abs
-            buildAbsoluteLoad(CpuMicroAction::OrAWithTemp);
+            buildAbsoluteLoad(program, CpuMicroAction::OrAWithTemp);
             break;
 
         case 0x2D: // AND abs
-            buildAbsoluteLoad(CpuMicroAction::AndAWithTemp);
+            buildAbsoluteLoad(program, CpuMicroAction::AndAWithTemp);
             break;
 
         case 0x4D: // EOR abs
-            buildAbsoluteLoad(CpuMicroAction::EorAWithTemp);
+            buildAbsoluteLoad(program, CpuMicroAction::EorAWithTemp);
             break;
 
         case 0x1D: // ORA abs,X
-            buildAbsoluteIndexedLoad(CpuIndexReg::X, CpuMicroAction::OrAWithTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::OrAWithTemp);
             break;
 
         case 0x19: // ORA abs,Y
-            buildAbsoluteIndexedLoad(CpuIndexReg::Y, CpuMicroAction::OrAWithTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::Y, CpuMicroAction::OrAWithTemp);
             break;
 
         case 0x3D: // AND abs,X
-            buildAbsoluteIndexedLoad(CpuIndexReg::X, CpuMicroAction::AndAWithTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::AndAWithTemp);
             break;
 
         case 0x39: // AND abs,Y
-            buildAbsoluteIndexedLoad(CpuIndexReg::Y, CpuMicroAction::AndAWithTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::Y, CpuMicroAction::AndAWithTemp);
             break;
 
         case 0x5D: // EOR abs,X
-            buildAbsoluteIndexedLoad(CpuIndexReg::X, CpuMicroAction::EorAWithTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::EorAWithTemp);
             break;
 
         case 0x59: // EOR abs,Y
-            buildAbsoluteIndexedLoad(CpuIndexReg::Y, CpuMicroAction::EorAWithTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::Y, CpuMicroAction::EorAWithTemp);
             break;
 
         case 0x09: // ORA #imm
-            buildImmediateAction(CpuMicroAction::OrAWithTemp);
+            buildImmediateAction(program, CpuMicroAction::OrAWithTemp);
             break;
 
         case 0x29: // AND #imm
-            buildImmediateAction(CpuMicroAction::AndAWithTemp);
+            buildImmediateAction(program, CpuMicroAction::AndAWithTemp);
             break;
 
         case 0x49: // EOR #imm
-            buildImmediateAction(CpuMicroAction::EorAWithTemp);
+            buildImmediateAction(program, CpuMicroAction::EorAWithTemp);
             break;
 
         case 0x15: // ORA zp,X
-            buildZeroPageIndexedLoad(CpuIndexReg::X, CpuMicroAction::OrAWithTemp);
+            buildZeroPageIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::OrAWithTemp);
             break;
 
         case 0x35: // AND zp,X
-            buildZeroPageIndexedLoad(CpuIndexReg::X, CpuMicroAction::AndAWithTemp);
+            buildZeroPageIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::AndAWithTemp);
             break;
 
         case 0x55: // EOR zp,X
-            buildZeroPageIndexedLoad(CpuIndexReg::X, CpuMicroAction::EorAWithTemp);
+            buildZeroPageIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::EorAWithTemp);
             break;
 
         case 0xA9: // LDA #imm
-            buildImmediateAction(CpuMicroAction::LoadAFromTemp);
+            buildImmediateAction(program, CpuMicroAction::LoadAFromTemp);
             break;
 
         case 0xA2: // LDX #imm
-            buildImmediateAction(CpuMicroAction::LoadXFromTemp);
+            buildImmediateAction(program, CpuMicroAction::LoadXFromTemp);
             break;
 
         case 0xA0: // LDY #imm
-            buildImmediateAction(CpuMicroAction::LoadYFromTemp);
+            buildImmediateAction(program, CpuMicroAction::LoadYFromTemp);
             break;
 
         case 0xA5: // LDA zp
-            buildZeroPageReadAction(CpuMicroAction::LoadAFromTemp);
+            buildZeroPageReadAction(program, CpuMicroAction::LoadAFromTemp);
             break;
 
         case 0xA6: // LDX zp
-            buildZeroPageReadAction(CpuMicroAction::LoadXFromTemp);
+            buildZeroPageReadAction(program, CpuMicroAction::LoadXFromTemp);
             break;
 
         case 0xA4: // LDY zp
-            buildZeroPageReadAction(CpuMicroAction::LoadYFromTemp);
+            buildZeroPageReadAction(program, CpuMicroAction::LoadYFromTemp);
             break;
 
         case 0xA1: // LDA (zp,X)
-            buildIndirectXRead(CpuMicroAction::LoadAFromTemp);
+            buildIndirectXRead(program, CpuMicroAction::LoadAFromTemp);
             break;
 
         case 0xB1: // LDA (zp),Y
-            buildIndirectYRead(CpuMicroAction::LoadAFromTemp);
+            buildIndirectYRead(program, CpuMicroAction::LoadAFromTemp);
             break;
 
         case 0x05: // ORA zp
-            buildZeroPageReadAction(CpuMicroAction::OrAWithTemp);
+            buildZeroPageReadAction(program, CpuMicroAction::OrAWithTemp);
             break;
 
         case 0x25: // AND zp
-            buildZeroPageReadAction(CpuMicroAction::AndAWithTemp);
+            buildZeroPageReadAction(program, CpuMicroAction::AndAWithTemp);
             break;
 
         case 0x45: // EOR zp
-            buildZeroPageReadAction(CpuMicroAction::EorAWithTemp);
+            buildZeroPageReadAction(program, CpuMicroAction::EorAWithTemp);
             break;
 
         case 0x01: // ORA (zp,X)
-            buildIndirectXRead(CpuMicroAction::OrAWithTemp);
+            buildIndirectXRead(program, CpuMicroAction::OrAWithTemp);
             break;
 
         case 0x11: // ORA (zp),Y
-            buildIndirectYRead(CpuMicroAction::OrAWithTemp);
+            buildIndirectYRead(program, CpuMicroAction::OrAWithTemp);
             break;
 
         case 0x21: // AND (zp,X)
-            buildIndirectXRead(CpuMicroAction::AndAWithTemp);
+            buildIndirectXRead(program, CpuMicroAction::AndAWithTemp);
             break;
 
         case 0x31: // AND (zp),Y
-            buildIndirectYRead(CpuMicroAction::AndAWithTemp);
+            buildIndirectYRead(program, CpuMicroAction::AndAWithTemp);
             break;
 
         case 0x41: // EOR (zp,X)
-            buildIndirectXRead(CpuMicroAction::EorAWithTemp);
+            buildIndirectXRead(program, CpuMicroAction::EorAWithTemp);
             break;
 
         case 0x51: // EOR (zp),Y
-            buildIndirectYRead(CpuMicroAction::EorAWithTemp);
+            buildIndirectYRead(program, CpuMicroAction::EorAWithTemp);
             break;
 
         case 0xC1: // CMP (zp,X)
-            buildIndirectXRead(CpuMicroAction::CompareAWithTemp);
+            buildIndirectXRead(program, CpuMicroAction::CompareAWithTemp);
             break;
 
         case 0xD1: // CMP (zp),Y
-            buildIndirectYRead(CpuMicroAction::CompareAWithTemp);
+            buildIndirectYRead(program, CpuMicroAction::CompareAWithTemp);
             break;
 
         case 0x61: // ADC (zp,X)
-            buildIndirectXRead(CpuMicroAction::AddWithCarryFromTemp);
+            buildIndirectXRead(program, CpuMicroAction::AddWithCarryFromTemp);
             break;
 
         case 0x71: // ADC (zp),Y
-            buildIndirectYRead(CpuMicroAction::AddWithCarryFromTemp);
+            buildIndirectYRead(program, CpuMicroAction::AddWithCarryFromTemp);
             break;
 
         case 0xE1: // SBC (zp,X)
-            buildIndirectXRead(CpuMicroAction::SubtractWithCarryFromTemp);
+            buildIndirectXRead(program, CpuMicroAction::SubtractWithCarryFromTemp);
             break;
 
         case 0xF1: // SBC (zp),Y
-            buildIndirectYRead(CpuMicroAction::SubtractWithCarryFromTemp);
+            buildIndirectYRead(program, CpuMicroAction::SubtractWithCarryFromTemp);
             break;
 
         case 0xAD: // LDA abs
-            buildAbsoluteLoad(CpuMicroAction::LoadAFromTemp);
+            buildAbsoluteLoad(program, CpuMicroAction::LoadAFromTemp);
             break;
 
         case 0xAE: // LDX abs
-            buildAbsoluteLoad(CpuMicroAction::LoadXFromTemp);
+            buildAbsoluteLoad(program, CpuMicroAction::LoadXFromTemp);
             break;
 
         case 0xAC: // LDY abs
-            buildAbsoluteLoad(CpuMicroAction::LoadYFromTemp);
+            buildAbsoluteLoad(program, CpuMicroAction::LoadYFromTemp);
             break;
 
         case 0xBD: // LDA abs,X
-            buildAbsoluteIndexedLoad(CpuIndexReg::X, CpuMicroAction::LoadAFromTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::LoadAFromTemp);
             break;
 
         case 0xB9: // LDA abs,Y
-            buildAbsoluteIndexedLoad(CpuIndexReg::Y, CpuMicroAction::LoadAFromTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::Y, CpuMicroAction::LoadAFromTemp);
             break;
 
         case 0xBC: // LDY abs,X
-            buildAbsoluteIndexedLoad(CpuIndexReg::X, CpuMicroAction::LoadYFromTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::LoadYFromTemp);
             break;
 
         case 0xBE: // LDX abs,Y
-            buildAbsoluteIndexedLoad(CpuIndexReg::Y, CpuMicroAction::LoadXFromTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::Y, CpuMicroAction::LoadXFromTemp);
             break;
 
         case 0x85: // STA zp
-            buildZeroPageStore(CpuMicroAction::StoreA);
+            buildZeroPageStore(program, CpuMicroAction::StoreA);
             break;
 
         case 0x86: // STX zp
-            buildZeroPageStore(CpuMicroAction::StoreX);
+            buildZeroPageStore(program, CpuMicroAction::StoreX);
             break;
 
         case 0x84: // STY zp
-            buildZeroPageStore(CpuMicroAction::StoreY);
+            buildZeroPageStore(program, CpuMicroAction::StoreY);
             break;
 
         case 0x8D: // STA abs
-            buildAbsoluteStore(CpuMicroAction::StoreA);
+            buildAbsoluteStore(program, CpuMicroAction::StoreA);
             break;
 
         case 0x8E: // STX abs
-            buildAbsoluteStore(CpuMicroAction::StoreX);
+            buildAbsoluteStore(program, CpuMicroAction::StoreX);
             break;
 
         case 0x8C: // STY abs
-            buildAbsoluteStore(CpuMicroAction::StoreY);
+            buildAbsoluteStore(program, CpuMicroAction::StoreY);
             break;
 
         case 0x9D: // STA abs,X
-            buildAbsoluteIndexedStore(CpuIndexReg::X, CpuMicroAction::StoreA);
+            buildAbsoluteIndexedStore(program, CpuIndexReg::X, CpuMicroAction::StoreA);
             break;
 
         case 0x81: // STA (zp,X)
-            buildIndirectXStore(CpuMicroAction::StoreA);
+            buildIndirectXStore(program, CpuMicroAction::StoreA);
             break;
 
         case 0x91: // STA (zp),Y
-            buildIndirectYStore(CpuMicroAction::StoreA);
+            buildIndirectYStore(program, CpuMicroAction::StoreA);
             break;
 
         case 0x99: // STA abs,Y
-            buildAbsoluteIndexedStore(CpuIndexReg::Y, CpuMicroAction::StoreA);
+            buildAbsoluteIndexedStore(program, CpuIndexReg::Y, CpuMicroAction::StoreA);
             break;
 
         case 0xB5: // LDA zp,X
-            buildZeroPageIndexedLoad(CpuIndexReg::X, CpuMicroAction::LoadAFromTemp);
+            buildZeroPageIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::LoadAFromTemp);
             break;
 
         case 0xB4: // LDY zp,X
-            buildZeroPageIndexedLoad(CpuIndexReg::X, CpuMicroAction::LoadYFromTemp);
+            buildZeroPageIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::LoadYFromTemp);
             break;
 
         case 0xB6: // LDX zp,Y
-            buildZeroPageIndexedLoad(CpuIndexReg::Y, CpuMicroAction::LoadXFromTemp);
+            buildZeroPageIndexedLoad(program, CpuIndexReg::Y, CpuMicroAction::LoadXFromTemp);
             break;
 
         case 0x95: // STA zp,X
-            buildZeroPageIndexedStore(CpuIndexReg::X, CpuMicroAction::StoreA);
+            buildZeroPageIndexedStore(program, CpuIndexReg::X, CpuMicroAction::StoreA);
             break;
 
         case 0x94: // STY zp,X
-            buildZeroPageIndexedStore(CpuIndexReg::X, CpuMicroAction::StoreY);
+            buildZeroPageIndexedStore(program, CpuIndexReg::X, CpuMicroAction::StoreY);
             break;
 
         case 0x96: // STX zp,Y
-            buildZeroPageIndexedStore(CpuIndexReg::Y, CpuMicroAction::StoreX);
+            buildZeroPageIndexedStore(program, CpuIndexReg::Y, CpuMicroAction::StoreX);
             break;
 
         case 0xAA: // TAX
-            buildInternalAction(CpuMicroAction::TransferAToX);
+            buildInternalAction(program, CpuMicroAction::TransferAToX);
             break;
 
         case 0xA8: // TAY
-            buildInternalAction(CpuMicroAction::TransferAToY);
+            buildInternalAction(program, CpuMicroAction::TransferAToY);
             break;
 
         case 0x8A: // TXA
-            buildInternalAction(CpuMicroAction::TransferXToA);
+            buildInternalAction(program, CpuMicroAction::TransferXToA);
             break;
 
         case 0x98: // TYA
-            buildInternalAction(CpuMicroAction::TransferYToA);
+            buildInternalAction(program, CpuMicroAction::TransferYToA);
             break;
 
         case 0xBA: // TSX
-            buildInternalAction(CpuMicroAction::TransferSPToX);
+            buildInternalAction(program, CpuMicroAction::TransferSPToX);
             break;
 
         case 0x9A: // TXS
-            buildInternalAction(CpuMicroAction::TransferXToSP);
+            buildInternalAction(program, CpuMicroAction::TransferXToSP);
             break;
 
         case 0xE8: // INX
-            buildInternalAction(CpuMicroAction::IncrementX);
+            buildInternalAction(program, CpuMicroAction::IncrementX);
             break;
 
         case 0xC8: // INY
-            buildInternalAction(CpuMicroAction::IncrementY);
+            buildInternalAction(program, CpuMicroAction::IncrementY);
             break;
 
         case 0xCA: // DEX
-            buildInternalAction(CpuMicroAction::DecrementX);
+            buildInternalAction(program, CpuMicroAction::DecrementX);
             break;
 
         case 0x88: // DEY
-            buildInternalAction(CpuMicroAction::DecrementY);
+            buildInternalAction(program, CpuMicroAction::DecrementY);
             break;
 
         case 0x18: // CLC
-            buildInternalAction(CpuMicroAction::ClearCarry);
+            buildInternalAction(program, CpuMicroAction::ClearCarry);
             break;
 
         case 0x38: // SEC
-            buildInternalAction(CpuMicroAction::SetCarry);
+            buildInternalAction(program, CpuMicroAction::SetCarry);
             break;
 
         case 0x58: // CLI
-            buildInternalAction(CpuMicroAction::ClearInterruptDisable);
+            buildInternalAction(program, CpuMicroAction::ClearInterruptDisable);
             break;
 
         case 0x78: // SEI
-            buildInternalAction(CpuMicroAction::SetInterruptDisable);
+            buildInternalAction(program, CpuMicroAction::SetInterruptDisable);
             break;
 
         case 0xD8: // CLD
-            buildInternalAction(CpuMicroAction::ClearDecimal);
+            buildInternalAction(program, CpuMicroAction::ClearDecimal);
             break;
 
         case 0xF8: // SED
-            buildInternalAction(CpuMicroAction::SetDecimal);
+            buildInternalAction(program, CpuMicroAction::SetDecimal);
             break;
 
         case 0xB8: // CLV
-            buildInternalAction(CpuMicroAction::ClearOverflow);
+            buildInternalAction(program, CpuMicroAction::ClearOverflow);
             break;
 
         case 0xC9: // CMP #imm
-            buildImmediateAction(CpuMicroAction::CompareAWithTemp);
+            buildImmediateAction(program, CpuMicroAction::CompareAWithTemp);
             break;
 
         case 0xE0: // CPX #imm
-            buildImmediateAction(CpuMicroAction::CompareXWithTemp);
+            buildImmediateAction(program, CpuMicroAction::CompareXWithTemp);
             break;
 
         case 0xC0: // CPY #imm
-            buildImmediateAction(CpuMicroAction::CompareYWithTemp);
+            buildImmediateAction(program, CpuMicroAction::CompareYWithTemp);
             break;
 
         case 0xC5: // CMP zp
-            buildZeroPageReadAction(CpuMicroAction::CompareAWithTemp);
+            buildZeroPageReadAction(program, CpuMicroAction::CompareAWithTemp);
             break;
 
         case 0xE4: // CPX zp
-            buildZeroPageReadAction(CpuMicroAction::CompareXWithTemp);
+            buildZeroPageReadAction(program, CpuMicroAction::CompareXWithTemp);
             break;
 
         case 0xC4: // CPY zp
-            buildZeroPageReadAction(CpuMicroAction::CompareYWithTemp);
+            buildZeroPageReadAction(program, CpuMicroAction::CompareYWithTemp);
             break;
 
         case 0xCD: // CMP abs
-            buildAbsoluteLoad(CpuMicroAction::CompareAWithTemp);
+            buildAbsoluteLoad(program, CpuMicroAction::CompareAWithTemp);
             break;
 
         case 0xEC: // CPX abs
-            buildAbsoluteLoad(CpuMicroAction::CompareXWithTemp);
+            buildAbsoluteLoad(program, CpuMicroAction::CompareXWithTemp);
             break;
 
         case 0xCC: // CPY abs
-            buildAbsoluteLoad(CpuMicroAction::CompareYWithTemp);
+            buildAbsoluteLoad(program, CpuMicroAction::CompareYWithTemp);
             break;
 
         case 0xD5: // CMP zp,X
-            buildZeroPageIndexedLoad(CpuIndexReg::X, CpuMicroAction::CompareAWithTemp);
+            buildZeroPageIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::CompareAWithTemp);
             break;
 
         case 0xDD: // CMP abs,X
-            buildAbsoluteIndexedLoad(CpuIndexReg::X, CpuMicroAction::CompareAWithTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::CompareAWithTemp);
             break;
 
         case 0xD9: // CMP abs,Y
-            buildAbsoluteIndexedLoad(CpuIndexReg::Y, CpuMicroAction::CompareAWithTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::Y, CpuMicroAction::CompareAWithTemp);
             break;
 
         case 0x69: // ADC #imm
-            buildImmediateAction(CpuMicroAction::AddWithCarryFromTemp);
+            buildImmediateAction(program, CpuMicroAction::AddWithCarryFromTemp);
             break;
 
         case 0xE9: // SBC #imm
         case 0xEB: // unofficial SBC #imm alias
-            buildImmediateAction(CpuMicroAction::SubtractWithCarryFromTemp);
+            buildImmediateAction(program, CpuMicroAction::SubtractWithCarryFromTemp);
             break;
 
         case 0x65: // ADC zp
-            buildZeroPageReadAction(CpuMicroAction::AddWithCarryFromTemp);
+            buildZeroPageReadAction(program, CpuMicroAction::AddWithCarryFromTemp);
             break;
 
         case 0xE5: // SBC zp
-            buildZeroPageReadAction(CpuMicroAction::SubtractWithCarryFromTemp);
+            buildZeroPageReadAction(program, CpuMicroAction::SubtractWithCarryFromTemp);
             break;
 
         case 0x6D: // ADC abs
-            buildAbsoluteLoad(CpuMicroAction::AddWithCarryFromTemp);
+            buildAbsoluteLoad(program, CpuMicroAction::AddWithCarryFromTemp);
             break;
 
         case 0xED: // SBC abs
-            buildAbsoluteLoad(CpuMicroAction::SubtractWithCarryFromTemp);
+            buildAbsoluteLoad(program, CpuMicroAction::SubtractWithCarryFromTemp);
             break;
 
         case 0x75: // ADC zp,X
-            buildZeroPageIndexedLoad(CpuIndexReg::X, CpuMicroAction::AddWithCarryFromTemp);
+            buildZeroPageIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::AddWithCarryFromTemp);
             break;
 
         case 0xF5: // SBC zp,X
-            buildZeroPageIndexedLoad(CpuIndexReg::X, CpuMicroAction::SubtractWithCarryFromTemp);
+            buildZeroPageIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::SubtractWithCarryFromTemp);
             break;
 
         case 0x7D: // ADC abs,X
-            buildAbsoluteIndexedLoad(CpuIndexReg::X, CpuMicroAction::AddWithCarryFromTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::AddWithCarryFromTemp);
             break;
 
         case 0x79: // ADC abs,Y
-            buildAbsoluteIndexedLoad(CpuIndexReg::Y, CpuMicroAction::AddWithCarryFromTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::Y, CpuMicroAction::AddWithCarryFromTemp);
             break;
 
         case 0xFD: // SBC abs,X
-            buildAbsoluteIndexedLoad(CpuIndexReg::X, CpuMicroAction::SubtractWithCarryFromTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::X, CpuMicroAction::SubtractWithCarryFromTemp);
             break;
 
         case 0xF9: // SBC abs,Y
-            buildAbsoluteIndexedLoad(CpuIndexReg::Y, CpuMicroAction::SubtractWithCarryFromTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::Y, CpuMicroAction::SubtractWithCarryFromTemp);
             break;
 
         case 0x24: // BIT zp
-            buildZeroPageReadAction(CpuMicroAction::BitTestWithTemp);
+            buildZeroPageReadAction(program, CpuMicroAction::BitTestWithTemp);
             break;
 
         case 0x2C: // BIT abs
-            buildAbsoluteLoad(CpuMicroAction::BitTestWithTemp);
+            buildAbsoluteLoad(program, CpuMicroAction::BitTestWithTemp);
             break;
 
         case 0x0A: // ASL A
-            buildInternalAction(CpuMicroAction::ShiftLeftA);
+            buildInternalAction(program, CpuMicroAction::ShiftLeftA);
             break;
 
         case 0x2A: // ROL A
-            buildInternalAction(CpuMicroAction::RotateLeftA);
+            buildInternalAction(program, CpuMicroAction::RotateLeftA);
             break;
 
         case 0x4A: // LSR A
-            buildInternalAction(CpuMicroAction::ShiftRightA);
+            buildInternalAction(program, CpuMicroAction::ShiftRightA);
             break;
 
         case 0x6A: // ROR A
-            buildInternalAction(CpuMicroAction::RotateRightA);
+            buildInternalAction(program, CpuMicroAction::RotateRightA);
             break;
 
         case 0x06: // ASL zp
-            buildZeroPageRMW(CpuMicroAction::ShiftLeftTemp);
+            buildZeroPageRMW(program, CpuMicroAction::ShiftLeftTemp);
             break;
 
         case 0x26: // ROL zp
-            buildZeroPageRMW(CpuMicroAction::RotateLeftTemp);
+            buildZeroPageRMW(program, CpuMicroAction::RotateLeftTemp);
             break;
 
         case 0x46: // LSR zp
-            buildZeroPageRMW(CpuMicroAction::ShiftRightTemp);
+            buildZeroPageRMW(program, CpuMicroAction::ShiftRightTemp);
             break;
 
         case 0x66: // ROR zp
-            buildZeroPageRMW(CpuMicroAction::RotateRightTemp);
+            buildZeroPageRMW(program, CpuMicroAction::RotateRightTemp);
             break;
 
         case 0x0E: // ASL abs
-            buildAbsoluteRMW(CpuMicroAction::ShiftLeftTemp);
+            buildAbsoluteRMW(program, CpuMicroAction::ShiftLeftTemp);
             break;
 
         case 0x2E: // ROL abs
-            buildAbsoluteRMW(CpuMicroAction::RotateLeftTemp);
+            buildAbsoluteRMW(program, CpuMicroAction::RotateLeftTemp);
             break;
 
         case 0x4E: // LSR abs
-            buildAbsoluteRMW(CpuMicroAction::ShiftRightTemp);
+            buildAbsoluteRMW(program, CpuMicroAction::ShiftRightTemp);
             break;
 
         case 0x6E: // ROR abs
-            buildAbsoluteRMW(CpuMicroAction::RotateRightTemp);
+            buildAbsoluteRMW(program, CpuMicroAction::RotateRightTemp);
             break;
 
         case 0x16: // ASL zp,X
-            buildZeroPageIndexedRMW(CpuIndexReg::X, CpuMicroAction::ShiftLeftTemp);
+            buildZeroPageIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::ShiftLeftTemp);
             break;
 
         case 0x36: // ROL zp,X
-            buildZeroPageIndexedRMW(CpuIndexReg::X, CpuMicroAction::RotateLeftTemp);
+            buildZeroPageIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::RotateLeftTemp);
             break;
 
         case 0x56: // LSR zp,X
-            buildZeroPageIndexedRMW(CpuIndexReg::X, CpuMicroAction::ShiftRightTemp);
+            buildZeroPageIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::ShiftRightTemp);
             break;
 
         case 0x76: // ROR zp,X
-            buildZeroPageIndexedRMW(CpuIndexReg::X, CpuMicroAction::RotateRightTemp);
+            buildZeroPageIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::RotateRightTemp);
             break;
 
         case 0x1E: // ASL abs,X
-            buildAbsoluteIndexedRMW(CpuIndexReg::X, CpuMicroAction::ShiftLeftTemp);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::ShiftLeftTemp);
             break;
 
         case 0x3E: // ROL abs,X
-            buildAbsoluteIndexedRMW(CpuIndexReg::X, CpuMicroAction::RotateLeftTemp);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::RotateLeftTemp);
             break;
 
         case 0x5E: // LSR abs,X
-            buildAbsoluteIndexedRMW(CpuIndexReg::X, CpuMicroAction::ShiftRightTemp);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::ShiftRightTemp);
             break;
 
         case 0x7E: // ROR abs,X
-            buildAbsoluteIndexedRMW(CpuIndexReg::X, CpuMicroAction::RotateRightTemp);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::RotateRightTemp);
             break;
 
         case 0xE6: // INC zp
-            buildZeroPageRMW(CpuMicroAction::IncrementTemp);
+            buildZeroPageRMW(program, CpuMicroAction::IncrementTemp);
             break;
 
         case 0xEE: // INC abs
-            buildAbsoluteRMW(CpuMicroAction::IncrementTemp);
+            buildAbsoluteRMW(program, CpuMicroAction::IncrementTemp);
             break;
 
         case 0xF6: // INC zp,X
-            buildZeroPageIndexedRMW(CpuIndexReg::X, CpuMicroAction::IncrementTemp);
+            buildZeroPageIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::IncrementTemp);
             break;
 
         case 0xFE: // INC abs,X
-            buildAbsoluteIndexedRMW(CpuIndexReg::X, CpuMicroAction::IncrementTemp);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::IncrementTemp);
             break;
 
         case 0xC6: // DEC zp
-            buildZeroPageRMW(CpuMicroAction::DecrementTemp);
+            buildZeroPageRMW(program, CpuMicroAction::DecrementTemp);
             break;
 
         case 0xCE: // DEC abs
-            buildAbsoluteRMW(CpuMicroAction::DecrementTemp);
+            buildAbsoluteRMW(program, CpuMicroAction::DecrementTemp);
             break;
 
         case 0xD6: // DEC zp,X
-            buildZeroPageIndexedRMW(CpuIndexReg::X, CpuMicroAction::DecrementTemp);
+            buildZeroPageIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::DecrementTemp);
             break;
 
         case 0xDE: // DEC abs,X
-            buildAbsoluteIndexedRMW(CpuIndexReg::X, CpuMicroAction::DecrementTemp);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::DecrementTemp);
             break;
 
         case 0x4C: // JMP abs
@@ -5248,25 +5063,25 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp readLo;
             readLo.kind = CpuMicroOpKind::OperandReadToAddress;
             readLo.busType = CpuBusCycleType::Read;
-            readLo.address = PC;
+            readLo.address = 0;
             readLo.value = 0;
-            readLo.useMicroAddress = false;
+            readLo.source = CpuMicroAddressSource::PC;
             readLo.index = CpuIndexReg::None;
             readLo.action = CpuMicroAction::None;
-            pushMicroOp(readLo);
+            program.push(readLo);
 
             CpuMicroOp readHi;
             readHi.kind = CpuMicroOpKind::OperandReadHighToAddress;
             readHi.busType = CpuBusCycleType::Read;
             readHi.address = 0;
             readHi.value = 0;
-            readHi.useMicroAddress = false;
+            readHi.source = CpuMicroAddressSource::Fixed;
             readHi.index = CpuIndexReg::None;
 
             // Fold jump into high-byte operand read.
             readHi.action = CpuMicroAction::JumpToMicroAddress;
 
-            pushMicroOp(readHi);
+            program.push(readHi);
 
             break;
         }
@@ -5276,303 +5091,303 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp readLo;
             readLo.kind = CpuMicroOpKind::OperandReadToAddress;
             readLo.busType = CpuBusCycleType::Read;
-            readLo.address = PC;
+            readLo.address = 0;
             readLo.value = 0;
-            readLo.useMicroAddress = false;
+            readLo.source = CpuMicroAddressSource::PC;
             readLo.index = CpuIndexReg::None;
             readLo.action = CpuMicroAction::None;
-            pushMicroOp(readLo);
+            program.push(readLo);
 
             CpuMicroOp readHi;
             readHi.kind = CpuMicroOpKind::OperandReadHighToAddress;
             readHi.busType = CpuBusCycleType::Read;
             readHi.address = 0;
             readHi.value = 0;
-            readHi.useMicroAddress = false;
+            readHi.source = CpuMicroAddressSource::Fixed;
             readHi.index = CpuIndexReg::None;
             readHi.action = CpuMicroAction::None;
-            pushMicroOp(readHi);
+            program.push(readHi);
 
             CpuMicroOp readPtrLo;
             readPtrLo.kind = CpuMicroOpKind::ReadJmpIndirectLow;
             readPtrLo.busType = CpuBusCycleType::Read;
             readPtrLo.address = 0;
             readPtrLo.value = 0;
-            readPtrLo.useMicroAddress = true;
+            readPtrLo.source = CpuMicroAddressSource::Micro;
             readPtrLo.index = CpuIndexReg::None;
             readPtrLo.action = CpuMicroAction::None;
-            pushMicroOp(readPtrLo);
+            program.push(readPtrLo);
 
             CpuMicroOp readPtrHi;
             readPtrHi.kind = CpuMicroOpKind::ReadJmpIndirectHigh;
             readPtrHi.busType = CpuBusCycleType::Read;
             readPtrHi.address = 0;
             readPtrHi.value = 0;
-            readPtrHi.useMicroAddress = true;
+            readPtrHi.source = CpuMicroAddressSource::Micro;
             readPtrHi.index = CpuIndexReg::None;
 
             // Fold jump into final indirect high-byte read.
             readPtrHi.action = CpuMicroAction::JumpToMicroAddress;
 
-            pushMicroOp(readPtrHi);
+            program.push(readPtrHi);
 
             break;
         }
 
         case 0x90: // BCC
-            buildBranch(CpuMicroAction::BranchIfCarryClear);
+            buildBranch(program, CpuMicroAction::BranchIfCarryClear);
             break;
 
         case 0xB0: // BCS
-            buildBranch(CpuMicroAction::BranchIfCarrySet);
+            buildBranch(program, CpuMicroAction::BranchIfCarrySet);
             break;
 
         case 0xF0: // BEQ
-            buildBranch(CpuMicroAction::BranchIfZeroSet);
+            buildBranch(program, CpuMicroAction::BranchIfZeroSet);
             break;
 
         case 0xD0: // BNE
-            buildBranch(CpuMicroAction::BranchIfZeroClear);
+            buildBranch(program, CpuMicroAction::BranchIfZeroClear);
             break;
 
         case 0x30: // BMI
-            buildBranch(CpuMicroAction::BranchIfMinusSet);
+            buildBranch(program, CpuMicroAction::BranchIfMinusSet);
             break;
 
         case 0x10: // BPL
-            buildBranch(CpuMicroAction::BranchIfMinusClear);
+            buildBranch(program, CpuMicroAction::BranchIfMinusClear);
             break;
 
         case 0x50: // BVC
-            buildBranch(CpuMicroAction::BranchIfOverflowClear);
+            buildBranch(program, CpuMicroAction::BranchIfOverflowClear);
             break;
 
         case 0x70: // BVS
-            buildBranch(CpuMicroAction::BranchIfOverflowSet);
+            buildBranch(program, CpuMicroAction::BranchIfOverflowSet);
             break;
 
         case 0x48: // PHA
-            buildStackPush(CpuMicroAction::PushA);
+            buildStackPush(program, CpuMicroAction::PushA);
             break;
 
         case 0x08: // PHP
-            buildStackPush(CpuMicroAction::PushProcessorStatus);
+            buildStackPush(program, CpuMicroAction::PushProcessorStatus);
             break;
 
         case 0x68: // PLA
-            buildStackPull(CpuMicroAction::PullA);
+            buildStackPull(program, CpuMicroAction::PullA);
             break;
 
         case 0x28: // PLP
-            buildStackPull(CpuMicroAction::PullProcessorStatus);
+            buildStackPull(program, CpuMicroAction::PullProcessorStatus);
             break;
 
         case 0x20: // JSR abs
-            buildJSR();
+            buildJSR(program);
             break;
 
         case 0x60: // RTS
-            buildRTS();
+            buildRTS(program);
             break;
 
         case 0x00: // BRK
-            buildBRK();
+            buildBRK(program);
             break;
 
         case 0x40: // RTI
-            buildRTI();
+            buildRTI(program);
             break;
 
         case 0x07: // SLO zp
-            buildZeroPageRMW(CpuMicroAction::ShiftLeftTempThenOrA);
+            buildZeroPageRMW(program, CpuMicroAction::ShiftLeftTempThenOrA);
             break;
 
         case 0x17: // SLO zp,X
-            buildZeroPageIndexedRMW(CpuIndexReg::X, CpuMicroAction::ShiftLeftTempThenOrA);
+            buildZeroPageIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::ShiftLeftTempThenOrA);
             break;
 
         case 0x0F: // SLO abs
-            buildAbsoluteRMW(CpuMicroAction::ShiftLeftTempThenOrA);
+            buildAbsoluteRMW(program, CpuMicroAction::ShiftLeftTempThenOrA);
             break;
 
         case 0x1F: // SLO abs,X
-            buildAbsoluteIndexedRMW(CpuIndexReg::X, CpuMicroAction::ShiftLeftTempThenOrA);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::ShiftLeftTempThenOrA);
             break;
 
         case 0x1B: // SLO abs,Y
-            buildAbsoluteIndexedRMW(CpuIndexReg::Y, CpuMicroAction::ShiftLeftTempThenOrA);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::Y, CpuMicroAction::ShiftLeftTempThenOrA);
             break;
 
         case 0x03: // SLO (zp,X)
-            buildIndirectXRMW(CpuMicroAction::ShiftLeftTempThenOrA);
+            buildIndirectXRMW(program, CpuMicroAction::ShiftLeftTempThenOrA);
             break;
 
         case 0x13: // SLO (zp),Y
-            buildIndirectYRMW(CpuMicroAction::ShiftLeftTempThenOrA);
+            buildIndirectYRMW(program, CpuMicroAction::ShiftLeftTempThenOrA);
             break;
 
         case 0x27: // RLA zp
-            buildZeroPageRMW(CpuMicroAction::RotateLeftTempThenAndA);
+            buildZeroPageRMW(program, CpuMicroAction::RotateLeftTempThenAndA);
             break;
 
         case 0x37: // RLA zp,X
-            buildZeroPageIndexedRMW(CpuIndexReg::X, CpuMicroAction::RotateLeftTempThenAndA);
+            buildZeroPageIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::RotateLeftTempThenAndA);
             break;
 
         case 0x2F: // RLA abs
-            buildAbsoluteRMW(CpuMicroAction::RotateLeftTempThenAndA);
+            buildAbsoluteRMW(program, CpuMicroAction::RotateLeftTempThenAndA);
             break;
 
         case 0x3F: // RLA abs,X
-            buildAbsoluteIndexedRMW(CpuIndexReg::X, CpuMicroAction::RotateLeftTempThenAndA);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::RotateLeftTempThenAndA);
             break;
 
         case 0x3B: // RLA abs,Y
-            buildAbsoluteIndexedRMW(CpuIndexReg::Y, CpuMicroAction::RotateLeftTempThenAndA);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::Y, CpuMicroAction::RotateLeftTempThenAndA);
             break;
 
         case 0x23: // RLA (zp,X)
-            buildIndirectXRMW(CpuMicroAction::RotateLeftTempThenAndA);
+            buildIndirectXRMW(program, CpuMicroAction::RotateLeftTempThenAndA);
             break;
 
         case 0x33: // RLA (zp),Y
-            buildIndirectYRMW(CpuMicroAction::RotateLeftTempThenAndA);
+            buildIndirectYRMW(program, CpuMicroAction::RotateLeftTempThenAndA);
             break;
 
         case 0x47: // SRE zp
-            buildZeroPageRMW(CpuMicroAction::ShiftRightTempThenEorA);
+            buildZeroPageRMW(program, CpuMicroAction::ShiftRightTempThenEorA);
             break;
 
         case 0x57: // SRE zp,X
-            buildZeroPageIndexedRMW(CpuIndexReg::X, CpuMicroAction::ShiftRightTempThenEorA);
+            buildZeroPageIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::ShiftRightTempThenEorA);
             break;
 
         case 0x4F: // SRE abs
-            buildAbsoluteRMW(CpuMicroAction::ShiftRightTempThenEorA);
+            buildAbsoluteRMW(program, CpuMicroAction::ShiftRightTempThenEorA);
             break;
 
         case 0x5F: // SRE abs,X
-            buildAbsoluteIndexedRMW(CpuIndexReg::X, CpuMicroAction::ShiftRightTempThenEorA);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::ShiftRightTempThenEorA);
             break;
 
         case 0x5B: // SRE abs,Y
-            buildAbsoluteIndexedRMW(CpuIndexReg::Y, CpuMicroAction::ShiftRightTempThenEorA);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::Y, CpuMicroAction::ShiftRightTempThenEorA);
             break;
 
         case 0x43: // SRE (zp,X)
-            buildIndirectXRMW(CpuMicroAction::ShiftRightTempThenEorA);
+            buildIndirectXRMW(program, CpuMicroAction::ShiftRightTempThenEorA);
             break;
 
         case 0x53: // SRE (zp),Y
-            buildIndirectYRMW(CpuMicroAction::ShiftRightTempThenEorA);
+            buildIndirectYRMW(program, CpuMicroAction::ShiftRightTempThenEorA);
             break;
 
         case 0x67: // RRA zp
-            buildZeroPageRMW(CpuMicroAction::RotateRightTempThenAdcA);
+            buildZeroPageRMW(program, CpuMicroAction::RotateRightTempThenAdcA);
             break;
 
         case 0x77: // RRA zp,X
-            buildZeroPageIndexedRMW(CpuIndexReg::X, CpuMicroAction::RotateRightTempThenAdcA);
+            buildZeroPageIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::RotateRightTempThenAdcA);
             break;
 
         case 0x6F: // RRA abs
-            buildAbsoluteRMW(CpuMicroAction::RotateRightTempThenAdcA);
+            buildAbsoluteRMW(program, CpuMicroAction::RotateRightTempThenAdcA);
             break;
 
         case 0x7F: // RRA abs,X
-            buildAbsoluteIndexedRMW(CpuIndexReg::X, CpuMicroAction::RotateRightTempThenAdcA);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::RotateRightTempThenAdcA);
             break;
 
         case 0x7B: // RRA abs,Y
-            buildAbsoluteIndexedRMW(CpuIndexReg::Y, CpuMicroAction::RotateRightTempThenAdcA);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::Y, CpuMicroAction::RotateRightTempThenAdcA);
             break;
 
         case 0x63: // RRA (zp,X)
-            buildIndirectXRMW(CpuMicroAction::RotateRightTempThenAdcA);
+            buildIndirectXRMW(program, CpuMicroAction::RotateRightTempThenAdcA);
             break;
 
         case 0x73: // RRA (zp),Y
-            buildIndirectYRMW(CpuMicroAction::RotateRightTempThenAdcA);
+            buildIndirectYRMW(program, CpuMicroAction::RotateRightTempThenAdcA);
             break;
 
         case 0xC7: // DCP zp
-            buildZeroPageRMW(CpuMicroAction::DecrementTempThenCompareA);
+            buildZeroPageRMW(program, CpuMicroAction::DecrementTempThenCompareA);
             break;
 
         case 0xD7: // DCP zp,X
-            buildZeroPageIndexedRMW(CpuIndexReg::X, CpuMicroAction::DecrementTempThenCompareA);
+            buildZeroPageIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::DecrementTempThenCompareA);
             break;
 
         case 0xCF: // DCP abs
-            buildAbsoluteRMW(CpuMicroAction::DecrementTempThenCompareA);
+            buildAbsoluteRMW(program, CpuMicroAction::DecrementTempThenCompareA);
             break;
 
         case 0xDF: // DCP abs,X
-            buildAbsoluteIndexedRMW(CpuIndexReg::X, CpuMicroAction::DecrementTempThenCompareA);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::DecrementTempThenCompareA);
             break;
 
         case 0xDB: // DCP abs,Y
-            buildAbsoluteIndexedRMW(CpuIndexReg::Y, CpuMicroAction::DecrementTempThenCompareA);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::Y, CpuMicroAction::DecrementTempThenCompareA);
             break;
 
         case 0xC3: // DCP (zp,X)
-            buildIndirectXRMW(CpuMicroAction::DecrementTempThenCompareA);
+            buildIndirectXRMW(program, CpuMicroAction::DecrementTempThenCompareA);
             break;
 
         case 0xD3: // DCP (zp),Y
-            buildIndirectYRMW(CpuMicroAction::DecrementTempThenCompareA);
+            buildIndirectYRMW(program, CpuMicroAction::DecrementTempThenCompareA);
             break;
 
         case 0xE7: // ISC zp
-            buildZeroPageRMW(CpuMicroAction::IncrementTempThenSbcA);
+            buildZeroPageRMW(program, CpuMicroAction::IncrementTempThenSbcA);
             break;
 
         case 0xF7: // ISC zp,X
-            buildZeroPageIndexedRMW(CpuIndexReg::X, CpuMicroAction::IncrementTempThenSbcA);
+            buildZeroPageIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::IncrementTempThenSbcA);
             break;
 
         case 0xEF: // ISC abs
-            buildAbsoluteRMW(CpuMicroAction::IncrementTempThenSbcA);
+            buildAbsoluteRMW(program, CpuMicroAction::IncrementTempThenSbcA);
             break;
 
         case 0xFF: // ISC abs,X
-            buildAbsoluteIndexedRMW(CpuIndexReg::X, CpuMicroAction::IncrementTempThenSbcA);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::X, CpuMicroAction::IncrementTempThenSbcA);
             break;
 
         case 0xFB: // ISC abs,Y
-            buildAbsoluteIndexedRMW(CpuIndexReg::Y, CpuMicroAction::IncrementTempThenSbcA);
+            buildAbsoluteIndexedRMW(program, CpuIndexReg::Y, CpuMicroAction::IncrementTempThenSbcA);
             break;
 
         case 0xE3: // ISC (zp,X)
-            buildIndirectXRMW(CpuMicroAction::IncrementTempThenSbcA);
+            buildIndirectXRMW(program, CpuMicroAction::IncrementTempThenSbcA);
             break;
 
         case 0xF3: // ISC (zp),Y
-            buildIndirectYRMW(CpuMicroAction::IncrementTempThenSbcA);
+            buildIndirectYRMW(program, CpuMicroAction::IncrementTempThenSbcA);
             break;
 
         case 0xA7: // LAX zp
-            buildZeroPageReadAction(CpuMicroAction::LoadAAndXFromTemp);
+            buildZeroPageReadAction(program, CpuMicroAction::LoadAAndXFromTemp);
             break;
 
         case 0xB7: // LAX zp,Y
-            buildZeroPageIndexedLoad(CpuIndexReg::Y, CpuMicroAction::LoadAAndXFromTemp);
+            buildZeroPageIndexedLoad(program, CpuIndexReg::Y, CpuMicroAction::LoadAAndXFromTemp);
             break;
 
         case 0xAF: // LAX abs
-            buildAbsoluteLoad(CpuMicroAction::LoadAAndXFromTemp);
+            buildAbsoluteLoad(program, CpuMicroAction::LoadAAndXFromTemp);
             break;
 
         case 0xBF: // LAX abs,Y
-            buildAbsoluteIndexedLoad(CpuIndexReg::Y, CpuMicroAction::LoadAAndXFromTemp);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::Y, CpuMicroAction::LoadAAndXFromTemp);
             break;
 
         case 0xA3: // LAX (zp,X)
-            buildIndirectXRead(CpuMicroAction::LoadAAndXFromTemp);
+            buildIndirectXRead(program, CpuMicroAction::LoadAAndXFromTemp);
             break;
 
         case 0xB3: // LAX (zp),Y
-            buildIndirectYRead(CpuMicroAction::LoadAAndXFromTemp);
+            buildIndirectYRead(program, CpuMicroAction::LoadAAndXFromTemp);
             break;
 
         case 0xAB: // LAX #imm unofficial
@@ -5580,29 +5395,29 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp readImm;
             readImm.kind = CpuMicroOpKind::OperandRead;
             readImm.busType = CpuBusCycleType::Read;
-            readImm.address = PC;
+            readImm.address = 0;
             readImm.value = 0;
-            readImm.useMicroAddress = false;
+            readImm.source = CpuMicroAddressSource::PC;
             readImm.index = CpuIndexReg::None;
             readImm.action = CpuMicroAction::LoadAAndXFromTemp;
-            pushMicroOp(readImm);
+            program.push(readImm);
             break;
         }
 
         case 0x87: // SAX zp
-            buildZeroPageStore(CpuMicroAction::StoreAAndX);
+            buildZeroPageStore(program, CpuMicroAction::StoreAAndX);
             break;
 
         case 0x8F: // SAX abs
-            buildAbsoluteStore(CpuMicroAction::StoreAAndX);
+            buildAbsoluteStore(program, CpuMicroAction::StoreAAndX);
             break;
 
         case 0x83: // SAX (zp,X)
-            buildIndirectXStore(CpuMicroAction::StoreAAndX);
+            buildIndirectXStore(program, CpuMicroAction::StoreAAndX);
             break;
 
         case 0x97: // SAX zp,Y
-            buildZeroPageIndexedStore(CpuIndexReg::Y, CpuMicroAction::StoreAAndX);
+            buildZeroPageIndexedStore(program, CpuIndexReg::Y, CpuMicroAction::StoreAAndX);
             break;
 
         case 0x0B: // ANC #imm
@@ -5611,12 +5426,12 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp readImm;
             readImm.kind = CpuMicroOpKind::OperandRead;
             readImm.busType = CpuBusCycleType::Read;
-            readImm.address = PC;
+            readImm.address = 0;
             readImm.value = 0;
-            readImm.useMicroAddress = false;
+            readImm.source = CpuMicroAddressSource::PC;
             readImm.index = CpuIndexReg::None;
             readImm.action = CpuMicroAction::AndImmediateThenCarryFromBit7;
-            pushMicroOp(readImm);
+            program.push(readImm);
 
             break;
         }
@@ -5626,12 +5441,12 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp readImm;
             readImm.kind = CpuMicroOpKind::OperandRead;
             readImm.busType = CpuBusCycleType::Read;
-            readImm.address = PC;
+            readImm.address = 0;
             readImm.value = 0;
-            readImm.useMicroAddress = false;
+            readImm.source = CpuMicroAddressSource::PC;
             readImm.index = CpuIndexReg::None;
             readImm.action = CpuMicroAction::AndImmediateThenLsrA;
-            pushMicroOp(readImm);
+            program.push(readImm);
 
             break;
         }
@@ -5641,12 +5456,12 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp readImm;
             readImm.kind = CpuMicroOpKind::OperandRead;
             readImm.busType = CpuBusCycleType::Read;
-            readImm.address = PC;
+            readImm.address = 0;
             readImm.value = 0;
-            readImm.useMicroAddress = false;
+            readImm.source = CpuMicroAddressSource::PC;
             readImm.index = CpuIndexReg::None;
             readImm.action = CpuMicroAction::StoreAAndXMinusImmediateToX;
-            pushMicroOp(readImm);
+            program.push(readImm);
 
             break;
         }
@@ -5656,38 +5471,38 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp readImm;
             readImm.kind = CpuMicroOpKind::OperandRead;
             readImm.busType = CpuBusCycleType::Read;
-            readImm.address = PC;
+            readImm.address = 0;
             readImm.value = 0;
-            readImm.useMicroAddress = false;
+            readImm.source = CpuMicroAddressSource::PC;
             readImm.index = CpuIndexReg::None;
             readImm.action = CpuMicroAction::AndImmediateThenArrA;
-            pushMicroOp(readImm);
+            program.push(readImm);
 
             break;
         }
 
         case 0xBB: // LAS abs,Y
-            buildAbsoluteIndexedLoad(CpuIndexReg::Y, CpuMicroAction::LoadA_X_SP_FromTempAndSP);
+            buildAbsoluteIndexedLoad(program, CpuIndexReg::Y, CpuMicroAction::LoadA_X_SP_FromTempAndSP);
             break;
 
         case 0x9C: // SHY abs,X
-            buildAbsoluteIndexedStore(CpuIndexReg::X, CpuMicroAction::StoreYAndHighPlusOne);
+            buildAbsoluteIndexedStore(program, CpuIndexReg::X, CpuMicroAction::StoreYAndHighPlusOne);
             break;
 
         case 0x9E: // SHX abs,Y
-            buildAbsoluteIndexedStore(CpuIndexReg::Y, CpuMicroAction::StoreXAndHighPlusOne);
+            buildAbsoluteIndexedStore(program, CpuIndexReg::Y, CpuMicroAction::StoreXAndHighPlusOne);
             break;
 
         case 0x9F: // AHX abs,Y
-            buildAbsoluteIndexedStore(CpuIndexReg::Y, CpuMicroAction::StoreAAndXAndHighPlusOne);
+            buildAbsoluteIndexedStore(program, CpuIndexReg::Y, CpuMicroAction::StoreAAndXAndHighPlusOne);
             break;
 
         case 0x93: // AHX (zp),Y
-            buildIndirectYStore(CpuMicroAction::StoreAAndXAndHighPlusOne);
+            buildIndirectYStore(program, CpuMicroAction::StoreAAndXAndHighPlusOne);
             break;
 
         case 0x9B: // TAS abs,Y
-            buildAbsoluteIndexedStore(CpuIndexReg::Y, CpuMicroAction::StoreSPFromAAndXAndHighPlusOne);
+            buildAbsoluteIndexedStore(program, CpuIndexReg::Y, CpuMicroAction::StoreSPFromAAndXAndHighPlusOne);
             break;
 
         case 0x8B: // XAA #imm
@@ -5695,12 +5510,12 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
             CpuMicroOp readImm;
             readImm.kind = CpuMicroOpKind::OperandRead;
             readImm.busType = CpuBusCycleType::Read;
-            readImm.address = PC;
+            readImm.address = 0;
             readImm.value = 0;
-            readImm.useMicroAddress = false;
+            readImm.source = CpuMicroAddressSource::PC;
             readImm.index = CpuIndexReg::None;
             readImm.action = CpuMicroAction::LoadAFromXAndImmediate;
-            pushMicroOp(readImm);
+            program.push(readImm);
 
             break;
         }
@@ -5710,18 +5525,18 @@ void CPU::buildMicroOpsForOpcode(uint8_t opcode)
     }
 }
 
-void CPU::buildAbsoluteLoad(CpuMicroAction action)
+constexpr void CPU::buildAbsoluteLoad(CpuMicroProgram& program, CpuMicroAction action)
 {
     // Read address low byte.
     CpuMicroOp readLo;
     readLo.kind = CpuMicroOpKind::OperandReadToAddress;
     readLo.busType = CpuBusCycleType::Read;
-    readLo.address = PC;
+    readLo.address = 0;
     readLo.value = 0;
-    readLo.useMicroAddress = false;
+    readLo.source = CpuMicroAddressSource::PC;
     readLo.index = CpuIndexReg::None;
     readLo.action = CpuMicroAction::None;
-    pushMicroOp(readLo);
+    program.push(readLo);
 
     // Read address high byte.
     CpuMicroOp readHi;
@@ -5729,10 +5544,10 @@ void CPU::buildAbsoluteLoad(CpuMicroAction action)
     readHi.busType = CpuBusCycleType::Read;
     readHi.address = 0;
     readHi.value = 0;
-    readHi.useMicroAddress = false;
+    readHi.source = CpuMicroAddressSource::Fixed;
     readHi.index = CpuIndexReg::None;
     readHi.action = CpuMicroAction::None;
-    pushMicroOp(readHi);
+    program.push(readHi);
 
     // Read value from full address.
     CpuMicroOp readValue;
@@ -5740,24 +5555,24 @@ void CPU::buildAbsoluteLoad(CpuMicroAction action)
     readValue.busType = CpuBusCycleType::Read;
     readValue.address = 0;
     readValue.value = 0;
-    readValue.useMicroAddress = true;
+    readValue.source = CpuMicroAddressSource::Micro;
     readValue.index = CpuIndexReg::None;
     readValue.action = action;
-    pushMicroOp(readValue);
+    program.push(readValue);
 }
 
-void CPU::buildAbsoluteIndexedLoad(CpuIndexReg index, CpuMicroAction action)
+constexpr void CPU::buildAbsoluteIndexedLoad(CpuMicroProgram& program, CpuIndexReg index, CpuMicroAction action)
 {
     // Read address low byte.
     CpuMicroOp readLo;
     readLo.kind = CpuMicroOpKind::OperandReadToAddress;
     readLo.busType = CpuBusCycleType::Read;
-    readLo.address = PC;
+    readLo.address = 0;
     readLo.value = 0;
-    readLo.useMicroAddress = false;
+    readLo.source = CpuMicroAddressSource::PC;
     readLo.index = CpuIndexReg::None;
     readLo.action = CpuMicroAction::None;
-    pushMicroOp(readLo);
+    program.push(readLo);
 
     // Read address high byte and apply X/Y in the same bus cycle.
     CpuMicroOp readHiAndApplyIndex;
@@ -5765,10 +5580,10 @@ void CPU::buildAbsoluteIndexedLoad(CpuIndexReg index, CpuMicroAction action)
     readHiAndApplyIndex.busType = CpuBusCycleType::Read;
     readHiAndApplyIndex.address = 0;
     readHiAndApplyIndex.value = 0;
-    readHiAndApplyIndex.useMicroAddress = false;
+    readHiAndApplyIndex.source = CpuMicroAddressSource::Fixed;
     readHiAndApplyIndex.index = index;
     readHiAndApplyIndex.action = CpuMicroAction::None;
-    pushMicroOp(readHiAndApplyIndex);
+    program.push(readHiAndApplyIndex);
 
     // Only runs if page crossed. The readHiAndApplyIndex op skips this
     // micro-op when no page cross occurred.
@@ -5777,10 +5592,10 @@ void CPU::buildAbsoluteIndexedLoad(CpuIndexReg index, CpuMicroAction action)
     dummy.busType = CpuBusCycleType::DummyRead;
     dummy.address = 0;
     dummy.value = 0;
-    dummy.useMicroAddress = false;
+    dummy.source = CpuMicroAddressSource::Fixed;
     dummy.index = CpuIndexReg::None;
     dummy.action = CpuMicroAction::None;
-    pushMicroOp(dummy);
+    program.push(dummy);
 
     // Read final value.
     CpuMicroOp readValue;
@@ -5788,24 +5603,24 @@ void CPU::buildAbsoluteIndexedLoad(CpuIndexReg index, CpuMicroAction action)
     readValue.busType = CpuBusCycleType::Read;
     readValue.address = 0;
     readValue.value = 0;
-    readValue.useMicroAddress = true;
+    readValue.source = CpuMicroAddressSource::Micro;
     readValue.index = CpuIndexReg::None;
     readValue.action = action;
-    pushMicroOp(readValue);
+    program.push(readValue);
 }
 
-void CPU::buildAbsoluteStore(CpuMicroAction action)
+constexpr void CPU::buildAbsoluteStore(CpuMicroProgram& program, CpuMicroAction action)
 {
     // Read address low byte.
     CpuMicroOp readLo;
     readLo.kind = CpuMicroOpKind::OperandReadToAddress;
     readLo.busType = CpuBusCycleType::Read;
-    readLo.address = PC;
+    readLo.address = 0;
     readLo.value = 0;
-    readLo.useMicroAddress = false;
+    readLo.source = CpuMicroAddressSource::PC;
     readLo.index = CpuIndexReg::None;
     readLo.action = CpuMicroAction::None;
-    pushMicroOp(readLo);
+    program.push(readLo);
 
     // Read address high byte.
     CpuMicroOp readHi;
@@ -5813,10 +5628,10 @@ void CPU::buildAbsoluteStore(CpuMicroAction action)
     readHi.busType = CpuBusCycleType::Read;
     readHi.address = 0;
     readHi.value = 0;
-    readHi.useMicroAddress = false;
+    readHi.source = CpuMicroAddressSource::Fixed;
     readHi.index = CpuIndexReg::None;
     readHi.action = CpuMicroAction::None;
-    pushMicroOp(readHi);
+    program.push(readHi);
 
     // Write selected register to full address.
     CpuMicroOp writeValue;
@@ -5824,94 +5639,94 @@ void CPU::buildAbsoluteStore(CpuMicroAction action)
     writeValue.busType = CpuBusCycleType::Write;
     writeValue.address = 0;
     writeValue.value = 0;
-    writeValue.useMicroAddress = true;
+    writeValue.source = CpuMicroAddressSource::Micro;
     writeValue.index = CpuIndexReg::None;
     writeValue.action = action;
-    pushMicroOp(writeValue);
+    program.push(writeValue);
 }
 
-void CPU::buildAbsoluteIndexedStore(CpuIndexReg index, CpuMicroAction action)
+constexpr void CPU::buildAbsoluteIndexedStore(CpuMicroProgram& program, CpuIndexReg index, CpuMicroAction action)
 {
     CpuMicroOp readLo;
     readLo.kind = CpuMicroOpKind::OperandReadToAddress;
     readLo.busType = CpuBusCycleType::Read;
-    readLo.address = PC;
+    readLo.address = 0;
     readLo.value = 0;
-    readLo.useMicroAddress = false;
+    readLo.source = CpuMicroAddressSource::PC;
     readLo.index = CpuIndexReg::None;
     readLo.action = CpuMicroAction::None;
-    pushMicroOp(readLo);
+    program.push(readLo);
 
     CpuMicroOp readHi;
     readHi.kind = CpuMicroOpKind::OperandReadHighToAddress;
     readHi.busType = CpuBusCycleType::Read;
     readHi.address = 0;
     readHi.value = 0;
-    readHi.useMicroAddress = false;
+    readHi.source = CpuMicroAddressSource::Fixed;
     readHi.index = CpuIndexReg::None;
     readHi.action = CpuMicroAction::None;
-    pushMicroOp(readHi);
+    program.push(readHi);
 
     CpuMicroOp applyIndexAndDummy;
     applyIndexAndDummy.kind = CpuMicroOpKind::ApplyAbsoluteIndexAndDummyRead;
     applyIndexAndDummy.busType = CpuBusCycleType::DummyRead;
     applyIndexAndDummy.address = 0;
     applyIndexAndDummy.value = 0;
-    applyIndexAndDummy.useMicroAddress = false;
+    applyIndexAndDummy.source = CpuMicroAddressSource::Fixed;
     applyIndexAndDummy.index = index;
     applyIndexAndDummy.action = CpuMicroAction::None;
-    pushMicroOp(applyIndexAndDummy);
+    program.push(applyIndexAndDummy);
 
     CpuMicroOp writeValue;
     writeValue.kind = CpuMicroOpKind::MemoryWrite;
     writeValue.busType = CpuBusCycleType::Write;
     writeValue.address = 0;
     writeValue.value = 0;
-    writeValue.useMicroAddress = true;
+    writeValue.source = CpuMicroAddressSource::Micro;
     writeValue.index = CpuIndexReg::None;
     writeValue.action = action;
-    pushMicroOp(writeValue);
+    program.push(writeValue);
 }
 
-void CPU::buildImmediateAction(CpuMicroAction action)
+constexpr void CPU::buildImmediateAction(CpuMicroProgram& program, CpuMicroAction action)
 {
     CpuMicroOp op;
     op.kind = CpuMicroOpKind::OperandRead;
     op.busType = CpuBusCycleType::Read;
-    op.address = PC;
+    op.address = 0;
     op.value = 0;
-    op.useMicroAddress = false;
+    op.source = CpuMicroAddressSource::PC;
     op.index = CpuIndexReg::None;
     op.action = action;
 
-    pushMicroOp(op);
+    program.push(op);
 }
 
-void CPU::buildInternalAction(CpuMicroAction action)
+constexpr void CPU::buildInternalAction(CpuMicroProgram& program, CpuMicroAction action)
 {
     CpuMicroOp op;
     op.kind = CpuMicroOpKind::DummyRead;
     op.busType = CpuBusCycleType::DummyRead;
-    op.address = PC;
+    op.address = 0;
     op.value = 0;
-    op.useMicroAddress = false;
+    op.source = CpuMicroAddressSource::PC;
     op.index = CpuIndexReg::None;
     op.action = action;
 
-    pushMicroOp(op);
+    program.push(op);
 }
 
-void CPU::buildZeroPageReadAction(CpuMicroAction action)
+constexpr void CPU::buildZeroPageReadAction(CpuMicroProgram& program, CpuMicroAction action)
 {
     // Read zero-page address operand into microAddress.
     CpuMicroOp readOperand;
     readOperand.kind = CpuMicroOpKind::OperandReadToAddress;
     readOperand.busType = CpuBusCycleType::Read;
-    readOperand.address = PC;
+    readOperand.address = 0;
     readOperand.value = 0;
-    readOperand.useMicroAddress = false;
+    readOperand.source = CpuMicroAddressSource::PC;
     readOperand.action = CpuMicroAction::None;
-    pushMicroOp(readOperand);
+    program.push(readOperand);
 
     // Read value from $00xx into microTemp, then load target register.
     CpuMicroOp readValue;
@@ -5919,22 +5734,22 @@ void CPU::buildZeroPageReadAction(CpuMicroAction action)
     readValue.busType = CpuBusCycleType::Read;
     readValue.address = 0;
     readValue.value = 0;
-    readValue.useMicroAddress = true;
+    readValue.source = CpuMicroAddressSource::Micro;
     readValue.action = action;
-    pushMicroOp(readValue);
+    program.push(readValue);
 }
 
-void CPU::buildZeroPageStore(CpuMicroAction action)
+constexpr void CPU::buildZeroPageStore(CpuMicroProgram& program, CpuMicroAction action)
 {
     // Read zero-page address operand into microAddress.
     CpuMicroOp readOperand;
     readOperand.kind = CpuMicroOpKind::OperandReadToAddress;
     readOperand.busType = CpuBusCycleType::Read;
-    readOperand.address = PC;
+    readOperand.address = 0;
     readOperand.value = 0;
-    readOperand.useMicroAddress = false;
+    readOperand.source = CpuMicroAddressSource::PC;
     readOperand.action = CpuMicroAction::None;
-    pushMicroOp(readOperand);
+    program.push(readOperand);
 
     // Write selected register to $00xx.
     CpuMicroOp writeValue;
@@ -5942,23 +5757,23 @@ void CPU::buildZeroPageStore(CpuMicroAction action)
     writeValue.busType = CpuBusCycleType::Write;
     writeValue.address = 0;
     writeValue.value = 0;
-    writeValue.useMicroAddress = true;
+    writeValue.source = CpuMicroAddressSource::Micro;
     writeValue.action = action;
-    pushMicroOp(writeValue);
+    program.push(writeValue);
 }
 
-void CPU::buildZeroPageIndexedLoad(CpuIndexReg index, CpuMicroAction action)
+constexpr void CPU::buildZeroPageIndexedLoad(CpuMicroProgram& program, CpuIndexReg index, CpuMicroAction action)
 {
     // Read zero-page base operand into microAddress.
     CpuMicroOp readOperand;
     readOperand.kind = CpuMicroOpKind::OperandReadToAddress;
     readOperand.busType = CpuBusCycleType::Read;
-    readOperand.address = PC;
+    readOperand.address = 0;
     readOperand.value = 0;
-    readOperand.useMicroAddress = false;
+    readOperand.source = CpuMicroAddressSource::PC;
     readOperand.index = CpuIndexReg::None;
     readOperand.action = CpuMicroAction::None;
-    pushMicroOp(readOperand);
+    program.push(readOperand);
 
     // Dummy read from unindexed base and apply X/Y in same cycle.
     CpuMicroOp dummyAndIndex;
@@ -5966,10 +5781,10 @@ void CPU::buildZeroPageIndexedLoad(CpuIndexReg index, CpuMicroAction action)
     dummyAndIndex.busType = CpuBusCycleType::DummyRead;
     dummyAndIndex.address = 0;
     dummyAndIndex.value = 0;
-    dummyAndIndex.useMicroAddress = true;
+    dummyAndIndex.source = CpuMicroAddressSource::Micro;
     dummyAndIndex.index = index;
     dummyAndIndex.action = CpuMicroAction::None;
-    pushMicroOp(dummyAndIndex);
+    program.push(dummyAndIndex);
 
     // Read final value.
     CpuMicroOp readValue;
@@ -5977,23 +5792,23 @@ void CPU::buildZeroPageIndexedLoad(CpuIndexReg index, CpuMicroAction action)
     readValue.busType = CpuBusCycleType::Read;
     readValue.address = 0;
     readValue.value = 0;
-    readValue.useMicroAddress = true;
+    readValue.source = CpuMicroAddressSource::Micro;
     readValue.index = CpuIndexReg::None;
     readValue.action = action;
-    pushMicroOp(readValue);
+    program.push(readValue);
 }
 
-void CPU::buildZeroPageIndexedStore(CpuIndexReg index, CpuMicroAction action)
+constexpr void CPU::buildZeroPageIndexedStore(CpuMicroProgram& program, CpuIndexReg index, CpuMicroAction action)
 {
     CpuMicroOp readOperand;
     readOperand.kind = CpuMicroOpKind::OperandReadToAddress;
     readOperand.busType = CpuBusCycleType::Read;
-    readOperand.address = PC;
+    readOperand.address = 0;
     readOperand.value = 0;
-    readOperand.useMicroAddress = false;
+    readOperand.source = CpuMicroAddressSource::PC;
     readOperand.index = CpuIndexReg::None;
     readOperand.action = CpuMicroAction::None;
-    pushMicroOp(readOperand);
+    program.push(readOperand);
 
     // Dummy read from unindexed base and apply X/Y in same cycle.
     CpuMicroOp dummyAndIndex;
@@ -6001,222 +5816,222 @@ void CPU::buildZeroPageIndexedStore(CpuIndexReg index, CpuMicroAction action)
     dummyAndIndex.busType = CpuBusCycleType::DummyRead;
     dummyAndIndex.address = 0;
     dummyAndIndex.value = 0;
-    dummyAndIndex.useMicroAddress = true;
+    dummyAndIndex.source = CpuMicroAddressSource::Micro;
     dummyAndIndex.index = index;
     dummyAndIndex.action = CpuMicroAction::None;
-    pushMicroOp(dummyAndIndex);
+    program.push(dummyAndIndex);
 
     CpuMicroOp writeValue;
     writeValue.kind = CpuMicroOpKind::MemoryWrite;
     writeValue.busType = CpuBusCycleType::Write;
     writeValue.address = 0;
     writeValue.value = 0;
-    writeValue.useMicroAddress = true;
+    writeValue.source = CpuMicroAddressSource::Micro;
     writeValue.index = CpuIndexReg::None;
     writeValue.action = action;
-    pushMicroOp(writeValue);
+    program.push(writeValue);
 }
 
-void CPU::buildIndirectXRead(CpuMicroAction action)
+constexpr void CPU::buildIndirectXRead(CpuMicroProgram& program, CpuMicroAction action)
 {
     CpuMicroOp readOperand;
     readOperand.kind = CpuMicroOpKind::OperandReadToZP;
     readOperand.busType = CpuBusCycleType::Read;
-    readOperand.address = PC;
+    readOperand.address = 0;
     readOperand.value = 0;
-    readOperand.useMicroAddress = false;
+    readOperand.source = CpuMicroAddressSource::PC;
     readOperand.index = CpuIndexReg::None;
     readOperand.action = CpuMicroAction::None;
-    pushMicroOp(readOperand);
+    program.push(readOperand);
 
     CpuMicroOp dummyAndApplyX;
     dummyAndApplyX.kind = CpuMicroOpKind::ApplyIndirectXIndexAndDummyRead;
     dummyAndApplyX.busType = CpuBusCycleType::DummyRead;
     dummyAndApplyX.address = 0;
     dummyAndApplyX.value = 0;
-    dummyAndApplyX.useMicroAddress = false;
+    dummyAndApplyX.source = CpuMicroAddressSource::Fixed;
     dummyAndApplyX.index = CpuIndexReg::None;
     dummyAndApplyX.action = CpuMicroAction::None;
-    pushMicroOp(dummyAndApplyX);
+    program.push(dummyAndApplyX);
 
     CpuMicroOp readLo;
     readLo.kind = CpuMicroOpKind::ReadPointerLow;
     readLo.busType = CpuBusCycleType::Read;
     readLo.address = 0;
     readLo.value = 0;
-    readLo.useMicroAddress = false;
+    readLo.source = CpuMicroAddressSource::Fixed;
     readLo.index = CpuIndexReg::None;
     readLo.action = CpuMicroAction::None;
-    pushMicroOp(readLo);
+    program.push(readLo);
 
     CpuMicroOp readHiAndBuild;
     readHiAndBuild.kind = CpuMicroOpKind::ReadPointerHighAndBuildPointerAddress;
     readHiAndBuild.busType = CpuBusCycleType::Read;
     readHiAndBuild.address = 0;
     readHiAndBuild.value = 0;
-    readHiAndBuild.useMicroAddress = false;
+    readHiAndBuild.source = CpuMicroAddressSource::Fixed;
     readHiAndBuild.index = CpuIndexReg::None;
     readHiAndBuild.action = CpuMicroAction::None;
-    pushMicroOp(readHiAndBuild);
+    program.push(readHiAndBuild);
 
     CpuMicroOp readValue;
     readValue.kind = CpuMicroOpKind::MemoryRead;
     readValue.busType = CpuBusCycleType::Read;
     readValue.address = 0;
     readValue.value = 0;
-    readValue.useMicroAddress = true;
+    readValue.source = CpuMicroAddressSource::Micro;
     readValue.index = CpuIndexReg::None;
     readValue.action = action;
-    pushMicroOp(readValue);
+    program.push(readValue);
 }
 
-void CPU::buildIndirectYRead(CpuMicroAction action)
+constexpr void CPU::buildIndirectYRead(CpuMicroProgram& program, CpuMicroAction action)
 {
     CpuMicroOp readOperand;
     readOperand.kind = CpuMicroOpKind::OperandReadToZP;
     readOperand.busType = CpuBusCycleType::Read;
-    readOperand.address = PC;
+    readOperand.address = 0;
     readOperand.value = 0;
-    readOperand.useMicroAddress = false;
+    readOperand.source = CpuMicroAddressSource::PC;
     readOperand.index = CpuIndexReg::None;
     readOperand.action = CpuMicroAction::None;
-    pushMicroOp(readOperand);
+    program.push(readOperand);
 
     CpuMicroOp readLo;
     readLo.kind = CpuMicroOpKind::ReadPointerLow;
     readLo.busType = CpuBusCycleType::Read;
     readLo.address = 0;
     readLo.value = 0;
-    readLo.useMicroAddress = false;
+    readLo.source = CpuMicroAddressSource::Fixed;
     readLo.index = CpuIndexReg::None;
     readLo.action = CpuMicroAction::None;
-    pushMicroOp(readLo);
+    program.push(readLo);
 
     CpuMicroOp readHiAndApplyY;
     readHiAndApplyY.kind = CpuMicroOpKind::ReadPointerHighAndApplyIndirectYForRead;
     readHiAndApplyY.busType = CpuBusCycleType::Read;
     readHiAndApplyY.address = 0;
     readHiAndApplyY.value = 0;
-    readHiAndApplyY.useMicroAddress = false;
+    readHiAndApplyY.source = CpuMicroAddressSource::Fixed;
     readHiAndApplyY.index = CpuIndexReg::None;
     readHiAndApplyY.action = CpuMicroAction::None;
-    pushMicroOp(readHiAndApplyY);
+    program.push(readHiAndApplyY);
 
     CpuMicroOp dummy;
     dummy.kind = CpuMicroOpKind::ConditionalPageCrossDummyRead;
     dummy.busType = CpuBusCycleType::DummyRead;
     dummy.address = 0;
     dummy.value = 0;
-    dummy.useMicroAddress = false;
+    dummy.source = CpuMicroAddressSource::Fixed;
     dummy.index = CpuIndexReg::None;
     dummy.action = CpuMicroAction::None;
-    pushMicroOp(dummy);
+    program.push(dummy);
 
     CpuMicroOp readValue;
     readValue.kind = CpuMicroOpKind::MemoryRead;
     readValue.busType = CpuBusCycleType::Read;
     readValue.address = 0;
     readValue.value = 0;
-    readValue.useMicroAddress = true;
+    readValue.source = CpuMicroAddressSource::Micro;
     readValue.index = CpuIndexReg::None;
     readValue.action = action;
-    pushMicroOp(readValue);
+    program.push(readValue);
 }
 
-void CPU::buildIndirectXRMW(CpuMicroAction action)
+constexpr void CPU::buildIndirectXRMW(CpuMicroProgram& program, CpuMicroAction action)
 {
     CpuMicroOp readZp;
     readZp.kind = CpuMicroOpKind::OperandReadToZP;
     readZp.busType = CpuBusCycleType::Read;
-    readZp.address = PC;
+    readZp.address = 0;
     readZp.value = 0;
-    readZp.useMicroAddress = false;
+    readZp.source = CpuMicroAddressSource::PC;
     readZp.index = CpuIndexReg::None;
     readZp.action = CpuMicroAction::None;
-    pushMicroOp(readZp);
+    program.push(readZp);
 
     CpuMicroOp dummyAndApplyX;
     dummyAndApplyX.kind = CpuMicroOpKind::ApplyIndirectXIndexAndDummyRead;
     dummyAndApplyX.busType = CpuBusCycleType::DummyRead;
     dummyAndApplyX.address = 0;
     dummyAndApplyX.value = 0;
-    dummyAndApplyX.useMicroAddress = false;
+    dummyAndApplyX.source = CpuMicroAddressSource::Fixed;
     dummyAndApplyX.index = CpuIndexReg::None;
     dummyAndApplyX.action = CpuMicroAction::None;
-    pushMicroOp(dummyAndApplyX);
+    program.push(dummyAndApplyX);
 
     CpuMicroOp readPtrLo;
     readPtrLo.kind = CpuMicroOpKind::ReadPointerLow;
     readPtrLo.busType = CpuBusCycleType::Read;
     readPtrLo.address = 0;
     readPtrLo.value = 0;
-    readPtrLo.useMicroAddress = false;
+    readPtrLo.source = CpuMicroAddressSource::Fixed;
     readPtrLo.index = CpuIndexReg::None;
     readPtrLo.action = CpuMicroAction::None;
-    pushMicroOp(readPtrLo);
+    program.push(readPtrLo);
 
     CpuMicroOp readPtrHiAndBuildAddress;
     readPtrHiAndBuildAddress.kind = CpuMicroOpKind::ReadPointerHighAndBuildPointerAddress;
     readPtrHiAndBuildAddress.busType = CpuBusCycleType::Read;
     readPtrHiAndBuildAddress.address = 0;
     readPtrHiAndBuildAddress.value = 0;
-    readPtrHiAndBuildAddress.useMicroAddress = false;
+    readPtrHiAndBuildAddress.source = CpuMicroAddressSource::Fixed;
     readPtrHiAndBuildAddress.index = CpuIndexReg::None;
     readPtrHiAndBuildAddress.action = CpuMicroAction::None;
-    pushMicroOp(readPtrHiAndBuildAddress);
+    program.push(readPtrHiAndBuildAddress);
 
     CpuMicroOp readValue;
     readValue.kind = CpuMicroOpKind::MemoryRead;
     readValue.busType = CpuBusCycleType::Read;
     readValue.address = 0;
     readValue.value = 0;
-    readValue.useMicroAddress = true;
+    readValue.source = CpuMicroAddressSource::Micro;
     readValue.index = CpuIndexReg::None;
     readValue.action = CpuMicroAction::None;
-    pushMicroOp(readValue);
+    program.push(readValue);
 
     CpuMicroOp dummyWriteAndCompute;
     dummyWriteAndCompute.kind = CpuMicroOpKind::MemoryRMWDummyWriteAndCompute;
     dummyWriteAndCompute.busType = CpuBusCycleType::DummyWrite;
     dummyWriteAndCompute.address = 0;
     dummyWriteAndCompute.value = 0;
-    dummyWriteAndCompute.useMicroAddress = true;
+    dummyWriteAndCompute.source = CpuMicroAddressSource::Micro;
     dummyWriteAndCompute.index = CpuIndexReg::None;
     dummyWriteAndCompute.action = action;
-    pushMicroOp(dummyWriteAndCompute);
+    program.push(dummyWriteAndCompute);
 
     CpuMicroOp finalWrite;
     finalWrite.kind = CpuMicroOpKind::MemoryRMWFinalWrite;
     finalWrite.busType = CpuBusCycleType::Write;
     finalWrite.address = 0;
     finalWrite.value = 0;
-    finalWrite.useMicroAddress = true;
+    finalWrite.source = CpuMicroAddressSource::Micro;
     finalWrite.index = CpuIndexReg::None;
     finalWrite.action = CpuMicroAction::None;
-    pushMicroOp(finalWrite);
+    program.push(finalWrite);
 }
 
-void CPU::buildIndirectYRMW(CpuMicroAction action)
+constexpr void CPU::buildIndirectYRMW(CpuMicroProgram& program, CpuMicroAction action)
 {
     CpuMicroOp readZp;
     readZp.kind = CpuMicroOpKind::OperandReadToZP;
     readZp.busType = CpuBusCycleType::Read;
-    readZp.address = PC;
+    readZp.address = 0;
     readZp.value = 0;
-    readZp.useMicroAddress = false;
+    readZp.source = CpuMicroAddressSource::PC;
     readZp.index = CpuIndexReg::None;
     readZp.action = CpuMicroAction::None;
-    pushMicroOp(readZp);
+    program.push(readZp);
 
     CpuMicroOp readPtrLo;
     readPtrLo.kind = CpuMicroOpKind::ReadPointerLow;
     readPtrLo.busType = CpuBusCycleType::Read;
     readPtrLo.address = 0;
     readPtrLo.value = 0;
-    readPtrLo.useMicroAddress = false;
+    readPtrLo.source = CpuMicroAddressSource::Fixed;
     readPtrLo.index = CpuIndexReg::None;
     readPtrLo.action = CpuMicroAction::None;
-    pushMicroOp(readPtrLo);
+    program.push(readPtrLo);
 
     CpuMicroOp readPtrHiAndApplyY;
     readPtrHiAndApplyY.kind = CpuMicroOpKind::ReadPointerHighAndApplyIndirectY;
@@ -6224,136 +6039,136 @@ void CPU::buildIndirectYRMW(CpuMicroAction action)
     readPtrHiAndApplyY.busType = CpuBusCycleType::Read;
     readPtrHiAndApplyY.address = 0;
     readPtrHiAndApplyY.value = 0;
-    readPtrHiAndApplyY.useMicroAddress = false;
+    readPtrHiAndApplyY.source = CpuMicroAddressSource::Fixed;
     readPtrHiAndApplyY.index = CpuIndexReg::None;
     readPtrHiAndApplyY.action = CpuMicroAction::None;
-    pushMicroOp(readPtrHiAndApplyY);
+    program.push(readPtrHiAndApplyY);
 
     CpuMicroOp dummyRead;
     dummyRead.kind = CpuMicroOpKind::DummyRead;
     dummyRead.busType = CpuBusCycleType::DummyRead;
     dummyRead.address = 0;
     dummyRead.value = 0;
-    dummyRead.useMicroAddress = false;
+    dummyRead.source = CpuMicroAddressSource::Fixed;
     dummyRead.index = CpuIndexReg::None;
     dummyRead.action = CpuMicroAction::None;
-    pushMicroOp(dummyRead);
+    program.push(dummyRead);
 
     CpuMicroOp readValue;
     readValue.kind = CpuMicroOpKind::MemoryRead;
     readValue.busType = CpuBusCycleType::Read;
     readValue.address = 0;
     readValue.value = 0;
-    readValue.useMicroAddress = true;
+    readValue.source = CpuMicroAddressSource::Micro;
     readValue.index = CpuIndexReg::None;
     readValue.action = CpuMicroAction::None;
-    pushMicroOp(readValue);
+    program.push(readValue);
 
     CpuMicroOp dummyWriteAndCompute;
     dummyWriteAndCompute.kind = CpuMicroOpKind::MemoryRMWDummyWriteAndCompute;
     dummyWriteAndCompute.busType = CpuBusCycleType::DummyWrite;
     dummyWriteAndCompute.address = 0;
     dummyWriteAndCompute.value = 0;
-    dummyWriteAndCompute.useMicroAddress = true;
+    dummyWriteAndCompute.source = CpuMicroAddressSource::Micro;
     dummyWriteAndCompute.index = CpuIndexReg::None;
     dummyWriteAndCompute.action = action;
-    pushMicroOp(dummyWriteAndCompute);
+    program.push(dummyWriteAndCompute);
 
     CpuMicroOp finalWrite;
     finalWrite.kind = CpuMicroOpKind::MemoryRMWFinalWrite;
     finalWrite.busType = CpuBusCycleType::Write;
     finalWrite.address = 0;
     finalWrite.value = 0;
-    finalWrite.useMicroAddress = true;
+    finalWrite.source = CpuMicroAddressSource::Micro;
     finalWrite.index = CpuIndexReg::None;
     finalWrite.action = CpuMicroAction::None;
-    pushMicroOp(finalWrite);
+    program.push(finalWrite);
 }
 
-void CPU::buildIndirectXStore(CpuMicroAction action)
+constexpr void CPU::buildIndirectXStore(CpuMicroProgram& program, CpuMicroAction action)
 {
     CpuMicroOp readOperand;
     readOperand.kind = CpuMicroOpKind::OperandReadToZP;
     readOperand.busType = CpuBusCycleType::Read;
-    readOperand.address = PC;
+    readOperand.address = 0;
     readOperand.value = 0;
-    readOperand.useMicroAddress = false;
+    readOperand.source = CpuMicroAddressSource::PC;
     readOperand.index = CpuIndexReg::None;
     readOperand.action = CpuMicroAction::None;
-    pushMicroOp(readOperand);
+    program.push(readOperand);
 
     CpuMicroOp dummyAndApplyX;
     dummyAndApplyX.kind = CpuMicroOpKind::ApplyIndirectXIndexAndDummyRead;
     dummyAndApplyX.busType = CpuBusCycleType::DummyRead;
     dummyAndApplyX.address = 0;
     dummyAndApplyX.value = 0;
-    dummyAndApplyX.useMicroAddress = false;
+    dummyAndApplyX.source = CpuMicroAddressSource::Fixed;
     dummyAndApplyX.index = CpuIndexReg::None;
     dummyAndApplyX.action = CpuMicroAction::None;
-    pushMicroOp(dummyAndApplyX);
+    program.push(dummyAndApplyX);
 
     CpuMicroOp readLo;
     readLo.kind = CpuMicroOpKind::ReadPointerLow;
     readLo.busType = CpuBusCycleType::Read;
     readLo.address = 0;
     readLo.value = 0;
-    readLo.useMicroAddress = false;
+    readLo.source = CpuMicroAddressSource::Fixed;
     readLo.index = CpuIndexReg::None;
     readLo.action = CpuMicroAction::None;
-    pushMicroOp(readLo);
+    program.push(readLo);
 
     CpuMicroOp readHiAndBuild;
     readHiAndBuild.kind = CpuMicroOpKind::ReadPointerHighAndBuildPointerAddress;
     readHiAndBuild.busType = CpuBusCycleType::Read;
     readHiAndBuild.address = 0;
     readHiAndBuild.value = 0;
-    readHiAndBuild.useMicroAddress = false;
+    readHiAndBuild.source = CpuMicroAddressSource::Fixed;
     readHiAndBuild.index = CpuIndexReg::None;
     readHiAndBuild.action = CpuMicroAction::None;
-    pushMicroOp(readHiAndBuild);
+    program.push(readHiAndBuild);
 
     CpuMicroOp writeValue;
     writeValue.kind = CpuMicroOpKind::MemoryWrite;
     writeValue.busType = CpuBusCycleType::Write;
     writeValue.address = 0;
     writeValue.value = 0;
-    writeValue.useMicroAddress = true;
+    writeValue.source = CpuMicroAddressSource::Micro;
     writeValue.index = CpuIndexReg::None;
     writeValue.action = action;
-    pushMicroOp(writeValue);
+    program.push(writeValue);
 }
 
-void CPU::buildIndirectYStore(CpuMicroAction action)
+constexpr void CPU::buildIndirectYStore(CpuMicroProgram& program, CpuMicroAction action)
 {
     CpuMicroOp readOperand;
     readOperand.kind = CpuMicroOpKind::OperandReadToZP;
     readOperand.busType = CpuBusCycleType::Read;
-    readOperand.address = PC;
+    readOperand.address = 0;
     readOperand.value = 0;
-    readOperand.useMicroAddress = false;
+    readOperand.source = CpuMicroAddressSource::PC;
     readOperand.index = CpuIndexReg::None;
     readOperand.action = CpuMicroAction::None;
-    pushMicroOp(readOperand);
+    program.push(readOperand);
 
     CpuMicroOp readLo;
     readLo.kind = CpuMicroOpKind::ReadPointerLow;
     readLo.busType = CpuBusCycleType::Read;
     readLo.address = 0;
     readLo.value = 0;
-    readLo.useMicroAddress = false;
+    readLo.source = CpuMicroAddressSource::Fixed;
     readLo.index = CpuIndexReg::None;
     readLo.action = CpuMicroAction::None;
-    pushMicroOp(readLo);
+    program.push(readLo);
 
     CpuMicroOp readHiAndApplyY;
     readHiAndApplyY.kind = CpuMicroOpKind::ReadPointerHighAndApplyIndirectY;
     readHiAndApplyY.busType = CpuBusCycleType::Read;
     readHiAndApplyY.address = 0;
     readHiAndApplyY.value = 0;
-    readHiAndApplyY.useMicroAddress = false;
+    readHiAndApplyY.source = CpuMicroAddressSource::Fixed;
     readHiAndApplyY.index = CpuIndexReg::None;
     readHiAndApplyY.action = CpuMicroAction::None;
-    pushMicroOp(readHiAndApplyY);
+    program.push(readHiAndApplyY);
 
     // Stores always dummy-read old-high + indexed-low.
     CpuMicroOp dummy;
@@ -6361,140 +6176,140 @@ void CPU::buildIndirectYStore(CpuMicroAction action)
     dummy.busType = CpuBusCycleType::DummyRead;
     dummy.address = 0;
     dummy.value = 0;
-    dummy.useMicroAddress = false;
+    dummy.source = CpuMicroAddressSource::Fixed;
     dummy.index = CpuIndexReg::None;
     dummy.action = CpuMicroAction::None;
-    pushMicroOp(dummy);
+    program.push(dummy);
 
     CpuMicroOp writeValue;
     writeValue.kind = CpuMicroOpKind::MemoryWrite;
     writeValue.busType = CpuBusCycleType::Write;
     writeValue.address = 0;
     writeValue.value = 0;
-    writeValue.useMicroAddress = true;
+    writeValue.source = CpuMicroAddressSource::Micro;
     writeValue.index = CpuIndexReg::None;
     writeValue.action = action;
-    pushMicroOp(writeValue);
+    program.push(writeValue);
 }
 
-void CPU::buildZeroPageRMW(CpuMicroAction action)
+constexpr void CPU::buildZeroPageRMW(CpuMicroProgram& program, CpuMicroAction action)
 {
     CpuMicroOp readOperand;
     readOperand.kind = CpuMicroOpKind::OperandReadToAddress;
     readOperand.busType = CpuBusCycleType::Read;
-    readOperand.address = PC;
+    readOperand.address = 0;
     readOperand.value = 0;
-    readOperand.useMicroAddress = false;
+    readOperand.source = CpuMicroAddressSource::PC;
     readOperand.index = CpuIndexReg::None;
     readOperand.action = CpuMicroAction::None;
-    pushMicroOp(readOperand);
+    program.push(readOperand);
 
     CpuMicroOp readValue;
     readValue.kind = CpuMicroOpKind::MemoryRead;
     readValue.busType = CpuBusCycleType::Read;
     readValue.address = 0;
     readValue.value = 0;
-    readValue.useMicroAddress = true;
+    readValue.source = CpuMicroAddressSource::Micro;
     readValue.index = CpuIndexReg::None;
     readValue.action = CpuMicroAction::None;
-    pushMicroOp(readValue);
+    program.push(readValue);
 
     CpuMicroOp dummyWriteAndCompute;
     dummyWriteAndCompute.kind = CpuMicroOpKind::MemoryRMWDummyWriteAndCompute;
     dummyWriteAndCompute.busType = CpuBusCycleType::DummyWrite;
     dummyWriteAndCompute.address = 0;
     dummyWriteAndCompute.value = 0;
-    dummyWriteAndCompute.useMicroAddress = true;
+    dummyWriteAndCompute.source = CpuMicroAddressSource::Micro;
     dummyWriteAndCompute.index = CpuIndexReg::None;
     dummyWriteAndCompute.action = action;
-    pushMicroOp(dummyWriteAndCompute);
+    program.push(dummyWriteAndCompute);
 
     CpuMicroOp finalWrite;
     finalWrite.kind = CpuMicroOpKind::MemoryRMWFinalWrite;
     finalWrite.busType = CpuBusCycleType::Write;
     finalWrite.address = 0;
     finalWrite.value = 0;
-    finalWrite.useMicroAddress = true;
+    finalWrite.source = CpuMicroAddressSource::Micro;
     finalWrite.index = CpuIndexReg::None;
     finalWrite.action = CpuMicroAction::None;
-    pushMicroOp(finalWrite);
+    program.push(finalWrite);
 }
 
-void CPU::buildAbsoluteRMW(CpuMicroAction action)
+constexpr void CPU::buildAbsoluteRMW(CpuMicroProgram& program, CpuMicroAction action)
 {
     CpuMicroOp readLo;
     readLo.kind = CpuMicroOpKind::OperandReadToAddress;
     readLo.busType = CpuBusCycleType::Read;
-    readLo.address = PC;
+    readLo.address = 0;
     readLo.value = 0;
-    readLo.useMicroAddress = false;
+    readLo.source = CpuMicroAddressSource::PC;
     readLo.index = CpuIndexReg::None;
     readLo.action = CpuMicroAction::None;
-    pushMicroOp(readLo);
+    program.push(readLo);
 
     CpuMicroOp readHi;
     readHi.kind = CpuMicroOpKind::OperandReadHighToAddress;
     readHi.busType = CpuBusCycleType::Read;
     readHi.address = 0;
     readHi.value = 0;
-    readHi.useMicroAddress = false;
+    readHi.source = CpuMicroAddressSource::Fixed;
     readHi.index = CpuIndexReg::None;
     readHi.action = CpuMicroAction::None;
-    pushMicroOp(readHi);
+    program.push(readHi);
 
     CpuMicroOp readValue;
     readValue.kind = CpuMicroOpKind::MemoryRead;
     readValue.busType = CpuBusCycleType::Read;
     readValue.address = 0;
     readValue.value = 0;
-    readValue.useMicroAddress = true;
+    readValue.source = CpuMicroAddressSource::Micro;
     readValue.index = CpuIndexReg::None;
     readValue.action = CpuMicroAction::None;
-    pushMicroOp(readValue);
+    program.push(readValue);
 
     CpuMicroOp dummyWriteAndCompute;
     dummyWriteAndCompute.kind = CpuMicroOpKind::MemoryRMWDummyWriteAndCompute;
     dummyWriteAndCompute.busType = CpuBusCycleType::DummyWrite;
     dummyWriteAndCompute.address = 0;
     dummyWriteAndCompute.value = 0;
-    dummyWriteAndCompute.useMicroAddress = true;
+    dummyWriteAndCompute.source = CpuMicroAddressSource::Micro;
     dummyWriteAndCompute.index = CpuIndexReg::None;
     dummyWriteAndCompute.action = action;
-    pushMicroOp(dummyWriteAndCompute);
+    program.push(dummyWriteAndCompute);
 
     CpuMicroOp finalWrite;
     finalWrite.kind = CpuMicroOpKind::MemoryRMWFinalWrite;
     finalWrite.busType = CpuBusCycleType::Write;
     finalWrite.address = 0;
     finalWrite.value = 0;
-    finalWrite.useMicroAddress = true;
+    finalWrite.source = CpuMicroAddressSource::Micro;
     finalWrite.index = CpuIndexReg::None;
     finalWrite.action = CpuMicroAction::None;
-    pushMicroOp(finalWrite);
+    program.push(finalWrite);
 }
 
-void CPU::buildZeroPageIndexedRMW(CpuIndexReg index, CpuMicroAction action)
+constexpr void CPU::buildZeroPageIndexedRMW(CpuMicroProgram& program, CpuIndexReg index, CpuMicroAction action)
 {
     // Read zero-page operand.
     CpuMicroOp readOperand;
     readOperand.kind = CpuMicroOpKind::OperandReadToAddress;
     readOperand.busType = CpuBusCycleType::Read;
-    readOperand.address = PC;
+    readOperand.address = 0;
     readOperand.value = 0;
-    readOperand.useMicroAddress = false;
+    readOperand.source = CpuMicroAddressSource::PC;
     readOperand.index = CpuIndexReg::None;
     readOperand.action = CpuMicroAction::None;
-    pushMicroOp(readOperand);
+    program.push(readOperand);
 
     CpuMicroOp dummyAndIndex;
     dummyAndIndex.kind = CpuMicroOpKind::ApplyZeroPageIndexAndDummyRead;
     dummyAndIndex.busType = CpuBusCycleType::DummyRead;
     dummyAndIndex.address = 0;
     dummyAndIndex.value = 0;
-    dummyAndIndex.useMicroAddress = true;
+    dummyAndIndex.source = CpuMicroAddressSource::Micro;
     dummyAndIndex.index = index;
     dummyAndIndex.action = CpuMicroAction::None;
-    pushMicroOp(dummyAndIndex);
+    program.push(dummyAndIndex);
 
     // Read old value from final zero-page address.
     CpuMicroOp readValue;
@@ -6502,20 +6317,20 @@ void CPU::buildZeroPageIndexedRMW(CpuIndexReg index, CpuMicroAction action)
     readValue.busType = CpuBusCycleType::Read;
     readValue.address = 0;
     readValue.value = 0;
-    readValue.useMicroAddress = true;
+    readValue.source = CpuMicroAddressSource::Micro;
     readValue.index = CpuIndexReg::None;
     readValue.action = CpuMicroAction::None;
-    pushMicroOp(readValue);
+    program.push(readValue);
 
     CpuMicroOp dummyWriteAndCompute;
     dummyWriteAndCompute.kind = CpuMicroOpKind::MemoryRMWDummyWriteAndCompute;
     dummyWriteAndCompute.busType = CpuBusCycleType::DummyWrite;
     dummyWriteAndCompute.address = 0;
     dummyWriteAndCompute.value = 0;
-    dummyWriteAndCompute.useMicroAddress = true;
+    dummyWriteAndCompute.source = CpuMicroAddressSource::Micro;
     dummyWriteAndCompute.index = CpuIndexReg::None;
     dummyWriteAndCompute.action = action;
-    pushMicroOp(dummyWriteAndCompute);
+    program.push(dummyWriteAndCompute);
 
     // Final write modified value.
     CpuMicroOp finalWrite;
@@ -6523,176 +6338,176 @@ void CPU::buildZeroPageIndexedRMW(CpuIndexReg index, CpuMicroAction action)
     finalWrite.busType = CpuBusCycleType::Write;
     finalWrite.address = 0;
     finalWrite.value = 0;
-    finalWrite.useMicroAddress = true;
+    finalWrite.source = CpuMicroAddressSource::Micro;
     finalWrite.index = CpuIndexReg::None;
     finalWrite.action = CpuMicroAction::None;
-    pushMicroOp(finalWrite);
+    program.push(finalWrite);
 }
 
-void CPU::buildAbsoluteIndexedRMW(CpuIndexReg index, CpuMicroAction action)
+constexpr void CPU::buildAbsoluteIndexedRMW(CpuMicroProgram& program, CpuIndexReg index, CpuMicroAction action)
 {
     CpuMicroOp readLo;
     readLo.kind = CpuMicroOpKind::OperandReadToAddress;
     readLo.busType = CpuBusCycleType::Read;
-    readLo.address = PC;
+    readLo.address = 0;
     readLo.value = 0;
-    readLo.useMicroAddress = false;
+    readLo.source = CpuMicroAddressSource::PC;
     readLo.index = CpuIndexReg::None;
     readLo.action = CpuMicroAction::None;
-    pushMicroOp(readLo);
+    program.push(readLo);
 
     CpuMicroOp readHi;
     readHi.kind = CpuMicroOpKind::OperandReadHighToAddress;
     readHi.busType = CpuBusCycleType::Read;
     readHi.address = 0;
     readHi.value = 0;
-    readHi.useMicroAddress = false;
+    readHi.source = CpuMicroAddressSource::Fixed;
     readHi.index = CpuIndexReg::None;
     readHi.action = CpuMicroAction::None;
-    pushMicroOp(readHi);
+    program.push(readHi);
 
     CpuMicroOp applyIndexAndDummy;
     applyIndexAndDummy.kind = CpuMicroOpKind::ApplyAbsoluteIndexAndDummyRead;
     applyIndexAndDummy.busType = CpuBusCycleType::DummyRead;
     applyIndexAndDummy.address = 0;
     applyIndexAndDummy.value = 0;
-    applyIndexAndDummy.useMicroAddress = false;
+    applyIndexAndDummy.source = CpuMicroAddressSource::Fixed;
     applyIndexAndDummy.index = index;
     applyIndexAndDummy.action = CpuMicroAction::None;
-    pushMicroOp(applyIndexAndDummy);
+    program.push(applyIndexAndDummy);
 
     CpuMicroOp readValue;
     readValue.kind = CpuMicroOpKind::MemoryRead;
     readValue.busType = CpuBusCycleType::Read;
     readValue.address = 0;
     readValue.value = 0;
-    readValue.useMicroAddress = true;
+    readValue.source = CpuMicroAddressSource::Micro;
     readValue.index = CpuIndexReg::None;
     readValue.action = CpuMicroAction::None;
-    pushMicroOp(readValue);
+    program.push(readValue);
 
     CpuMicroOp dummyWriteAndCompute;
     dummyWriteAndCompute.kind = CpuMicroOpKind::MemoryRMWDummyWriteAndCompute;
     dummyWriteAndCompute.busType = CpuBusCycleType::DummyWrite;
     dummyWriteAndCompute.address = 0;
     dummyWriteAndCompute.value = 0;
-    dummyWriteAndCompute.useMicroAddress = true;
+    dummyWriteAndCompute.source = CpuMicroAddressSource::Micro;
     dummyWriteAndCompute.index = CpuIndexReg::None;
     dummyWriteAndCompute.action = action;
-    pushMicroOp(dummyWriteAndCompute);
+    program.push(dummyWriteAndCompute);
 
     CpuMicroOp finalWrite;
     finalWrite.kind = CpuMicroOpKind::MemoryRMWFinalWrite;
     finalWrite.busType = CpuBusCycleType::Write;
     finalWrite.address = 0;
     finalWrite.value = 0;
-    finalWrite.useMicroAddress = true;
+    finalWrite.source = CpuMicroAddressSource::Micro;
     finalWrite.index = CpuIndexReg::None;
     finalWrite.action = CpuMicroAction::None;
-    pushMicroOp(finalWrite);
+    program.push(finalWrite);
 }
 
-void CPU::buildBranch(CpuMicroAction action)
+constexpr void CPU::buildBranch(CpuMicroProgram& program, CpuMicroAction action)
 {
     CpuMicroOp readOffset;
     readOffset.kind = CpuMicroOpKind::OperandReadToBranchOffset;
     readOffset.busType = CpuBusCycleType::Read;
-    readOffset.address = PC;
+    readOffset.address = 0;
     readOffset.value = 0;
-    readOffset.useMicroAddress = false;
+    readOffset.source = CpuMicroAddressSource::PC;
     readOffset.index = CpuIndexReg::None;
     readOffset.action = action;
-    pushMicroOp(readOffset);
+    program.push(readOffset);
 
     CpuMicroOp takenDummy;
     takenDummy.kind = CpuMicroOpKind::BranchTakenDummyRead;
     takenDummy.busType = CpuBusCycleType::DummyRead;
     takenDummy.address = 0;
     takenDummy.value = 0;
-    takenDummy.useMicroAddress = false;
+    takenDummy.source = CpuMicroAddressSource::Fixed;
     takenDummy.index = CpuIndexReg::None;
     takenDummy.action = CpuMicroAction::None;
-    pushMicroOp(takenDummy);
+    program.push(takenDummy);
 
     CpuMicroOp pageDummy;
     pageDummy.kind = CpuMicroOpKind::BranchPageCrossDummyRead;
     pageDummy.busType = CpuBusCycleType::DummyRead;
     pageDummy.address = 0;
     pageDummy.value = 0;
-    pageDummy.useMicroAddress = false;
+    pageDummy.source = CpuMicroAddressSource::Fixed;
     pageDummy.index = CpuIndexReg::None;
     pageDummy.action = CpuMicroAction::None;
-    pushMicroOp(pageDummy);
+    program.push(pageDummy);
 }
 
-void CPU::buildStackPush(CpuMicroAction action)
+constexpr void CPU::buildStackPush(CpuMicroProgram& program, CpuMicroAction action)
 {
     CpuMicroOp dummy;
     dummy.kind = CpuMicroOpKind::DummyRead;
     dummy.busType = CpuBusCycleType::DummyRead;
-    dummy.address = PC;
+    dummy.address = 0;
     dummy.value = 0;
-    dummy.useMicroAddress = false;
+    dummy.source = CpuMicroAddressSource::PC;
     dummy.index = CpuIndexReg::None;
     dummy.action = CpuMicroAction::None;
-    pushMicroOp(dummy);
+    program.push(dummy);
 
     CpuMicroOp pushOp;
     pushOp.kind = CpuMicroOpKind::StackWrite;
     pushOp.busType = CpuBusCycleType::StackWrite;
     pushOp.address = 0;
     pushOp.value = 0;
-    pushOp.useMicroAddress = false;
+    pushOp.source = CpuMicroAddressSource::Fixed;
     pushOp.index = CpuIndexReg::None;
     pushOp.action = action;
-    pushMicroOp(pushOp);
+    program.push(pushOp);
 }
 
-void CPU::buildStackPull(CpuMicroAction action)
+constexpr void CPU::buildStackPull(CpuMicroProgram& program, CpuMicroAction action)
 {
     CpuMicroOp dummy1;
     dummy1.kind = CpuMicroOpKind::DummyRead;
     dummy1.busType = CpuBusCycleType::DummyRead;
-    dummy1.address = PC;
+    dummy1.address = 0;
     dummy1.value = 0;
-    dummy1.useMicroAddress = false;
+    dummy1.source = CpuMicroAddressSource::PC;
     dummy1.index = CpuIndexReg::None;
     dummy1.action = CpuMicroAction::None;
-    pushMicroOp(dummy1);
+    program.push(dummy1);
 
     CpuMicroOp dummy2;
     dummy2.kind = CpuMicroOpKind::DummyRead;
     dummy2.busType = CpuBusCycleType::DummyRead;
-    dummy2.address = uint16_t(0x0100 | SP);
+    dummy2.address = 0;
     dummy2.value = 0;
-    dummy2.useMicroAddress = false;
+    dummy2.source = CpuMicroAddressSource::Stack;
     dummy2.index = CpuIndexReg::None;
     dummy2.action = CpuMicroAction::None;
-    pushMicroOp(dummy2);
+    program.push(dummy2);
 
     CpuMicroOp pullOp;
     pullOp.kind = CpuMicroOpKind::StackRead;
     pullOp.busType = CpuBusCycleType::StackRead;
     pullOp.address = 0;
     pullOp.value = 0;
-    pullOp.useMicroAddress = false;
+    pullOp.source = CpuMicroAddressSource::Fixed;
     pullOp.index = CpuIndexReg::None;
     pullOp.action = action;
-    pushMicroOp(pullOp);
+    program.push(pullOp);
 }
 
-void CPU::buildJSR()
+constexpr void CPU::buildJSR(CpuMicroProgram& program)
 {
     // Cycle 2: Read target low byte.
     CpuMicroOp readLo;
     readLo.kind = CpuMicroOpKind::OperandReadToAddress;
     readLo.busType = CpuBusCycleType::Read;
-    readLo.address = PC;
+    readLo.address = 0;
     readLo.value = 0;
-    readLo.useMicroAddress = false;
+    readLo.source = CpuMicroAddressSource::PC;
     readLo.index = CpuIndexReg::None;
     readLo.action = CpuMicroAction::None;
-    pushMicroOp(readLo);
+    program.push(readLo);
 
     /*
      * Cycle 3:
@@ -6702,12 +6517,12 @@ void CPU::buildJSR()
     CpuMicroOp prepReturn;
     prepReturn.kind = CpuMicroOpKind::DummyRead;
     prepReturn.busType = CpuBusCycleType::DummyRead;
-    prepReturn.address = uint16_t(0x0100 | SP);
+    prepReturn.address = 0;
     prepReturn.value = 0;
-    prepReturn.useMicroAddress = false;
+    prepReturn.source = CpuMicroAddressSource::Stack;
     prepReturn.index = CpuIndexReg::None;
     prepReturn.action = CpuMicroAction::PrepareJSRReturnAddress;
-    pushMicroOp(prepReturn);
+    program.push(prepReturn);
 
     // Cycle 4: Push return-address high byte.
     CpuMicroOp pushHi;
@@ -6715,10 +6530,10 @@ void CPU::buildJSR()
     pushHi.busType = CpuBusCycleType::StackWrite;
     pushHi.address = 0;
     pushHi.value = 0;
-    pushHi.useMicroAddress = false;
+    pushHi.source = CpuMicroAddressSource::Fixed;
     pushHi.index = CpuIndexReg::None;
     pushHi.action = CpuMicroAction::PushJSRReturnHigh;
-    pushMicroOp(pushHi);
+    program.push(pushHi);
 
     // Cycle 5: Push return-address low byte.
     CpuMicroOp pushLo;
@@ -6726,10 +6541,10 @@ void CPU::buildJSR()
     pushLo.busType = CpuBusCycleType::StackWrite;
     pushLo.address = 0;
     pushLo.value = 0;
-    pushLo.useMicroAddress = false;
+    pushLo.source = CpuMicroAddressSource::Fixed;
     pushLo.index = CpuIndexReg::None;
     pushLo.action = CpuMicroAction::PushJSRReturnLow;
-    pushMicroOp(pushLo);
+    program.push(pushLo);
 
     // Cycle 6: Read target high byte and jump.
     CpuMicroOp readHi;
@@ -6737,504 +6552,266 @@ void CPU::buildJSR()
     readHi.busType = CpuBusCycleType::Read;
     readHi.address = 0;
     readHi.value = 0;
-    readHi.useMicroAddress = false;
+    readHi.source = CpuMicroAddressSource::Fixed;
     readHi.index = CpuIndexReg::None;
     readHi.action = CpuMicroAction::JumpToMicroAddress;
-    pushMicroOp(readHi);
+    program.push(readHi);
 }
 
-void CPU::buildRTS()
+constexpr void CPU::buildRTS(CpuMicroProgram& program)
 {
     CpuMicroOp dummy1;
     dummy1.kind = CpuMicroOpKind::DummyRead;
     dummy1.busType = CpuBusCycleType::DummyRead;
-    dummy1.address = PC;
+    dummy1.address = 0;
     dummy1.value = 0;
-    dummy1.useMicroAddress = false;
+    dummy1.source = CpuMicroAddressSource::PC;
     dummy1.index = CpuIndexReg::None;
     dummy1.action = CpuMicroAction::None;
-    pushMicroOp(dummy1);
+    program.push(dummy1);
 
     CpuMicroOp dummy2;
     dummy2.kind = CpuMicroOpKind::DummyRead;
     dummy2.busType = CpuBusCycleType::DummyRead;
-    dummy2.address = uint16_t(0x0100 | SP);
+    dummy2.address = 0;
     dummy2.value = 0;
-    dummy2.useMicroAddress = false;
+    dummy2.source = CpuMicroAddressSource::Stack;
     dummy2.index = CpuIndexReg::None;
     dummy2.action = CpuMicroAction::None;
-    pushMicroOp(dummy2);
+    program.push(dummy2);
 
     CpuMicroOp pullLo;
     pullLo.kind = CpuMicroOpKind::StackRead;
     pullLo.busType = CpuBusCycleType::StackRead;
     pullLo.address = 0;
     pullLo.value = 0;
-    pullLo.useMicroAddress = false;
+    pullLo.source = CpuMicroAddressSource::Fixed;
     pullLo.index = CpuIndexReg::None;
     pullLo.action = CpuMicroAction::PullRTSLow;
-    pushMicroOp(pullLo);
+    program.push(pullLo);
 
     CpuMicroOp pullHi;
     pullHi.kind = CpuMicroOpKind::StackRead;
     pullHi.busType = CpuBusCycleType::StackRead;
     pullHi.address = 0;
     pullHi.value = 0;
-    pullHi.useMicroAddress = false;
+    pullHi.source = CpuMicroAddressSource::Fixed;
     pullHi.index = CpuIndexReg::None;
     pullHi.action = CpuMicroAction::PullRTSHigh;
-    pushMicroOp(pullHi);
+    program.push(pullHi);
 
     CpuMicroOp finish;
     finish.kind = CpuMicroOpKind::DummyRead;
     finish.busType = CpuBusCycleType::DummyRead;
     finish.address = 0;
     finish.value = 0;
-    finish.useMicroAddress = true;
+    finish.source = CpuMicroAddressSource::Micro;
     finish.index = CpuIndexReg::None;
     finish.action = CpuMicroAction::FinishRTS;
-    pushMicroOp(finish);
+    program.push(finish);
 }
 
-void CPU::buildBRK()
+constexpr void CPU::buildBRK(CpuMicroProgram& program)
 {
     CpuMicroOp dummy;
     dummy.kind = CpuMicroOpKind::DummyRead;
     dummy.busType = CpuBusCycleType::DummyRead;
-    dummy.address = PC;
+    dummy.address = 0;
     dummy.value = 0;
-    dummy.useMicroAddress = false;
+    dummy.source = CpuMicroAddressSource::PC;
     dummy.index = CpuIndexReg::None;
     dummy.action = CpuMicroAction::PrepareBRKReturnAddress;
-    pushMicroOp(dummy);
+    program.push(dummy);
 
     CpuMicroOp pushHi;
     pushHi.kind = CpuMicroOpKind::StackWrite;
     pushHi.busType = CpuBusCycleType::StackWrite;
     pushHi.address = 0;
     pushHi.value = 0;
-    pushHi.useMicroAddress = false;
+    pushHi.source = CpuMicroAddressSource::Fixed;
     pushHi.index = CpuIndexReg::None;
     pushHi.action = CpuMicroAction::PushBRKReturnHigh;
-    pushMicroOp(pushHi);
+    program.push(pushHi);
 
     CpuMicroOp pushLo;
     pushLo.kind = CpuMicroOpKind::StackWrite;
     pushLo.busType = CpuBusCycleType::StackWrite;
     pushLo.address = 0;
     pushLo.value = 0;
-    pushLo.useMicroAddress = false;
+    pushLo.source = CpuMicroAddressSource::Fixed;
     pushLo.index = CpuIndexReg::None;
     pushLo.action = CpuMicroAction::PushBRKReturnLow;
-    pushMicroOp(pushLo);
+    program.push(pushLo);
 
     CpuMicroOp pushStatus;
     pushStatus.kind = CpuMicroOpKind::StackWrite;
     pushStatus.busType = CpuBusCycleType::StackWrite;
     pushStatus.address = 0;
     pushStatus.value = 0;
-    pushStatus.useMicroAddress = false;
+    pushStatus.source = CpuMicroAddressSource::Fixed;
     pushStatus.index = CpuIndexReg::None;
     pushStatus.action = CpuMicroAction::PushBRKStatus;
-    pushMicroOp(pushStatus);
+    program.push(pushStatus);
 
     CpuMicroOp readVecLo;
     readVecLo.kind = CpuMicroOpKind::Internal;
     readVecLo.busType = CpuBusCycleType::Read;
     readVecLo.address = 0xFFFE;
     readVecLo.value = 0;
-    readVecLo.useMicroAddress = false;
+    readVecLo.source = CpuMicroAddressSource::Fixed;
     readVecLo.index = CpuIndexReg::None;
     readVecLo.action = CpuMicroAction::ReadBRKVectorLow;
-    pushMicroOp(readVecLo);
+    program.push(readVecLo);
 
     CpuMicroOp readVecHi;
     readVecHi.kind = CpuMicroOpKind::Internal;
     readVecHi.busType = CpuBusCycleType::Read;
     readVecHi.address = 0xFFFF;
     readVecHi.value = 0;
-    readVecHi.useMicroAddress = false;
+    readVecHi.source = CpuMicroAddressSource::Fixed;
     readVecHi.index = CpuIndexReg::None;
     readVecHi.action = CpuMicroAction::ReadBRKVectorHigh;
-    pushMicroOp(readVecHi);
+    program.push(readVecHi);
 }
 
-void CPU::buildRTI()
+constexpr void CPU::buildRTI(CpuMicroProgram& program)
 {
     CpuMicroOp dummy1;
     dummy1.kind = CpuMicroOpKind::DummyRead;
     dummy1.busType = CpuBusCycleType::DummyRead;
-    dummy1.address = PC;
+    dummy1.address = 0;
     dummy1.value = 0;
-    dummy1.useMicroAddress = false;
+    dummy1.source = CpuMicroAddressSource::PC;
     dummy1.index = CpuIndexReg::None;
     dummy1.action = CpuMicroAction::None;
-    pushMicroOp(dummy1);
+    program.push(dummy1);
 
     CpuMicroOp dummy2;
     dummy2.kind = CpuMicroOpKind::DummyRead;
     dummy2.busType = CpuBusCycleType::DummyRead;
-    dummy2.address = uint16_t(0x0100 | SP);
+    dummy2.address = 0;
     dummy2.value = 0;
-    dummy2.useMicroAddress = false;
+    dummy2.source = CpuMicroAddressSource::Stack;
     dummy2.index = CpuIndexReg::None;
     dummy2.action = CpuMicroAction::None;
-    pushMicroOp(dummy2);
+    program.push(dummy2);
 
     CpuMicroOp pullStatus;
     pullStatus.kind = CpuMicroOpKind::StackRead;
     pullStatus.busType = CpuBusCycleType::StackRead;
     pullStatus.address = 0;
     pullStatus.value = 0;
-    pullStatus.useMicroAddress = false;
+    pullStatus.source = CpuMicroAddressSource::Fixed;
     pullStatus.index = CpuIndexReg::None;
     pullStatus.action = CpuMicroAction::PullRTIStatus;
-    pushMicroOp(pullStatus);
+    program.push(pullStatus);
 
     CpuMicroOp pullLo;
     pullLo.kind = CpuMicroOpKind::StackRead;
     pullLo.busType = CpuBusCycleType::StackRead;
     pullLo.address = 0;
     pullLo.value = 0;
-    pullLo.useMicroAddress = false;
+    pullLo.source = CpuMicroAddressSource::Fixed;
     pullLo.index = CpuIndexReg::None;
     pullLo.action = CpuMicroAction::PullRTIPCLow;
-    pushMicroOp(pullLo);
+    program.push(pullLo);
 
     CpuMicroOp pullHi;
     pullHi.kind = CpuMicroOpKind::StackRead;
     pullHi.busType = CpuBusCycleType::StackRead;
     pullHi.address = 0;
     pullHi.value = 0;
-    pullHi.useMicroAddress = false;
+    pullHi.source = CpuMicroAddressSource::Fixed;
     pullHi.index = CpuIndexReg::None;
 
     // Pull high byte and finish RTI in the same stack-read cycle.
     pullHi.action = CpuMicroAction::PullRTIPCHigh;
 
-    pushMicroOp(pullHi);
+    program.push(pullHi);
 }
 
-bool CPU::canExecuteOpcodeWithMicroOps(uint8_t opcode) const
+constexpr CPU::CpuMicroProgram CPU::buildInterruptMicroProgram(uint16_t vectorAddress)
 {
-    switch (opcode)
-    {
-        case 0xEA: // NOP implied
-        case 0x1A:
-        case 0x3A:
-        case 0x5A:
-        case 0x7A:
-        case 0xDA:
-        case 0xFA:
-        case 0x80:
-        case 0x82:
-        case 0x89:
-        case 0xC2:
-        case 0xE2:
-        case 0x04:
-        case 0x44:
-        case 0x64:
-        case 0x14:
-        case 0x34:
-        case 0x54:
-        case 0x74:
-        case 0xD4:
-        case 0xF4:
-        case 0x0C:
-        case 0x1C:
-        case 0x3C:
-        case 0x5C:
-        case 0x7C:
-        case 0xDC:
-        case 0xFC:
-
-        case 0x0D: // ORA abs
-        case 0x2D: // AND abs
-        case 0x4D: // EOR abs
-
-        case 0x1D: // ORA abs,X
-        case 0x19: // ORA abs,Y
-
-        case 0x01: // ORA (zp,X)
-        case 0x11: // ORA (zp),Y
-
-        case 0x21: // AND (zp,X)
-        case 0x31: // AND (zp),Y
-
-        case 0x41: // EOR (zp,X)
-        case 0x51: // EOR (zp),Y
-
-        case 0x3D: // AND abs,X
-        case 0x39: // AND abs,Y
-
-        case 0x5D: // EOR abs,X
-        case 0x59: // EOR abs,Y
-
-        case 0x09: // ORA #imm
-        case 0x29: // AND #imm
-        case 0x49: // EOR #imm
-
-        case 0x05: // ORA zp
-        case 0x25: // AND zp
-        case 0x45: // EOR zp
-
-        case 0x15: // ORA zp,X
-        case 0x35: // AND zp,X
-        case 0x55: // EOR zp,X
-
-        case 0xC1: // CMP (zp,X)
-        case 0xD1: // CMP (zp),Y
-
-        case 0x61: // ADC (zp,X)
-        case 0x71: // ADC (zp),Y
-
-        case 0xE1: // SBC (zp,X)
-        case 0xF1: // SBC (zp),Y
-
-        case 0xA9: // LDA #imm
-        case 0xA2: // LDX #imm
-        case 0xA0: // LDY #imm
-
-        case 0xA5: // LDA zp
-        case 0xA6: // LDX zp
-        case 0xA4: // LDY zp
-
-        case 0xAD: // LDA abs
-        case 0xAE: // LDX abs
-        case 0xAC: // LDY abs
-
-        case 0xBD: // LDA abs,X
-        case 0xB9: // LDA abs,Y
-        case 0xBC: // LDY abs,X
-        case 0xBE: // LDX abs,Y
-
-        case 0xA1: // LDA (zp,X)
-        case 0xB1: // LDA (zp),Y
-
-        case 0xB5: // LDA zp,X
-        case 0xB4: // LDY zp,X
-        case 0xB6: // LDX zp,Y
-
-        case 0x85: // STA zp
-        case 0x86: // STX zp
-        case 0x84: // STY zp
-
-        case 0x8D: // STA abs
-        case 0x8E: // STX abs
-        case 0x8C: // STY abs
-
-        case 0x9D: // STA abs,X
-        case 0x99: // STA abs,Y
-
-        case 0x95: // STA zp,X
-        case 0x94: // STY zp,X
-        case 0x96: // STX zp,Y
-
-        case 0x81: // STA (zp,X)
-        case 0x91: // STA (zp),Y
-
-        case 0xAA: // TAX
-        case 0xA8: // TAY
-        case 0x8A: // TXA
-        case 0x98: // TYA
-        case 0xBA: // TSX
-        case 0x9A: // TXS
-
-        case 0xE8: // INX
-        case 0xC8: // INY
-        case 0xCA: // DEX
-        case 0x88: // DEY
-
-        case 0x18: // CLC
-        case 0x38: // SEC
-        case 0x58: // CLI
-        case 0x78: // SEI
-        case 0xD8: // CLD
-        case 0xF8: // SED
-        case 0xB8: // CLV
-
-        case 0xC9: // CMP #imm
-        case 0xE0: // CPX #imm
-        case 0xC0: // CPY #imm
-
-        case 0xC5: // CMP zp
-        case 0xE4: // CPX zp
-        case 0xC4: // CPY zp
-
-        case 0xCD: // CMP abs
-        case 0xEC: // CPX abs
-        case 0xCC: // CPY abs
-
-        case 0xD5: // CMP zp,X
-        case 0xDD: // CMP abs,X
-        case 0xD9: // CMP abs,Y
-
-        case 0x69: // ADC #imm
-        case 0xE9: // SBC #imm
-        case 0xEB: // unofficial SBC #imm alias
-
-        case 0x65: // ADC zp
-        case 0xE5: // SBC zp
-
-        case 0x6D: // ADC abs
-        case 0xED: // SBC abs
-
-        case 0x75: // ADC zp,X
-        case 0xF5: // SBC zp,X
-
-        case 0x7D: // ADC abs,X
-        case 0x79: // ADC abs,Y
-        case 0xFD: // SBC abs,X
-        case 0xF9: // SBC abs,Y
-
-        case 0x24: // BIT zp
-        case 0x2C: // BIT abs
-
-        case 0x0A: // ASL A
-        case 0x2A: // ROL A
-        case 0x4A: // LSR A
-        case 0x6A: // ROR A
-
-        case 0x06: // ASL zp
-        case 0x26: // ROL zp
-        case 0x46: // LSR zp
-        case 0x66: // ROR zp
-
-        case 0x0E: // ASL abs
-        case 0x2E: // ROL abs
-        case 0x4E: // LSR abs
-        case 0x6E: // ROR abs
-
-        case 0x16: // ASL zp,X
-        case 0x36: // ROL zp,X
-        case 0x56: // LSR zp,X
-        case 0x76: // ROR zp,X
-
-        case 0x1E: // ASL abs,X
-        case 0x3E: // ROL abs,X
-        case 0x5E: // LSR abs,X
-        case 0x7E: // ROR abs,X
-
-        case 0xE6: // INC zp
-        case 0xEE: // INC abs
-        case 0xF6: // INC zp,X
-        case 0xFE: // INC abs,X
-
-        case 0xC6: // DEC zp
-        case 0xCE: // DEC abs
-        case 0xD6: // DEC zp,X
-        case 0xDE: // DEC abs,X
-
-        case 0x4C: // JMP abs
-        case 0x6C: // JMP (abs)
-
-        case 0x90: // BCC
-        case 0xB0: // BCS
-        case 0xF0: // BEQ
-        case 0xD0: // BNE
-        case 0x30: // BMI
-        case 0x10: // BPL
-        case 0x50: // BVC
-        case 0x70: // BVS
-
-        case 0x08: // PHP
-        case 0x28: // PLP
-        case 0x48: // PHA
-        case 0x68: // PLA
-
-        case 0x20: // JSR
-        case 0x60: // RTS
-
-        case 0x00: // BRK
-        case 0x40: // RTI
-
-        case 0x07: // SLO zp
-        case 0x17: // SLO zp,X
-        case 0x0F: // SLO abs
-        case 0x1F: // SLO abs,X
-        case 0x1B: // SLO abs,Y
-        case 0x03: // SLO (zp,X)
-        case 0x13: // SLO (zp),Y
-
-        case 0x27: // RLA zp
-        case 0x37: // RLA zp,X
-        case 0x2F: // RLA abs
-        case 0x3F: // RLA abs,X
-        case 0x3B: // RLA abs,Y
-        case 0x23: // RLA (zp,X)
-        case 0x33: // RLA (zp),Y
-
-        case 0x47: // SRE zp
-        case 0x57: // SRE zp,X
-        case 0x4F: // SRE abs
-        case 0x5F: // SRE abs,X
-        case 0x5B: // SRE abs,Y
-        case 0x43: // SRE (zp,X)
-        case 0x53: // SRE (zp),Y
-
-        case 0x67: // RRA zp
-        case 0x77: // RRA zp,X
-        case 0x6F: // RRA abs
-        case 0x7F: // RRA abs,X
-        case 0x7B: // RRA abs,Y
-        case 0x63: // RRA (zp,X)
-        case 0x73: // RRA (zp),Y
-
-        case 0xC7: // DCP zp
-        case 0xD7: // DCP zp,X
-        case 0xCF: // DCP abs
-        case 0xDF: // DCP abs,X
-        case 0xDB: // DCP abs,Y
-        case 0xC3: // DCP (zp,X)
-        case 0xD3: // DCP (zp),Y
+    CpuMicroProgram program;
 
-        case 0xE7: // ISC zp
-        case 0xF7: // ISC zp,X
-        case 0xEF: // ISC abs
-        case 0xFF: // ISC abs,X
-        case 0xFB: // ISC abs,Y
-        case 0xE3: // ISC (zp,X)
-        case 0xF3: // ISC (zp),Y
+    /*
+     * Hardware IRQ/NMI entry is seven CPU cycles.
+     *
+     * 1. Dummy opcode read
+     * 2. Second dummy read
+     * 3. Push return PC high
+     * 4. Push return PC low
+     * 5. Push processor status
+     * 6. Read vector low
+     * 7. Read vector high and install PC
+     */
 
-        case 0xA7: // LAX zp
-        case 0xB7: // LAX zp,Y
-        case 0xAF: // LAX abs
-        case 0xBF: // LAX abs,Y
-        case 0xA3: // LAX (zp,X)
-        case 0xB3: // LAX (zp),Y
-        case 0xAB: // LAX #imm
+    CpuMicroOp dummy1;
+    dummy1.kind         = CpuMicroOpKind::DummyRead;
+    dummy1.busType      = CpuBusCycleType::DummyRead;
+    dummy1.source       = CpuMicroAddressSource::PC;
+    dummy1.action       = CpuMicroAction::None;
+    program.push(dummy1);
 
-        case 0x87: // SAX zp
-        case 0x8F: // SAX abs
-        case 0x83: // SAX (zp,X)
-        case 0x97: // SAX zp,Y
+    CpuMicroOp dummy2;
+    dummy2.kind         = CpuMicroOpKind::DummyRead;
+    dummy2.busType      = CpuBusCycleType::DummyRead;
+    dummy2.source       = CpuMicroAddressSource::PC;
+    dummy2.action       = CpuMicroAction::None;
+    program.push(dummy2);
 
-        case 0x0B: // ANC #imm
-        case 0x2B: // ANC #imm
+    CpuMicroOp pushHigh;
+    pushHigh.kind       = CpuMicroOpKind::StackWrite;
+    pushHigh.busType    = CpuBusCycleType::StackWrite;
+    pushHigh.action     =  CpuMicroAction::PushInterruptReturnHigh;
+    program.push(pushHigh);
 
-        case 0x4B: // ALR #imm
+    CpuMicroOp pushLow;
+    pushLow.kind        = CpuMicroOpKind::StackWrite;
+    pushLow.busType     = CpuBusCycleType::StackWrite;
+    pushLow.action      = CpuMicroAction::PushInterruptReturnLow;
+    program.push(pushLow);
 
-        case 0xCB: // AXS/SBX #imm
+    CpuMicroOp pushStatus;
+    pushStatus.kind     = CpuMicroOpKind::StackWrite;
+    pushStatus.busType  = CpuBusCycleType::StackWrite;
+    pushStatus.action   = CpuMicroAction::PushInterruptStatus;
+    program.push(pushStatus);
 
-        case 0x6B: // ARR #imm
+    CpuMicroOp readVectorLow;
+    readVectorLow.kind      = CpuMicroOpKind::Internal;
+    readVectorLow.busType   = CpuBusCycleType::Read;
+    readVectorLow.address   = vectorAddress;
+    readVectorLow.action    = CpuMicroAction::ReadInterruptVectorLow;
+    program.push(readVectorLow);
 
-        case 0xBB: // LAS abs,Y
+    CpuMicroOp readVectorHigh;
+    readVectorHigh.kind     = CpuMicroOpKind::Internal;
+    readVectorHigh.busType  = CpuBusCycleType::Read;
+    readVectorHigh.address  = static_cast<uint16_t>(vectorAddress + 1);
+    readVectorHigh.action   = CpuMicroAction::ReadInterruptVectorHigh;
+    program.push(readVectorHigh);
 
-        case 0x9C: // SHY abs,X
+    return program;
+}
 
-        case 0x9E: // SHX abs,Y
+constexpr std::array<CPU::CpuMicroProgram, 256> CPU::buildOpcodeMicroPrograms()
+{
+    std::array<CpuMicroProgram, 256> programs {};
 
-        case 0x9F: // AHX abs,Y
-        case 0x93: // AHX (zp),Y
+    for (size_t opcode = 0; opcode < programs.size(); ++opcode)
+        buildMicroOpsForOpcode(programs[opcode], static_cast<uint8_t>(opcode));
 
-        case 0x9B: // TAS abs,Y
+    return programs;
+}
 
-        case 0x8B: // XAA #imm
-            return true;
+constexpr std::array<CPU::CpuMicroProgram, 256> CPU::OPCODE_MICRO_PROGRAMS = CPU::buildOpcodeMicroPrograms();
+constexpr CPU::CpuMicroProgram CPU::IRQ_MICRO_PROGRAM = CPU::buildInterruptMicroProgram(0xFFFE);
+constexpr CPU::CpuMicroProgram CPU::NMI_MICRO_PROGRAM = CPU::buildInterruptMicroProgram(0xFFFA);
 
-        default:
-            return false;
-    }
+bool CPU::canExecuteOpcodeWithMicroOps(uint8_t opcode) const
+{
+    return OPCODE_MICRO_PROGRAMS[opcode].count != 0;
 }
 
 bool CPU::tickMicroOps()
@@ -7293,6 +6870,7 @@ bool CPU::tickMicroOps()
         }
 
         recordExecutionHistory(opcodePC);
+        ++instructionCount;
 
         activeOpcodePC = opcodePC;
         activeOpcode   = opcode;
@@ -7332,7 +6910,7 @@ bool CPU::tickMicroOps()
             return true;
         }
 
-        buildMicroOpsForOpcode(opcode);
+        startMicroProgram(OPCODE_MICRO_PROGRAMS[opcode]);
 
         microSequenceType = CpuMicroSequenceType::Opcode;
 
@@ -7377,10 +6955,10 @@ bool CPU::beginPendingInterruptMicroOps()
     {
         nmiPending = false;
 
-        if (traceMgr)
+        if (traceActive())
             traceMgr->recordCPUNMI("NMI accepted into micro-op sequence", makeCpuStamp());
 
-        buildInterruptMicroOps(CpuMicroSequenceType::NMI, 0xFFFA);
+        startInterruptMicroOps(CpuMicroSequenceType::NMI, 0xFFFA);
         return true;
     }
 
@@ -7402,14 +6980,14 @@ bool CPU::beginPendingInterruptMicroOps()
     if (!IRQ || !IRQ->isIRQActive())
         return false;
 
-    if (traceMgr)
+    if (traceActive())
         traceMgr->recordCPUIRQ("IRQ accepted into micro-op sequence", makeCpuStamp());
 
-    buildInterruptMicroOps(CpuMicroSequenceType::IRQ,0xFFFE);
+    startInterruptMicroOps(CpuMicroSequenceType::IRQ,0xFFFE);
     return true;
 }
 
-void CPU::buildInterruptMicroOps(CpuMicroSequenceType type, uint16_t vectorAddress)
+void CPU::startInterruptMicroOps(CpuMicroSequenceType type, uint16_t vectorAddress)
 {
     clearMicroOps();
 
@@ -7427,63 +7005,7 @@ void CPU::buildInterruptMicroOps(CpuMicroSequenceType type, uint16_t vectorAddre
     microVectorLow = 0;
     microVectorHigh = 0;
 
-    /*
-     * Hardware IRQ/NMI entry is seven CPU cycles.
-     *
-     * 1. Dummy opcode read
-     * 2. Second dummy read
-     * 3. Push return PC high
-     * 4. Push return PC low
-     * 5. Push processor status
-     * 6. Read vector low
-     * 7. Read vector high and install PC
-     */
-
-    CpuMicroOp dummy1;
-    dummy1.kind         = CpuMicroOpKind::DummyRead;
-    dummy1.busType      = CpuBusCycleType::DummyRead;
-    dummy1.address      = PC;
-    dummy1.action       = CpuMicroAction::None;
-    pushMicroOp(dummy1);
-
-    CpuMicroOp dummy2;
-    dummy2.kind         = CpuMicroOpKind::DummyRead;
-    dummy2.busType      = CpuBusCycleType::DummyRead;
-    dummy2.address      = PC;
-    dummy2.action       = CpuMicroAction::None;
-    pushMicroOp(dummy2);
-
-    CpuMicroOp pushHigh;
-    pushHigh.kind       = CpuMicroOpKind::StackWrite;
-    pushHigh.busType    = CpuBusCycleType::StackWrite;
-    pushHigh.action     =  CpuMicroAction::PushInterruptReturnHigh;
-    pushMicroOp(pushHigh);
-
-    CpuMicroOp pushLow;
-    pushLow.kind        = CpuMicroOpKind::StackWrite;
-    pushLow.busType     = CpuBusCycleType::StackWrite;
-    pushLow.action      = CpuMicroAction::PushInterruptReturnLow;
-    pushMicroOp(pushLow);
-
-    CpuMicroOp pushStatus;
-    pushStatus.kind     = CpuMicroOpKind::StackWrite;
-    pushStatus.busType  = CpuBusCycleType::StackWrite;
-    pushStatus.action   = CpuMicroAction::PushInterruptStatus;
-    pushMicroOp(pushStatus);
-
-    CpuMicroOp readVectorLow;
-    readVectorLow.kind      = CpuMicroOpKind::Internal;
-    readVectorLow.busType   = CpuBusCycleType::Read;
-    readVectorLow.address   = vectorAddress;
-    readVectorLow.action    = CpuMicroAction::ReadInterruptVectorLow;
-    pushMicroOp(readVectorLow);
-
-    CpuMicroOp readVectorHigh;
-    readVectorHigh.kind     = CpuMicroOpKind::Internal;
-    readVectorHigh.busType  = CpuBusCycleType::Read;
-    readVectorHigh.address  = static_cast<uint16_t>(vectorAddress + 1);
-    readVectorHigh.action   = CpuMicroAction::ReadInterruptVectorHigh;
-    pushMicroOp(readVectorHigh);
+    startMicroProgram(type == CpuMicroSequenceType::NMI ? NMI_MICRO_PROGRAM : IRQ_MICRO_PROGRAM);
 
     microInstructionActive          = true;
     executedMicroOpsThisInstruction = 0;
@@ -7956,7 +7478,7 @@ void CPU::postLoadState()
     pendingOpcodeFetch = false;
     pendingOpcodeAddress = 0;
 
-    microOps = {};
+    microProgram = nullptr;
     microOpCount = 0;
     microOpIndex = 0;
     microInstructionActive = false;
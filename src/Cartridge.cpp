@@ -141,7 +141,7 @@ bool Cartridge::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
     if (!rdr.readVectorU8(romData)) { rdr.exitChunkPayload(chunk); return false; }
 
     // Rebuild header + chipSections from romData
-    chipSections.clear();
+    releaseChipSections();
     hasRAM = false;
     cartSize = 0;
 
@@ -185,6 +185,9 @@ bool Cartridge::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
         mapper->attachMemoryInstance(mem);
     }
 
+    if (mem)
+        mem->invalidatePageMap();
+
     // Mapper subchunks (now it can actually load them)
     StateReader::Chunk sub{};
     while (rdr.nextChunk(sub))
@@ -237,7 +240,7 @@ void Cartridge::clear()
 
     mapper.reset();
 
-    chipSections.clear();
+    releaseChipSections();
     romData.clear();
     ramData.clear();
 
@@ -249,6 +252,9 @@ void Cartridge::clear()
     exROMLine = true;
     gameLine = true;
 
+    if (mem)
+        mem->invalidatePageMap();
+
     mapperType = CartridgeType::GENERIC;
 
     std::memset(&header, 0, sizeof(header));
@@ -282,7 +288,7 @@ bool Cartridge::loadROM(const std::string& path)
 
     // Clear everything first
     mapper.reset();
-    chipSections.clear();
+    releaseChipSections();
     romData.clear();
     ramData.clear();
     hasRAM = false;
@@ -360,6 +366,9 @@ bool Cartridge::loadROM(const std::string& path)
     // Create mapper (or nullptr for UNKNOWN => “no mapper”)
     mapper = createMapper(mapperType);
 
+    if (mem)
+        mem->invalidatePageMap();
+
     // Choose a sane initial bank (bank 0 if present, else lowest bank)
     currentBank = selectInitialBank(chipSections);
 
@@ -631,16 +640,7 @@ void Cartridge::writeRAM(size_t offset, uint8_t value)
 
 bool Cartridge::setCurrentBank(uint8_t bank)
 {
-    bool bankFound = false;
-    for (const auto &section : chipSections)
-    {
-        if (section.bankNumber == bank)
-        {
-            bankFound = true;
-            break;
-        }
-    }
-    if (!bankFound)
+    if (bankSections[bank].empty())
         return false;
 
     currentBank = bank;
@@ -656,12 +656,50 @@ bool Cartridge::setCurrentBank(uint8_t bank)
 
 uint16_t Cartridge::getNumberOfBanks() const
 {
-    std::set<uint16_t> uniqueBanks;
-    for (const auto &section : chipSections)
+    uint16_t banks = 0;
+    for (const auto& sections : bankSections)
+    {
+        if (!sections.empty())
+            ++banks;
+    }
+    return banks;
+}
+
+bool Cartridge::mapChipBank(uint8_t bank, cartLocation location)
+{
+    if (!mem)
+        return false;
+
+    for (size_t index : bankSections[bank])
     {
-        uniqueBanks.insert(section.bankNumber);
+        const chipSection& section = chipSections[index];
+        const uint8_t* data = section.data.data();
+
+        if (location == cartLocation::LO)
+        {
+            if (section.loadAddress == CART_LO_START && section.data.size() >= 8192)
+            {
+                mem->mapCartridgeBank(location, data);
+                return true;
+            }
+            continue;
+        }
+
+        // ROMH comes from an 8K chip at $A000/$E000 or the top half of a 16K chip
+        if ((section.loadAddress == CART_HI_START || section.loadAddress == CART_HI_START1) && section.data.size() == 8192)
+        {
+            mem->mapCartridgeBank(location, data);
+            return true;
+        }
+
+        if (section.loadAddress == CART_LO_START && section.data.size() == 16384)
+        {
+            mem->mapCartridgeBank(location, data + 8192);
+            return true;
+        }
     }
-    return static_cast<uint16_t>(uniqueBanks.size());
+
+    return false;
 }
 
 bool Cartridge::hasSectionAt(uint16_t address) const
@@ -707,13 +745,21 @@ bool Cartridge::loadIntoMemory()
     }
 
     // Iterate through only the sections for the current bank.
-    for (const auto &section : chipSections)
+    for (size_t index : bankSections[currentBank])
     {
-        if (section.bankNumber != currentBank)
-            continue;
+        const chipSection& section = chipSections[index];
 
         // Check for a 16K chunk and split it.
-        if (section.data.size() == 16384)
+        if (section.data.size() == 16384 && section.loadAddress <= CART_LO_START)
+        {
+            #ifdef Debug
+            std::cout << "Mapping 16K section: LO/HI bank " << int(currentBank) << std::endl;
+            #endif // Debug
+
+            mem->mapCartridgeBank(cartLocation::LO, section.data.data());
+            mem->mapCartridgeBank(cartLocation::HI, section.data.data() + 8192);
+        }
+        else if (section.data.size() == 16384)
         {
             // Load First 8K into LO
             {
@@ -760,12 +806,8 @@ bool Cartridge::loadIntoMemory()
             }
             else if (section.loadAddress == CART_HI_START || section.loadAddress == CART_HI_START1)
             {
-                // Always map ROMH content to the HI buffer, starting at 0.
-                location = cartLocation::HI;
-
-                for (size_t i = 0; i < section.data.size(); ++i)
-                    mem->writeCartridge(static_cast<uint16_t>(i), section.data[i], location);
-
+                // Always map ROMH content to the HI window
+                mem->mapCartridgeBank(cartLocation::HI, section.data.data());
                 continue;
             }
             else if (section.loadAddress == 0xE000)
@@ -791,6 +833,12 @@ bool Cartridge::loadIntoMemory()
                       << " bank, starting at base 0x" << std::hex << baseAddress << std::endl;
             #endif // Debug
 
+            if (section.loadAddress == baseAddress)
+            {
+                mem->mapCartridgeBank(location, section.data.data());
+                continue;
+            }
+
             for (size_t i = 0; i < section.data.size(); i++)
             {
                 uint16_t offset = (section.loadAddress - baseAddress) + i;
@@ -832,13 +880,20 @@ void Cartridge::clearCartridge(cartLocation location)
         throw std::runtime_error("Unable to clear cartridge memory, no memory object");
     }
 
-    const uint16_t area_size = 8192; // 8KB
+    // An empty window reads $FF, later byte writes copy it into Memory's buffer
+    mem->mapCartridgeBank(location, nullptr);
+}
 
-    // Iterate through all offsets in the 8KB block and write 0xFF
-    for (uint16_t offset = 0; offset < area_size; ++offset)
-    {
-        mem->writeCartridge(offset, 0xFF, location);
-    }
+void Cartridge::releaseChipSections()
+{
+    // Memory may still be looking at the chip data
+    if (mem)
+        mem->detachCartridgeBanks();
+
+    chipSections.clear();
+
+    for (auto& sections : bankSections)
+        sections.clear();
 }
 
 bool Cartridge::processChipSections()
@@ -920,6 +975,12 @@ bool Cartridge::processChipSections()
         offset += payloadLen;
     }
 
+    for (auto& sections : bankSections)
+        sections.clear();
+
+    for (size_t i = 0; i < chipSections.size(); ++i)
+        bankSections[chipSections[i].bankNumber].push_back(i);
+
     return true;
 }
 
@@ -1168,6 +1229,9 @@ void Cartridge::setExROMLine(bool level)
 
     exROMLine = level;
 
+    if (mem)
+        mem->invalidatePageMap();
+
     if (traceMgr && traceMgr->cartDetailOn(TraceManager::TraceDetail::CART_LINE))
     {
         auto stamp = traceMgr->makeStamp(
@@ -1189,6 +1253,9 @@ void Cartridge::setGameLine(bool level)
 
     gameLine = level;
 
+    if (mem)
+        mem->invalidatePageMap();
+
     if (traceMgr && traceMgr->cartDetailOn(TraceManager::TraceDetail::CART_LINE))
     {
         auto stamp = traceMgr->makeStamp(
@@ -14,7 +14,7 @@ CaptureMapper::CaptureMapper() :
     registersEnabled(false),
     romHEnabled(false)
 {
-
+    claimsCpuMemory = true;
 }
 
 CaptureMapper::~CaptureMapper() = default;
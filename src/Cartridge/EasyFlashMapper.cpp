@@ -121,38 +121,23 @@ bool EasyFlashMapper::loadIntoMemory(uint8_t bank)
 
     selectedBank = static_cast<uint8_t>(bank & 0x3F);
 
-    cart->clearCartridge(cartLocation::LO);
-    cart->clearCartridge(cartLocation::HI);
-    cart->clearCartridge(cartLocation::HI_E000);
-
+    // ROML and ROMH are pointer swaps into the chip data, empty banks read as $FF
     bool loadedAny = false;
 
-    for (const auto& sec : cart->getChipSections())
-    {
-        if (sec.bankNumber != selectedBank)
-            continue;
-
-        const size_t size = std::min(sec.data.size(), size_t(0x2000));
-
-        if (sec.loadAddress == CART_LO_START || sec.loadAddress == 0x8000)
-        {
-            for (size_t i = 0; i < size; ++i)
-                mem->writeCartridge(i, sec.data[i], cartLocation::LO);
-
-            loadedAny = true;
-        }
-        else if (sec.loadAddress == CART_HI_START ||
-         sec.loadAddress == 0xA000 ||
-         sec.loadAddress == 0xE000)
-        {
-            for (size_t i = 0; i < size; ++i)
-            {
-                mem->writeCartridge(i, sec.data[i], cartLocation::HI);
-                mem->writeCartridge(i, sec.data[i], cartLocation::HI_E000);
-            }
+    if (cart->mapChipBank(selectedBank, cartLocation::LO))
+        loadedAny = true;
+    else
+        cart->clearCartridge(cartLocation::LO);
 
-            loadedAny = true;
-        }
+    if (cart->mapChipBank(selectedBank, cartLocation::HI))
+    {
+        cart->mapChipBank(selectedBank, cartLocation::HI_E000);
+        loadedAny = true;
+    }
+    else
+    {
+        cart->clearCartridge(cartLocation::HI);
+        cart->clearCartridge(cartLocation::HI_E000);
     }
 
     applyControlRegister(control.raw);
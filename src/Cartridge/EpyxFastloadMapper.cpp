@@ -14,7 +14,7 @@ EpyxFastloadMapper::EpyxFastloadMapper() :
     capacitorCounter(0),
     loaded(false)
 {
-
+    clocked = true;
 }
 
 EpyxFastloadMapper::~EpyxFastloadMapper() = default;
@@ -14,7 +14,7 @@ ExpertMapper::ExpertMapper() :
     freezeCycles(10),
     freezeActive(false)
 {
-
+    clocked = true;
 }
 
 ExpertMapper::~ExpertMapper() = default;
@@ -13,6 +13,7 @@ IDE64Mapper::IDE64Mapper()
 {
     controller.attachDevice(0, &device0);
     controller.attachDevice(1, &device1);
+    claimsCpuMemory = true;
 }
 
 IDE64Mapper::~IDE64Mapper() = default;
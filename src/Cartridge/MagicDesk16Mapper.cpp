@@ -104,10 +104,9 @@ bool MagicDesk16Mapper::loadIntoMemory(uint8_t bank)
 
     const Cartridge::chipSection* selectedSection = nullptr;
 
-    for (const auto& section : cart->getChipSections())
+    for (size_t index : cart->getBankSections(selectedBank))
     {
-        if (section.bankNumber != selectedBank)
-            continue;
+        const Cartridge::chipSection& section = cart->getChipSections()[index];
 
         if (section.loadAddress != 0x8000)
             continue;
@@ -129,15 +128,8 @@ bool MagicDesk16Mapper::loadIntoMemory(uint8_t bank)
         return false;
     }
 
-    cart->clearCartridge(cartLocation::LO);
-    cart->clearCartridge(cartLocation::HI);
-
-    for (size_t i = 0; i < 0x2000; ++i)
-    {
-        mem->writeCartridge(static_cast<uint16_t>(i), selectedSection->data[i], cartLocation::LO);
-
-        mem->writeCartridge(static_cast<uint16_t>(i), selectedSection->data[i + 0x2000], cartLocation::HI);
-    }
+    mem->mapCartridgeBank(cartLocation::LO, selectedSection->data.data());
+    mem->mapCartridgeBank(cartLocation::HI, selectedSection->data.data() + 0x2000);
 
     return true;
 }
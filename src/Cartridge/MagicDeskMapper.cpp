@@ -110,17 +110,8 @@ void MagicDeskMapper::write(uint16_t address, uint8_t value)
 bool MagicDeskMapper::loadIntoMemory(uint8_t bank) {
     if (!cart || !mem) return false;
 
-    const auto& sections = cart->getChipSections();
-    for (const auto& sec : sections)
-    {
-        if (sec.bankNumber == bank && sec.loadAddress == 0x8000 && sec.data.size() == 0x2000)
-        {
-            size_t size = std::min(sec.data.size(), size_t(0x2000));
-            for (size_t i = 0; i < size; ++i)
-                mem->writeCartridge(i, sec.data[i], cartLocation::LO);
-            return true;
-        }
-    }
+    if (cart->mapChipBank(bank, cartLocation::LO))
+        return true;
 
     std::cerr << "MagicDesk: Bank " << unsigned(bank) << " not found.\n";
     return false;
@@ -81,48 +81,18 @@ bool OceanMapper::mapSelectedBank()
 {
     buildBankList();
 
-    cart->clearCartridge(cartLocation::LO);
-    cart->clearCartridge(cartLocation::HI);
-
     const uint8_t logicalBank = static_cast<uint8_t>(sel & 0x0F);
-    const uint16_t loBank = logicalBank;
-    const uint16_t hiBank = static_cast<uint16_t>(logicalBank + 16);
-
-    bool wroteLo = false;
-    bool wroteHi = false;
-
-    for (const auto& s : cart->getChipSections())
-    {
-        if (s.chipType != 0)
-            continue;
+    const uint8_t loBank = logicalBank;
+    const uint8_t hiBank = static_cast<uint8_t>(logicalBank + 16);
 
-        if (s.loadAddress == CART_LO_START)
-        {
-            if (s.bankNumber != loBank)
-                continue;
-
-            if (s.data.size() != 8192)
-                continue;
-
-            for (size_t i = 0; i < s.data.size(); ++i)
-                mem->writeCartridge(static_cast<uint16_t>(i), s.data[i], cartLocation::LO);
-
-            wroteLo = true;
-        }
-        else if (s.loadAddress == CART_HI_START)
-        {
-            if (s.bankNumber != hiBank)
-                continue;
+    // Pointer swaps, missing banks read as $FF
+    const bool wroteLo = cart->mapChipBank(loBank, cartLocation::LO);
+    if (!wroteLo)
+        cart->clearCartridge(cartLocation::LO);
 
-            if (s.data.size() != 8192)
-                continue;
-
-            for (size_t i = 0; i < s.data.size(); ++i)
-                mem->writeCartridge(static_cast<uint16_t>(i), s.data[i], cartLocation::HI);
-
-            wroteHi = true;
-        }
-    }
+    const bool wroteHi = cart->mapChipBank(hiBank, cartLocation::HI);
+    if (!wroteHi)
+        cart->clearCartridge(cartLocation::HI);
 
     return wroteLo || wroteHi;
 }
@@ -19,7 +19,7 @@ RetroReplayMapper::RetroReplayMapper() :
     flashMode(false),
     freezeDelayCycles(0)
 {
-
+    clocked = true;
 }
 
 RetroReplayMapper::~RetroReplayMapper() = default;
@@ -16,7 +16,7 @@ StarDOSMapper::StarDOSMapper() :
     romlEnabled(true),
     loaded(false)
 {
-
+    clocked = true;
 }
 
 StarDOSMapper::~StarDOSMapper() = default;
@@ -23,6 +23,9 @@ Cassette::~Cassette() noexcept
 {
     try
     {
+        // Memory is torn down first as part of the machine, leave the lines alone
+        mem = nullptr;
+
         stop();
         unloadCassette();
     }
@@ -98,6 +101,8 @@ void Cassette::startMotor()
 
 bool Cassette::loadCassette(const std::string& path, VideoMode mode)
 {
+    if (mem) mem->syncCassetteLine();
+
     tapeImage = createTapeImage(path);
     if (!tapeImage || !tapeImage->loadTape(path, mode))
     {
@@ -110,6 +115,8 @@ bool Cassette::loadCassette(const std::string& path, VideoMode mode)
 }
 
 void Cassette::unloadCassette() {
+    if (mem) mem->syncCassetteLine();
+
     cassetteLoaded = false;
     playPressed = false;
     motorStatus = false;
@@ -126,12 +133,16 @@ bool Cassette::isT64() const
 
 void Cassette::play()
 {
+    if (mem) mem->syncCassetteLine();
+
     playPressed = true;
     if (mem) mem->setCassetteSenseLow(true);
 }
 
 void Cassette::stop()
 {
+    if (mem) mem->syncCassetteLine();
+
     playPressed = false;
     motorStatus = false;
     if (mem) mem->setCassetteSenseLow(false);
@@ -139,6 +150,8 @@ void Cassette::stop()
 
 void Cassette::rewind()
 {
+    if (mem) mem->syncCassetteLine();
+
     if (tapeImage) tapeImage->rewind();
     setData(true);  // idle-high after rewind
     tapePosition = 0;
@@ -151,6 +164,11 @@ void Cassette::eject()
 }
 
 void Cassette::tick()
+{
+    advance(1);
+}
+
+void Cassette::advance(uint32_t cycles)
 {
     // Cassette must be loaded, play pressed, and motor running
     if (!cassetteLoaded || !motorStatus || !playPressed) {
@@ -163,11 +181,24 @@ void Cassette::tick()
         return;
     }
 
-    // Advance one cycle of tape simulation
-    tapeImage->simulateLoading();
+    // Advance the tape simulation
+    tapeImage->advance(cycles);
     setData(tapeImage->currentBit());
 }
 
+uint32_t Cassette::cyclesUntilDataChange() const
+{
+    // Stopped: the line is forced high on the next cycle and stays there
+    if (!cassetteLoaded || !motorStatus || !playPressed || !tapeImage)
+        return data ? TapeImage::NO_EDGE : 1;
+
+    // Line still forced high from before the tape started moving
+    if (bool(data) != tapeImage->currentBit())
+        return 1;
+
+    return tapeImage->cyclesUntilLevelChange();
+}
+
 T64LoadResult Cassette::t64LoadPrgIntoMemory()
 {
     T64LoadResult result;
@@ -8,9 +8,11 @@
 #include <chrono>
 #include <filesystem>
 #include <functional>
+#include <iostream>
 #include <mutex>
 #include <thread>
 #include <vector>
+#include "ComponentProfiler.h"
 #include "Computer.h"
 #include "DebugManager.h"
 #include "Drive/D1541.h"
@@ -18,6 +20,7 @@
 #include "Drive/D1581.h"
 #include "Drive/Drive.h"
 #include "EmulationSession.h"
+#include "HeadlessSession.h"
 #include "MachineBuilder.h"
 #include "Debug/MLMonitor.h"
 #include "Debug/MLMonitorBackend.h"
@@ -26,9 +29,11 @@
 #include "Tape/TapeImageFactory.h"
 #include "UIBridge.h"
 
-Computer::Computer() :
+Computer::Computer(bool headless) :
     videoMode_(VideoMode::NTSC),
     cpuCfg_(&NTSC_CPU),
+    headless_(headless),
+    profiler_(nullptr),
     running(true),
     uiQuit(false),
     uiPaused(false),
@@ -49,9 +54,17 @@ Computer::Computer() :
     turbo232BaseAddress(0xDE00),
     resumeAfterVicCycleBreakpoint(false)
 {
-    components_.sdlContext = std::make_unique<SDLContext>();
+    if (headless_)
+    {
+        components_.nullVideoSink = std::make_unique<NullVideoSink>();
+    }
+    else
+    {
+        components_.sdlContext = std::make_unique<SDLContext>();
+        components_.videoOutput = std::make_unique<VideoOutput>();
+    }
+
     components_.audioOutput = std::make_unique<AudioOutput>();
-    components_.videoOutput = std::make_unique<VideoOutput>();
     components_.cart = std::make_unique<Cartridge>();
     components_.cass = std::make_unique<Cassette>();
     components_.cia1 = std::make_unique<CIA1>();
@@ -59,6 +72,7 @@ Computer::Computer() :
     components_.cpu = std::make_unique<CPU>();
     components_.dataBus = std::make_unique<DataBusLatch>();
     components_.ui = std::make_unique<EmulatorUI>();
+    components_.scheduler = std::make_unique<EventScheduler>();
     components_.executionHistory = std::make_unique<ExecutionHistory>(4096);
     components_.expansionManager = std::make_unique<ExpansionManager>(*this);
     components_.bus = std::make_unique<IECBUS>();
@@ -432,13 +446,78 @@ void Computer::setJoystickConfig(int port, const JoystickMapping& cfg)
 
 bool Computer::boot()
 {
+    if (headless_)
+    {
+        std::cerr << "Error: boot() requires a windowed machine, use runHeadless() instead" << std::endl;
+        return false;
+    }
+
     EmulationSession session(*this, components_, runtime_, roms_, uiQuit);
 
     return session.run();
 }
 
+bool Computer::runHeadless(const HeadlessConfig& config, HeadlessResult& result)
+{
+    if (!headless_)
+    {
+        std::cerr << "Error: runHeadless() requires a machine constructed in headless mode" << std::endl;
+        return false;
+    }
+
+    profiler_ = config.profiler;
+    components_.bus->attachProfilerInstance(config.profiler);
+
+    HeadlessSession session(*this, components_, runtime_, roms_, config);
+
+    const bool ok = session.run();
+    result = session.getResult();
+
+    profiler_ = nullptr;
+    components_.bus->attachProfilerInstance(nullptr);
+
+    return ok;
+}
+
 void Computer::tickCycle()
 {
+    if (profiler_ && profiler_->beginCycle())
+    {
+        tickCycleImpl<true>();
+        profiler_->endCycle();
+    }
+    else
+    {
+        tickCycleImpl<false>();
+    }
+}
+
+void Computer::syncScheduledDevices()
+{
+    if (components_.scheduler)
+        components_.scheduler->syncAll();
+
+    // SID voices run behind until a sample is due
+    if (components_.sid)
+        components_.sid->sync();
+
+    // Threaded drives stop here until the next cycle is run
+    if (components_.bus)
+        components_.bus->syncDrives();
+
+    // Drives skipping an idle loop run the cycles they still owe
+    for (auto& drive : components_.drives)
+    {
+        if (drive)
+            drive->syncIdle();
+    }
+}
+
+template <bool Profiled>
+void Computer::tickCycleImpl()
+{
+    using Component = ComponentProfiler::Component;
+
     if (!resumeAfterVicCycleBreakpoint)
     {
         components_.vic->beginCycle();
@@ -461,8 +540,14 @@ void Computer::tickCycle()
     // VIC performs its memory/bus fetch before the CPU's Phi2 bus cycle.
     components_.vic->busPhase();
 
-    components_.cpu->setRDY(components_.vic->getBA());
-    components_.cpu->setAEC(components_.vic->getAEC());
+    if constexpr (Profiled) profiler_->mark(Component::VIC);
+
+    // A running REU transfer holds the CPU off the bus and takes the cycles the VIC leaves free
+    const bool vicBA = components_.vic->getBA();
+    const bool reuDMA = components_.reu->isDMAActive();
+
+    components_.cpu->setRDY(vicBA && !reuDMA);
+    components_.cpu->setAEC(components_.vic->getAEC() && !reuDMA);
     components_.cpu->tick();
 
     if (cartridgeNMIPending)
@@ -471,10 +556,16 @@ void Computer::tickCycle()
         cartridgeNMIPending = false;
     }
 
+    if constexpr (Profiled) profiler_->mark(Component::CPU);
+
     components_.sid->tick(1);
 
-    components_.cia1->updateTimers(1);
-    components_.cia2->updateTimers(1);
+    if constexpr (Profiled) profiler_->mark(Component::SID);
+
+    // CIAs only run when a timer, TOD tick or port device is due, or on register access
+    components_.scheduler->advance();
+
+    if constexpr (Profiled) profiler_->mark(Component::CIA);
 
     if (components_.swiftLink)
         components_.swiftLink->tick(1);
@@ -482,13 +573,26 @@ void Computer::tickCycle()
     if (components_.turbo232)
         components_.turbo232->tick(1);
 
+    if (reuDMA && vicBA)
+        components_.reu->tickDMA();
+
+    if constexpr (Profiled) profiler_->mark(Component::Expansion);
+
+    // Drive time is split out by the bus itself while profiling
     components_.bus->tick(1);
 
-    if (auto* mapper = components_.cart->getMapper())
+    if constexpr (Profiled) profiler_->mark(Component::IECBus);
+
+    auto* mapper = components_.cart->getMapper();
+    if (mapper && mapper->isClocked())
         mapper->tick(1);
 
+    if constexpr (Profiled) profiler_->mark(Component::Cartridge);
+
     // Pixel composition and raster advancement happen after Phi2.
     components_.vic->endCycle();
+
+    if constexpr (Profiled) profiler_->mark(Component::VIC);
 }
 
 void Computer::warmReset()
@@ -511,6 +615,47 @@ void Computer::setSIDModel(const std::string& model)
     if (components_.resetCtl) components_.resetCtl->setSIDModel(model);
 }
 
+void Computer::setDriveThreads(bool enabled)
+{
+    if (components_.bus) components_.bus->setThreadedDrives(enabled);
+}
+
+void Computer::setSIDThread(bool enabled)
+{
+    if (components_.sid) components_.sid->setAudioThread(enabled);
+}
+
+void Computer::setAudioSampleRate(int rate)
+{
+    if (components_.audioOutput && !components_.audioOutput->setSampleRate(rate))
+        std::cerr << "Warning: unsupported audio rate " << rate << ", using " << components_.audioOutput->getSampleRate() << " Hz" << std::endl;
+}
+
+void Computer::setSIDResampler(const std::string& quality)
+{
+    SIDResampler::Quality parsed = SIDResampler::Quality::Fast;
+
+    if (!SIDResampler::parseQuality(quality, parsed))
+        std::cerr << "Warning: unknown SID resampler " << quality << ", using fast" << std::endl;
+
+    if (components_.sid) components_.sid->setResamplerQuality(parsed);
+}
+
+bool Computer::addSID(uint16_t baseAddress, const std::string& model, double pan)
+{
+    if (components_.sid && components_.sid->addLinkedChip(baseAddress, sidModelFromString(model), pan))
+        return true;
+
+    std::cerr << "Warning: cannot add a SID at $" << std::hex << std::uppercase << baseAddress << std::dec << std::nouppercase
+        << ", expected a free 32 byte window in $D420-$D7FF or $DE00-$DFFF and at most 3 SIDs" << std::endl;
+    return false;
+}
+
+void Computer::setSIDPan(double pan)
+{
+    if (components_.sid) components_.sid->setPan(pan);
+}
+
 void Computer::wireUp()
 {
     MachineBuilder::assemble(this, components_, runtime_, roms_);
@@ -0,0 +1,68 @@
+// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#include "Debug/DebugHooks.h"
+#include "Memory.h"
+
+DebugHooks::DebugHooks() :
+    mem(nullptr),
+    tracing(false)
+{
+    flags.fill(0);
+    pageArmCount.fill(0);
+}
+
+DebugHooks::~DebugHooks() = default;
+
+void DebugHooks::arm(uint16_t address, Access access)
+{
+    const uint8_t old = flags[address];
+    flags[address] = static_cast<uint8_t>(old | access);
+
+    if (old == 0 && flags[address] != 0)
+    {
+        if (pageArmCount[address >> 8]++ == 0)
+            pageChanged();
+    }
+}
+
+void DebugHooks::disarm(uint16_t address, Access access)
+{
+    const uint8_t old = flags[address];
+    flags[address] = static_cast<uint8_t>(old & ~access);
+
+    if (old != 0 && flags[address] == 0)
+    {
+        if (--pageArmCount[address >> 8] == 0)
+            pageChanged();
+    }
+}
+
+void DebugHooks::disarmAll(Access access)
+{
+    for (uint32_t address = 0; address < flags.size(); ++address)
+    {
+        if (flags[address] & access)
+            disarm(static_cast<uint16_t>(address), access);
+    }
+}
+
+void DebugHooks::setTracing(bool on)
+{
+    if (tracing == on)
+        return;
+
+    tracing = on;
+    pageChanged();
+}
+
+void DebugHooks::pageChanged()
+{
+    // Memory rebuilds its page map with the armed pages on the slow path
+    if (mem)
+        mem->invalidatePageMap();
+}
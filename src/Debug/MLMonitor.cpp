@@ -11,6 +11,7 @@
 #include "Debug/CartridgeCommand.h"
 #include "Debug/CIACommand.h"
 #include "Debug/CPUCommand.h"
+#include "Debug/DebugHooks.h"
 #include "Debug/DisassembleCommand.h"
 #include "Debug/DriveCommand.h"
 #include "Debug/ExportDisassemblyCommand.h"
@@ -39,6 +40,7 @@
 #include "Debug/MonitorCommand.h"
 
 MLMonitor::MLMonitor() :
+    hooks(nullptr),
     monbackend(nullptr),
     running(false),
     outputFileEnabled(false),
@@ -186,6 +188,7 @@ void MLMonitor::addWriteWatch(uint16_t address)
 {
     uint8_t value = monbackend->readRAM(address);
     writeWatches[address] = value;
+    if (hooks) hooks->arm(address, DebugHooks::HOOK_WRITE);
     std::cout << "Watchpoint set at $" << std::hex << std::setw(4) << std::setfill('0') << address
               << " (initial value = $" << std::setw(2) << static_cast<int>(value) << ")\n";
 }
@@ -194,6 +197,7 @@ void MLMonitor::clearWriteWatch(uint16_t address)
 {
     if (writeWatches.erase(address))
     {
+        if (hooks) hooks->disarm(address, DebugHooks::HOOK_WRITE);
         std::cout << "Watchpoint cleared at $" << std::hex << std::setw(4) << std::setfill('0') << address << "\n";
     }
     else
@@ -214,6 +218,8 @@ void MLMonitor::clearAllWriteWatches()
         it = writeWatches.erase(it); // erase returns next valid iterator
     }
 
+    if (hooks) hooks->disarmAll(DebugHooks::HOOK_WRITE);
+
     std::cout << "All writeWatches cleared.\n";
 }
 
@@ -254,13 +260,17 @@ bool MLMonitor::checkWatchWrite(uint16_t address, uint8_t newVal)
 void MLMonitor::addReadWatch(uint16_t address)
 {
     readWatches.insert(address);
+    if (hooks) hooks->arm(address, DebugHooks::HOOK_READ);
     std::cout << "Read watchpoint set at $" << std::hex << std::setw(4) << std::setfill('0') << address << "\n";
 }
 
 void MLMonitor::clearReadWatch(uint16_t address)
 {
     if (readWatches.erase(address))
+    {
+        if (hooks) hooks->disarm(address, DebugHooks::HOOK_READ);
         std::cout << "Read watchpoint cleared at $" << std::hex << std::setw(4) << std::setfill('0') << address << "\n";
+    }
     else
         std::cout << "No read watchpoint found at $" << std::hex << std::setw(4) << std::setfill('0') << address << "\n";
 }
@@ -273,6 +283,8 @@ void MLMonitor::clearAllReadWatches()
         std::cout << "Read watchpoint cleared at $" << std::hex << std::setw(4) << std::setfill('0') << addr << "\n";
         it = readWatches.erase(it);
     }
+
+    if (hooks) hooks->disarmAll(DebugHooks::HOOK_READ);
     std::cout << "All read watchpoints cleared.\n";
 }
 
@@ -440,7 +440,7 @@ std::string MLMonitorBackend::vicDumpBackgroundRowDebug(int raster) const
 
     if (!snap)
     {
-        out << "No row-state snapshot available for raster " << raster << "\n";
+        out << "No row-state snapshot available for raster " << raster << "\n" << Vic::DEBUG_CAPTURE_HINT;
         return out.str();
     }
 
@@ -582,7 +582,7 @@ std::string MLMonitorBackend::vicDumpBackgroundCellDebug(int raster, int col) co
 
     if (!snap)
     {
-        out << "No row-state snapshot available for raster " << raster << "\n";
+        out << "No row-state snapshot available for raster " << raster << "\n" << Vic::DEBUG_CAPTURE_HINT;
         return out.str();
     }
 
@@ -701,7 +701,7 @@ std::string MLMonitorBackend::vicDumpAllRasterEvents() const
 
     if (events->empty())
     {
-        out << "No recorded events.\n";
+        out << "No recorded events.\n" << Vic::DEBUG_CAPTURE_HINT;
         return out.str();
     }
 
@@ -880,7 +880,7 @@ std::string MLMonitorBackend::vicDumpRasterEvents(int raster) const
     }
 
     if (!any)
-        out << "No recorded events on this raster.\n";
+        out << "No recorded events on this raster.\n" << Vic::DEBUG_CAPTURE_HINT;
 
     return out.str();
 }
@@ -905,7 +905,7 @@ std::string MLMonitorBackend::vicDumpRasterRowState(int raster) const
         );
 
     if (detail.empty())
-        out << "No row-state snapshot available.\n";
+        out << "No row-state snapshot available.\n" << Vic::DEBUG_CAPTURE_HINT;
     else
         out << detail << "\n";
 
@@ -1843,6 +1843,22 @@ std::string MLMonitorBackend::vicDumpMemory(uint16_t address, int count) const
     return out.str();
 }
 
+std::string MLMonitorBackend::vicDebugCaptureStatus() const
+{
+    if (!vic)
+        return "VIC not available\n";
+
+    std::ostringstream out;
+
+    out << "VIC debug capture: " << (vic->isDebugCaptureEnabled() ? "on" : "off") << "\n";
+    out << "  this frame: " << (vic->isDebugCaptureActive() ? "capturing" : "idle") << "\n";
+
+    if (vic->isDebugCapturePending())
+        out << "  next frame: armed\n";
+
+    return out.str();
+}
+
 void MLMonitorBackend::vicFFRaster(uint8_t targetRaster)
 {
     if (!vic || !comp)
@@ -1852,6 +1868,8 @@ void MLMonitorBackend::vicFFRaster(uint8_t targetRaster)
     {
         comp->tickCycle();
     }
+
+    comp->syncScheduledDevices();
 }
 
 void MLMonitorBackend::enterMonitor()
@@ -1946,6 +1964,8 @@ void MLMonitorBackend::cpuStepInstruction()
     }
     while (!cpu->isAtInstructionBoundary() && --guard > 0);
 
+    comp->syncScheduledDevices();
+
     if (guard <= 0)
     {
         std::cerr
@@ -47,7 +47,7 @@ std::string TraceCommand::help() const
         "  trace on|off                     Enable or disable tracing globally\n"
         "  trace cats|categories            List all top-level chip categories and their status\n"
         "  trace details                    List all CART/CIA/CPU/VIC/PLA/Memory detail categories and their status\n"
-        "  trace dump                       Dump the current trace buffer to console\n"
+        "  trace dump                       Dump the most recent trace records (up to 32K) to console\n"
         "  trace clear                      Clear stored trace data\n"
         "  trace file <path>                Write trace output to a file\n"
         "  trace status                     Show global, category, and detail trace status\n"
@@ -429,6 +429,9 @@ void TraceCommand::execute(MLMonitor& mon, const std::vector<std::string>& args)
         std::cout << "Trace " << (traceMgr->isEnabled() ? "ON" : "OFF") << "\n";
         std::cout << traceMgr->listCategoryStatus() << "\n";
         std::cout << traceMgr->listDetailStatus() << "\n";
+
+        if (traceMgr->getDroppedRecords() != 0)
+            std::cout << "Trace file dropped " << std::dec << traceMgr->getDroppedRecords() << " records\n";
         return;
     }
 
@@ -5,8 +5,12 @@
 // non-commercial use only. Redistribution, modification, or use
 // of this code in whole or in part for any other purpose is
 // strictly prohibited without the prior written consent of the author.
+#include <algorithm>
 #include <bitset>
+#include <chrono>
+#include <cstring>
 #include "CPU.h"
+#include "Debug/DebugHooks.h"
 #include "Debug/TraceManager.h"
 
 TraceManager::TraceManager() :
@@ -14,11 +18,18 @@ TraceManager::TraceManager() :
     cia1object(nullptr),
     cia2object(nullptr),
     processor(nullptr),
+    hooks(nullptr),
     mem(nullptr),
     pla(nullptr),
     sidchip(nullptr),
     vicII(nullptr),
     tracing(false),
+    ring(nullptr),
+    ringHead(0),
+    dumpTail(0),
+    writerRunning(false),
+    droppedRecords(0),
+    writerTail(0),
     chipCats(0u),
     detailCats(0ull)
 {
@@ -27,6 +38,7 @@ TraceManager::TraceManager() :
 
 TraceManager::~TraceManager()
 {
+    stopWriter();
     if (file.is_open()) file.close();
 }
 
@@ -51,7 +63,15 @@ void TraceManager::enableAllCategories(bool enable)
 
 void TraceManager::enable(bool on)
 {
+    // Sessions that never trace skip the ring, once allocated it is kept for later sessions
+    if (on && !ring)
+        ring = std::make_unique<TraceRecord[]>(RING_SIZE);
+
     tracing = on;
+
+    if (hooks)
+        hooks->setTracing(on);
+
     if (!on)
     {
         dumpBuffer();
@@ -60,19 +80,26 @@ void TraceManager::enable(bool on)
 
 void TraceManager::setFileOutput(const std::string& path)
 {
+    stopWriter();
+
     if (file.is_open()) file.close();
     file.open(path, std::ios::out | std::ios::trunc);
+
+    // Records are formatted and written on a background thread
+    if (file.is_open())
+        startWriter();
 }
 
 void TraceManager::dumpBuffer()
 {
-    for (auto& line : buffer) std::cout << line << "\n";
-    buffer.clear();
+    TraceRecord rec;
+    while (copyRecord(dumpTail, rec))
+        std::cout << formatRecord(rec) << "\n";
 }
 
 void TraceManager::clearBuffer()
 {
-    buffer.clear();
+    dumpTail = ringHead.load(std::memory_order_acquire);
 }
 
 bool TraceManager::cartDetailOn(TraceDetail d) const
@@ -326,185 +353,148 @@ void TraceManager::recordCartBank(const char* mapper, int bank, uint16_t lo, uin
 {
     if (!cartDetailOn(TraceDetail::CART_BANK)) return;
 
-    std::stringstream out;
+    TraceRecord& rec = beginRecord(RecordKind::CartBank, stamp);
+    rec.word[0] = lo;
+    rec.word[1] = hi;
+    rec.word[2] = static_cast<uint16_t>(static_cast<uint32_t>(bank) & 0xFFFF);
+    rec.word[3] = static_cast<uint16_t>(static_cast<uint32_t>(bank) >> 16);
 
-    out << makeStamp(stamp) << "[CART] Mapper: " << mapper << " Bank: " << bank << " CART_LO: " << std::hex << std::setw(4) << lo << " CART_HI: " << hi;
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    const size_t len = std::min(std::strlen(mapper), RECORD_TEXT_SIZE - 1);
+    std::memcpy(rec.text, mapper, len);
+    rec.text[len] = '\0';
+    commitRecord();
 }
 
 void TraceManager::recordCartControl(const std::string& text, Stamp stamp)
 {
     if (!cartDetailOn(TraceDetail::CART_CTRL)) return;
 
-    std::string line = makeStamp(stamp) + text;
-    buffer.push_back(line);
-    if (file.is_open()) file << line << "\n";
+    recordText("", text, &stamp);
 }
 
 void TraceManager::recordCartLine(const std::string& text, Stamp stamp)
 {
     if (!cartDetailOn(TraceDetail::CART_LINE)) return;
 
-    std::string line = makeStamp(stamp) + text;
-    buffer.push_back(line);
-    if (file.is_open()) file << line << "\n";
+    recordText("", text, &stamp);
 }
 
 void TraceManager::recordCartMem(const std::string& text, Stamp stamp)
 {
     if (!cartDetailOn(TraceDetail::CART_MEM)) return;
 
-    std::string line = makeStamp(stamp) + text;
-    buffer.push_back(line);
-    if (file.is_open()) file << line << "\n";
+    recordText("", text, &stamp);
 }
 
 void TraceManager::recordCiaTimer(int cia, char timerName, uint16_t value, bool underflow, Stamp stamp)
 {
     if (!ciaDetailOn(cia, TraceDetail::CIA_TIMER)) return;
 
-    std::stringstream out;
-    out << makeStamp(stamp) << "[CIA" << cia << ":TIMER] "
-        << "Timer=" << timerName
-        << " Value=$" << std::hex << std::uppercase << std::setw(4) << std::setfill('0') << value
-        << " Underflow=" << (underflow ? "Yes" : "No");
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    TraceRecord& rec = beginRecord(RecordKind::CiaTimer, stamp);
+    rec.byte[0] = static_cast<uint8_t>(cia);
+    rec.byte[1] = static_cast<uint8_t>(timerName);
+    rec.byte[2] = underflow;
+    rec.word[0] = value;
+    commitRecord();
 }
 
 void TraceManager::recordCiaICR(int cia, uint8_t icr, bool irqRaised, Stamp stamp)
 {
     if (!ciaDetailOn(cia, TraceDetail::CIA_IRQ)) return;
 
-    std::stringstream out;
-    out << makeStamp(stamp) << "[CIA" << cia << ":IRQ] "
-        << "ICR=$" << std::hex << std::uppercase << std::setw(2) << std::setfill('0') << int(icr)
-        << " Raised=" << (irqRaised ? "True" : "False");
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    TraceRecord& rec = beginRecord(RecordKind::CiaICR, stamp);
+    rec.byte[0] = static_cast<uint8_t>(cia);
+    rec.byte[1] = icr;
+    rec.byte[2] = irqRaised;
+    commitRecord();
 }
+
 void TraceManager::recordCPUExec(uint16_t pcExec, uint8_t opcode, Stamp stamp)
 {
     if (!processor || !cpuDetailOn(TraceDetail::CPU_EXEC)) return;
 
-    std::stringstream out;
-
-    // Do heading first
-    out << makeStamp(stamp);
-
     auto st = processor->getState();
-    out << "[CPU]" << std::hex << std::uppercase << std::setfill('0')
-        << "PC=$"  << std::setw(4) << pcExec
-        << " OPC=$"<< std::setw(2) << int(opcode)
-        << "  A=$" << std::setw(2) << int(st.A)
-        << "  X=$" << std::setw(2) << int(st.X)
-        << "  Y=$" << std::setw(2) << int(st.Y)
-        << "  SP=$"<< std::setw(2) << int(st.SP)
-        << "  P="  << std::bitset<8>(st.SR);
 
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    TraceRecord& rec = beginRecord(RecordKind::CPUExec, stamp);
+    rec.word[0] = pcExec;
+    rec.byte[0] = opcode;
+    rec.byte[1] = st.A;
+    rec.byte[2] = st.X;
+    rec.byte[3] = st.Y;
+    rec.byte[4] = st.SP;
+    rec.byte[5] = st.SR;
+    commitRecord();
 }
 
 void TraceManager::recordCPUIRQ(const std::string& text, Stamp stamp)
 {
     if (!cpuDetailOn(TraceDetail::CPU_IRQ)) return;
 
-    std::ostringstream out;
-    out << makeStamp(stamp) << "[CPU:IRQ] " << text;
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    recordText("[CPU:IRQ] ", text, &stamp);
 }
 
 void TraceManager::recordCPUNMI(const std::string& text, Stamp stamp)
 {
     if (!cpuDetailOn(TraceDetail::CPU_NMI)) return;
 
-    std::ostringstream out;
-    out << makeStamp(stamp) << "[CPU:NMI] " << text;
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    recordText("[CPU:NMI] ", text, &stamp);
 }
 
 void TraceManager::recordCPUStack(const std::string& text, Stamp stamp)
 {
     if (!cpuDetailOn(TraceDetail::CPU_STACK)) return;
 
-    std::ostringstream out;
-    out << makeStamp(stamp) << "[CPU:STACK] " << text;
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    recordText("[CPU:STACK] ", text, &stamp);
 }
 
 void TraceManager::recordCPUBA(const std::string& text, Stamp stamp)
 {
     if (!cpuDetailOn(TraceDetail::CPU_BA)) return;
 
-    std::ostringstream out;
-    out << makeStamp(stamp) << "[CPU:BA] " << text;
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    recordText("[CPU:BA] ", text, &stamp);
 }
 
 void TraceManager::recordCPUJam(const std::string& text, Stamp stamp)
 {
     if (!cpuDetailOn(TraceDetail::CPU_JAM)) return;
 
-    std::ostringstream out;
-    out << makeStamp(stamp) << "[CPU:JAM] " << text;
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    recordText("[CPU:JAM] ", text, &stamp);
 }
 
 void TraceManager::recordMemRead(uint16_t address, uint8_t value, uint16_t pc, Stamp stamp)
 {
     if (!tracing || !catOn(TraceCat::MEM)) return;
 
-    std::stringstream out;
-
-    out << makeStamp(stamp) << "[MEMORY] READ: Address=$" << std::hex << std::uppercase << std::setfill('0')
-        << std::setw(4) << address
-        << " Value=$" << std::setw(2) << int(value)
-        << " PC=$" << std::setw(4) << pc;
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    TraceRecord& rec = beginRecord(RecordKind::MemRead, stamp);
+    rec.word[0] = address;
+    rec.word[1] = pc;
+    rec.byte[0] = value;
+    commitRecord();
 }
 
 void TraceManager::recordMemWrite(uint16_t address, uint8_t value, uint16_t pc, Stamp stamp)
 {
     if (!tracing || !catOn(TraceCat::MEM)) return;
 
-    std::stringstream out;
-
-    out << makeStamp(stamp) << "[MEMORY] WRITE: Address=$" << std::hex << std::uppercase << std::setfill('0')
-        << std::setw(4) << address
-        << " Value=$" << std::setw(2) << int(value)
-        << " PC=$" << std::setw(4) << pc;
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    TraceRecord& rec = beginRecord(RecordKind::MemWrite, stamp);
+    rec.word[0] = address;
+    rec.word[1] = pc;
+    rec.byte[0] = value;
+    commitRecord();
 }
 
 void TraceManager::recordPlaMode(uint8_t mode, bool game, bool exrom, bool charen, bool hiram, bool loram, Stamp stamp)
 {
     if (!plaDetailOn(TraceDetail::PLA_MODE)) return;
 
-    std::stringstream out;
-
-    out << makeStamp(stamp) << "[PLA] Mode: " << int(mode) << " Game Line: " << (game ? "1 (inactive)" : "0 (asserted)") <<
-        " exRom: " << (exrom ? "1 (inactive" : "0 (asserted)") << " CHAREN: " << charen <<  " HIRAM: " << hiram << " LORAM: " << loram;
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    TraceRecord& rec = beginRecord(RecordKind::PlaMode, stamp);
+    rec.byte[0] = mode;
+    rec.byte[1] = game;
+    rec.byte[2] = exrom;
+    rec.byte[3] = charen;
+    rec.byte[4] = hiram;
+    rec.byte[5] = loram;
+    commitRecord();
 }
 
 void TraceManager::recordPlaPortWrite(uint8_t oldValue, uint8_t newValue,
@@ -513,18 +503,15 @@ void TraceManager::recordPlaPortWrite(uint8_t oldValue, uint8_t newValue,
 {
     if (!plaDetailOn(TraceDetail::PLA_PORT)) return;
 
-    std::stringstream out;
-    out << makeStamp(stamp)
-        << "[PLA] $0001 write old=$" << std::hex << std::uppercase << std::setw(2) << std::setfill('0') << int(oldValue)
-        << " new=$" << std::setw(2) << int(newValue)
-        << " GAME=" << (game ? "1" : "0")
-        << " EXROM=" << (exrom ? "1" : "0")
-        << " CHAREN=" << (charen ? "1" : "0")
-        << " HIRAM=" << (hiram ? "1" : "0")
-        << " LORAM=" << (loram ? "1" : "0");
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    TraceRecord& rec = beginRecord(RecordKind::PlaPort, stamp);
+    rec.byte[0] = oldValue;
+    rec.byte[1] = newValue;
+    rec.byte[2] = game;
+    rec.byte[3] = exrom;
+    rec.byte[4] = charen;
+    rec.byte[5] = hiram;
+    rec.byte[6] = loram;
+    commitRecord();
 }
 
 void TraceManager::recordPlaResolve(uint16_t address, const char* bankName, uint16_t offset, uint8_t mcr, uint8_t mode,
@@ -532,138 +519,306 @@ void TraceManager::recordPlaResolve(uint16_t address, const char* bankName, uint
 {
     if (!plaDetailOn(TraceDetail::PLA_RESOLVE)) return;
 
-    std::stringstream out;
-    out << makeStamp(stamp)
-        << "[PLA] resolve addr=$" << std::hex << std::uppercase << std::setw(4) << std::setfill('0') << address
-        << " -> " << bankName
-        << " offset=$" << std::setw(4) << offset
-        << " MCR=$" << std::setw(2) << int(mcr)
-        << " mode=" << std::dec << int(mode)
-        << " GAME=" << (game ? "1" : "0")
-        << " EXROM=" << (exrom ? "1" : "0")
-        << " CHAREN=" << (charen ? "1" : "0")
-        << " HIRAM=" << (hiram ? "1" : "0")
-        << " LORAM=" << (loram ? "1" : "0");
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    // bankName always points at one of PLA's string literals
+    TraceRecord& rec = beginRecord(RecordKind::PlaResolve, stamp);
+    rec.name = bankName;
+    rec.word[0] = address;
+    rec.word[1] = offset;
+    rec.byte[0] = mcr;
+    rec.byte[1] = mode;
+    rec.byte[2] = game;
+    rec.byte[3] = exrom;
+    rec.byte[4] = charen;
+    rec.byte[5] = hiram;
+    rec.byte[6] = loram;
+    commitRecord();
 }
 
 void TraceManager::recordSidWrite(uint16_t reg, uint8_t val, Stamp stamp)
 {
     if (!tracing || !catOn(TraceCat::SID)) return;
 
-    std::stringstream out;
-
-    if (reg < 32)
-    {
-        out << makeStamp(stamp) << "[SID] " << sidRegNames[reg] << " = $" << std::hex << +val;
-    }
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";;
+    TraceRecord& rec = beginRecord(RecordKind::SidWrite, stamp);
+    rec.word[0] = reg;
+    rec.byte[0] = val;
+    commitRecord();
 }
 
 void TraceManager::recordVicRaster(uint16_t line, uint16_t dot, bool irq, uint8_t d011, uint8_t d012, Stamp stamp)
 {
     if (!vicDetailOn(TraceDetail::VIC_RASTER)) return;
 
-    std::stringstream out;
-
-    out << makeStamp(stamp)
-    << "[VIC] Raster Line=" << std::dec << line
-    << " Dot=" << dot
-    << " IRQ=" << (irq ? "ON" : "OFF")
-    << " D011=$" << std::hex << std::setw(2) << std::setfill('0') << +d011
-    << " D012=$" << std::setw(2) << std::setfill('0') << +d012;
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    TraceRecord& rec = beginRecord(RecordKind::VicRaster, stamp);
+    rec.word[0] = line;
+    rec.word[1] = dot;
+    rec.byte[0] = irq;
+    rec.byte[1] = d011;
+    rec.byte[2] = d012;
+    commitRecord();
 }
 
 void TraceManager::recordVicIrq(bool level, Stamp stamp)
 {
     if (!vicDetailOn(TraceDetail::VIC_IRQ)) return;
 
-    std::stringstream out;
-
-    out << makeStamp(stamp) << "[VIC] IRQ Line Level: " << (level ? "High" : "Level");
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    TraceRecord& rec = beginRecord(RecordKind::VicIrq, stamp);
+    rec.byte[0] = level;
+    commitRecord();
 }
 
 void TraceManager::recordVicEvent(const std::string& text, Stamp stamp)
 {
     if (!vicDetailOn(TraceDetail::VIC_EVENT)) return;
 
-    std::stringstream out;
-    out << makeStamp(stamp) << "[VIC] " << text;
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    recordText("[VIC] ", text, &stamp);
 }
 
 void TraceManager::recordVicRegister(const std::string& text, Stamp stamp)
 {
     if (!vicDetailOn(TraceDetail::VIC_REG)) return;
 
-    std::ostringstream out;
-    out << makeStamp(stamp) << "[VIC:REG] " << text;
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    recordText("[VIC:REG] ", text, &stamp);
 }
 
 void TraceManager::recordVicBadline(const std::string& text, Stamp stamp)
 {
     if (!vicDetailOn(TraceDetail::VIC_BADLINE)) return;
 
-    std::ostringstream out;
-    out << makeStamp(stamp) << "[VIC:BADLINE] " << text;
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    recordText("[VIC:BADLINE] ", text, &stamp);
 }
 
 void TraceManager::recordVicSprite(const std::string& text, Stamp stamp)
 {
     if (!vicDetailOn(TraceDetail::VIC_SPRITE)) return;
 
-    std::ostringstream out;
-    out << makeStamp(stamp) << "[VIC:SPRITE] " << text;
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    recordText("[VIC:SPRITE] ", text, &stamp);
 }
 
 void TraceManager::recordVicBus(const std::string& text, Stamp stamp)
 {
     if (!vicDetailOn(TraceDetail::VIC_BUS)) return;
 
-    std::ostringstream out;
-    out << makeStamp(stamp) << "[VIC:BUS] " << text;
-
-    buffer.push_back(out.str());
-    if (file.is_open()) file << buffer.back() << "\n";
+    recordText("[VIC:BUS] ", text, &stamp);
 }
 
 void TraceManager::recordCustomEvent(const std::string& text)
 {
     if (tracing)
-    {
-        buffer.push_back(text);
-        if (file.is_open()) file << text << "\n";
-    }
+        recordText("", text, nullptr);
 }
 
 void TraceManager::recordCustomEvent(const std::string& text, Stamp stamp)
 {
     if (!tracing) return;
 
-    std::string line = makeStamp(stamp) + text;
-    buffer.push_back(line);
-    if (file.is_open()) file << line << "\n";
+    recordText("", text, &stamp);
+}
+
+TraceManager::TraceRecord& TraceManager::beginRecord(RecordKind kind, const Stamp& stamp)
+{
+    // Single producer: only the emulation thread records events
+    TraceRecord& rec = ring[ringHead.load(std::memory_order_relaxed) & RING_MASK];
+    rec.stamp = stamp;
+    rec.kind = kind;
+    rec.name = "";
+    return rec;
+}
+
+void TraceManager::recordText(const char* prefix, const std::string& text, const Stamp* stamp)
+{
+    TraceRecord& rec = beginRecord(stamp ? RecordKind::StampedText : RecordKind::Text, stamp ? *stamp : Stamp{0, 0, 0});
+    rec.name = prefix;
+
+    const size_t len = std::min(text.size(), RECORD_TEXT_SIZE - 1);
+    std::memcpy(rec.text, text.data(), len);
+    rec.text[len] = '\0';
+    commitRecord();
+}
+
+bool TraceManager::copyRecord(uint64_t& tail, TraceRecord& out)
+{
+    while (true)
+    {
+        const uint64_t head = ringHead.load(std::memory_order_acquire);
+        if (tail == head)
+            return false;
+
+        // The slot for head - RING_SIZE may be mid-rewrite, so the oldest
+        // stable record is one past it.
+        if (head - tail >= RING_SIZE)
+            tail = head - RING_SIZE + 1;
+
+        out = ring[tail & RING_MASK];
+
+        // If the producer reached this slot while we copied, start over from
+        // the new oldest record.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (ringHead.load(std::memory_order_relaxed) - tail >= RING_SIZE)
+            continue;
+
+        ++tail;
+        return true;
+    }
+}
+
+std::string TraceManager::formatRecord(const TraceRecord& rec) const
+{
+    std::stringstream out;
+
+    switch (rec.kind)
+    {
+        case RecordKind::Text:
+            out << rec.name << rec.text;
+            break;
+
+        case RecordKind::StampedText:
+            out << makeStamp(rec.stamp) << rec.name << rec.text;
+            break;
+
+        case RecordKind::CartBank:
+        {
+            const int bank = static_cast<int>(static_cast<uint32_t>(rec.word[2]) | (static_cast<uint32_t>(rec.word[3]) << 16));
+            out << makeStamp(rec.stamp) << "[CART] Mapper: " << rec.text << " Bank: " << bank << " CART_LO: " << std::hex << std::setw(4)
+                << rec.word[0] << " CART_HI: " << rec.word[1];
+            break;
+        }
+
+        case RecordKind::CiaTimer:
+            out << makeStamp(rec.stamp) << "[CIA" << int(rec.byte[0]) << ":TIMER] "
+                << "Timer=" << static_cast<char>(rec.byte[1])
+                << " Value=$" << std::hex << std::uppercase << std::setw(4) << std::setfill('0') << rec.word[0]
+                << " Underflow=" << (rec.byte[2] ? "Yes" : "No");
+            break;
+
+        case RecordKind::CiaICR:
+            out << makeStamp(rec.stamp) << "[CIA" << int(rec.byte[0]) << ":IRQ] "
+                << "ICR=$" << std::hex << std::uppercase << std::setw(2) << std::setfill('0') << int(rec.byte[1])
+                << " Raised=" << (rec.byte[2] ? "True" : "False");
+            break;
+
+        case RecordKind::CPUExec:
+            out << makeStamp(rec.stamp);
+            out << "[CPU]" << std::hex << std::uppercase << std::setfill('0')
+                << "PC=$"  << std::setw(4) << rec.word[0]
+                << " OPC=$"<< std::setw(2) << int(rec.byte[0])
+                << "  A=$" << std::setw(2) << int(rec.byte[1])
+                << "  X=$" << std::setw(2) << int(rec.byte[2])
+                << "  Y=$" << std::setw(2) << int(rec.byte[3])
+                << "  SP=$"<< std::setw(2) << int(rec.byte[4])
+                << "  P="  << std::bitset<8>(rec.byte[5]);
+            break;
+
+        case RecordKind::MemRead:
+        case RecordKind::MemWrite:
+            out << makeStamp(rec.stamp) << (rec.kind == RecordKind::MemRead ? "[MEMORY] READ: Address=$" : "[MEMORY] WRITE: Address=$")
+                << std::hex << std::uppercase << std::setfill('0')
+                << std::setw(4) << rec.word[0]
+                << " Value=$" << std::setw(2) << int(rec.byte[0])
+                << " PC=$" << std::setw(4) << rec.word[1];
+            break;
+
+        case RecordKind::PlaMode:
+            out << makeStamp(rec.stamp) << "[PLA] Mode: " << int(rec.byte[0]) << " Game Line: " << (rec.byte[1] ? "1 (inactive)" : "0 (asserted)") <<
+                " exRom: " << (rec.byte[2] ? "1 (inactive" : "0 (asserted)") << " CHAREN: " << int(rec.byte[3]) <<  " HIRAM: " << int(rec.byte[4])
+                << " LORAM: " << int(rec.byte[5]);
+            break;
+
+        case RecordKind::PlaPort:
+            out << makeStamp(rec.stamp)
+                << "[PLA] $0001 write old=$" << std::hex << std::uppercase << std::setw(2) << std::setfill('0') << int(rec.byte[0])
+                << " new=$" << std::setw(2) << int(rec.byte[1])
+                << " GAME=" << (rec.byte[2] ? "1" : "0")
+                << " EXROM=" << (rec.byte[3] ? "1" : "0")
+                << " CHAREN=" << (rec.byte[4] ? "1" : "0")
+                << " HIRAM=" << (rec.byte[5] ? "1" : "0")
+                << " LORAM=" << (rec.byte[6] ? "1" : "0");
+            break;
+
+        case RecordKind::PlaResolve:
+            out << makeStamp(rec.stamp)
+                << "[PLA] resolve addr=$" << std::hex << std::uppercase << std::setw(4) << std::setfill('0') << rec.word[0]
+                << " -> " << rec.name
+                << " offset=$" << std::setw(4) << rec.word[1]
+                << " MCR=$" << std::setw(2) << int(rec.byte[0])
+                << " mode=" << std::dec << int(rec.byte[1])
+                << " GAME=" << (rec.byte[2] ? "1" : "0")
+                << " EXROM=" << (rec.byte[3] ? "1" : "0")
+                << " CHAREN=" << (rec.byte[4] ? "1" : "0")
+                << " HIRAM=" << (rec.byte[5] ? "1" : "0")
+                << " LORAM=" << (rec.byte[6] ? "1" : "0");
+            break;
+
+        case RecordKind::SidWrite:
+            if (rec.word[0] < 32)
+                out << makeStamp(rec.stamp) << "[SID] " << sidRegNames[rec.word[0]] << " = $" << std::hex << +rec.byte[0];
+            break;
+
+        case RecordKind::VicRaster:
+            out << makeStamp(rec.stamp)
+                << "[VIC] Raster Line=" << std::dec << rec.word[0]
+                << " Dot=" << rec.word[1]
+                << " IRQ=" << (rec.byte[0] ? "ON" : "OFF")
+                << " D011=$" << std::hex << std::setw(2) << std::setfill('0') << +rec.byte[1]
+                << " D012=$" << std::setw(2) << std::setfill('0') << +rec.byte[2];
+            break;
+
+        case RecordKind::VicIrq:
+            out << makeStamp(rec.stamp) << "[VIC] IRQ Line Level: " << (rec.byte[0] ? "High" : "Level");
+            break;
+    }
+
+    return out.str();
+}
+
+void TraceManager::startWriter()
+{
+    writerTail = ringHead.load(std::memory_order_acquire);
+    writerRunning.store(true, std::memory_order_release);
+    writerThread = std::thread(&TraceManager::writerLoop, this);
+}
+
+void TraceManager::stopWriter()
+{
+    if (!writerThread.joinable())
+        return;
+
+    writerRunning.store(false, std::memory_order_release);
+    writerThread.join();
+}
+
+void TraceManager::writerLoop()
+{
+    TraceRecord rec;
+
+    while (true)
+    {
+        // Sample the flag first so everything recorded before stopWriter() is drained
+        const bool running = writerRunning.load(std::memory_order_acquire);
+        bool wrote = false;
+
+        uint64_t expected = writerTail;
+        while (copyRecord(writerTail, rec))
+        {
+            // copyRecord skips ahead when the producer lapped us
+            if (writerTail - 1 != expected)
+                droppedRecords.fetch_add(writerTail - 1 - expected, std::memory_order_relaxed);
+            expected = writerTail;
+
+            file << formatRecord(rec) << "\n";
+            wrote = true;
+        }
+
+        if (!running)
+            break;
+
+        if (!wrote)
+        {
+            file.flush();
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+
+    file.flush();
 }
 
 std::string TraceManager::makeStamp(const Stamp& stamp) const
@@ -42,6 +42,9 @@ std::string VICCommand::help() const
         "    break                  Show VIC raster/cycle breakpoint\n"
         "    break <r> <c>          Break at VIC raster/cycle\n"
         "    break clear            Clear VIC raster/cycle breakpoint\n"
+        "    capture                Show raster debug capture state\n"
+        "    capture on|off         Record events and row/pixel snapshots every frame\n"
+        "    capture frame          Record the next full frame only\n"
         "    regs <group>           Dump VIC-II registers\n"
         "    cycle                  Show debug info for current raster/cycle\n"
         "    cycle live             Show debug info for current live raster/cycle\n"
@@ -63,6 +66,15 @@ std::string VICCommand::borderUsage() const
         " vic border edge <raster>\n";
 }
 
+std::string VICCommand::captureUsage() const
+{
+    return
+        "Usage:\n"
+        "  vic capture\n"
+        "  vic capture on|off\n"
+        "  vic capture frame\n";
+}
+
 std::string VICCommand::cycleUsage() const
 {
     return
@@ -310,6 +322,42 @@ void VICCommand::execute(MLMonitor& mon, const std::vector<std::string>& args)
 
         return;
     }
+    else if (sub == "capture")
+    {
+        // vic capture
+        if (args.size() == 2)
+        {
+            std::cout << mon.mlmonitorbackend()->vicDebugCaptureStatus();
+            return;
+        }
+
+        if (args.size() != 3)
+        {
+            std::cout << captureUsage();
+            return;
+        }
+
+        if (args[2] == "on")
+        {
+            mon.mlmonitorbackend()->vicSetDebugCapture(true);
+            std::cout << "VIC debug capture on, starting with the next frame\n";
+        }
+        else if (args[2] == "off")
+        {
+            mon.mlmonitorbackend()->vicSetDebugCapture(false);
+            std::cout << "VIC debug capture off, the last captured frame is kept\n";
+        }
+        else if (args[2] == "frame")
+        {
+            mon.mlmonitorbackend()->vicCaptureNextFrame();
+            std::cout << "VIC debug capture armed for the next frame\n";
+        }
+        else
+        {
+            std::cout << captureUsage();
+        }
+        return;
+    }
     else if (sub == "cycle")
     {
         if (args.size() == 2)
@@ -9,6 +9,7 @@
 
 #include <cstdio>
 
+#include "Debug/DebugHooks.h"
 #include "Debug/MLMonitor.h"
 #include "Debug/MLMonitorBackend.h"
 #include "Debug/TraceManager.h"
@@ -32,6 +33,7 @@
 
 DebugManager::DebugManager(std::atomic<bool>& uiPausedRef)
     : uiPaused_(uiPausedRef),
+      hooks_(std::make_unique<DebugHooks>()),
       monitor_(std::make_unique<MLMonitor>()),
       backend_(std::make_unique<MLMonitorBackend>()),
       trace_(std::make_unique<TraceManager>()),
@@ -45,6 +47,10 @@ DebugManager::DebugManager(std::atomic<bool>& uiPausedRef)
     // Monitor needs its backend (and trace manager for the "trace" command)
     monitor_->attachMLMonitorBackendInstance(backend_.get());
     monitor_->attachTraceManagerInstance(trace_.get());
+
+    // Watchpoints and tracing arm the memory path through the hook registry
+    monitor_->attachDebugHooksInstance(hooks_.get());
+    trace_->attachDebugHooksInstance(hooks_.get());
 }
 
 DebugManager::~DebugManager() = default;
@@ -122,6 +128,7 @@ void DebugManager::wireTrace(Cartridge* cart,
     trace_->attachCIA2Instance(cia2);
     trace_->attachCPUInstance(cpu);
     trace_->attachMemoryInstance(mem);
+    hooks_->attachMemoryInstance(mem);
     trace_->attachPLAInstance(pla);
     trace_->attachSIDInstance(sid);
     trace_->attachVicInstance(vic);
@@ -166,6 +173,11 @@ bool DebugManager::handleEvent(const SDL_Event& ev)
     return monitorCtl_ ? monitorCtl_->handleEvent(ev) : false;
 }
 
+DebugHooks& DebugManager::hooks()
+{
+    return *hooks_;
+}
+
 MLMonitor& DebugManager::monitor()
 {
     return *monitor_;
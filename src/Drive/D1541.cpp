@@ -10,6 +10,7 @@
 
 D1541::D1541(int deviceNumber, const std::string& loRom, const std::string& hiRom) :
     motorOn(false),
+    gcrImage(nullptr),
     diskLoaded(false),
     diskWriteProtected(false),
     atnLineLow(false),
@@ -28,6 +29,7 @@ D1541::D1541(int deviceNumber, const std::string& loRom, const std::string& hiRo
     currentSector(0),
     gcrBitCounter(0),
     gcrPos(0),
+    gcrPosLength(0),
     gcrDirty(true),
     uiTrack(17),
     uiSector(0),
@@ -36,6 +38,7 @@ D1541::D1541(int deviceNumber, const std::string& loRom, const std::string& hiRo
     setDeviceNumber(deviceNumber);
     d1541mem.attachPeripheralInstance(this);
     driveCPU.attachMemoryInstance(&d1541mem);
+    attachIdleTracking(&driveCPU, &d1541mem);
     driveCPU.attachIRQLineInstance(&IRQ);
 
     if (!d1541mem.initialize(loRom, hiRom))
@@ -106,6 +109,8 @@ bool D1541::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
     if (std::memcmp(chunk.tag, "D541", 4) != 0)
         return false;
 
+    idleTracker.reset();
+
     rdr.enterChunkPayload(chunk);
 
     uint32_t ver = 0;
@@ -138,6 +143,7 @@ bool D1541::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
     {
         resetForMediaChange();
 
+        gcrImage = nullptr;
         diskImage.reset();
         loadedDiskName.clear();
         diskLoaded = false;
@@ -206,6 +212,8 @@ bool D1541::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
 
 void D1541::reset()
 {
+    idleTracker.reset();
+
     // Mechanics
     motorOn = false;
 
@@ -219,6 +227,7 @@ void D1541::reset()
     currentTrack                = 17;
     currentSector               = 0;
     densityCode                 = 3;
+    gcrTrackZone                = 3;
     halfTrackPos                = currentTrack * 2;
     loadedDiskName.clear();
 
@@ -251,6 +260,7 @@ void D1541::reset()
     }
 
     gcrPos                      = 0;
+    gcrPosLength                = 0;
     gcrBitCounter               = 0;
     gcrDirty                    = true;
     lastHeaderTrack             = 0;
@@ -299,6 +309,12 @@ void D1541::tick(uint32_t cycles)
 
     while (remaining > 0)
     {
+        if (skipIdleCycle())
+        {
+            --remaining;
+            continue;
+        }
+
         driveCPU.tick();
         uint32_t dc = driveCPU.getElapsedCycles();
         if (dc == 0) dc = 1;
@@ -321,9 +337,23 @@ void D1541::tick(uint32_t cycles)
         uiLedWasOn = ledOn;
 
         remaining -= dc;
+
+        observeIdle();
     }
 }
 
+bool D1541::canSkipIdle() const
+{
+    // The disk passing under the head feeds VIA2 every byte
+    return !(motorOn && diskLoaded);
+}
+
+void D1541::runOwedIdleCycles(uint32_t cycles)
+{
+    if (cycles != 0)
+        tick(cycles);
+}
+
 bool D1541::gcrTick()
 {
     if (gcrDirty)
@@ -334,14 +364,39 @@ bool D1541::gcrTick()
 
         gcrDirty = false;
 
-        if (!gcrTrackStream.empty())
-            gcrPos = oldPos % gcrTrackStream.size();
+        const size_t length = gcrTrackStream.size();
+
+        if (gcrImage)
+        {
+            // G64 tracks differ in length, keep the head at the same angle across the step
+            if (length == 0)
+                gcrPos = oldPos;
+            else if (gcrPosLength > 0)
+                gcrPos = static_cast<size_t>(uint64_t(oldPos) * length / gcrPosLength) % length;
+            else
+                gcrPos = oldPos % length;
+
+            if (length > 0)
+                gcrPosLength = length;
+        }
+        else if (length > 0)
+            gcrPos = oldPos % length;
         else
             gcrPos = 0;
     }
 
+    // Writing to a half-track the G64 does not hold formats it from scratch
+    if (gcrTrackStream.empty() && gcrImage && diskWriteGate && motorOn && diskLoaded && !diskWriteProtected)
+        startBlankGCRTrack();
+
     if (gcrTrackStream.empty())
+    {
+        // The disk keeps turning under an unformatted half-track
+        if (gcrImage && gcrPosLength > 0)
+            gcrPos = (gcrPos + 1) % gcrPosLength;
+
         return false;
+    }
 
     if (gcrSync.size() != gcrTrackStream.size())
         gcrSync.assign(gcrTrackStream.size(), 0);
@@ -377,8 +432,9 @@ bool D1541::gcrTick()
 
 void D1541::gcrAdvance(uint32_t dc)
 {
-    // Use the VIA2 density latch as the source of truth for bit rate.
-    const int cyclesPerByte = cyclesPerByteFromDensity(densityCode);
+    // Use the VIA2 density latch as the source of truth for bit rate, unless
+    // the image recorded the speed zone the track was mastered with.
+    const int cyclesPerByte = cyclesPerByteFromDensity(gcrImage ? gcrTrackZone : densityCode);
 
     gcrBitCounter += int(dc);
 
@@ -397,6 +453,13 @@ void D1541::rebuildGCRTrackStream()
 
     if (!diskLoaded || !diskImage) return;
 
+    // Raw images already hold the GCR for every half-track
+    if (gcrImage)
+    {
+        loadGCRTrackFromImage();
+        return;
+    }
+
     const int track1based = int(currentTrack) + 1;
     const int spt = gcrCodec.sectorsPerTrack1541(track1based);
 
@@ -486,6 +549,70 @@ void D1541::rebuildGCRTrackStream()
     d1541mem.getVIA2().clearMechBytePending();
 }
 
+void D1541::loadGCRTrackFromImage()
+{
+    size_t length = 0;
+    const uint8_t* data = gcrImage->getTrackData(size_t(halfTrackPos), length);
+    gcrTrackZone = gcrImage->getSpeedZone(size_t(halfTrackPos));
+
+    // An unformatted half-track has no data and simply never delivers a byte
+    if (data)
+        gcrTrackStream.assign(data, data + length);
+
+    rebuildSyncMapForCurrentTrack();
+
+    const size_t n = gcrTrackStream.size();
+    gcrSectorAtPos.assign(n, 0);
+
+    // Tag every byte with the sector whose header passed the head last,
+    // the first pass finds the header that wraps around the index hole.
+    constexpr size_t HEADER_GCR_SIZE = 10;
+    std::vector<uint8_t> raw;
+    uint8_t sectorTag = 0;
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (size_t pos = 1; pos + HEADER_GCR_SIZE <= n; ++pos)
+        {
+            if (gcrSync[pos - 1] && !gcrSync[pos])
+            {
+                raw.clear();
+                if (gcrCodec.decodeBytes(&gcrTrackStream[pos], HEADER_GCR_SIZE, raw) && raw[0] == 0x08)
+                    sectorTag = raw[2];
+            }
+
+            if (pass == 1)
+                gcrSectorAtPos[pos] = sectorTag;
+        }
+    }
+
+    // gcrTick() carries the rotational position over from the previous track
+
+    gcrWrittenMask.assign(n, 0);
+    d1541mem.getVIA2().clearMechBytePending();
+}
+
+void D1541::startBlankGCRTrack()
+{
+    // Bytes per revolution at the density the DOS selected, zone 0 (outer tracks 31+) to zone 3
+    static constexpr size_t kTrackBytes[4] = { 6250, 6666, 7142, 7692 };
+
+    gcrTrackZone = densityCode & 0x03;
+
+    const size_t length = kTrackBytes[gcrTrackZone];
+    gcrTrackStream.assign(length, 0x00);
+    gcrSync.assign(length, 0);
+    gcrSectorAtPos.assign(length, 0);
+    gcrWrittenMask.assign(length, 0);
+
+    if (gcrPosLength > 0)
+        gcrPos = static_cast<size_t>(uint64_t(gcrPos) * length / gcrPosLength) % length;
+    else
+        gcrPos %= length;
+
+    gcrPosLength = length;
+}
+
 void D1541::updateIRQ()
 {
     bool via1IRQ = d1541mem.getVIA1().checkIRQActive();
@@ -499,6 +626,7 @@ void D1541::updateIRQ()
 
 void D1541::loadDisk(const std::string& path)
 {
+    syncIdle();
     resetForMediaChange();
 
     diskWriteProtected  = false;
@@ -508,6 +636,7 @@ void D1541::loadDisk(const std::string& path)
     {
         // "Door open / no media" behavior: don't reset the drive computer
         loadedDiskName.clear();
+        gcrImage        = nullptr;
         diskImage.reset();
         diskLoaded      = false;
         lastError       = DriveError::NO_DISK;
@@ -515,6 +644,7 @@ void D1541::loadDisk(const std::string& path)
         // Invalidate any ongoing media stream
         gcrDirty        = true;
         gcrPos          = 0;
+        gcrPosLength    = 0;
         gcrBitCounter   = 0;
 
         gcrTrackStream.clear();
@@ -526,7 +656,15 @@ void D1541::loadDisk(const std::string& path)
 
     // HOT SWAP
     diskImage           = std::move(img);
+    gcrImage            = dynamic_cast<G64*>(diskImage.get());
     diskLoaded          = true;
+
+    // Only raw images can hold data beyond track 35
+    if (!gcrImage && halfTrackPos > 34 * 2)
+    {
+        halfTrackPos    = 34 * 2;
+        currentTrack    = 34;
+    }
     invalidateRawGcrCache();
 #ifdef Debug
     debugDumpDirectorySectors("after-load");
@@ -538,6 +676,7 @@ void D1541::loadDisk(const std::string& path)
     // Invalidate/rebuild media stream for the newly inserted disk
     gcrDirty            = true;
     gcrPos              = 0;
+    gcrPosLength        = 0;
     gcrBitCounter       = 0;
 
     gcrTrackStream.clear();
@@ -548,12 +687,15 @@ void D1541::loadDisk(const std::string& path)
 
 void D1541::unloadDisk()
 {
+    syncIdle();
     flushAndSaveDisk();
 
+    gcrImage = nullptr;
     diskImage.reset();  // Reset disk image by assigning a fresh instance
     loadedDiskName.clear();
 
     gcrPos = 0;
+    gcrPosLength = 0;
     gcrBitCounter = 0;
     gcrTrackStream.clear();
     gcrSync.clear();
@@ -696,6 +838,8 @@ void D1541::atnChanged(bool atnLow)
     // Always forward the very first notification so VIA1 gets a baseline sample
     if (iecLinesPrimed && atnLow == atnLineLow) return;
 
+    syncIdle();
+
     bool prevAtnLow = atnLineLow;
     atnLineLow = atnLow;
 
@@ -713,6 +857,8 @@ void D1541::clkChanged(bool clkLow)
 {
     if (iecLinesPrimed && clkLow == clkLineLow) return;
 
+    syncIdle();
+
     clkLineLow = clkLow;
 
     auto& via1 = d1541mem.getVIA1();
@@ -725,6 +871,8 @@ void D1541::dataChanged(bool dataLow)
 {
     if (iecLinesPrimed && dataLow == dataLineLow) return;
 
+    syncIdle();
+
     dataLineLow = dataLow;
 
     auto& via1 = d1541mem.getVIA1();
@@ -985,8 +1133,11 @@ void D1541::onStepperPhaseChange(uint8_t oldPhase, uint8_t newPhase)
 
     saveCurrentRawTrackToCache();
 
-    halfTrackPos = std::clamp(halfTrackPos + step, 0, 34 * 2);  // 0..68 halftracks
-    currentTrack = uint8_t(halfTrackPos / 2);                   // 0..34 (=> track 1..35)
+    // 0..68 halftracks (track 1..35), raw images may carry or be written up to 84
+    const int lastHalfTrack = gcrImage ? int(G64::MAX_HALF_TRACKS) - 1 : 34 * 2;
+
+    halfTrackPos = std::clamp(halfTrackPos + step, 0, lastHalfTrack);
+    currentTrack = uint8_t(halfTrackPos / 2);
 
     uiTrack = currentTrack;
     uiSector = currentSector;
@@ -1004,6 +1155,14 @@ int D1541::cyclesPerByteFromDensity(uint8_t code) const
 
 void D1541::saveCurrentRawTrackToCache()
 {
+    // Written G64 tracks go straight back into the image
+    if (gcrImage)
+    {
+        if (trackModifiedByWrite && !gcrTrackStream.empty())
+            gcrImage->writeTrack(size_t(halfTrackPos), gcrTrackStream.data(), gcrTrackStream.size(), gcrTrackZone);
+        return;
+    }
+
     if (currentTrack >= rawGcrTrackCache.size())
         return;
 
@@ -1021,6 +1180,12 @@ void D1541::saveCurrentRawTrackToCache()
 
 void D1541::loadCurrentRawTrackFromCacheOrBuild()
 {
+    if (gcrImage)
+    {
+        rebuildGCRTrackStream();
+        return;
+    }
+
     if (currentTrack >= rawGcrTrackCache.size())
         return;
 
@@ -1071,6 +1236,7 @@ void D1541::invalidateRawGcrCache()
     gcrWrittenMask.clear();
 
     gcrPos = 0;
+    gcrPosLength = 0;
     gcrDirty = true;
 }
 
@@ -1494,6 +1660,7 @@ void D1541::resetForMediaChange()
 
     // --- Media/GCR reset ---
     gcrPos = 0;
+    gcrPosLength = 0;
     gcrBitCounter = 0;
     gcrDirty = true;
     lastHeaderTrack = 0;
@@ -1679,6 +1846,10 @@ void D1541::flushAllDirtyRawTracksToImage()
     // Save current live track before flushing.
     saveCurrentRawTrackToCache();
 
+    // G64 tracks are already in the image, nothing to decode
+    if (gcrImage)
+        return;
+
     const uint8_t oldTrack = currentTrack;
     const size_t oldPos = gcrPos;
 
@@ -1758,6 +1929,8 @@ Drive::IECSnapshot D1541::snapshotIEC() const
 
 void D1541::forceSyncIEC()
 {
+    syncIdle();
+
     if (bus)
     {
         atnLineLow  = !bus->getAtnLine();
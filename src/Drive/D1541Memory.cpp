@@ -12,8 +12,8 @@ D1541Memory::D1541Memory()
 {
     // Initialize Memory to all 0's
     D1541RAM.resize(RAM_SIZE,0);
-    D1541ROM1.resize(ROM_SIZE,0);
-    D1541ROM2.resize(ROM_SIZE,0);
+    D1541ROM1 = RomSpan(ROM_SIZE);
+    D1541ROM2 = RomSpan(ROM_SIZE);
 }
 
 D1541Memory::~D1541Memory() = default;
@@ -61,6 +61,11 @@ void D1541Memory::tick(uint32_t cycles)
     }
 }
 
+uint32_t D1541Memory::getQuietCycles() const
+{
+    return std::min(via1.getQuietCycles(), via2.getQuietCycles());
+}
+
 void D1541Memory::reset()
 {
     // Reset all RAM to 0's
@@ -79,10 +84,12 @@ uint8_t D1541Memory::read(uint16_t address)
     }
     else if (address >= VIA1_START && address <= (VIA1_START + 0x03FF))
     {
+        if (!via1.isQuietRead(address)) ++sideEffectCount;
         return via1.readRegister((address - VIA1_START) & 0x0F);
     }
     else if (address >= VIA2_START && address <= (VIA2_START + 0x03FF))
     {
+        if (!via2.isQuietRead(address)) ++sideEffectCount;
         return via2.readRegister((address - VIA2_START) & 0x0F);
     }
     else if (address >= ROM1_START && address <= ROM1_END)
@@ -104,14 +111,16 @@ void D1541Memory::write(uint16_t address, uint8_t value)
 {
     if (address >= D1541_RAM_START && address <= D1541_RAM_END)
     {
-        D1541RAM[address - D1541_RAM_START] = value;
+        storeRAM(D1541RAM[address - D1541_RAM_START], value);
     }
     else if (address >= VIA1_START && address <= (VIA1_START + 0x03FF))
     {
+        if (!via1.isQuietWrite(address, value)) ++sideEffectCount;
         via1.writeRegister((address - VIA1_START) & 0x0F, value);
     }
     else if (address >= VIA2_START && address <= (VIA2_START + 0x03FF))
     {
+        if (!via2.isQuietWrite(address, value)) ++sideEffectCount;
         via2.writeRegister((address - VIA2_START) & 0x0F, value);
     }
 }
@@ -121,9 +130,9 @@ bool D1541Memory::initialize(const std::string& D1541LoROM, const std::string& D
     // Initialize Drive RAM to 0's
     std::fill(D1541RAM.begin(), D1541RAM.end(), 0x00);
 
-    // Initialize both ROMS to 0's before loading
-    std::fill(D1541ROM1.begin(), D1541ROM1.end(), 0x00);
-    std::fill(D1541ROM2.begin(), D1541ROM2.end(), 0x00);
+    // Both ROMS read as 0's until loaded
+    D1541ROM1 = RomSpan(ROM_SIZE);
+    D1541ROM2 = RomSpan(ROM_SIZE);
 
     // Try to load in ROM files passed in via config
     if (!loadROM(D1541LoROM, D1541ROM1, ROM_SIZE, "1541 ROM Lo") || !loadROM(D1541HiROM, D1541ROM2, ROM_SIZE, "1541 ROM Hi"))
@@ -134,20 +143,12 @@ bool D1541Memory::initialize(const std::string& D1541LoROM, const std::string& D
     return true;
 }
 
-bool D1541Memory::loadROM(const std::string& filename, std::vector<uint8_t>& targetBuffer, size_t expectedSize, const std::string& romName)
+bool D1541Memory::loadROM(const std::string& filename, RomSpan& target, size_t expectedSize, const std::string& romName)
 {
-    std::ifstream file(filename, std::ios::binary | std::ios::ate);
-    if (!file.is_open())
-        return false;
-
-    std::streamsize fileSize = file.tellg();
-    if (static_cast<size_t>(fileSize) != expectedSize)
-        return false;
-
-    file.seekg(0, std::ios::beg);
-    if (!file.read(reinterpret_cast<char*>(targetBuffer.data()), expectedSize))
+    RomSpan rom = RomCache::instance().acquire(filename);
+    if (!rom.isLoaded() || rom.size() != expectedSize)
         return false;
 
-    file.close();
+    target = std::move(rom);
     return true;
 }
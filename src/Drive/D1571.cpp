@@ -41,6 +41,7 @@ D1571::D1571(int deviceNumber, const std::string& romName) :
 {
     setDeviceNumber(deviceNumber);
     d1571mem.attachPeripheralInstance(this);
+    attachIdleTracking(&driveCPU, &d1571mem);
     driveCPU.attachIRQLineInstance(&IRQ);
     driveCPU.attachMemoryInstance(&d1571mem);
 
@@ -140,6 +141,9 @@ bool D1571::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
     if (std::memcmp(chunk.tag, "D157", 4) != 0)
         return false;
 
+    idleTracker.reset();
+    pendingChipCycles = 0;
+
     rdr.enterChunkPayload(chunk);
 
     // Header / identity
@@ -286,13 +290,11 @@ void D1571::tick(uint32_t cycles)
 
         for (uint32_t i = 0; i < cpuTicks; ++i)
         {
-            driveCPU.tick();
-
-            // Your CPU::tick() advances exactly one CPU cycle per call.
-            // So tick the drive-local chips once per drive CPU PHI2 cycle.
-            d1571mem.tick(1);
+            if (skipIdleCycle())
+                continue;
 
-            updateIRQ();
+            runCPUCycle();
+            observeIdle();
         }
 
         // Physical/mechanical time is not doubled by 2 MHz mode.
@@ -319,6 +321,48 @@ void D1571::tick(uint32_t cycles)
     }
 }
 
+void D1571::runCPUCycle()
+{
+    driveCPU.tick();
+
+    // The drive CPU runs the legacy whole-instruction path, which does every
+    // bus access of an instruction in its first cycle. The VIAs, CIA and FDC
+    // can then catch up once per instruction instead of once per PHI2 cycle.
+    // The micro-op path spreads the accesses over the instruction, so there
+    // they are clocked every cycle.
+    ++pendingChipCycles;
+
+    if (driveCPU.isAtInstructionBoundary() || driveCPU.getUseMicroOps())
+        flushChipCycles();
+}
+
+void D1571::flushChipCycles()
+{
+    if (pendingChipCycles == 0)
+        return;
+
+    // Cleared first, a bus change made by the chips comes back through syncIdle()
+    const uint32_t cycles = pendingChipCycles;
+    pendingChipCycles = 0;
+
+    d1571mem.tick(cycles);
+    updateIRQ();
+}
+
+bool D1571::canSkipIdle() const
+{
+    // In GCR mode the disk passing under the head feeds VIA2 every byte
+    return !(isGCRMode() && motorOn && diskLoaded);
+}
+
+void D1571::runOwedIdleCycles(uint32_t cycles)
+{
+    while (cycles-- > 0)
+        runCPUCycle();
+
+    flushChipCycles();
+}
+
 bool D1571::gcrTick()
 {
     if (gcrDirty)
@@ -383,12 +427,18 @@ void D1571::gcrAdvance(uint32_t dc)
     while (gcrBitCounter >= cyclesPerByte)
     {
         gcrBitCounter -= cyclesPerByte;
+
+        // The byte lands in VIA2, which has to be current first
+        flushChipCycles();
         gcrTick();
     }
 }
 
 void D1571::reset()
 {
+    idleTracker.reset();
+    pendingChipCycles = 0;
+
     motorOn                     = false;
     diskWriteProtected          = false;
     lastError                   = DriveError::NONE;
@@ -459,6 +509,8 @@ void D1571::setSRQAsserted(bool state)
 
 void D1571::forceSyncIEC()
 {
+    syncIdle();
+
     if (bus)
     {
         atnLineLow  = !bus->readAtnLine();
@@ -882,6 +934,8 @@ void D1571::onStepperPhaseChange(uint8_t oldPhase, uint8_t newPhase)
 
 void D1571::loadDisk(const std::string& path)
 {
+    syncIdle();
+
     diskWriteProtected = false;
 
     auto img = DiskFactory::create(path);
@@ -954,6 +1008,7 @@ void D1571::loadDisk(const std::string& path)
 
 void D1571::unloadDisk()
 {
+    syncIdle();
     flushAndSaveDisk();
 
     // Drop the current image
@@ -1038,6 +1093,8 @@ void D1571::atnChanged(bool atnLow)
 {
     if (atnLow == atnLineLow) return; // ignore no change
 
+    syncIdle();
+
     bool prev = atnLineLow;
     atnLineLow = atnLow;
 
@@ -1065,6 +1122,8 @@ void D1571::clkChanged(bool clkLow)
 {
     if (clkLow == clkLineLow) return; // ignore no change
 
+    syncIdle();
+
     bool prevClkLow  = clkLineLow;
     clkLineLow       = clkLow;
 
@@ -1085,6 +1144,8 @@ void D1571::dataChanged(bool dataLow)
 {
     if (dataLow == dataLineLow) return;
 
+    syncIdle();
+
     dataLineLow = dataLow;
 
     auto& via1 = d1571mem.getVIA1();
@@ -10,10 +10,11 @@
 
 D1571Memory::D1571Memory() :
     parentPeripheral(nullptr),
-    lastBus(0xFF)
+    lastBus(0xFF),
+    D1571ROM(ROM_SIZE),
+    romBase(ROM_START)
 {
     D1571RAM.resize(RAM_SIZE,0);
-    D1571ROM.resize(ROM_SIZE,0);
 }
 
 D1571Memory::~D1571Memory() = default;
@@ -89,11 +90,17 @@ void D1571Memory::tick(uint32_t cycles)
     }
 }
 
+uint32_t D1571Memory::getQuietCycles() const
+{
+    return std::min({ via1.getQuietCycles(), via2.getQuietCycles(), cia.getQuietCycles(), fdc.getQuietCycles() });
+}
+
 bool D1571Memory::initialize(const std::string& fileName)
 {
-    // Clear RAM/ROM
+    // Clear RAM, ROM reads as 0's until loaded
     std::fill(D1571RAM.begin(), D1571RAM.end(), 0x00);
-    std::fill(D1571ROM.begin(), D1571ROM.end(), 0x00);
+    D1571ROM = RomSpan(ROM_SIZE);
+    romBase = ROM_START;
 
     // Attempt to load passed in ROM file
     if (!loadROM(fileName)) return false;
@@ -119,22 +126,26 @@ uint8_t D1571Memory::read(uint16_t address)
     }
     else if (address >= ROM_START && address <= ROM_END)
     {
-        value = D1571ROM[address - ROM_START];
+        value = (address >= romBase) ? D1571ROM[address - romBase] : 0xFF;
     }
     else if (address >= VIA1_START && address <= VIA1_END)
     {
+        if (!via1.isQuietRead(address)) ++sideEffectCount;
         value = via1.readRegister((address - VIA1_START) & 0x000F);
     }
     else if (address >= VIA2_START && address <= VIA2_END)
     {
+        if (!via2.isQuietRead(address)) ++sideEffectCount;
         value = via2.readRegister((address - VIA2_START) & 0x000F);
     }
     else if (address >= CIA_START && address <= CIA_END)
     {
+        if (!cia.isQuietRead(address)) ++sideEffectCount;
         value = cia.readRegister((address - CIA_START) & 0x000F);
     }
     else if (address >= FDC_START && address <= FDC_END)
     {
+        ++sideEffectCount;
         value = fdc.readRegister((address - FDC_START) & 0x0003);
     }
     else
@@ -152,55 +163,43 @@ void D1571Memory::write(uint16_t address, uint8_t value)
 
     if (address >= RAM_START && address <= RAM_END)
     {
-        D1571RAM[address - RAM_START] = value;
+        storeRAM(D1571RAM[address - RAM_START], value);
     }
     else if (address >= 0x0800 && address <= 0x0FFF)
     {
-        D1571RAM[address & 0x07FF] = value; // RAM mirror
+        storeRAM(D1571RAM[address & 0x07FF], value); // RAM mirror
     }
     else if (address >= VIA1_START && address <= VIA1_END)
     {
+        if (!via1.isQuietWrite(address, value)) ++sideEffectCount;
         via1.writeRegister((address - VIA1_START) & 0x000F, value);
     }
     else if (address >= VIA2_START && address <= VIA2_END)
     {
+        if (!via2.isQuietWrite(address, value)) ++sideEffectCount;
         via2.writeRegister((address - VIA2_START) & 0x000F, value);
     }
     else if (address >= CIA_START && address <= CIA_END)
     {
+        if (!cia.isQuietWrite(address, value)) ++sideEffectCount;
         cia.writeRegister((address - CIA_START) & 0x000F, value);
     }
     else if (address >= FDC_START && address <= FDC_END)
     {
+        ++sideEffectCount;
         fdc.writeRegister((address - FDC_START) & 0x0003, value);
     }
 }
 
 bool D1571Memory::loadROM(const std::string& filename)
 {
-    std::ifstream f(filename, std::ios::binary | std::ios::ate);
-    if (!f) return false;
-
-    const auto size = static_cast<size_t>(f.tellg());
-    f.seekg(0, std::ios::beg);
-
-    if (size != 0x4000 && size != 0x8000) return false; // accept only 16K or 32K
-
-    std::vector<uint8_t> buf(size);
-    if (!f.read(reinterpret_cast<char*>(buf.data()), buf.size())) return false;
+    RomSpan rom = RomCache::instance().acquire(filename);
+    if (!rom.isLoaded()) return false;
 
-    std::fill(D1571ROM.begin(), D1571ROM.end(), 0xFF);
+    if (rom.size() != 0x4000 && rom.size() != 0x8000) return false; // accept only 16K or 32K
 
-    if (size == 0x8000)
-    {
-        // 32K -> $8000-$FFFF
-        std::copy(buf.begin(), buf.end(), D1571ROM.begin());
-    }
-    else
-    {
-        // 16K -> map to $C000-$FFFF (upper half of ROM window)
-        const size_t off = 0x4000; // offset inside our 32K vector
-        std::copy(buf.begin(), buf.end(), D1571ROM.begin() + off);
-    }
+    // 32K -> $8000-$FFFF, 16K -> $C000-$FFFF (upper half of ROM window)
+    romBase = static_cast<uint16_t>(0x10000 - rom.size());
+    D1571ROM = std::move(rom);
     return true;
 }
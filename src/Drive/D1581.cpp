@@ -31,6 +31,7 @@ D1581::D1581(int deviceNumber, const std::string& romName) :
     setDeviceNumber(deviceNumber);
     d1581mem.attachPeripheralInstance(this);
     d1581mem.attachCPUInstance(&driveCPU);
+    attachIdleTracking(&driveCPU, &d1581mem);
     driveCPU.attachMemoryInstance(&d1581mem);
     driveCPU.attachIRQLineInstance(&irq);
 
@@ -98,6 +99,9 @@ bool D1581::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
     if (std::memcmp(chunk.tag, "D158", 4) != 0)
         return false;
 
+    idleTracker.reset();
+    pendingChipCycles = 0;
+
     rdr.enterChunkPayload(chunk);
 
     // Version
@@ -211,6 +215,9 @@ bool D1581::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
 
 void D1581::reset()
 {
+    idleTracker.reset();
+    pendingChipCycles = 0;
+
     motorOn = false;
 
     // Status
@@ -283,14 +290,11 @@ void D1581::tick(uint32_t cycles)
 {
     while (cycles-- > 0)
     {
-        // CPU::tick() is already one external CPU cycle.
-        driveCPU.tick();
-
-        // Match D1571 behavior: local chips advance one cycle,
-        // not getElapsedCycles() cycles.
-        d1581mem.tick(1);
-
-        updateIRQ();
+        if (!skipIdleCycle())
+        {
+            runCPUCycle();
+            observeIdle();
+        }
 
         Drive::tick(1);
 
@@ -306,6 +310,44 @@ void D1581::tick(uint32_t cycles)
     }
 }
 
+void D1581::runCPUCycle()
+{
+    // CPU::tick() is already one external CPU cycle.
+    driveCPU.tick();
+
+    // The drive CPU runs the legacy whole-instruction path, which does every
+    // bus access of an instruction in its first cycle. The CIA and FDC can
+    // then catch up once per instruction. The micro-op path spreads the
+    // accesses over the instruction, and a byte going out of the serial port
+    // drives the bus, so both are clocked cycle by cycle.
+    ++pendingChipCycles;
+
+    if (driveCPU.isAtInstructionBoundary() || driveCPU.getUseMicroOps() ||
+        d1581mem.getCIA().isSerialOutputActive())
+        flushChipCycles();
+}
+
+void D1581::flushChipCycles()
+{
+    if (pendingChipCycles == 0)
+        return;
+
+    // Cleared first, a bus change made by the chips comes back through syncIdle()
+    const uint32_t cycles = pendingChipCycles;
+    pendingChipCycles = 0;
+
+    d1581mem.tick(cycles);
+    updateIRQ();
+}
+
+void D1581::runOwedIdleCycles(uint32_t cycles)
+{
+    while (cycles-- > 0)
+        runCPUCycle();
+
+    flushChipCycles();
+}
+
 void D1581::syncTrackFromFDC()
 {
     auto* fdc = getFDC();
@@ -316,6 +358,7 @@ void D1581::syncTrackFromFDC()
 
 void D1581::unloadDisk()
 {
+    syncIdle();
     flushAndSaveDisk();
 
     diskImage.reset();
@@ -328,6 +371,8 @@ void D1581::unloadDisk()
 
 void D1581::forceSyncIEC()
 {
+    syncIdle();
+
     if (!bus) return;
 
     const bool newAtnLow  = !bus->readAtnLine();
@@ -345,18 +390,21 @@ void D1581::forceSyncIEC()
 void D1581::atnChanged(bool atnLow)
 {
     (void)atnLow;
+    syncIdle();
     syncLiveIECInputs();
 }
 
 void D1581::clkChanged(bool clkLow)
 {
     (void)clkLow;
+    syncIdle();
     syncLiveIECInputs();
 }
 
 void D1581::dataChanged(bool dataLow)
 {
     (void)dataLow;
+    syncIdle();
     syncLiveIECInputs();
 }
 
@@ -617,6 +665,7 @@ bool D1581::fdcWriteSector(uint8_t track, uint8_t sector, const uint8_t* buffer,
 
 void D1581::loadDisk(const std::string& path)
 {
+    syncIdle();
     flushAndSaveDisk();
 
     diskWriteProtected = false;
@@ -11,10 +11,11 @@
 D1581Memory::D1581Memory() :
     driveCPU(nullptr),
     parentPeripheral(nullptr),
-    lastBus(0xFF)
+    lastBus(0xFF),
+    D1581ROM(ROM_SIZE),
+    romBase(ROM_START)
 {
     D1581RAM.resize(RAM_SIZE);
-    D1581ROM.resize(ROM_SIZE);
 }
 
 D1581Memory::~D1581Memory() = default;
@@ -82,24 +83,28 @@ void D1581Memory::reset()
 
 void D1581Memory::tick(uint32_t cycles)
 {
-    while(cycles-- > 0)
-    {
-        cia.tick(1);
-        fdc.tick(1);
+    // The CIA and FDC do not see each other, each catches up on the whole run
+    cia.tick(cycles);
+    fdc.tick(cycles);
 
-        if (parentPeripheral)
-        {
-            auto* drive = static_cast<D1581*>(parentPeripheral);
-            drive->updateIRQ();
-        }
+    if (parentPeripheral)
+    {
+        auto* drive = static_cast<D1581*>(parentPeripheral);
+        drive->updateIRQ();
     }
 }
 
+uint32_t D1581Memory::getQuietCycles() const
+{
+    return std::min(cia.getQuietCycles(), fdc.getQuietCycles());
+}
+
 bool D1581Memory::initialize(const std::string& fileName)
 {
-    // Clear RAM/ROM
+    // Clear RAM, ROM reads as 0's until loaded
     std::fill(D1581RAM.begin(), D1581RAM.end(), 0x00);
-    std::fill(D1581ROM.begin(), D1581ROM.end(), 0x00);
+    D1581ROM = RomSpan(ROM_SIZE);
+    romBase = ROM_START;
 
     // Attempt to load passed in ROM file
     if (!loadROM(fileName)) return false;
@@ -130,6 +135,9 @@ uint8_t D1581Memory::read(uint16_t address)
     else if (address >= CIA_START && address <= CIA_END)
     {
         const uint16_t reg = (address - CIA_START) & 0x000F;
+
+        // Port B reads also land in the monitor's IEC history
+        if (reg == 1 || !cia.isQuietRead(reg)) ++sideEffectCount;
         value = cia.readRegister(reg);
 
         if (reg == 1)
@@ -157,11 +165,13 @@ uint8_t D1581Memory::read(uint16_t address)
     else if (address >= FDC_START && address <= FDC_END)
     {
         const uint16_t reg = (address - FDC_START) & 0x0003;
+
+        ++sideEffectCount;
         value = fdc.readRegister(reg);
     }
     else if (address >= ROM_START && address <= ROM_END)
     {
-        value = D1581ROM[address - ROM_START];
+        value = (address >= romBase) ? D1581ROM[address - romBase] : 0xFF;
     }
 
     lastBus = value;
@@ -174,12 +184,13 @@ void D1581Memory::write(uint16_t address, uint8_t value)
 
     if (address >= RAM_START && address <= RAM_END)
     {
-        D1581RAM[address - RAM_START] = value;
+        storeRAM(D1581RAM[address - RAM_START], value);
     }
     else if (address >= CIA_START && address <= CIA_END)
     {
         const uint16_t reg = (address - CIA_START) & 0x000F;
 
+        if (reg == 1 || !cia.isQuietWrite(reg, value)) ++sideEffectCount;
         cia.writeRegister(reg, value);
 
         if (reg == 1 || reg == 3 || reg == 0x0C || reg == 0x0D || reg == 0x0E)
@@ -219,35 +230,21 @@ void D1581Memory::write(uint16_t address, uint8_t value)
     else if (address >= FDC_START && address <= FDC_END)
     {
         const uint16_t reg = (address - FDC_START) & 0x0003;
+
+        ++sideEffectCount;
         fdc.writeRegister(reg, value);
     }
 }
 
 bool D1581Memory::loadROM(const std::string& filename)
 {
-    std::ifstream f(filename, std::ios::binary | std::ios::ate);
-    if (!f) return false;
-
-    const auto size = static_cast<size_t>(f.tellg());
-    f.seekg(0, std::ios::beg);
-
-    if (size != 0x4000 && size != 0x8000) return false; // accept only 16K or 32K
-
-    std::vector<uint8_t> buf(size);
-    if (!f.read(reinterpret_cast<char*>(buf.data()), buf.size())) return false;
+    RomSpan rom = RomCache::instance().acquire(filename);
+    if (!rom.isLoaded()) return false;
 
-    std::fill(D1581ROM.begin(), D1581ROM.end(), 0xFF);
+    if (rom.size() != 0x4000 && rom.size() != 0x8000) return false; // accept only 16K or 32K
 
-    if (size == 0x8000)
-    {
-        // 32K -> $8000-$FFFF
-        std::copy(buf.begin(), buf.end(), D1581ROM.begin());
-    }
-    else
-    {
-        // 16K -> map to $C000-$FFFF (upper half of ROM window)
-        const size_t off = 0x4000; // offset inside our 32K vector
-        std::copy(buf.begin(), buf.end(), D1581ROM.begin() + off);
-    }
+    // 32K -> $8000-$FFFF, 16K -> $C000-$FFFF (upper half of ROM window)
+    romBase = static_cast<uint16_t>(0x10000 - rom.size());
+    D1581ROM = std::move(rom);
     return true;
 }
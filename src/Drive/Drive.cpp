@@ -22,13 +22,40 @@ Drive::Drive() :
     ackHold(false),
     byteAckHold(false),
     ackDelay(0),
-    lastClkHigh(true)
+    lastClkHigh(true),
+    idleCPU(nullptr),
+    idleMemory(nullptr)
 {
 
 }
 
 Drive::~Drive() = default;
 
+void Drive::attachIdleTracking(CPU* cpu, DriveMemoryBase* memory)
+{
+    idleCPU = cpu;
+    idleMemory = memory;
+}
+
+void Drive::syncIdle()
+{
+    // Run the part of the current iteration that was only counted so far
+    runOwedIdleCycles(idleTracker.resume());
+}
+
+void Drive::skipIdleIteration()
+{
+    const uint32_t period = idleTracker.getPeriod();
+
+    idleTracker.skipIteration(*idleCPU);
+    idleMemory->tick(period);
+    updateIRQ();
+
+    // Execute the next iteration if a timer or the FDC fires inside it
+    if (idleMemory->getQuietCycles() < period)
+        idleTracker.resume();
+}
+
 void Drive::atnChanged(bool atnAsserted)
 {
     if (atnAsserted)
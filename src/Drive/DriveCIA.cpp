@@ -5,8 +5,10 @@
 // non-commercial use only. Redistribution, modification, or use
 // of this code in whole or in part for any other purpose is
 // strictly prohibited without the prior written consent of the author.
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include "Drive/DriveCIA.h"
 
 DriveCIA::DriveCIA() :
@@ -224,123 +226,165 @@ void DriveCIA::reset()
 
 void DriveCIA::tick(uint32_t cycles)
 {
-    while (cycles-- > 0)
+    while (cycles > 0)
     {
-        bool timerAUnderflowThisCycle = false;
-
-        // --- Timer A decrement decision ---
-        bool decA = false;
-        if (timerARunning)
+        // Without a CNT edge to count, PHI2 timers just count down until one of them underflows
+        if (cntLevel == lastCntLevel)
         {
-            const uint8_t cra = registers.controlRegisterA;
-            const bool countCNT = (cra & CRA_INMODE) != 0;
+            const bool phi2A = timerARunning && (registers.controlRegisterA & CRA_INMODE) == 0;
+            const bool phi2B = timerBRunning && (registers.controlRegisterB & CRB_INMODE_MASK) == CRB_INMODE_PHI2;
 
-            if (!countCNT)
-                decA = true;
-            else
-                decA = (cntLevel && !lastCntLevel); // Timer CNT mode counts rising edge.
-        }
+            uint32_t run = cycles;
 
-        // --- Timer A run ---
-        if (decA)
-        {
-            const bool underflow = (timerACounter == 0x0000);
+            if (phi2A)
+                run = std::min<uint32_t>(run, timerACounter);
 
-            timerACounter = static_cast<uint16_t>(timerACounter - 1);
+            if (phi2B)
+                run = std::min<uint32_t>(run, timerBCounter);
 
-            if (underflow)
+            if (run > 0)
             {
-                triggerInterrupt(INTERRUPT_TIMER_A);
-                timerAUnderflowThisCycle = true;
-
-                if (registers.controlRegisterA & CRA_RUNMODE)
+                if (phi2A)
                 {
-                    timerARunning = false;
-                    registers.controlRegisterA &= static_cast<uint8_t>(~CRA_START);
+                    timerACounter = static_cast<uint16_t>(timerACounter - run);
+                    registers.timerALowByte  = static_cast<uint8_t>(timerACounter & 0xFF);
+                    registers.timerAHighByte = static_cast<uint8_t>((timerACounter >> 8) & 0xFF);
                 }
-                else
+
+                if (phi2B)
                 {
-                    timerACounter = timerALatch;
+                    timerBCounter = static_cast<uint16_t>(timerBCounter - run);
+                    registers.timerBLowByte  = static_cast<uint8_t>(timerBCounter & 0xFF);
+                    registers.timerBHighByte = static_cast<uint8_t>((timerBCounter >> 8) & 0xFF);
                 }
-            }
 
-            registers.timerALowByte  = static_cast<uint8_t>(timerACounter & 0xFF);
-            registers.timerAHighByte = static_cast<uint8_t>((timerACounter >> 8) & 0xFF);
+                lastSpLevel = spLevel;
+                cycles -= run;
+                continue;
+            }
         }
 
-        // CIA serial output path.
-        //
-        // CRA bit 6 = 1 means serial output mode. In this mode Timer A
-        // underflows clock bits out through the serial port. This minimal
-        // emulation advances the shift count and raises the SDR interrupt
-        // after 8 bits.
-        const bool sdrOutputMode = (registers.controlRegisterA & CRA_SPMODE) != 0;
+        stepCycle();
+        --cycles;
+    }
+}
+
+void DriveCIA::stepCycle()
+{
+    bool timerAUnderflowThisCycle = false;
 
-        if (sdrOutputMode && serialOutputLoaded && timerAUnderflowThisCycle)
-        {
-            const bool outBit = (serialShiftRegister & 0x80) != 0;
+    // --- Timer A decrement decision ---
+    bool decA = false;
+    if (timerARunning)
+    {
+        const uint8_t cra = registers.controlRegisterA;
+        const bool countCNT = (cra & CRA_INMODE) != 0;
+
+        if (!countCNT)
+            decA = true;
+        else
+            decA = (cntLevel && !lastCntLevel); // Timer CNT mode counts rising edge.
+    }
 
-            serialOutputBit(outBit);
-            serialOutputClockPulse();
+    // --- Timer A run ---
+    if (decA)
+    {
+        const bool underflow = (timerACounter == 0x0000);
 
-            serialShiftRegister = static_cast<uint8_t>(serialShiftRegister << 1);
-            ++serialBitCount;
+        timerACounter = static_cast<uint16_t>(timerACounter - 1);
 
-            if (serialBitCount >= 8)
+        if (underflow)
+        {
+            triggerInterrupt(INTERRUPT_TIMER_A);
+            timerAUnderflowThisCycle = true;
+
+            if (registers.controlRegisterA & CRA_RUNMODE)
             {
-                serialOutputFinished();
-                triggerInterrupt(INTERRUPT_SERIAL_SHIFT_REGISTER);
-                serialBitCount = 0;
-                serialOutputLoaded = false;
+                timerARunning = false;
+                registers.controlRegisterA &= static_cast<uint8_t>(~CRA_START);
+            }
+            else
+            {
+                timerACounter = timerALatch;
             }
         }
 
-        // --- Timer B decrement decision ---
-        bool decB = false;
-        if (timerBRunning)
+        registers.timerALowByte  = static_cast<uint8_t>(timerACounter & 0xFF);
+        registers.timerAHighByte = static_cast<uint8_t>((timerACounter >> 8) & 0xFF);
+    }
+
+    // CIA serial output path.
+    //
+    // CRA bit 6 = 1 means serial output mode. In this mode Timer A
+    // underflows clock bits out through the serial port. This minimal
+    // emulation advances the shift count and raises the SDR interrupt
+    // after 8 bits.
+    const bool sdrOutputMode = (registers.controlRegisterA & CRA_SPMODE) != 0;
+
+    if (sdrOutputMode && serialOutputLoaded && timerAUnderflowThisCycle)
+    {
+        const bool outBit = (serialShiftRegister & 0x80) != 0;
+
+        serialOutputBit(outBit);
+        serialOutputClockPulse();
+
+        serialShiftRegister = static_cast<uint8_t>(serialShiftRegister << 1);
+        ++serialBitCount;
+
+        if (serialBitCount >= 8)
         {
-            const uint8_t crb = registers.controlRegisterB;
-            const uint8_t mode = crb & CRB_INMODE_MASK;
-
-            if (mode == CRB_INMODE_PHI2)
-                decB = true;
-            else if (mode == CRB_INMODE_CNT)
-                decB = (cntLevel && !lastCntLevel);
-            else if (mode == CRB_INMODE_TA)
-                decB = timerAUnderflowThisCycle;
-            else
-                decB = timerAUnderflowThisCycle && cntLevel;
+            serialOutputFinished();
+            triggerInterrupt(INTERRUPT_SERIAL_SHIFT_REGISTER);
+            serialBitCount = 0;
+            serialOutputLoaded = false;
         }
+    }
 
-        // --- Timer B run ---
-        if (decB)
-        {
-            const bool underflow = (timerBCounter == 0x0000);
+    // --- Timer B decrement decision ---
+    bool decB = false;
+    if (timerBRunning)
+    {
+        const uint8_t crb = registers.controlRegisterB;
+        const uint8_t mode = crb & CRB_INMODE_MASK;
+
+        if (mode == CRB_INMODE_PHI2)
+            decB = true;
+        else if (mode == CRB_INMODE_CNT)
+            decB = (cntLevel && !lastCntLevel);
+        else if (mode == CRB_INMODE_TA)
+            decB = timerAUnderflowThisCycle;
+        else
+            decB = timerAUnderflowThisCycle && cntLevel;
+    }
 
-            timerBCounter = static_cast<uint16_t>(timerBCounter - 1);
+    // --- Timer B run ---
+    if (decB)
+    {
+        const bool underflow = (timerBCounter == 0x0000);
 
-            if (underflow)
-            {
-                triggerInterrupt(INTERRUPT_TIMER_B);
+        timerBCounter = static_cast<uint16_t>(timerBCounter - 1);
 
-                if (registers.controlRegisterB & CRB_RUNMODE)
-                {
-                    timerBRunning = false;
-                    registers.controlRegisterB &= static_cast<uint8_t>(~CRB_START);
-                }
-                else
-                {
-                    timerBCounter = timerBLatch;
-                }
-            }
+        if (underflow)
+        {
+            triggerInterrupt(INTERRUPT_TIMER_B);
 
-            registers.timerBLowByte  = static_cast<uint8_t>(timerBCounter & 0xFF);
-            registers.timerBHighByte = static_cast<uint8_t>((timerBCounter >> 8) & 0xFF);
+            if (registers.controlRegisterB & CRB_RUNMODE)
+            {
+                timerBRunning = false;
+                registers.controlRegisterB &= static_cast<uint8_t>(~CRB_START);
+            }
+            else
+            {
+                timerBCounter = timerBLatch;
+            }
         }
 
-        lastCntLevel = cntLevel;
-        lastSpLevel = spLevel;
+        registers.timerBLowByte  = static_cast<uint8_t>(timerBCounter & 0xFF);
+        registers.timerBHighByte = static_cast<uint8_t>((timerBCounter >> 8) & 0xFF);
     }
+
+    lastCntLevel = cntLevel;
+    lastSpLevel = spLevel;
 }
 
 uint8_t DriveCIA::readRegister(uint16_t address)
@@ -530,6 +574,59 @@ void DriveCIA::writeRegister(uint16_t address, uint8_t value)
     }
 }
 
+bool DriveCIA::isQuietRead(uint16_t address) const
+{
+    switch (address & 0x0F)
+    {
+        case 0x04: // Timer counters
+        case 0x05:
+        case 0x06:
+        case 0x07:
+        case 0x0D: // ICR, the read acknowledges
+            return false;
+
+        default:
+            return true;
+    }
+}
+
+bool DriveCIA::isQuietWrite(uint16_t address, uint8_t value) const
+{
+    // Rewriting a port with its current value leaves the outputs alone
+    switch (address & 0x0F)
+    {
+        case 0x00: return value == registers.portA;
+        case 0x01: return value == registers.portB;
+        default:   return false;
+    }
+}
+
+uint32_t DriveCIA::getQuietCycles() const
+{
+    // A CNT edge is still waiting to be counted or shifted
+    if (cntLevel != lastCntLevel)
+        return 0;
+
+    uint32_t quiet = std::numeric_limits<uint32_t>::max();
+
+    const uint8_t armed = registers.interruptEnable & static_cast<uint8_t>(~interruptStatus) & 0x1F;
+
+    // Timer A counts PHI2 unless it waits for CNT edges, which can not come while idle
+    if (timerARunning && (registers.controlRegisterA & CRA_INMODE) == 0)
+    {
+        const bool sdrOutput = (registers.controlRegisterA & CRA_SPMODE) != 0 && serialOutputLoaded;
+        const bool chainsB = timerBRunning && (registers.controlRegisterB & CRB_INMODE_TA) != 0;
+
+        if ((armed & INTERRUPT_TIMER_A) || sdrOutput || chainsB)
+            quiet = std::min<uint32_t>(quiet, timerACounter);
+    }
+
+    if (timerBRunning && (registers.controlRegisterB & CRB_INMODE_MASK) == CRB_INMODE_PHI2 && (armed & INTERRUPT_TIMER_B))
+        quiet = std::min<uint32_t>(quiet, timerBCounter);
+
+    return quiet;
+}
+
 void DriveCIA::triggerInterrupt(InterruptBit bit)
 {
     const uint8_t mask = static_cast<uint8_t>(bit) & 0x1F;
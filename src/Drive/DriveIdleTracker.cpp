@@ -0,0 +1,95 @@
+﻿// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#include "CPU.h"
+#include "Drive/DriveIdleTracker.h"
+
+DriveIdleTracker::DriveIdleTracker() :
+    anchorValid(false),
+    anchorSignature(0),
+    anchorSideEffects(0),
+    anchorCycles(0),
+    anchorInstructions(0),
+    idle(false),
+    period(0),
+    instructions(0),
+    owed(0),
+    skippedCycles(0)
+{
+
+}
+
+DriveIdleTracker::~DriveIdleTracker() = default;
+
+void DriveIdleTracker::reset()
+{
+    anchorValid = false;
+    idle = false;
+    period = 0;
+    instructions = 0;
+    owed = 0;
+}
+
+bool DriveIdleTracker::observe(const CPU& cpu, uint32_t sideEffects)
+{
+    if (!cpu.isAtInstructionBoundary())
+        return false;
+
+    const uint64_t signature = cpu.getLoopSignature();
+
+    if (!anchorValid || sideEffects != anchorSideEffects)
+    {
+        setAnchor(signature, sideEffects, cpu);
+        return false;
+    }
+
+    const uint32_t elapsed = cpu.getTotalCycles() - anchorCycles;
+
+    if (signature == anchorSignature)
+    {
+        // Back where we started with nothing changed: a repeatable iteration
+        period = elapsed;
+        instructions = static_cast<uint32_t>(cpu.getInstructionCount() - anchorInstructions);
+        setAnchor(signature, sideEffects, cpu);
+        return period != 0;
+    }
+
+    // Not back yet, or the anchor was taken on the way into the loop
+    if (elapsed > MAX_PERIOD)
+        setAnchor(signature, sideEffects, cpu);
+
+    return false;
+}
+
+void DriveIdleTracker::skipIteration(CPU& cpu)
+{
+    cpu.skipIdleCycles(period, instructions);
+    skippedCycles += period;
+    owed = 0;
+}
+
+uint32_t DriveIdleTracker::resume()
+{
+    const uint32_t remaining = idle ? owed : 0;
+
+    idle = false;
+    owed = 0;
+
+    // The CPU state stopped at an iteration boundary, start looking again from there
+    anchorValid = false;
+
+    return remaining;
+}
+
+void DriveIdleTracker::setAnchor(uint64_t signature, uint32_t sideEffects, const CPU& cpu)
+{
+    anchorValid = true;
+    anchorSignature = signature;
+    anchorSideEffects = sideEffects;
+    anchorCycles = cpu.getTotalCycles();
+    anchorInstructions = cpu.getInstructionCount();
+}
@@ -0,0 +1,197 @@
+﻿// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#include "Drive/Drive.h"
+#include "Drive/DriveThread.h"
+
+thread_local DriveThread* DriveThread::currentThread = nullptr;
+
+DriveThread::DriveThread(Drive& drive, std::function<void()> clockCycle, uint64_t startCycle) :
+    drive(drive),
+    clockCycle(std::move(clockCycle)),
+    cycle(startCycle),
+    c64Low(0),
+    othersLow(0),
+    ownLow(0),
+    srqHigh(true),
+    queueHead(0),
+    queueTail(0),
+    target(startCycle),
+    done(startCycle),
+    stopping(false),
+    sleeping(false)
+{
+    worker = std::thread(&DriveThread::run, this);
+}
+
+DriveThread::~DriveThread()
+{
+    stopping.store(true);
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wake.notify_one();
+    }
+
+    if (worker.joinable())
+        worker.join();
+}
+
+void DriveThread::runTo(uint64_t cycle)
+{
+    // Only the emulator thread moves the target
+    if (target.load(std::memory_order_relaxed) == cycle)
+        return;
+
+    target.store(cycle);
+
+    if (sleeping.load())
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wake.notify_one();
+    }
+}
+
+void DriveThread::waitFor(uint64_t cycle)
+{
+    runTo(cycle);
+
+    for (int waits = 0; done.load(std::memory_order_acquire) < cycle; ++waits)
+    {
+        if (waits >= SPIN_WAITS)
+            std::this_thread::yield();
+    }
+}
+
+bool DriveThread::postC64Lines(uint64_t cycle, uint8_t lowMask)
+{
+    const uint32_t tail = queueTail.load(std::memory_order_relaxed);
+    if (tail - queueHead.load(std::memory_order_acquire) == QUEUE_SIZE)
+        return false;
+
+    queue[tail & (QUEUE_SIZE - 1)] = LineEvent{ cycle, lowMask };
+    queueTail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+void DriveThread::setView(uint8_t c64Low, uint8_t othersLow, uint8_t ownLow, bool srqHigh, bool notify)
+{
+    this->srqHigh = srqHigh;
+
+    if (!notify)
+    {
+        this->c64Low = c64Low;
+        this->othersLow = othersLow;
+        this->ownLow = ownLow;
+        return;
+    }
+
+    // The drive is stopped, act as its thread while it reacts
+    DriveThread* previous = currentThread;
+    currentThread = this;
+    applyView(c64Low, othersLow, ownLow);
+    currentThread = previous;
+}
+
+void DriveThread::driveLine(uint8_t line, bool low)
+{
+    const uint8_t newOwnLow = low ? (ownLow | line) : (ownLow & ~line);
+    if (newOwnLow == ownLow)
+        return;
+
+    outputs.push_back(OutputEvent{ cycle, line, low });
+    applyView(c64Low, othersLow, newOwnLow);
+}
+
+void DriveThread::driveSrq(bool asserted)
+{
+    outputs.push_back(OutputEvent{ cycle, LINE_SRQ, asserted });
+}
+
+void DriveThread::run()
+{
+    currentThread = this;
+
+    uint64_t goal = 0;
+    while (awaitTarget(cycle, goal))
+    {
+        while (cycle < goal)
+        {
+            applyQueuedLines(cycle);
+            clockCycle();
+            ++cycle;
+        }
+
+        // C64 changes made during the target cycle itself, before it sampled the bus
+        applyQueuedLines(cycle);
+        done.store(cycle, std::memory_order_release);
+    }
+}
+
+bool DriveThread::awaitTarget(uint64_t from, uint64_t& goal)
+{
+    for (int waits = 0; ; ++waits)
+    {
+        if (stopping.load(std::memory_order_acquire))
+            return false;
+
+        goal = target.load(std::memory_order_acquire);
+        if (goal != from)
+            return true;
+
+        if (waits < SPIN_WAITS)
+            continue;
+
+        if (waits < YIELD_WAITS)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Nothing to do for a while (paused, between frames), sleep until runTo()
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        sleeping.store(true);
+        wake.wait(lock, [this, from]() { return stopping.load() || target.load() != from; });
+        sleeping.store(false);
+    }
+}
+
+void DriveThread::applyQueuedLines(uint64_t upTo)
+{
+    uint32_t head = queueHead.load(std::memory_order_relaxed);
+
+    while (head != queueTail.load(std::memory_order_acquire))
+    {
+        const LineEvent event = queue[head & (QUEUE_SIZE - 1)];
+        if (event.cycle > upTo)
+            break;
+
+        queueHead.store(++head, std::memory_order_release);
+        applyView(event.lowMask, othersLow, ownLow);
+    }
+}
+
+void DriveThread::applyView(uint8_t newC64Low, uint8_t newOthersLow, uint8_t newOwnLow)
+{
+    const uint8_t before = c64Low | othersLow | ownLow;
+
+    c64Low = newC64Low;
+    othersLow = newOthersLow;
+    ownLow = newOwnLow;
+
+    // Same order as the bus notifies, a reaction of the drive may already have changed the next line
+    uint8_t changed = (c64Low | othersLow | ownLow) ^ before;
+    if (changed & LINE_ATN)
+        drive.atnChanged(isLineLow(LINE_ATN));
+
+    changed = (c64Low | othersLow | ownLow) ^ before;
+    if (changed & LINE_CLK)
+        drive.clkChanged(isLineLow(LINE_CLK));
+
+    changed = (c64Low | othersLow | ownLow) ^ before;
+    if (changed & LINE_DATA)
+        drive.dataChanged(isLineLow(LINE_DATA));
+}
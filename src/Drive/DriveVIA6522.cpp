@@ -5,6 +5,8 @@
 // non-commercial use only. Redistribution, modification, or use
 // of this code in whole or in part for any other purpose is
 // strictly prohibited without the prior written consent of the author.
+#include <algorithm>
+#include <limits>
 #include "Drive/DriveVIA6522.h"
 
 DriveVIA6522::DriveVIA6522() :
@@ -162,12 +164,9 @@ void DriveVIA6522::reset()
 
 void DriveVIA6522::tick(uint32_t cycles)
 {
-    while (cycles-- > 0)
-    {
-        timer1Tick();
-        timer2Tick();
-    }
-
+    // The timers never touch each other, so each one catches up on its own
+    advanceTimer1(cycles);
+    advanceTimer2(cycles);
 }
 
 DriveVIABase::VIATimerDebugView DriveVIA6522::getTimerDebugView() const
@@ -198,6 +197,71 @@ bool DriveVIA6522::checkIRQActive() const
     return active != 0;
 }
 
+bool DriveVIA6522::isQuietRead(uint16_t address) const
+{
+    switch (address & 0x0F)
+    {
+        case 0x00: // ORB/IRB, the read clears CB1/CB2
+            return (registers.interruptFlag & (IFR_CB1 | IFR_CB2)) == 0;
+
+        case 0x01: // ORA/IRA, the read clears CA1/CA2
+            return (registers.interruptFlag & (IFR_CA1 | IFR_CA2)) == 0;
+
+        case 0x02: // DDRB
+        case 0x03: // DDRA
+        case 0x06: // T1 latches
+        case 0x07:
+        case 0x0B: // ACR
+        case 0x0C: // PCR
+        case 0x0E: // IER
+        case 0x0F: // ORA/IRA no handshake
+            return true;
+
+        default:
+            // Timer counters, shift register and IFR move under the CPU
+            return false;
+    }
+}
+
+bool DriveVIA6522::isQuietWrite(uint16_t address, uint8_t value) const
+{
+    // Rewriting port B with its current value leaves the outputs alone
+    if ((address & 0x0F) == 0x00)
+        return value == registers.orbIRB && (registers.interruptFlag & (IFR_CB1 | IFR_CB2)) == 0;
+
+    return false;
+}
+
+uint32_t DriveVIA6522::getQuietCycles() const
+{
+    uint32_t quiet = std::numeric_limits<uint32_t>::max();
+
+    // A flag that is masked off or already set can not change the IRQ line
+    const uint8_t armed = registers.interruptEnable & static_cast<uint8_t>(~registers.interruptFlag);
+
+    if ((armed & IFR_TIMER1) && timer1Running && !timer1InhibitIRQ)
+    {
+        // The underflow tick is the first one that is not quiet, a reload or fresh load costs one extra tick
+        const uint16_t start = timer1ReloadPending ? timer1Latch : timer1Counter;
+        const uint32_t extra = (timer1ReloadPending || timer1JustLoaded) ? 1u : 0u;
+        const uint32_t ticks = (start == 0 ? 0x10000u : start) + extra;
+
+        quiet = std::min(quiet, ticks - 1);
+    }
+
+    const bool pulseCountMode = (registers.auxControlRegister & ACR_T2_PULSE_COUNT) != 0;
+
+    if ((armed & IFR_TIMER2) && timer2Running && !pulseCountMode && !timer2InhibitIRQ)
+    {
+        const uint32_t extra = timer2JustLoaded ? 1u : 0u;
+        const uint32_t ticks = (timer2Counter == 0 ? 0x10000u : timer2Counter) + extra;
+
+        quiet = std::min(quiet, ticks - 1);
+    }
+
+    return quiet;
+}
+
 void DriveVIA6522::triggerInterrupt(uint8_t sourceMask)
 {
     registers.interruptFlag |= sourceMask;
@@ -442,6 +506,63 @@ bool DriveVIA6522::writeControlRegister(uint16_t address, uint8_t value)
     }
 }
 
+void DriveVIA6522::advanceTimer1(uint32_t cycles)
+{
+    while (cycles > 0 && timer1Running)
+    {
+        // Reloads and the underflow tick are stepped, the plain count down in between is not
+        if (!timer1ReloadPending && !timer1JustLoaded)
+        {
+            const uint32_t toUnderflow = timer1Counter == 0 ? 0x10000u : timer1Counter;
+
+            if (timer1InhibitIRQ || cycles < toUnderflow)
+            {
+                timer1Counter = static_cast<uint16_t>(timer1Counter - cycles);
+                syncTimer1Registers();
+                return;
+            }
+
+            timer1Counter = static_cast<uint16_t>(timer1Counter - (toUnderflow - 1));
+            cycles -= toUnderflow - 1;
+        }
+
+        timer1Tick();
+        --cycles;
+    }
+}
+
+void DriveVIA6522::advanceTimer2(uint32_t cycles)
+{
+    // Pulse counting mode only moves on PB6 edges
+    if (!timer2Running || (registers.auxControlRegister & ACR_T2_PULSE_COUNT) != 0)
+        return;
+
+    if (timer2JustLoaded && cycles > 0)
+    {
+        timer2Tick();
+        --cycles;
+    }
+
+    if (cycles == 0)
+        return;
+
+    const uint32_t toUnderflow = timer2Counter == 0 ? 0x10000u : timer2Counter;
+
+    if (timer2InhibitIRQ || cycles < toUnderflow)
+    {
+        timer2Counter = static_cast<uint16_t>(timer2Counter - cycles);
+        syncTimer2Registers();
+        return;
+    }
+
+    // One-shot: after the underflow tick the interrupt stays inhibited
+    timer2Counter = static_cast<uint16_t>(timer2Counter - (toUnderflow - 1));
+    timer2Tick();
+
+    timer2Counter = static_cast<uint16_t>(timer2Counter - (cycles - toUnderflow));
+    syncTimer2Registers();
+}
+
 void DriveVIA6522::timer1Tick()
 {
     if (!timer1Running)
@@ -213,83 +213,90 @@ void FDC177x::reset()
 
 void FDC177x::tick(uint32_t cycles)
 {
-    while (cycles-- > 0)
+    // Count down to the next command step in one go, several steps may fall inside a long catch up
+    while (cycles > 0 && cyclesUntilEvent > 0)
     {
-        if (cyclesUntilEvent <= 0)
-            continue;
+        if (cycles < static_cast<uint32_t>(cyclesUntilEvent))
+        {
+            cyclesUntilEvent -= static_cast<int32_t>(cycles);
+            return;
+        }
 
-        --cyclesUntilEvent;
+        cycles -= static_cast<uint32_t>(cyclesUntilEvent);
+        cyclesUntilEvent = 0;
 
-        if (cyclesUntilEvent != 0)
-            continue;
+        handleEvent();
+    }
+}
 
-        switch (currentType)
+void FDC177x::handleEvent()
+{
+    switch (currentType)
+    {
+        case CommandType::TypeI:
         {
-            case CommandType::TypeI:
-            {
-                updateTypeIStatusBits();
-                finishCommand(true);
-                break;
-            }
+            updateTypeIStatusBits();
+            finishCommand(true);
+            break;
+        }
 
-            case CommandType::TypeII:
+        case CommandType::TypeII:
+        {
+            if (readSectorInProgress)
             {
-                if (readSectorInProgress)
+                if (transferPhase == TransferPhase::InitialDelay ||
+                    transferPhase == TransferPhase::ByteGap)
                 {
-                    if (transferPhase == TransferPhase::InitialDelay ||
-                        transferPhase == TransferPhase::ByteGap)
+                    if (dataIndex < currentSectorSize)
                     {
-                        if (dataIndex < currentSectorSize)
-                        {
-                            registers.data = sectorBuffer[dataIndex];
-                            setDRQ(true);
-                            transferPhase = TransferPhase::ByteReady;
-                        }
-                        else
-                        {
-                            transferPhase = TransferPhase::FinishDelay;
-                            cyclesUntilEvent = 16;
-                        }
+                        registers.data = sectorBuffer[dataIndex];
+                        setDRQ(true);
+                        transferPhase = TransferPhase::ByteReady;
                     }
-                    else if (transferPhase == TransferPhase::FinishDelay)
+                    else
                     {
-                        finishCommand(true);
-                        transferPhase = TransferPhase::Idle;
+                        transferPhase = TransferPhase::FinishDelay;
+                        cyclesUntilEvent = 16;
                     }
                 }
-
-                break;
+                else if (transferPhase == TransferPhase::FinishDelay)
+                {
+                    finishCommand(true);
+                    transferPhase = TransferPhase::Idle;
+                }
             }
 
-            case CommandType::TypeIII:
+            break;
+        }
+
+        case CommandType::TypeIII:
+        {
+            if (readAddressInProgress)
             {
-                if (readAddressInProgress)
-                {
-                    if (readAddressByteDelay)
-                        readAddressByteDelay = false;
+                if (readAddressByteDelay)
+                    readAddressByteDelay = false;
 
-                    if (addressIndex < sizeof(addressBuffer))
-                    {
-                        registers.data = addressBuffer[addressIndex];
-                        setBusy(true);
-                        setDRQ(true);
-                    }
-                    else
-                    {
-                        finishCommand(true);
-                    }
+                if (addressIndex < sizeof(addressBuffer))
+                {
+                    registers.data = addressBuffer[addressIndex];
+                    setBusy(true);
+                    setDRQ(true);
                 }
                 else
                 {
                     finishCommand(true);
                 }
-
-                break;
+            }
+            else
+            {
+                finishCommand(true);
             }
 
-            default:
-                break;
+            break;
         }
+
+        default:
+            break;
     }
 }
 
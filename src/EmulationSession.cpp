@@ -49,7 +49,8 @@ EmulationSession::EmulationSession(Computer& host, MachineComponents& components
       lastCpuCfg_(runtime.cpuCfg),
       audioPausedForMonitor_(false),
       audioStarted_(false),
-      audioCatchupMode_(true)
+      audioCatchupMode_(true),
+      tapeWarp_(false)
 {
 
 }
@@ -143,7 +144,8 @@ void EmulationSession::processEvents()
     }
     else if (!monitorOpen && audioPausedForMonitor_)
     {
-        audioOutput_.resumeAudio();
+        if (!tapeWarp_)
+            audioOutput_.resumeAudio();
         audioPausedForMonitor_ = false;
     }
 
@@ -187,6 +189,36 @@ bool EmulationSession::runFrame()
         runtime_.busPrimedAfterBoot = true;
     }
 
+    // Pick up anything the UI changed between frames (tape PLAY, user port devices)
+    host_.syncScheduledDevices();
+
+    updateTapeWarp();
+
+    // Tape warp runs whole frames back to back for one host frame and only shows the first
+    const auto warpBatchEnd = std::chrono::steady_clock::now() +
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(frameDuration_);
+    bool framePresented = false;
+
+    do
+    {
+        if (!runFrameCycles(framePresented))
+            return false;
+
+        if (runtime_.uiPaused.load())
+            break;
+
+        updateTapeWarp();
+    }
+    while (tapeWarp_ && std::chrono::steady_clock::now() < warpBatchEnd);
+
+    // Leave the chips current for the UI, monitor and save states
+    host_.syncScheduledDevices();
+
+    return true;
+}
+
+bool EmulationSession::runFrameCycles(bool& framePresented)
+{
     int frameCycles = 0;
     const int targetCycles = runtime_.cpuCfg->cyclesPerFrame();
 
@@ -223,7 +255,12 @@ bool EmulationSession::runFrame()
         if (vic_.isFrameDone())
         {
             vic_.clearFrameFlag();
-            videoOutput_.finishFrameAndSignal();
+
+            if (!tapeWarp_ || !framePresented)
+            {
+                videoOutput_.finishFrameAndSignal();
+                framePresented = true;
+            }
         }
 
         ++frameCycles;
@@ -260,6 +297,14 @@ bool EmulationSession::finalizeFrame()
     const auto frameStep =
         std::chrono::duration_cast<std::chrono::steady_clock::duration>(frameDuration_);
 
+    // No pacing or audio cushion while the tape warps
+    if (tapeWarp_)
+    {
+        nextFrameTime_ = now + frameStep;
+        videoOutput_.renderFrame(runtime_.running);
+        return true;
+    }
+
     const int blockSamples = std::max(1, audioOutput_.getBlockSamples());
 
     // Hysteresis thresholds.
@@ -330,6 +375,28 @@ void EmulationSession::shutdown()
     media_.flushAndSaveMedia();
 }
 
+void EmulationSession::updateTapeWarp()
+{
+    const bool warp = media_.isTapeWarpActive();
+    if (warp == tapeWarp_)
+        return;
+
+    tapeWarp_ = warp;
+
+    if (warp)
+    {
+        audioOutput_.pauseAudio();
+        sid_.setAudioMuted(true);
+        return;
+    }
+
+    // Motor stopped: back to real time, rebuild the audio cushion before resuming
+    sid_.setAudioMuted(false);
+    audioStarted_ = false;
+    audioCatchupMode_ = true;
+    nextFrameTime_ = std::chrono::steady_clock::now();
+}
+
 void EmulationSession::syncTimingFromRuntimeMode()
 {
     if (lastVideoMode_ == runtime_.videoMode &&
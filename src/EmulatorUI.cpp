@@ -188,11 +188,11 @@ void EmulatorUI::startDiskFileDialog(int deviceNum, UiCommand::DriveType driveTy
     switch (driveType)
     {
         case UiCommand::DriveType::D1541:
-            startFileDialog("Select D64 Image (1541)", { ".d64" }, UiCommand::Type::AttachDisk);
+            startFileDialog("Select D64/G64 Image (1541)", { ".d64", ".g64" }, UiCommand::Type::AttachDisk);
             break;
 
         case UiCommand::DriveType::D1571:
-            startFileDialog("Select D64/D71 Image (1571)", { ".d64", ".d71" }, UiCommand::Type::AttachDisk);
+            startFileDialog("Select D64/D71/G64 Image (1571)", { ".d64", ".d71", ".g64" }, UiCommand::Type::AttachDisk);
             break;
 
         case UiCommand::DriveType::D1581:
@@ -640,6 +640,9 @@ void EmulatorUI::installMenu(const MediaViewState& v)
                     ImGui::EndMenu();
                 }
 
+                if (ImGui::MenuItem("Warp while loading", nullptr, v.tapeWarp))
+                    push(UiCommand::Type::CassToggleWarp);
+
                 ImGui::EndMenu();
             }
 
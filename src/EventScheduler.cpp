@@ -0,0 +1,86 @@
+// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#include "EventScheduler.h"
+
+EventScheduler::EventScheduler() :
+    now_(0),
+    nextDue_(NEVER)
+{
+    due_.fill(NEVER);
+    clients_.fill(nullptr);
+}
+
+EventScheduler::~EventScheduler() = default;
+
+void EventScheduler::attach(Slot slot, IScheduledDevice* client)
+{
+    const size_t index = static_cast<size_t>(slot);
+
+    clients_[index] = client;
+    due_[index] = client ? now_ : NEVER;
+
+    recomputeNextDue();
+}
+
+void EventScheduler::detach(Slot slot)
+{
+    attach(slot, nullptr);
+}
+
+void EventScheduler::schedule(Slot slot, uint64_t cycle)
+{
+    const size_t index = static_cast<size_t>(slot);
+
+    if (!clients_[index])
+        return;
+
+    due_[index] = cycle;
+    recomputeNextDue();
+}
+
+void EventScheduler::syncAll()
+{
+    for (size_t i = 0; i < SLOT_COUNT; ++i)
+    {
+        if (!clients_[i])
+            continue;
+
+        // The client reschedules itself from catchUp()
+        due_[i] = NEVER;
+        clients_[i]->catchUp();
+    }
+
+    recomputeNextDue();
+}
+
+void EventScheduler::dispatch()
+{
+    for (size_t i = 0; i < SLOT_COUNT; ++i)
+    {
+        if (due_[i] > now_ || !clients_[i])
+            continue;
+
+        due_[i] = NEVER;
+        clients_[i]->catchUp();
+    }
+
+    recomputeNextDue();
+}
+
+void EventScheduler::recomputeNextDue()
+{
+    uint64_t next = NEVER;
+
+    for (uint64_t due : due_)
+    {
+        if (due < next)
+            next = due;
+    }
+
+    nextDue_ = next;
+}
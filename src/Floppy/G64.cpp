@@ -5,8 +5,482 @@
 // non-commercial use only. Redistribution, modification, or use
 // of this code in whole or in part for any other purpose is
 // strictly prohibited without the prior written consent of the author.
+#include <filesystem>
 #include "Floppy/G64.h"
 
-G64::G64() = default;
+namespace
+{
+    constexpr char G64_SIGNATURE[8] = { 'G', 'C', 'R', '-', '1', '5', '4', '1' };
+
+    constexpr size_t HEADER_GCR_SIZE = 10;  // 8 header bytes
+    constexpr size_t DATA_GCR_SIZE   = 325; // ID + 256 data + checksum + 2 off bytes
+
+    inline uint32_t readLE32(const uint8_t* p)
+    {
+        return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+    }
+
+    inline void writeLE32(uint8_t* p, uint32_t value)
+    {
+        p[0] = uint8_t(value);
+        p[1] = uint8_t(value >> 8);
+        p[2] = uint8_t(value >> 16);
+        p[3] = uint8_t(value >> 24);
+    }
+}
+
+G64::G64() :
+    maxTrackSize(0),
+    layoutChanged(false)
+{
+
+}
 
 G64::~G64() = default;
+
+bool G64::loadDisk(const std::string& filePath)
+{
+    halfTracks.clear();
+    layoutChanged = false;
+
+    if (!readFile(filePath))
+        return false;
+
+    if (!parseHeader())
+    {
+        std::cerr << "Failed to validate the disk image, not a valid G64 image! " << filePath << std::endl;
+        image.clear();
+        imagePath.clear();
+        return false;
+    }
+
+    buildSectorView();
+    dirty = false;
+
+    #ifdef Debug
+    std::cout << "Loaded G64: " << filePath << " (" << image.size() << " bytes, "
+              << halfTracks.size() << " half-tracks)" << std::endl;
+    #endif // Debug
+    return true;
+}
+
+bool G64::saveDisk(const std::string& filePath)
+{
+    if (image.empty())
+    {
+        std::cerr << "Error: No disk image loaded to save!" << std::endl;
+        return false;
+    }
+
+    // Same file, unchanged on disk and same track layout: only rewrite the tracks that changed
+    std::error_code ec;
+    if (filePath == imagePath && !layoutChanged && std::filesystem::file_size(filePath, ec) == image.size() && !ec)
+    {
+        bool anyDirty = false;
+        for (const HalfTrack& ht : halfTracks)
+            anyDirty |= ht.dirty;
+
+        if (!anyDirty)
+            return true;
+
+        std::fstream file(filePath, std::ios::binary | std::ios::in | std::ios::out);
+        if (!file.is_open())
+        {
+            std::cerr << "Failed to open file for writing: " << filePath << std::endl;
+            return false;
+        }
+
+        for (HalfTrack& ht : halfTracks)
+        {
+            if (!ht.dirty)
+                continue;
+
+            file.seekp(std::streamoff(ht.offset + 2));
+            file.write(reinterpret_cast<const char*>(ht.modified.data()), ht.modified.size());
+            if (!file.good())
+            {
+                std::cerr << "Error occurred while writing to file: " << filePath << std::endl;
+                return false;
+            }
+
+            ht.dirty = false;
+        }
+
+        return true;
+    }
+
+    // Different file, new layout, or the file was replaced: write the whole image with the changed tracks in it
+    std::vector<uint8_t> out = buildImage();
+
+    std::ofstream file(filePath, std::ios::binary);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open file for writing: " << filePath << std::endl;
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(out.data()), out.size());
+    if (!file.good())
+    {
+        std::cerr << "Error occurred while writing to file: " << filePath << std::endl;
+        return false;
+    }
+
+    // The file now matches the image in memory, continue from it
+    if (filePath == imagePath)
+    {
+        image = std::move(out);
+        layoutChanged = false;
+
+        if (!parseHeader())
+            std::cerr << "Error: Saved G64 image failed to parse: " << filePath << std::endl;
+    }
+
+    std::cout << "Disk saved successfully to: " << filePath << std::endl;
+    return true;
+}
+
+std::vector<uint8_t> G64::buildImage() const
+{
+    const size_t oldCount = image[9];
+    const size_t count    = halfTracks.size();
+    const size_t oldData  = HEADER_SIZE + oldCount * 8;
+    const size_t newData  = HEADER_SIZE + count * 8;
+    const size_t shift    = newData - oldData;
+
+    uint16_t trackSize = maxTrackSize;
+    for (const HalfTrack& ht : halfTracks)
+    {
+        if (ht.relocated)
+            trackSize = std::max(trackSize, ht.length);
+    }
+
+    // Header and the two grown tables, then the old track data moved up behind them
+    std::vector<uint8_t> out(newData, 0x00);
+    std::copy(image.begin(), image.begin() + HEADER_SIZE, out.begin());
+    out[9]  = uint8_t(count);
+    out[10] = uint8_t(trackSize);
+    out[11] = uint8_t(trackSize >> 8);
+    out.insert(out.end(), image.begin() + oldData, image.end());
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const HalfTrack& ht = halfTracks[i];
+        size_t offset = 0;
+
+        if (ht.relocated)
+        {
+            offset = out.size();
+            out.resize(offset + 2 + trackSize, 0x00);
+            out[offset]     = uint8_t(ht.length);
+            out[offset + 1] = uint8_t(ht.length >> 8);
+            std::copy(ht.modified.begin(), ht.modified.end(), out.begin() + offset + 2);
+        }
+        else if (ht.offset != 0)
+        {
+            offset = ht.offset + shift;
+            if (!ht.modified.empty())
+                std::copy(ht.modified.begin(), ht.modified.end(), out.begin() + offset + 2);
+        }
+
+        const uint32_t speed = ht.speedEntry > 3 ? uint32_t(ht.speedEntry + shift) : ht.speedEntry;
+
+        writeLE32(out.data() + HEADER_SIZE + i * 4, uint32_t(offset));
+        writeLE32(out.data() + HEADER_SIZE + (count + i) * 4, speed);
+    }
+
+    return out;
+}
+
+const uint8_t* G64::getTrackData(size_t halfTrack, size_t& length) const
+{
+    length = 0;
+
+    if (halfTrack >= halfTracks.size())
+        return nullptr;
+
+    const HalfTrack& ht = halfTracks[halfTrack];
+    if (ht.offset == 0 && ht.modified.empty())
+        return nullptr;
+
+    length = ht.length;
+    return ht.modified.empty() ? image.data() + ht.offset + 2 : ht.modified.data();
+}
+
+uint8_t G64::getSpeedZone(size_t halfTrack) const
+{
+    if (halfTrack >= halfTracks.size())
+        return 0;
+
+    return halfTracks[halfTrack].speedZone;
+}
+
+bool G64::writeTrack(size_t halfTrack, const uint8_t* data, size_t length, uint8_t speedZone)
+{
+    if (halfTrack >= MAX_HALF_TRACKS || length == 0 || length > 0xFFFF)
+    {
+        std::cerr << "Error: G64 can not store half-track " << halfTrack << " with "
+                  << length << " bytes, the write is lost" << std::endl;
+        return false;
+    }
+
+    speedZone &= 0x03;
+
+    // Half-tracks past the end of the table are added to it
+    if (halfTrack >= halfTracks.size())
+    {
+        halfTracks.resize(halfTrack + 1);
+        layoutChanged = true;
+    }
+
+    size_t currentLength = 0;
+    const uint8_t* current = getTrackData(halfTrack, currentLength);
+
+    HalfTrack& ht = halfTracks[halfTrack];
+
+    if (current && currentLength == length && ht.speedZone == speedZone && std::equal(data, data + length, current))
+        return true;
+
+    ht.modified.assign(data, data + length);
+    ht.dirty = true;
+    dirty = true;
+
+    // A new track, length or zone no longer fits the stored slot and tables
+    if (!current || currentLength != length || ht.speedZone != speedZone)
+    {
+        ht.length     = uint16_t(length);
+        ht.speedZone  = speedZone;
+        ht.speedEntry = speedZone;
+        ht.relocated  = true;
+        layoutChanged = true;
+    }
+
+    return true;
+}
+
+bool G64::writeSector(uint8_t track, uint16_t sector, const std::vector<uint8_t>& data)
+{
+    const size_t halfTrack = size_t(track - 1) * 2;
+
+    size_t length = 0;
+    const uint8_t* trackData = getTrackData(halfTrack, length);
+
+    // Find the data block first, a sector only in the decoded view would be lost on save
+    size_t dataPos = 0;
+    bool found = false;
+
+    if (trackData)
+    {
+        std::vector<SectorPos> sectors;
+        scanSectors(trackData, length, sectors);
+
+        std::vector<uint8_t> raw;
+        for (const SectorPos& sp : sectors)
+        {
+            if (sp.track != track || sp.sector != sector)
+                continue;
+
+            if (!decodeAt(trackData, length, sp.dataPos, DATA_GCR_SIZE, raw) || raw[0] != 0x07)
+                continue;
+
+            dataPos = sp.dataPos;
+            found = true;
+            break;
+        }
+    }
+
+    if (!found)
+    {
+        std::cerr << "Error: G64 has no GCR data block for track " << int(track) << " sector "
+                  << int(sector) << ", the write can not be stored" << std::endl;
+        return false;
+    }
+
+    if (!Disk::writeSector(track, sector, data))
+        return false;
+
+    std::vector<uint8_t> raw(260, 0x00);
+    raw[0] = 0x07;
+
+    const std::vector<uint8_t> sec = readSector(track, uint8_t(sector));
+    uint8_t csum = 0;
+    for (size_t i = 0; i < SECTOR_SIZE; ++i)
+    {
+        raw[1 + i] = sec[i];
+        csum ^= sec[i];
+    }
+    raw[257] = csum;
+
+    std::vector<uint8_t> gcr;
+    gcrCodec.encodeBytes(raw.data(), raw.size(), gcr);
+
+    std::vector<uint8_t> updated(trackData, trackData + length);
+    for (size_t i = 0; i < gcr.size(); ++i)
+        updated[(dataPos + i) % length] = gcr[i];
+
+    return writeTrack(halfTrack, updated.data(), updated.size(), getSpeedZone(halfTrack));
+}
+
+bool G64::readFile(const std::string& filePath)
+{
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open file: " << filePath << std::endl;
+        return false;
+    }
+
+    const std::streamsize size = file.tellg();
+    if (size < std::streamsize(HEADER_SIZE))
+    {
+        std::cerr << "Failed to read file: " << filePath << std::endl;
+        return false;
+    }
+
+    image.resize(size_t(size));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(image.data()), size))
+    {
+        image.clear();
+        std::cerr << "Failed to read file: " << filePath << std::endl;
+        return false;
+    }
+
+    imagePath = filePath;
+    return true;
+}
+
+bool G64::parseHeader()
+{
+    if (!std::equal(G64_SIGNATURE, G64_SIGNATURE + 8, reinterpret_cast<const char*>(image.data())))
+        return false;
+
+    if (image[8] != 0x00)
+        return false;
+
+    const size_t count = image[9];
+    if (count == 0 || count > MAX_HALF_TRACKS)
+        return false;
+
+    maxTrackSize = uint16_t(image[10] | (image[11] << 8));
+
+    const size_t offsetTable = HEADER_SIZE;
+    const size_t speedTable  = offsetTable + count * 4;
+    if (speedTable + count * 4 > image.size())
+        return false;
+
+    halfTracks.assign(count, HalfTrack{});
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        HalfTrack& ht = halfTracks[i];
+
+        const uint32_t offset = readLE32(image.data() + offsetTable + i * 4);
+        const uint32_t speed  = readLE32(image.data() + speedTable + i * 4);
+
+        if (offset == 0)
+            continue;
+
+        if (size_t(offset) + 2 > image.size())
+            return false;
+
+        const uint16_t length = uint16_t(image[offset] | (image[offset + 1] << 8));
+        if (length == 0 || length > maxTrackSize || size_t(offset) + 2 + length > image.size())
+            return false;
+
+        // Values above 3 point at a per-byte zone map, use the zone of the first byte
+        uint8_t zone = uint8_t(speed & 0x03);
+        if (speed > 3)
+        {
+            if (speed >= image.size())
+                return false;
+
+            zone = uint8_t((image[speed] >> 6) & 0x03);
+        }
+
+        ht.offset     = offset;
+        ht.length     = length;
+        ht.speedZone  = zone;
+        ht.speedEntry = speed;
+    }
+
+    return true;
+}
+
+void G64::buildSectorView()
+{
+    initializeGeometryForBlankImage();
+    initializeBlankImageBuffer();
+
+    std::vector<SectorPos> sectors;
+    std::vector<uint8_t> raw;
+
+    for (size_t t = 1; t <= geom.sectorsPerTrack.size(); ++t)
+    {
+        size_t length = 0;
+        const uint8_t* data = getTrackData((t - 1) * 2, length);
+        if (!data)
+            continue;
+
+        scanSectors(data, length, sectors);
+
+        for (const SectorPos& sp : sectors)
+        {
+            if (sp.track != t || sp.sector >= geom.sectorsPerTrack[t - 1])
+                continue;
+
+            if (!decodeAt(data, length, sp.dataPos, DATA_GCR_SIZE, raw) || raw[0] != 0x07)
+                continue;
+
+            const size_t offset = computeOffset(uint8_t(t), sp.sector);
+            std::copy(raw.begin() + 1, raw.begin() + 1 + SECTOR_SIZE, fileImageBuffer.begin() + offset);
+        }
+    }
+}
+
+void G64::scanSectors(const uint8_t* data, size_t length, std::vector<SectorPos>& out) const
+{
+    out.clear();
+
+    if (length < HEADER_GCR_SIZE + DATA_GCR_SIZE)
+        return;
+
+    std::vector<uint8_t> header;
+    bool wantData = false;
+    SectorPos pending{};
+
+    for (size_t pos = 0; pos < length; ++pos)
+    {
+        // A byte aligned sync ends where a run of at least two $FF bytes stops
+        const uint8_t prev1 = data[(pos + length - 1) % length];
+        const uint8_t prev2 = data[(pos + length - 2) % length];
+        if (data[pos] == 0xFF || prev1 != 0xFF || prev2 != 0xFF)
+            continue;
+
+        if (wantData)
+        {
+            pending.dataPos = pos;
+            out.push_back(pending);
+            wantData = false;
+            continue;
+        }
+
+        if (!decodeAt(data, length, pos, HEADER_GCR_SIZE, header) || header[0] != 0x08)
+            continue;
+
+        pending.sector = header[2];
+        pending.track  = header[3];
+        wantData = true;
+    }
+}
+
+bool G64::decodeAt(const uint8_t* data, size_t length, size_t pos, size_t gcrSize, std::vector<uint8_t>& out) const
+{
+    out.clear();
+
+    uint8_t block[DATA_GCR_SIZE];
+    for (size_t i = 0; i < gcrSize; ++i)
+        block[i] = data[(pos + i) % length];
+
+    return gcrCodec.decodeBytes(block, gcrSize, out);
+}
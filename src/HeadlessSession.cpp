@@ -0,0 +1,381 @@
+// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include "Computer.h"
+#include "Common/Petscii.h"
+#include "ComponentProfiler.h"
+#include "CPUTiming.h"
+#include "HeadlessSession.h"
+#include "MachineComponents.h"
+#include "MachineRomConfig.h"
+#include "MachineRuntimeState.h"
+
+HeadlessSession::HeadlessSession(Computer& host, MachineComponents& components,
+                                 MachineRuntimeState& runtime,
+                                 MachineRomConfig& roms,
+                                 const HeadlessConfig& config)
+    : host_(host),
+      components_(components),
+      runtime_(runtime),
+      roms_(roms),
+      config_(config),
+      audioOutput_(*components.audioOutput),
+      cia1_(*components.cia1),
+      cia2_(*components.cia2),
+      cpu_(*components.cpu),
+      dataBus_(*components.dataBus),
+      bus_(*components.bus),
+      media_(*components.media),
+      mem_(*components.mem),
+      pla_(*components.pla),
+      sid_(*components.sid),
+      vic_(*components.vic),
+      result_(),
+      measuring_(false),
+      pendingJump_(false),
+      instructionStart_(0),
+      audioDataBytes_(0)
+{
+
+}
+
+HeadlessSession::~HeadlessSession()
+{
+    closeAudioCapture();
+}
+
+bool HeadlessSession::run()
+{
+    if (!initializeMachine())
+        return false;
+
+    uint64_t warmupFrames = 0;
+    if (config_.warmupFrames == 0)
+        startMeasurement();
+
+    while (result_.reason == HeadlessStopReason::None)
+    {
+        if (!runFrame())
+        {
+            result_.reason = HeadlessStopReason::Error;
+            break;
+        }
+
+        host_.syncScheduledDevices();
+        media_.tick();
+        drainAudio();
+
+        if (!measuring_)
+        {
+            if (++warmupFrames >= config_.warmupFrames)
+                startMeasurement();
+        }
+        else
+        {
+            ++result_.frames;
+
+            if (config_.maxFrames && result_.frames >= config_.maxFrames)
+                result_.reason = HeadlessStopReason::FrameLimit;
+        }
+
+        if (!runtime_.running)
+            break;
+    }
+
+    const auto hostEnd = std::chrono::steady_clock::now();
+
+    result_.hostSeconds = measuring_ ? std::chrono::duration<double>(hostEnd - hostStart_).count() : 0.0;
+    result_.instructions = measuring_ ? cpu_.getInstructionCount() - instructionStart_ : 0;
+    result_.emulatedSeconds = static_cast<double>(result_.cycles) / runtime_.cpuCfg->clockSpeedHz;
+
+    shutdown();
+    return result_.reason != HeadlessStopReason::Error;
+}
+
+void HeadlessSession::startMeasurement()
+{
+    measuring_ = true;
+
+    result_.frames = 0;
+    result_.cycles = 0;
+    result_.audioSamples = 0;
+
+    if (!config_.program.empty())
+    {
+        uint16_t address = config_.programAddress;
+        for (uint8_t byte : config_.program)
+            mem_.writeDirect(address++, byte);
+
+        pendingJump_ = true;
+    }
+
+    if (!config_.typedText.empty())
+    {
+        // KERNAL keyboard buffer at $0277, pending count at $C6
+        const size_t count = std::min<size_t>(config_.typedText.size(), 10);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const char c = config_.typedText[i];
+            mem_.writeDirect(static_cast<uint16_t>(0x0277 + i), c == '\n' ? 0x0D : asciiToPetscii(c));
+        }
+
+        mem_.writeDirect(0xC6, static_cast<uint8_t>(count));
+    }
+
+    if (config_.profiler)
+        config_.profiler->reset();
+
+    instructionStart_ = cpu_.getInstructionCount();
+    hostStart_ = std::chrono::steady_clock::now();
+}
+
+bool HeadlessSession::initializeMachine()
+{
+    if (!mem_.Initialize(roms_.basicRom, roms_.kernalRom, roms_.charRom))
+    {
+        throw std::runtime_error("Error: Problem encountered initializing memory!");
+    }
+
+    bus_.reset();
+    pla_.reset();
+    cpu_.reset();
+    dataBus_.reset();
+    vic_.reset();
+    cia1_.reset();
+    cia2_.reset();
+    sid_.reset();
+
+
+    cpu_.setMode(runtime_.videoMode);
+    vic_.setMode(runtime_.videoMode);
+    sid_.setMode(runtime_.videoMode);
+    cia1_.setMode(runtime_.videoMode);
+    cia2_.setMode(runtime_.videoMode);
+    media_.setVideoMode(runtime_.videoMode);
+
+    bus_.setHostCpuHz(runtime_.cpuCfg->clockSpeedHz);
+
+    // No SDL device is opened, the SID buffer is drained once per frame instead
+    sid_.setSampleRate(audioOutput_.getSampleRate());
+
+    if (config_.reuModel != REUModel::None)
+        media_.attachREU(config_.reuModel);
+
+    if (!config_.diskPath.empty())
+    {
+        const std::string ext = media_.lowerExt(config_.diskPath);
+
+        DriveModel model = DriveModel::D1541;
+        if (ext == ".d71")
+            model = DriveModel::D1571;
+        else if (ext == ".d81")
+            model = DriveModel::D1581;
+
+        if (config_.createBlankDisk)
+            media_.createBlankDisk(8, model, config_.diskPath);
+        else
+            media_.attachDiskImage(8, model, config_.diskPath);
+    }
+
+    // Process boot attachments
+    media_.applyBootAttachments();
+
+    if (!config_.audioCapturePath.empty() && !openAudioCapture())
+    {
+        std::cerr << "Unable to open audio capture file " << config_.audioCapturePath << "\n";
+        return false;
+    }
+
+    return true;
+}
+
+bool HeadlessSession::runFrame()
+{
+    if (runtime_.pendingBusPrime)
+    {
+        bus_.reset();
+
+        runtime_.pendingBusPrime = false;
+        runtime_.busPrimedAfterBoot = true;
+    }
+
+    host_.syncScheduledDevices();
+
+    const bool checkInstructions = measuring_ && (config_.hasMatchCondition() || pendingJump_);
+
+    while (true)
+    {
+        try
+        {
+            if (checkInstructions && cpu_.isAtInstructionBoundary())
+            {
+                if (pendingJump_)
+                {
+                    cpu_.setPC(config_.programAddress);
+                    pendingJump_ = false;
+                }
+
+                if (checkInstructionConditions())
+                    return true;
+            }
+
+            host_.tickCycle();
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr
+                << "Exception caught: "
+                << e.what()
+                << "\n";
+
+            return false;
+        }
+
+        if (!measuring_)
+        {
+            if (vic_.isFrameDone())
+            {
+                vic_.clearFrameFlag();
+                return true;
+            }
+
+            continue;
+        }
+
+        ++result_.cycles;
+
+        if (config_.maxCycles && result_.cycles >= config_.maxCycles)
+        {
+            result_.reason = HeadlessStopReason::CycleLimit;
+            return true;
+        }
+
+        if (vic_.isFrameDone())
+        {
+            vic_.clearFrameFlag();
+            return true;
+        }
+    }
+}
+
+bool HeadlessSession::checkInstructionConditions()
+{
+    if (config_.stopOnPC && cpu_.getPC() == config_.stopPC)
+    {
+        result_.reason = HeadlessStopReason::PCMatch;
+        return true;
+    }
+
+    if (config_.stopOnMemory && mem_.peek(config_.stopMemoryAddress) == config_.stopMemoryValue)
+    {
+        result_.reason = HeadlessStopReason::MemoryMatch;
+        return true;
+    }
+
+    return false;
+}
+
+void HeadlessSession::drainAudio()
+{
+    int buffered = sid_.getAudioBufferedSamples();
+
+    while (buffered-- > 0)
+    {
+        // One stereo frame, both channels are the same unless extra SIDs are panned
+        double s[2] = { 0.0, 0.0 };
+        sid_.popFrame(s[0], s[1]);
+        ++result_.audioSamples;
+
+        if (!audioFile_.is_open())
+            continue;
+
+        char bytes[4];
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            const int16_t sample16 = static_cast<int16_t>(std::clamp(s[ch], -1.0, 1.0) * 32767.0);
+            bytes[ch * 2 + 0] = static_cast<char>(sample16 & 0xFF);
+            bytes[ch * 2 + 1] = static_cast<char>((sample16 >> 8) & 0xFF);
+        }
+
+        audioFile_.write(bytes, 4);
+        audioDataBytes_ += 4;
+    }
+}
+
+void HeadlessSession::shutdown()
+{
+    runtime_.running = false;
+
+    closeAudioCapture();
+
+    media_.flushAndSaveMedia();
+}
+
+bool HeadlessSession::openAudioCapture()
+{
+    audioFile_.open(config_.audioCapturePath, std::ios::binary | std::ios::trunc);
+    if (!audioFile_)
+        return false;
+
+    // Placeholder sizes, patched once the capture is closed
+    audioDataBytes_ = 0;
+    writeWavHeader(0);
+
+    return static_cast<bool>(audioFile_);
+}
+
+void HeadlessSession::closeAudioCapture()
+{
+    if (!audioFile_.is_open())
+        return;
+
+    audioFile_.seekp(0, std::ios::beg);
+    writeWavHeader(audioDataBytes_);
+    audioFile_.close();
+}
+
+void HeadlessSession::writeWavHeader(uint32_t dataBytes)
+{
+    const uint32_t sampleRate = static_cast<uint32_t>(audioOutput_.getSampleRate());
+    const uint16_t channels = 2;
+    const uint16_t bitsPerSample = 16;
+    const uint16_t blockAlign = channels * (bitsPerSample / 8);
+    const uint32_t byteRate = sampleRate * blockAlign;
+
+    auto writeU16 = [this](uint16_t v)
+    {
+        const char b[2] = { static_cast<char>(v & 0xFF), static_cast<char>((v >> 8) & 0xFF) };
+        audioFile_.write(b, 2);
+    };
+
+    auto writeU32 = [this](uint32_t v)
+    {
+        const char b[4] = { static_cast<char>(v & 0xFF), static_cast<char>((v >> 8) & 0xFF),
+                            static_cast<char>((v >> 16) & 0xFF), static_cast<char>((v >> 24) & 0xFF) };
+        audioFile_.write(b, 4);
+    };
+
+    audioFile_.write("RIFF", 4);
+    writeU32(36 + dataBytes);
+    audioFile_.write("WAVE", 4);
+
+    audioFile_.write("fmt ", 4);
+    writeU32(16);
+    writeU16(1); // PCM
+    writeU16(channels);
+    writeU32(sampleRate);
+    writeU32(byteRate);
+    writeU16(blockAlign);
+    writeU16(bitsPerSample);
+
+    audioFile_.write("data", 4);
+    writeU32(dataBytes);
+}
@@ -5,7 +5,10 @@
 // non-commercial use only. Redistribution, modification, or use
 // of this code in whole or in part for any other purpose is
 // strictly prohibited without the prior written consent of the author.
+#include <algorithm>
+#include <cmath>
 #include "CIA2.h"
+#include "ComponentProfiler.h"
 #include "Drive/Drive.h"
 #include "IECBUS.h"
 
@@ -13,8 +16,13 @@ IECBUS::IECBUS() :
     //Initialize to defaults
     currentState(State::IDLE),
     cia2(nullptr),
+    profiler(nullptr),
     currentTalker(nullptr),
     hostCpuHz(1022727.0),
+    threadedDrives(false),
+    hostCycle(0),
+    publishedCycle(0),
+    pausedDepth(0),
     line_srqin(true),
     c64DrivesAtnLow(false),
     c64DrivesClkLow(false),
@@ -31,6 +39,29 @@ IECBUS::IECBUS() :
 
 IECBUS::~IECBUS() = default;
 
+IECBUS::DrivePause::DrivePause(IECBUS& bus) :
+    bus(bus),
+    active(!bus.driveThreads.empty() && DriveThread::current() == nullptr)
+{
+    if (!active)
+        return;
+
+    if (bus.pausedDepth == 0)
+        bus.syncDriveThreads();
+
+    ++bus.pausedDepth;
+}
+
+IECBUS::DrivePause::~DrivePause()
+{
+    if (!active)
+        return;
+
+    // Whatever was changed here has already been told to the drives directly
+    if (--bus.pausedDepth == 0)
+        bus.refreshDriveViews(false);
+}
+
 static int deviceNumberOf(const Peripheral* p, const std::map<int, Peripheral*>& devices)
 {
     for (const auto& [num, dev] : devices)
@@ -91,6 +122,8 @@ bool IECBUS::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
     if (std::memcmp(chunk.tag, "IEC0", 4) != 0)
         return false;
 
+    DrivePause pause(*this);
+
     rdr.enterChunkPayload(chunk);
 
     uint32_t ver = 0;
@@ -182,6 +215,8 @@ bool IECBUS::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
 
 void IECBUS::reset()
 {
+    DrivePause pause(*this);
+
     // Reset bus-level state machine
     currentState   = State::IDLE;
     currentTalker  = nullptr;
@@ -229,8 +264,8 @@ void IECBUS::reset()
         dev->dataChanged(dataLow);
     }
 
-    for (auto& [dev, acc] : driveCycleAccumulators)
-        acc = 0.0;
+    for (DriveSlot& slot : driveSlots)
+        slot.acc = 0;
 
     lastClk = busLines.clk;
 }
@@ -241,18 +276,21 @@ void IECBUS::setAtnLine(bool state)
     currentState = c64DrivesAtnLow ? State::ATTENTION : State::IDLE;
 
     recalcAndNotify();
+    postC64Lines();
 }
 
 void IECBUS::setClkLine(bool state)
 {
     c64DrivesClkLow = !state;
     recalcAndNotify();
+    postC64Lines();
 }
 
 void IECBUS::setDataLine(bool state)
 {
     c64DrivesDataLow = !state;
     recalcAndNotify();
+    postC64Lines();
 }
 
 void IECBUS::setSrqLine(bool state)
@@ -273,17 +311,24 @@ void IECBUS::setC64IECOutputs(bool atnReleased, bool clkReleased, bool dataRelea
     currentState = c64DrivesAtnLow ? State::ATTENTION : State::IDLE;
 
     recalcAndNotify();
+    postC64Lines();
 }
 
 void IECBUS::peripheralControlClk(Peripheral* device, bool clkLow)
 {
-    if (!device) return;
-    bool registered = false;
-    for (auto const& [num, dev] : devices)
+    if (DriveThread* thread = workerThread())
     {
-        if (dev == device) { registered = true; break; }
+        thread->driveLine(DriveThread::LINE_CLK, clkLow);
+        return;
     }
-    if (!registered) return;
+
+    if (!device || !isRegistered(device)) return;
+
+    DrivePause pause(*this);
+
+    // Lines only need resolving when this device's output actually changes
+    auto it = devDrivesClkLow.find(device);
+    if (it != devDrivesClkLow.end() && it->second == clkLow) return;
 
     devDrivesClkLow[device] = clkLow;
     recalcAndNotify();
@@ -291,13 +336,19 @@ void IECBUS::peripheralControlClk(Peripheral* device, bool clkLow)
 
 void IECBUS::peripheralControlData(Peripheral* device, bool dataLow)
 {
-    if (!device) return;
-    bool registered = false;
-    for (auto const& [num, dev] : devices)
+    if (DriveThread* thread = workerThread())
     {
-        if (dev == device) { registered = true; break; }
+        thread->driveLine(DriveThread::LINE_DATA, dataLow);
+        return;
     }
-    if (!registered) return;
+
+    if (!device || !isRegistered(device)) return;
+
+    DrivePause pause(*this);
+
+    // Lines only need resolving when this device's output actually changes
+    auto it = devDrivesDataLow.find(device);
+    if (it != devDrivesDataLow.end() && it->second == dataLow) return;
 
     devDrivesDataLow[device] = dataLow;
     recalcAndNotify();
@@ -305,13 +356,19 @@ void IECBUS::peripheralControlData(Peripheral* device, bool dataLow)
 
 void IECBUS::peripheralControlAtn(Peripheral* device, bool atnLow)
 {
-    if (!device) return;
-    bool registered = false;
-    for (auto const& [num, dev] : devices)
+    if (DriveThread* thread = workerThread())
     {
-        if (dev == device) { registered = true; break; }
+        thread->driveLine(DriveThread::LINE_ATN, atnLow);
+        return;
     }
-    if (!registered) return;
+
+    if (!device || !isRegistered(device)) return;
+
+    DrivePause pause(*this);
+
+    // Lines only need resolving when this device's output actually changes
+    auto it = devDrivesAtnLow.find(device);
+    if (it != devDrivesAtnLow.end() && it->second == atnLow) return;
 
     devDrivesAtnLow[device] = atnLow;
     recalcAndNotify();
@@ -319,16 +376,23 @@ void IECBUS::peripheralControlAtn(Peripheral* device, bool atnLow)
 
 void IECBUS::peripheralControlSrq(Peripheral* device, bool state)
 {
+    if (DriveThread* thread = workerThread())
+    {
+        thread->driveSrq(state);
+        return;
+    }
+
     if (device == nullptr) return;
 
     // Check that the device is registered.
-    bool registered = false;
-    for (auto const& [num, dev] : devices)
-    {
-        if (dev == device) { registered = true; break; }
-    }
-    if (!registered) return;
+    if (!isRegistered(device)) return;
+
+    DrivePause pause(*this);
+    applySrq(device, state);
+}
 
+void IECBUS::applySrq(Peripheral* device, bool state)
+{
     // If no talker is active, assign this device as the current talker.
     if (currentTalker == nullptr) currentTalker = device;
 
@@ -347,18 +411,30 @@ void IECBUS::registerDevice(int deviceNumber, Peripheral* device)
     if (!device) return;
     if (devices.find(deviceNumber) != devices.end()) return;
 
+    stopDriveThreads();
+
     // FORCE consistency
     device->setDeviceNumber(deviceNumber);
 
     devices[deviceNumber] = device;
     device->attachBusInstance(this);
-    driveCycleAccumulators[device] = 0.0;
+
+    // Only drives are clocked by the bus, resolve that once here rather than per cycle
+    if (auto* drive = dynamic_cast<Drive*>(device))
+    {
+        auto pos = std::find_if(driveSlots.begin(), driveSlots.end(),
+            [deviceNumber](const DriveSlot& slot) { return slot.drive->getDeviceNumber() > deviceNumber; });
+
+        driveSlots.insert(pos, DriveSlot{ drive, driveClockStep(drive), 0 });
+    }
 
     recalcAndNotify();
 
     device->atnChanged(!busLines.atn);
     device->clkChanged(!busLines.clk);
     device->dataChanged(!busLines.data);
+
+    startDriveThreads();
 }
 
 void IECBUS::unregisterDevice(int deviceNumber)
@@ -368,10 +444,17 @@ void IECBUS::unregisterDevice(int deviceNumber)
 
     Peripheral* device = it->second;
 
+    stopDriveThreads();
+
     devDrivesClkLow.erase(device);
     devDrivesDataLow.erase(device);
     devDrivesAtnLow.erase(device);
-    driveCycleAccumulators.erase(device);
+
+    driveSlots.erase(
+        std::remove_if(driveSlots.begin(), driveSlots.end(),
+            [device](const DriveSlot& slot) { return static_cast<Peripheral*>(slot.drive) == device; }),
+        driveSlots.end()
+    );
 
     if (currentTalker == device) currentTalker = nullptr;
 
@@ -383,6 +466,8 @@ void IECBUS::unregisterDevice(int deviceNumber)
     devices.erase(it);
 
     recalcAndNotify();
+
+    startDriveThreads();
 }
 
 void IECBUS::listen(int deviceNumber)
@@ -392,6 +477,8 @@ void IECBUS::listen(int deviceNumber)
     auto it = devices.find(deviceNumber);
     if (it == devices.end()) return;
 
+    DrivePause pause(*this);
+
     Peripheral* dev = it->second;
     // Avoid duplicates
     if (std::find(currentListeners.begin(), currentListeners.end(), dev) == currentListeners.end()) currentListeners.push_back(dev);
@@ -405,6 +492,8 @@ void IECBUS::unListen(int deviceNumber)
 {
     if (romControlledIEC) return;
 
+    DrivePause pause(*this);
+
     // UNLISTEN is global ($3F)
     currentState = State::UNLISTEN;
 
@@ -421,6 +510,8 @@ void IECBUS::talk(int deviceNumber)
     auto it = devices.find(deviceNumber);
     if (it == devices.end()) return;
 
+    DrivePause pause(*this);
+
     currentTalker = it->second;
     currentState  = State::TALK;
 
@@ -435,6 +526,8 @@ void IECBUS::unTalk(int deviceNumber)
 {
     if (romControlledIEC) return;
 
+    DrivePause pause(*this);
+
     // UNTALK is global ($5F)
     currentState = State::UNTALK;
 
@@ -451,40 +544,83 @@ void IECBUS::unTalk(int deviceNumber)
 
 void IECBUS::tick(uint64_t cyclesPassed)
 {
-    for (uint64_t c = 0; c < cyclesPassed; ++c)
+    if (driveSlots.empty())
+        return;
+
+    if (!driveThreads.empty())
     {
-        updateSrqLine();
-        recalcAndNotify();
+        // The drives run on their own threads, only hand over how far they may go
+        hostCycle += cyclesPassed;
+        if (hostCycle - publishedCycle < DRIVE_PUBLISH_CYCLES)
+            return;
+
+        publishedCycle = hostCycle;
 
-        for (auto const& [num, dev] : devices)
+        bool tooFarBehind = false;
+        for (auto& thread : driveThreads)
         {
-            auto* drive = dynamic_cast<Drive*>(dev);
-            if (!drive)
-                continue;
+            thread->runTo(hostCycle);
+            tooFarBehind |= (hostCycle - thread->completed() > DRIVE_MAX_SKEW);
+        }
 
-            double& acc = driveCycleAccumulators[dev];
+        // Bounds how long the drives see each other's line changes late
+        if (tooFarBehind)
+            syncDriveThreads();
 
-            acc += drive->clockHz() / hostCpuHz;
+        return;
+    }
+
+    for (uint64_t c = 0; c < cyclesPassed; ++c)
+    {
+        for (DriveSlot& slot : driveSlots)
+        {
+            slot.acc += slot.step;
 
-            while (acc >= 1.0)
+            while (slot.acc >= DRIVE_CLOCK_ONE)
             {
-                drive->tick(1);
-                acc -= 1.0;
+                // Charge bus bookkeeping and drive time separately when sampled
+                const bool profiled = profiler && profiler->isSampling();
+                if (profiled) profiler->mark(ComponentProfiler::Component::IECBus);
+
+                slot.drive->tick(1);
+                slot.acc -= DRIVE_CLOCK_ONE;
 
-                updateSrqLine();
-                recalcAndNotify();
+                if (profiled) profiler->mark(ComponentProfiler::Component::Drives);
             }
         }
-    }
 
-    updateSrqLine();
-    recalcAndNotify();
+        // Line changes are resolved as the drives drive them, SRQ is still polled
+        updateSrqLine();
+    }
 }
 
 void IECBUS::setHostCpuHz(double hz)
 {
-    if (hz > 0.0)
-        hostCpuHz = hz;
+    if (hz <= 0.0)
+        return;
+
+    DrivePause pause(*this);
+
+    hostCpuHz = hz;
+
+    for (DriveSlot& slot : driveSlots)
+        slot.step = driveClockStep(slot.drive);
+}
+
+bool IECBUS::isRegistered(const Peripheral* device) const
+{
+    for (auto const& [num, dev] : devices)
+    {
+        if (dev == device)
+            return true;
+    }
+
+    return false;
+}
+
+uint64_t IECBUS::driveClockStep(const Drive* drive) const
+{
+    return static_cast<uint64_t>(std::llround(drive->clockHz() / hostCpuHz * static_cast<double>(DRIVE_CLOCK_ONE)));
 }
 
 void IECBUS::updateBusState()
@@ -568,9 +704,10 @@ void IECBUS::updateSrqLine()
             break;
         }
     }
+    const bool old = line_srqin;
     line_srqin = !srqAsserted;
-    // Update the CIA2
-    if(cia2) cia2->srqChanged(line_srqin);
+    // Update the CIA2, it only cares about edges
+    if (cia2 && old != line_srqin) cia2->srqChanged(line_srqin);
 }
 
 void IECBUS::secondaryAddress(uint8_t devNum, uint8_t sa)
@@ -582,7 +719,9 @@ void IECBUS::secondaryAddress(uint8_t devNum, uint8_t sa)
     if (it == devices.end())
         return;
 
-   it->second->onSecondaryAddress(sa);
+    DrivePause pause(*this);
+
+    it->second->onSecondaryAddress(sa);
 }
 
 Peripheral* IECBUS::getDevice(int id) const
@@ -641,6 +780,9 @@ void IECBUS::recalcAndNotify()
 
     updateBusState();
 
+    // Running drive threads take their changes from their own view instead
+    const bool notifyDevices = driveThreads.empty() || pausedDepth > 0;
+
     // ATN first
     if (busLines.atn != oldAtn)
     {
@@ -649,8 +791,9 @@ void IECBUS::recalcAndNotify()
         if (cia2)
             cia2->atnChanged(atnLow);
 
-        for (auto const& [num, dev] : devices)
-            if (dev) dev->atnChanged(atnLow);
+        if (notifyDevices)
+            for (auto const& [num, dev] : devices)
+                if (dev) dev->atnChanged(atnLow);
     }
 
     if (busLines.clk != oldClk)
@@ -660,8 +803,9 @@ void IECBUS::recalcAndNotify()
         if (cia2)
             cia2->clkChanged(clkLow);
 
-        for (auto const& [num, dev] : devices)
-            if (dev) dev->clkChanged(clkLow);
+        if (notifyDevices)
+            for (auto const& [num, dev] : devices)
+                if (dev) dev->clkChanged(clkLow);
     }
 
     if (busLines.data != oldData)
@@ -671,8 +815,169 @@ void IECBUS::recalcAndNotify()
         if (cia2)
             cia2->dataChanged(dataLow);
 
-        for (auto const& [num, dev] : devices)
-            if (dev) dev->dataChanged(dataLow);
+        if (notifyDevices)
+            for (auto const& [num, dev] : devices)
+                if (dev) dev->dataChanged(dataLow);
+    }
+}
+
+void IECBUS::setThreadedDrives(bool enabled)
+{
+    if (enabled == threadedDrives)
+        return;
+
+    stopDriveThreads();
+    threadedDrives = enabled;
+    startDriveThreads();
+}
+
+uint8_t IECBUS::c64LowMask() const
+{
+    uint8_t lowMask = 0;
+    if (c64DrivesAtnLow)  lowMask |= DriveThread::LINE_ATN;
+    if (c64DrivesClkLow)  lowMask |= DriveThread::LINE_CLK;
+    if (c64DrivesDataLow) lowMask |= DriveThread::LINE_DATA;
+    return lowMask;
+}
+
+void IECBUS::postC64Lines()
+{
+    if (driveThreads.empty() || pausedDepth > 0)
+        return;
+
+    const uint8_t lowMask = c64LowMask();
+    for (auto& thread : driveThreads)
+    {
+        if (!thread->postC64Lines(hostCycle, lowMask))
+        {
+            // Queue full, hand the change over once the drives caught up instead
+            syncDriveThreads();
+            refreshDriveViews(true);
+            return;
+        }
+    }
+}
+
+void IECBUS::startDriveThreads()
+{
+    if (!threadedDrives || !driveThreads.empty())
+        return;
+
+    // Slots stay put while the threads exist, register/unregister stop them first
+    for (DriveSlot& slot : driveSlots)
+    {
+        driveThreads.push_back(std::make_unique<DriveThread>(*slot.drive,
+            [&slot]()
+            {
+                slot.acc += slot.step;
+                while (slot.acc >= DRIVE_CLOCK_ONE)
+                {
+                    slot.drive->tick(1);
+                    slot.acc -= DRIVE_CLOCK_ONE;
+                }
+            },
+            hostCycle));
+    }
+
+    publishedCycle = hostCycle;
+    refreshDriveViews(false);
+}
+
+void IECBUS::stopDriveThreads()
+{
+    if (driveThreads.empty())
+        return;
+
+    syncDrives();
+
+    // Keep the bus in step with what the drives last drove
+    collectDriveOutputs();
+    driveThreads.clear();
+}
+
+void IECBUS::syncDriveThreads()
+{
+    for (auto& thread : driveThreads)
+        thread->runTo(hostCycle);
+
+    for (auto& thread : driveThreads)
+        thread->waitFor(hostCycle);
+
+    publishedCycle = hostCycle;
+
+    // Show the drives each other's changes, a few rounds in case they react to each other
+    for (int round = 0; round < 8 && collectDriveOutputs(); ++round)
+        refreshDriveViews(true);
+}
+
+bool IECBUS::collectDriveOutputs()
+{
+    pendingOutputs.clear();
+
+    for (auto& thread : driveThreads)
+    {
+        Peripheral* device = &thread->getDrive();
+        std::vector<DriveThread::OutputEvent>& outputs = thread->getOutputs();
+
+        for (const DriveThread::OutputEvent& output : outputs)
+            pendingOutputs.push_back(PendingOutput{ output.cycle, device, output.line, output.low });
+
+        outputs.clear();
+    }
+
+    // Replay the changes in the order they were made, ties in device number order
+    std::stable_sort(pendingOutputs.begin(), pendingOutputs.end(),
+        [](const PendingOutput& a, const PendingOutput& b) { return a.cycle < b.cycle; });
+
+    for (const PendingOutput& output : pendingOutputs)
+    {
+        switch (output.line)
+        {
+            case DriveThread::LINE_ATN:  devDrivesAtnLow[output.device]  = output.low; break;
+            case DriveThread::LINE_CLK:  devDrivesClkLow[output.device]  = output.low; break;
+            case DriveThread::LINE_DATA: devDrivesDataLow[output.device] = output.low; break;
+            case DriveThread::LINE_SRQ:  applySrq(output.device, output.low); break;
+            default: break;
+        }
+    }
+
+    recalcAndNotify();
+
+    // SRQ is polled every cycle while the drives run on this thread
+    updateSrqLine();
+
+    return !pendingOutputs.empty();
+}
+
+void IECBUS::refreshDriveViews(bool notify)
+{
+    const uint8_t c64Low = c64LowMask();
+
+    for (auto& thread : driveThreads)
+    {
+        const Peripheral* self = &thread->getDrive();
+        uint8_t othersLow = 0;
+        uint8_t ownLow = 0;
+
+        auto collect = [self, &othersLow, &ownLow](const std::map<Peripheral*, bool>& pulls, uint8_t line)
+        {
+            for (const auto& [dev, low] : pulls)
+            {
+                if (!low)
+                    continue;
+
+                if (dev == self)
+                    ownLow |= line;
+                else
+                    othersLow |= line;
+            }
+        };
+
+        collect(devDrivesAtnLow, DriveThread::LINE_ATN);
+        collect(devDrivesClkLow, DriveThread::LINE_CLK);
+        collect(devDrivesDataLow, DriveThread::LINE_DATA);
+
+        thread->setView(c64Low, othersLow, ownLow, line_srqin, notify);
     }
 }
 
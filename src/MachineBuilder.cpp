@@ -50,6 +50,7 @@ void MachineBuilder::assemble(Computer* host, MachineComponents& components, Mac
     components.cia1->attachIRQLineInstance(components.irq.get());
     components.cia1->attachKeyboardInstance(components.keyb.get());
     components.cia1->attachMemoryInstance(components.mem.get());
+    components.cia1->attachSchedulerInstance(components.scheduler.get(), EventScheduler::Slot::CIA1);
     components.cia1->attachTraceManagerInstance(&components.debug->trace());
     components.cia1->attachVicInstance(components.vic.get());
 
@@ -61,12 +62,14 @@ void MachineBuilder::assemble(Computer* host, MachineComponents& components, Mac
     components.cia2->attachDataBusLatchInstance(components.dataBus.get());
     components.cia2->attachIECBusInstance(components.bus.get());
     components.cia2->attachNMILineInstance(components.nmiLine.get());
+    components.cia2->attachSchedulerInstance(components.scheduler.get(), EventScheduler::Slot::CIA2);
     components.cia2->attachTraceManagerInstance(&components.debug->trace());
     components.cia2->attachUserPortInstance(components.userPort.get());
     components.cia2->attachVicInstance(components.vic.get());
 
     components.audioOutput->attachSIDInstance(components.sid.get());
-    components.videoOutput->setMonitorOpenCallback([&components]() -> bool { return components.debug && components.debug->monitorController().isOpen();});
+    if (components.videoOutput)
+        components.videoOutput->setMonitorOpenCallback([&components]() -> bool { return components.debug && components.debug->monitorController().isOpen();});
 
     components.keyb->attachNMILineInstance(components.nmiLine.get());
 
@@ -78,6 +81,7 @@ void MachineBuilder::assemble(Computer* host, MachineComponents& components, Mac
     components.mem->attachSIDInstance(components.sid.get());
     components.mem->attachCartridgeInstance(components.cart.get());
     components.mem->attachCassetteInstance(components.cass.get());
+    components.mem->attachDebugHooksInstance(&components.debug->hooks());
     components.mem->attachDebugManagerInstance(components.debug.get());
     components.mem->attachPLAInstance(components.pla.get());
     components.mem->attachREUInstance(components.reu.get());
@@ -114,7 +118,10 @@ void MachineBuilder::assemble(Computer* host, MachineComponents& components, Mac
 
     components.vic->attachCPUInstance(components.cpu.get());
     components.vic->attachDataBusLatchInstance(components.dataBus.get());
-    components.vic->attachIVideoSinkInstance(components.videoOutput.get());
+    if (components.videoOutput)
+        components.vic->attachIVideoSinkInstance(components.videoOutput.get());
+    else
+        components.vic->attachIVideoSinkInstance(components.nullVideoSink.get());
     components.vic->attachMemoryInstance(components.mem.get());
     components.vic->attachCIA2Instance(components.cia2.get());
     components.vic->attachIRQLineInstance(components.irq.get());
@@ -822,6 +822,12 @@ void MediaManager::tapeEject()
     state_.tapePath.clear();
 }
 
+bool MediaManager::isTapeWarpActive() const
+{
+    const Cassette* cass = components_.cass.get();
+    return state_.tapeWarp && cass && cass->isPlayPressed() && cass->motorOn();
+}
+
 void MediaManager::applyBootAttachments()
 {
     if (state_.cartAttached && !state_.cartPath.empty())
@@ -11,6 +11,7 @@
 #include "CIA2.h"
 #include "CPU.h"
 #include "DataBusLatch.h"
+#include "Debug/DebugHooks.h"
 #include "DebugManager.h"
 #include "Memory.h"
 #include "MLMonitor.h"
@@ -29,6 +30,7 @@ Memory::Memory() :
     cass(nullptr),
     cpu(nullptr),
     dataBus(nullptr),
+    hooks(nullptr),
     debugManager(nullptr),
     monitor(nullptr),
     pla(nullptr),
@@ -38,21 +40,30 @@ Memory::Memory() :
     traceMgr(nullptr),
     turbo232(nullptr),
     vic(nullptr),
+    cartLoView(nullptr),
+    cartHiView(nullptr),
+    cartHiE000View(nullptr),
     cartridgeAttached(false),
     romLOverlayIsRAM(false),
     romHOverLayIsRAM(false),
     cassetteSenseLow(false),
     dataDirectionRegister(0x2F),
-    port1OutputLatch(0x37)
+    port1OutputLatch(0x37),
+    pageMapGeneration(0)
 {
     mem.resize(MAX_MEMORY,0);
-    basicROM.resize(BASIC_ROM_SIZE,0);
-    kernalROM.resize(KERNAL_ROM_SIZE,0);
-    charROM.resize(CHAR_ROM_SIZE,0);
+    basicROM = RomSpan(BASIC_ROM_SIZE);
+    kernalROM = RomSpan(KERNAL_ROM_SIZE);
+    charROM = RomSpan(CHAR_ROM_SIZE);
     colorRAM.resize(COLOR_RAM_SIZE,0);
     cart_lo.resize(CART_LO_SIZE,0);
     cart_hi.resize(CART_HI_SIZE,0);
     cart_hi_e000.resize(CART_HI_E000_SIZE,0);
+    cart_empty.resize(CART_LO_SIZE,0xFF);
+
+    cartLoView = cart_lo.data();
+    cartHiView = cart_hi.data();
+    cartHiE000View = cart_hi_e000.data();
 
     applyPort1SideEffects(computeEffectivePort1(port1OutputLatch, dataDirectionRegister));
 }
@@ -78,10 +89,10 @@ void Memory::saveState(StateWriter& wrtr) const
     // Dump Misc
     wrtr.writeBool(cartridgeAttached);
 
-    // Dump Cartridge Lo/Hi
-    wrtr.writeVectorU8(cart_lo);
-    wrtr.writeVectorU8(cart_hi);
-    wrtr.writeVectorU8(cart_hi_e000);
+    // Dump Cartridge Lo/Hi as currently visible
+    wrtr.writeVectorU8(std::vector<uint8_t>(cartLoView, cartLoView + cart_lo.size()));
+    wrtr.writeVectorU8(std::vector<uint8_t>(cartHiView, cartHiView + cart_hi.size()));
+    wrtr.writeVectorU8(std::vector<uint8_t>(cartHiE000View, cartHiE000View + cart_hi_e000.size()));
 
     // End the chunk for CIA1
     wrtr.endChunk();
@@ -114,9 +125,20 @@ bool Memory::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
         if (!rdr.readVectorU8(cart_hi))                                     { rdr.exitChunkPayload(chunk); return false; }
         if (!rdr.readVectorU8(cart_hi_e000))                                { rdr.exitChunkPayload(chunk); return false; }
 
+        cart_lo.resize(CART_LO_SIZE, 0);
+        cart_hi.resize(CART_HI_SIZE, 0);
+        cart_hi_e000.resize(CART_HI_E000_SIZE, 0);
+
+        cartLoView = cart_lo.data();
+        cartHiView = cart_hi.data();
+        cartHiE000View = cart_hi_e000.data();
+
         // Re-apply port $01 side effects (PLA mapping + cassette motor)
         applyPort1SideEffects(computeEffectivePort1(port1OutputLatch, dataDirectionRegister));
 
+        // RAM may have been reallocated
+        invalidatePageMap();
+
         rdr.exitChunkPayload(chunk);
         return true;
     }
@@ -125,12 +147,104 @@ bool Memory::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
     return false;
 }
 
+inline const Memory::PageEntry* Memory::lookupPage(uint16_t address)
+{
+    if (!pla)
+        return nullptr;
+
+    if (pageMapGeneration != pla->getMappingGeneration())
+        rebuildPageMap();
+
+    return &pageMap[address >> 8];
+}
+
+inline bool Memory::pageHooked(uint16_t address) const
+{
+    #ifdef NO_DEBUG_HOOKS
+    (void)address;
+    return false;
+    #else
+    return hooks && hooks->isPageArmed(static_cast<uint8_t>(address >> 8));
+    #endif
+}
+
+void Memory::rebuildPageMap()
+{
+    pla->syncCartridgeLines();
+
+    // Mappers such as Capture and IDE64 can claim any CPU address
+    const bool mapperClaimsCpu = cart && cartridgeAttached && cart->hasCpuMemoryOverrides();
+
+    for (size_t page = 0; page < pageMap.size(); ++page)
+    {
+        PageEntry& entry = pageMap[page];
+        entry.read = nullptr;
+        entry.write = nullptr;
+
+        // Page zero holds the CPU port at $0000/$0001
+        if (page == 0 || mapperClaimsCpu)
+            continue;
+
+        // Tracing and watchpoints are only checked on the slow path
+        if (pageHooked(static_cast<uint16_t>(page << 8)))
+            continue;
+
+        const size_t base = page << 8;
+        uint8_t* ram = mem.data() + base;
+
+        switch (pla->getPageBank(static_cast<uint8_t>(page)))
+        {
+            case PLA::RAM:
+                entry.read = ram;
+                entry.write = ram;
+                break;
+
+            // Writes under ROM go to the underlying RAM
+            case PLA::KERNAL_ROM:
+                entry.read = kernalROM.data() + (base - 0xE000);
+                entry.write = ram;
+                break;
+
+            case PLA::BASIC_ROM:
+                entry.read = basicROM.data() + (base - 0xA000);
+                entry.write = ram;
+                break;
+
+            case PLA::CHARACTER_ROM:
+                entry.read = charROM.data() + (base - 0xD000);
+                entry.write = ram;
+                break;
+
+            // Cartridge, I/O and unmapped pages need the full decode
+            default:
+                break;
+        }
+    }
+
+    pageMapGeneration = pla->getMappingGeneration();
+}
+
 uint8_t Memory::read(uint16_t address)
 {
+    // Plain RAM and system ROM pages with no debug hooks armed
+    const PageEntry* page = lookupPage(address);
+    if (page && page->read)
+    {
+        const uint8_t value = page->read[address & 0xFF];
+
+        if (dataBus)
+            dataBus->drive(value, DataBusLatch::Driver::Memory);
+
+        return value;
+    }
+
     // Complete tracing and watchpoint processing without changing
     // which component drove the shared data bus.
     auto finishRead = [&](uint8_t value) -> uint8_t
     {
+        if (!pageHooked(address))
+            return value;
+
         if (traceMgr && traceMgr->memDetailOn(TraceManager::TraceDetail::MEM_CPU) && traceMgr->memRangeContains(address))
         {
             const uint16_t pc = cpu ? cpu->getPC() : 0;
@@ -141,7 +255,7 @@ uint8_t Memory::read(uint16_t address)
             traceMgr->recordMemRead(address, value, pc, stamp);
         }
 
-        if (monitor && monitor->checkWatchRead(address, value))
+        if (hooks->isArmed(address, DebugHooks::HOOK_READ) && monitor && monitor->checkWatchRead(address, value))
         {
             if (debugManager)
                 debugManager->onWatchpoint();
@@ -302,7 +416,7 @@ uint8_t Memory::read(uint16_t address)
             if (accessInfo.offset >= cart_lo.size())
                 throw std::runtime_error("Error: Attempt to read past end of cartridge LO");
 
-            return cartridgeRead(cart_lo[accessInfo.offset]);
+            return cartridgeRead(cartLoView[accessInfo.offset]);
         }
 
         case PLA::CARTRIDGE_HI:
@@ -316,7 +430,7 @@ uint8_t Memory::read(uint16_t address)
             if (accessInfo.offset >= cart_hi.size())
                 throw std::runtime_error("Error: Attempt to read past end of cartridge HI");
 
-            return cartridgeRead(cart_hi[accessInfo.offset]);
+            return cartridgeRead(cartHiView[accessInfo.offset]);
         }
 
         case PLA::CARTRIDGE_HI_E000:
@@ -333,7 +447,7 @@ uint8_t Memory::read(uint16_t address)
             if (accessInfo.offset >= cart_hi_e000.size())
                 throw std::runtime_error("Error: Attempt to read past end of cartridge HI_E000");
 
-            return cartridgeRead(cart_hi_e000[accessInfo.offset]);
+            return cartridgeRead(cartHiE000View[accessInfo.offset]);
         }
 
         case PLA::IO:
@@ -360,6 +474,13 @@ uint8_t Memory::read(uint16_t address)
 
 uint8_t Memory::peek(uint16_t address) const
 {
+    if (pla && pageMapGeneration == pla->getMappingGeneration())
+    {
+        const uint8_t* page = pageMap[address >> 8].read;
+        if (page)
+            return page[address & 0xFF];
+    }
+
     if (address == 0x0000)
         return dataDirectionRegister;
 
@@ -432,7 +553,7 @@ uint8_t Memory::peek(uint16_t address) const
             if (accessInfo.offset >= cart_lo.size())
                 return dataBus ? dataBus->sample() : 0xFF;
 
-            return cart_lo[accessInfo.offset];
+            return cartLoView[accessInfo.offset];
         }
 
         case PLA::CARTRIDGE_HI:
@@ -446,7 +567,7 @@ uint8_t Memory::peek(uint16_t address) const
             if (accessInfo.offset >= cart_hi.size())
                 return dataBus ? dataBus->sample() : 0xFF;
 
-            return cart_hi[accessInfo.offset];
+            return cartHiView[accessInfo.offset];
         }
 
         case PLA::CARTRIDGE_HI_E000:
@@ -461,7 +582,7 @@ uint8_t Memory::peek(uint16_t address) const
             if (accessInfo.offset >= cart_hi_e000.size())
                 return dataBus ? dataBus->sample() : 0xFF;
 
-            return cart_hi_e000[accessInfo.offset];
+            return cartHiE000View[accessInfo.offset];
         }
 
         case PLA::IO:
@@ -548,6 +669,10 @@ uint8_t Memory::readForDMA(uint16_t address)
         return value;
     };
 
+    const PageEntry* page = lookupPage(address);
+    if (page && page->read)
+        return driveMemory(page->read[address & 0xFF]);
+
     if (address == 0x0000)
         return driveMemory(dataDirectionRegister);
 
@@ -642,7 +767,7 @@ uint8_t Memory::readForDMA(uint16_t address)
                 return sampleOpenBus();
 
             // Stored in Memory, but physically supplied by cartridge.
-            return driveCartridge(cart_lo[accessInfo.offset]);
+            return driveCartridge(cartLoView[accessInfo.offset]);
         }
 
         case PLA::CARTRIDGE_HI:
@@ -656,7 +781,7 @@ uint8_t Memory::readForDMA(uint16_t address)
             if (accessInfo.offset >= cart_hi.size())
                 return sampleOpenBus();
 
-            return driveCartridge(cart_hi[accessInfo.offset]
+            return driveCartridge(cartHiView[accessInfo.offset]
             );
         }
 
@@ -671,7 +796,7 @@ uint8_t Memory::readForDMA(uint16_t address)
             if (accessInfo.offset >= cart_hi_e000.size())
                 return sampleOpenBus();
 
-            return driveCartridge(cart_hi_e000[accessInfo.offset]);
+            return driveCartridge(cartHiE000View[accessInfo.offset]);
         }
 
         case PLA::UNMAPPED:
@@ -714,8 +839,9 @@ uint8_t Memory::readIO(uint16_t address)
                                     vic ? vic->getRasterDot() : 0));
         }
 
-        if (sid)
-            return sid->readRegister(mirroredAddress);
+        // The first SID, or an extra one mapped into its mirrors
+        if (SID* chip = sid ? sid->chipForAddress(address) : nullptr)
+            return chip->readRegister(mirroredAddress);
     }
     else if (address >= IO_CIA1_START && address <= IO_CIA1_END)
     {
@@ -762,6 +888,10 @@ uint8_t Memory::readIO(uint16_t address)
         if (reu && reu->isEnabled() && address >= 0xDF00 && address <= 0xDF0A)
             return reu->readIO(address);
 
+        // Extra SIDs mapped into the I/O expansion area
+        if (SID* chip = sid ? sid->chipForAddress(address) : nullptr)
+            return chip->readRegister(static_cast<uint16_t>(0xD400 | (address & 0x1F)));
+
         if (cart && cartridgeAttached)
             return cart->read(address);
 
@@ -773,10 +903,20 @@ uint8_t Memory::readIO(uint16_t address)
 
 void Memory::write(uint16_t address, uint8_t value)
 {
+    // Plain RAM pages, and RAM under system ROM, with no debug hooks armed
+    const PageEntry* page = lookupPage(address);
+    if (page && page->write)
+    {
+        page->write[address & 0xFF] = value;
+        return;
+    }
+
     if (!pla) throw std::runtime_error("Error: Missing PLA object!");
 
+    const bool hooked = pageHooked(address);
+
     // Check for trace enabled and write if so
-    if (traceMgr && traceMgr->memDetailOn(TraceManager::TraceDetail::MEM_CPU) && traceMgr->memRangeContains(address))
+    if (hooked && traceMgr && traceMgr->memDetailOn(TraceManager::TraceDetail::MEM_CPU) && traceMgr->memRangeContains(address))
     {
         uint16_t PC = cpu ? cpu->getPC() : 0;
         TraceManager::Stamp stamp = traceMgr->makeStamp(cpu ? cpu->getTotalCycles() : 0, vic ? vic->getCurrentRaster() : 0,
@@ -787,6 +927,7 @@ void Memory::write(uint16_t address, uint8_t value)
 
     if (address == 0x0000)
     {
+        syncCassetteLine();
         dataDirectionRegister = value;
         uint8_t effective = computeEffectivePort1(port1OutputLatch, dataDirectionRegister);
 
@@ -806,6 +947,7 @@ void Memory::write(uint16_t address, uint8_t value)
     }
     else if (address == 0x0001)
     {
+        syncCassetteLine();
         port1OutputLatch = value;
         uint8_t effective = computeEffectivePort1(port1OutputLatch, dataDirectionRegister);
 
@@ -828,7 +970,7 @@ void Memory::write(uint16_t address, uint8_t value)
     {
         cart->write(address, value);
 
-        if (monitor && monitor->checkWatchWrite(address, value))
+        if (hooked && hooks->isArmed(address, DebugHooks::HOOK_WRITE) && monitor && monitor->checkWatchWrite(address, value))
         {
             if (debugManager)
                 debugManager->onWatchpoint();
@@ -918,7 +1060,7 @@ void Memory::write(uint16_t address, uint8_t value)
             break;
         }
     }
-    if (monitor && monitor->checkWatchWrite(address, value))
+    if (hooked && hooks->isArmed(address, DebugHooks::HOOK_WRITE) && monitor && monitor->checkWatchWrite(address, value))
     {
         if (debugManager)
             debugManager->onWatchpoint();
@@ -950,7 +1092,7 @@ void Memory::writeDirect(uint16_t address, uint8_t value)
         #endif
     }
 
-    if (monitor && monitor->checkWatchWrite(address, value))
+    if (pageHooked(address) && hooks->isArmed(address, DebugHooks::HOOK_WRITE) && monitor && monitor->checkWatchWrite(address, value))
     {
         if (debugManager)
             debugManager->onWatchpoint();
@@ -961,8 +1103,16 @@ void Memory::writeDirect(uint16_t address, uint8_t value)
 
 void Memory::writeForDMA(uint16_t address, uint8_t value)
 {
+    const PageEntry* page = lookupPage(address);
+    if (page && page->write)
+    {
+        page->write[address & 0xFF] = value;
+        return;
+    }
+
     if (address == 0x0000)
     {
+        syncCassetteLine();
         dataDirectionRegister = value;
         applyPort1SideEffects(computeEffectivePort1(port1OutputLatch, dataDirectionRegister));
         return;
@@ -970,6 +1120,7 @@ void Memory::writeForDMA(uint16_t address, uint8_t value)
 
     if (address == 0x0001)
     {
+        syncCassetteLine();
         port1OutputLatch = value;
         applyPort1SideEffects(computeEffectivePort1(port1OutputLatch, dataDirectionRegister));
         return;
@@ -1045,6 +1196,63 @@ void Memory::writeForDMA(uint16_t address, uint8_t value)
     }
 }
 
+size_t Memory::getDMAReadSpan(uint16_t address, size_t length, const uint8_t*& data)
+{
+    data = nullptr;
+
+    const PageEntry* page = lookupPage(address);
+    if (!page || !page->read)
+        return 0;
+
+    data = page->read + (address & 0xFF);
+
+    // Neighbouring pages only extend the run while they continue the same buffer
+    size_t span = 0x100 - (address & 0xFF);
+    for (size_t next = (address >> 8) + 1; span < length && next < pageMap.size(); ++next)
+    {
+        if (pageMap[next].read != pageMap[next - 1].read + 0x100)
+            break;
+
+        span += 0x100;
+    }
+
+    return std::min(span, length);
+}
+
+size_t Memory::getDMAWriteSpan(uint16_t address, size_t length, uint8_t*& data)
+{
+    data = nullptr;
+
+    const PageEntry* page = lookupPage(address);
+    if (!page || !page->write)
+        return 0;
+
+    data = page->write + (address & 0xFF);
+
+    size_t span = 0x100 - (address & 0xFF);
+    for (size_t next = (address >> 8) + 1; span < length && next < pageMap.size(); ++next)
+    {
+        if (pageMap[next].write != pageMap[next - 1].write + 0x100)
+            break;
+
+        span += 0x100;
+    }
+
+    return std::min(span, length);
+}
+
+bool Memory::isVisibleToVIC(uint16_t address, size_t length) const
+{
+    if (length == 0)
+        return false;
+
+    const size_t bankBase = cia2 ? cia2->getCurrentVICBank() : 0;
+    const size_t bankEnd = bankBase + 0x4000;
+    const size_t end = static_cast<size_t>(address) + length;
+
+    return address < bankEnd && end > bankBase;
+}
+
 uint8_t Memory::readCartridge(uint16_t offset, cartLocation location) const
 {
     switch (location)
@@ -1052,17 +1260,17 @@ uint8_t Memory::readCartridge(uint16_t offset, cartLocation location) const
         case cartLocation::LO:
             if (offset >= cart_lo.size())
                 throw std::runtime_error("Error: Attempt to read past end of cartridge lo");
-            return cart_lo[offset];
+            return cartLoView[offset];
 
         case cartLocation::HI:
             if (offset >= cart_hi.size())
                 throw std::runtime_error("Error: Attempt to read past end of cartridge hi");
-            return cart_hi[offset];
+            return cartHiView[offset];
 
         case cartLocation::HI_E000:
             if (offset >= cart_hi_e000.size())
                 throw std::runtime_error("Error: Attempt to read past end of cartridge hi e000");
-            return cart_hi_e000[offset];
+            return cartHiE000View[offset];
 
         default:
             return 0xFF;
@@ -1076,7 +1284,10 @@ void Memory::writeCartridge(uint16_t address, uint8_t value, cartLocation locati
         case cartLocation::LO:
         {
             if (address < cart_lo.size())
+            {
+                ownCartridgeBank(cart_lo, cartLoView);
                 cart_lo[address] = value;
+            }
             else
                 throw std::runtime_error("Error: Attempt to write past end of cartridge lo size");
             break;
@@ -1084,7 +1295,10 @@ void Memory::writeCartridge(uint16_t address, uint8_t value, cartLocation locati
         case cartLocation::HI:
         {
             if (address < cart_hi.size())
+            {
+                ownCartridgeBank(cart_hi, cartHiView);
                 cart_hi[address] = value;
+            }
             else
                 throw std::runtime_error("Error: Attempt to write past end of cartridge hi size");
             break;
@@ -1092,7 +1306,10 @@ void Memory::writeCartridge(uint16_t address, uint8_t value, cartLocation locati
         case cartLocation::HI_E000:
         {
             if (address < cart_hi_e000.size())
+            {
+                ownCartridgeBank(cart_hi_e000, cartHiE000View);
                 cart_hi_e000[address] = value;
+            }
             else
                 throw std::runtime_error("Error: Attempt to write past end of cartridge hi e000 size");
             break;
@@ -1102,6 +1319,36 @@ void Memory::writeCartridge(uint16_t address, uint8_t value, cartLocation locati
     }
 }
 
+void Memory::mapCartridgeBank(cartLocation location, const uint8_t* data)
+{
+    // All windows are 8K, an unpopulated bank reads as $FF
+    const uint8_t* bank = data ? data : cart_empty.data();
+
+    switch (location)
+    {
+        case cartLocation::LO:      cartLoView = bank; break;
+        case cartLocation::HI:      cartHiView = bank; break;
+        case cartLocation::HI_E000: cartHiE000View = bank; break;
+        default: break;
+    }
+}
+
+void Memory::detachCartridgeBanks()
+{
+    ownCartridgeBank(cart_lo, cartLoView);
+    ownCartridgeBank(cart_hi, cartHiView);
+    ownCartridgeBank(cart_hi_e000, cartHiE000View);
+}
+
+void Memory::ownCartridgeBank(std::vector<uint8_t>& buffer, const uint8_t*& view)
+{
+    if (view == buffer.data())
+        return;
+
+    std::copy(view, view + buffer.size(), buffer.begin());
+    view = buffer.data();
+}
+
 void Memory::writeIO(uint16_t address, uint8_t value)
 {
     if (address >= 0xD000 && address <= 0xD3FF)
@@ -1142,9 +1389,9 @@ void Memory::writeIO(uint16_t address, uint8_t value)
                                     vic ? vic->getRasterDot() : 0));
         }
 
-        if (sid)
+        if (SID* chip = sid ? sid->chipForAddress(address) : nullptr)
         {
-            sid->writeRegister(mirroredAddress,value);
+            chip->writeRegister(mirroredAddress,value);
             return;
         }
     }
@@ -1213,6 +1460,12 @@ void Memory::writeIO(uint16_t address, uint8_t value)
             return;
         }
 
+        if (SID* chip = sid ? sid->chipForAddress(address) : nullptr)
+        {
+            chip->writeRegister(static_cast<uint16_t>(0xD400 | (address & 0x1F)), value);
+            return;
+        }
+
         if (cart && cartridgeAttached)
         {
             cart->write(address, value);
@@ -1221,21 +1474,14 @@ void Memory::writeIO(uint16_t address, uint8_t value)
     }
 }
 
-bool Memory::load_ROM(const std::string& filename, std::vector<uint8_t>& targetBuffer, size_t expectedSize, const std::string& romName)
+bool Memory::load_ROM(const std::string& filename, RomSpan& target, size_t expectedSize, const std::string& romName)
 {
-    std::ifstream file(filename, std::ios::binary | std::ios::ate);
-    if (!file.is_open())
+    RomSpan rom = RomCache::instance().acquire(filename);
+    if (!rom.isLoaded() || rom.size() != expectedSize)
         return false;
 
-    std::streamsize fileSize = file.tellg();
-    if (static_cast<size_t>(fileSize) != expectedSize)
-        return false;
-
-    file.seekg(0, std::ios::beg);
-    if (!file.read(reinterpret_cast<char*>(targetBuffer.data()), expectedSize))
-        return false;
-
-    file.close();
+    target = std::move(rom);
+    invalidatePageMap();
     return true;
 }
 
@@ -1247,6 +1493,8 @@ bool Memory::Initialize(const std::string& basic, const std::string& kernal, con
         mem[i] = (i & 0x40) ? 0xFF : 0x00;
     }
 
+    invalidatePageMap();
+
     // Load each ROM and check for successful load
     if (!load_ROM(basic, basicROM, 0x2000, "BASIC") || !load_ROM(kernal, kernalROM, 0x2000, "Kernal") || !load_ROM(character, charROM, 0x1000, "CHAR"))
     {
@@ -1265,6 +1513,25 @@ uint8_t Memory::computeEffectivePort1(uint8_t latch, uint8_t ddr)
     return static_cast<uint8_t>((latch & ddr) | invDDR);
 }
 
+void Memory::setCassetteSenseLow(bool pressed)
+{
+    if (pressed == cassetteSenseLow)
+        return;
+
+    // Opening or closing the gate changes what the pending cycles see
+    if (cia1)
+        cia1->syncCassetteLine();
+
+    cassetteSenseLow = pressed;
+}
+
+void Memory::syncCassetteLine()
+{
+    // With PLAY up the tape is not sampled at all
+    if (cassetteSenseLow && cia1)
+        cia1->syncCassetteLine();
+}
+
 void Memory::applyPort1SideEffects(uint8_t effective)
 {
     // Bit 5 low => motor ON (active low)
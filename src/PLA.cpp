@@ -14,6 +14,8 @@ PLA::PLA() :
     cpu(nullptr),
     traceMgr(nullptr),
     vic(nullptr),
+    memoryControlRegister(0x37),
+    mappingGeneration(1),
     lastModeIndex(0xFF),
     lastloram(false),
     lasthiram(false),
@@ -49,6 +51,7 @@ bool PLA::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
         if (!rdr.readU8(mcr))                   { rdr.exitChunkPayload(chunk); return false; }
 
         updateMemoryControlRegister(mcr);
+        ++mappingGeneration;
 
         // reset trace deltas so you don't get a burst of "mode changed" noise
         lastModeIndex = 0xFF;
@@ -68,6 +71,7 @@ void PLA::reset()
     exROMLine = true;
     gameLine = true;
     cartridgeAttached = false;
+    ++mappingGeneration;
 
     // Default memory control register state on power on
     updateMemoryControlRegister(0x37);
@@ -82,6 +86,9 @@ void PLA::updateMemoryControlRegister(uint8_t value)
     hiram  = (value & 0x02) != 0;
     charen = (value & 0x04) != 0;
 
+    if ((oldValue ^ value) & 0x07)
+        ++mappingGeneration;
+
     if (traceMgr && traceMgr->plaDetailOn(TraceManager::TraceDetail::PLA_PORT))
     {
         TraceManager::Stamp stamp = traceMgr->makeStamp(
@@ -94,7 +101,7 @@ void PLA::updateMemoryControlRegister(uint8_t value)
     }
 }
 
-PLA::memoryAccessInfo PLA::getMemoryAccess(uint16_t address)
+void PLA::syncCartridgeLines()
 {
     if (cart && cartridgeAttached)
     {
@@ -107,6 +114,11 @@ PLA::memoryAccessInfo PLA::getMemoryAccess(uint16_t address)
         exROMLine = true;
         gameLine = true;
     }
+}
+
+PLA::memoryAccessInfo PLA::getMemoryAccess(uint16_t address)
+{
+    syncCartridgeLines();
 
     // Compute the mode index by combining control bits:
     // Bit 4: exROMLine, Bit 3: gameLine, Bit 2: charen, Bit 1: hiram, Bit 0: loram.
@@ -189,16 +201,7 @@ std::string PLA::describeAddress(uint16_t addr)
 
 std::string PLA::describeMode()
 {
-    if (cart && cartridgeAttached)
-    {
-        exROMLine = cart->getExROMLine();
-        gameLine  = cart->getGameLine();
-    }
-    else
-    {
-        exROMLine = true;
-        gameLine  = true;
-    }
+    syncCartridgeLines();
 
     std::ostringstream out;
     out << "PLA State:\n";
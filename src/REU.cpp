@@ -5,6 +5,7 @@
 // non-commercial use only. Redistribution, modification, or use
 // of this code in whole or in part for any other purpose is
 // strictly prohibited without the prior written consent of the author.
+#include <cstring>
 #include "DataBusLatch.h"
 #include "IRQLine.h"
 #include "Memory.h"
@@ -24,7 +25,7 @@ REU::~REU() = default;
 void REU::saveState(StateWriter& wrtr) const
 {
     wrtr.beginChunk("REU0");
-    wrtr.writeU32(1); //version
+    wrtr.writeU32(2); //version
 
     // Dump registers
     wrtr.writeU8(regs.status);
@@ -43,6 +44,14 @@ void REU::saveState(StateWriter& wrtr) const
     // Dump RAM
     wrtr.writeVectorU8(ram);
 
+    // Transfer in progress
+    wrtr.writeBool(dma.active);
+    wrtr.writeBool(dma.preloaded);
+    wrtr.writeBool(dma.verifyError);
+    wrtr.writeBool(dma.swapWritePhase);
+    wrtr.writeU8(dma.type);
+    wrtr.writeU32(dma.remaining);
+
     wrtr.endChunk();
 }
 
@@ -54,7 +63,7 @@ bool REU::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
 
         uint32_t ver = 0;
         if (!rdr.readU32(ver))                  { rdr.exitChunkPayload(chunk); return false; }
-        if (ver != 1)                           { rdr.exitChunkPayload(chunk); return false; }
+        if (ver < 1 || ver > 2)                 { rdr.exitChunkPayload(chunk); return false; }
 
         // Load registers
         if (!rdr.readU8(regs.status))           { rdr.exitChunkPayload(chunk); return false; }
@@ -73,6 +82,19 @@ bool REU::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
         // Load RAM
         if (!rdr.readVectorU8(ram))             { rdr.exitChunkPayload(chunk); return false; }
 
+        // Version 1 states were taken with transfers completing instantly
+        dma = DMAState{};
+
+        if (ver >= 2)
+        {
+            if (!rdr.readBool(dma.active))          { rdr.exitChunkPayload(chunk); return false; }
+            if (!rdr.readBool(dma.preloaded))       { rdr.exitChunkPayload(chunk); return false; }
+            if (!rdr.readBool(dma.verifyError))     { rdr.exitChunkPayload(chunk); return false; }
+            if (!rdr.readBool(dma.swapWritePhase))  { rdr.exitChunkPayload(chunk); return false; }
+            if (!rdr.readU8(dma.type))              { rdr.exitChunkPayload(chunk); return false; }
+            if (!rdr.readU32(dma.remaining))        { rdr.exitChunkPayload(chunk); return false; }
+        }
+
         // Post load validation
         const std::size_t expectedBytes = bytesForREUModel(model);
 
@@ -80,6 +102,7 @@ bool REU::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
         {
             ram.clear();
             model = REUModel::None;
+            dma = DMAState{};
         }
         else if (ram.size() != expectedBytes)
         {
@@ -104,6 +127,7 @@ void REU::reset()
 {
     regs        = REURegisters{};
     regs.status = baseStatusForModel();
+    dma         = DMAState{};
     updateIRQStatus();
 }
 
@@ -312,10 +336,10 @@ bool REU::shouldIncrementREUAddress() const
     return (regs.addressControl & ACR_FIX_REU) == 0;
 }
 
-void REU::incrementREUAddress()
+void REU::incrementREUAddress(uint32_t count)
 {
     uint32_t addr = reuAddress();
-    addr = (addr + 1) & 0xFFFFFFu;
+    addr = (addr + count) & 0xFFFFFFu;
 
     regs.reuAddressLo = static_cast<uint16_t>(addr & 0xFFFFu);
     regs.reuBank      = static_cast<uint8_t>((addr >> 16) & 0xFFu);
@@ -360,76 +384,210 @@ void REU::startTransfer()
 
     regs.status |= baseStatusForModel();
 
-    const uint8_t transferType = regs.command & CR_TRANSFER_MASK;
-    const uint32_t length = transferLengthBytes();
+    // The bytes move one per cycle from tickDMA(), starting with the next cycle
+    dma = DMAState{};
+    dma.active = true;
+    dma.type = regs.command & CR_TRANSFER_MASK;
+    dma.remaining = transferLengthBytes();
 
-    for (uint32_t i = 0; i < length; ++i)
+    // Plain RAM on the C64 side is moved in one go, the CPU still loses the same cycles
+    dma.preloaded = transferBlock();
+}
+
+void REU::tickDMA()
+{
+    if (!dma.active)
+        return;
+
+    if (dma.preloaded)
     {
-        const uint16_t c64Addr = regs.c64Address;
-        const uint32_t reuAddr = maskedREUAddress();
+        if (--dma.remaining == 0)
+            finishTransfer();
+
+        return;
+    }
+
+    // A swap reads both sides in one cycle and writes them back in the next
+    if (dma.type == 0x02 && !dma.swapWritePhase)
+    {
+        dma.swapWritePhase = true;
+        return;
+    }
+
+    dma.swapWritePhase = false;
+
+    if (!transferByte())
+    {
+        dma.verifyError = true;
+        finishTransfer();
+        return;
+    }
+
+    if (--dma.remaining == 0)
+        finishTransfer();
+}
 
-        switch (transferType)
+bool REU::transferByte()
+{
+    const uint16_t c64Addr = regs.c64Address;
+    const uint32_t reuAddr = maskedREUAddress();
+
+    switch (dma.type)
+    {
+        case 0x00: // C64 -> REU
         {
-            case 0x00: // C64 -> REU
-            {
-                const uint8_t value = mem->readForDMA(c64Addr);
-                ram[reuAddr] = value;
-                break;
-            }
+            const uint8_t value = mem->readForDMA(c64Addr);
+            ram[reuAddr] = value;
+            break;
+        }
 
-            case 0x01: // REU -> C64
-            {
-                const uint8_t value = ram[reuAddr];
+        case 0x01: // REU -> C64
+        {
+            const uint8_t value = ram[reuAddr];
 
-                if (dataBus)
-                    dataBus->drive(value, DataBusLatch::Driver::REU);
+            if (dataBus)
+                dataBus->drive(value, DataBusLatch::Driver::REU);
 
-                mem->writeForDMA(c64Addr, value);
-                break;
-            }
+            mem->writeForDMA(c64Addr, value);
+            break;
+        }
 
-            case 0x02: // Swap C64 <-> REU
-            {
-                const uint8_t c64Value = mem->readForDMA(c64Addr);
-                const uint8_t reuValue = ram[reuAddr];
+        case 0x02: // Swap C64 <-> REU
+        {
+            const uint8_t c64Value = mem->readForDMA(c64Addr);
+            const uint8_t reuValue = ram[reuAddr];
 
-                if (dataBus)
-                    dataBus->drive(reuValue, DataBusLatch::Driver::REU);
+            if (dataBus)
+                dataBus->drive(reuValue, DataBusLatch::Driver::REU);
 
-                mem->writeForDMA(c64Addr, reuValue);
-                ram[reuAddr] = c64Value;
-                break;
-            }
+            mem->writeForDMA(c64Addr, reuValue);
+            ram[reuAddr] = c64Value;
+            break;
+        }
 
-            case 0x03: // Verify C64 against REU
-            {
-                const uint8_t c64Value = mem->readForDMA(c64Addr);
-                const uint8_t reuValue = ram[reuAddr];
+        case 0x03: // Verify C64 against REU
+        {
+            const uint8_t c64Value = mem->readForDMA(c64Addr);
+            const uint8_t reuValue = ram[reuAddr];
+
+            if (c64Value != reuValue)
+                return false;
+
+            break;
+        }
+    }
+
+    if (shouldIncrementC64Address())
+        regs.c64Address = static_cast<uint16_t>(regs.c64Address + 1);
+
+    if (shouldIncrementREUAddress())
+        incrementREUAddress();
+
+    return true;
+}
+
+bool REU::transferBlock()
+{
+    if (!shouldIncrementC64Address() || !shouldIncrementREUAddress())
+        return false;
+
+    const uint16_t c64Addr = regs.c64Address;
+    const uint32_t reuAddr = maskedREUAddress();
+    const uint32_t length = dma.remaining;
+
+    // Neither side may wrap inside the block
+    if (c64Addr + length > 0x10000u || reuAddr + length > ram.size())
+        return false;
+
+    // Writes the VIC could fetch mid-transfer have to arrive byte by byte
+    const bool writesC64 = dma.type == 0x01 || dma.type == 0x02;
+    if (writesC64 && mem->isVisibleToVIC(c64Addr, length))
+        return false;
+
+    const uint8_t* c64Read = nullptr;
+    uint8_t* c64Write = nullptr;
+
+    if (dma.type != 0x01 && mem->getDMAReadSpan(c64Addr, length, c64Read) < length)
+        return false;
+
+    if (writesC64 && mem->getDMAWriteSpan(c64Addr, length, c64Write) < length)
+        return false;
+
+    // A swap has to read back the RAM it writes, not a ROM above it
+    if (dma.type == 0x02 && c64Read != c64Write)
+        return false;
+
+    uint8_t* reuData = ram.data() + reuAddr;
+    uint32_t moved = length;
+    uint32_t cycles = length;
+    uint8_t lastValue = 0xFF;
+    DataBusLatch::Driver lastDriver = DataBusLatch::Driver::REU;
+
+    switch (dma.type)
+    {
+        case 0x00: // C64 -> REU
+            std::memcpy(reuData, c64Read, length);
+            lastValue = c64Read[length - 1];
+            lastDriver = DataBusLatch::Driver::Memory;
+            break;
+
+        case 0x01: // REU -> C64
+            std::memcpy(c64Write, reuData, length);
+            lastValue = reuData[length - 1];
+            break;
 
-                if (c64Value != reuValue)
-                {
-                    regs.status |= SR_VERIFY_ERROR;
+        case 0x02: // Swap C64 <-> REU
+            std::swap_ranges(c64Write, c64Write + length, reuData);
+            lastValue = c64Write[length - 1];
+            cycles = length * 2;
+            break;
 
-                    regs.status |= SR_END_OF_BLOCK;
-                    updateIRQStatus();
-                    return;
-                }
+        case 0x03: // Verify C64 against REU
+        {
+            const auto diff = std::mismatch(c64Read, c64Read + length, reuData);
 
-                break;
+            // The compare stops on the first mismatch, leaving the addresses on it
+            if (diff.first != c64Read + length)
+            {
+                moved = static_cast<uint32_t>(diff.first - c64Read);
+                cycles = moved + 1;
+                dma.verifyError = true;
             }
+
+            lastValue = c64Read[std::min(moved, length - 1)];
+            lastDriver = DataBusLatch::Driver::Memory;
+            break;
         }
+    }
 
-        if (shouldIncrementC64Address())
-            regs.c64Address = static_cast<uint16_t>(regs.c64Address + 1);
+    if (dataBus)
+        dataBus->drive(lastValue, lastDriver);
 
-        if (shouldIncrementREUAddress())
-            incrementREUAddress();
-    }
+    regs.c64Address = static_cast<uint16_t>(regs.c64Address + moved);
+    incrementREUAddress(moved);
+
+    dma.remaining = cycles;
+    return true;
+}
+
+void REU::finishTransfer()
+{
+    dma.active = false;
 
     regs.status |= SR_END_OF_BLOCK;
+
+    if (dma.verifyError)
+        regs.status |= SR_VERIFY_ERROR;
+
     updateIRQStatus();
 }
 
+void REU::completeTransfer()
+{
+    while (dma.active)
+        tickDMA();
+}
+
 std::string REU::dumpIRQStatus() const
 {
     auto yn = [](bool v)
@@ -566,6 +724,12 @@ std::string REU::dumpStatus() const
         << std::dec
         << " / " << transferLengthBytes() << " bytes\n";
 
+    out << "  DMA:           ";
+    if (dma.active)
+        out << "running, " << dma.remaining << (dma.preloaded ? " cycles" : " bytes") << " left\n";
+    else
+        out << "idle\n";
+
     out << "\nControl:\n";
 
     out << "  IRQ mask:      $"
@@ -875,6 +1039,7 @@ std::string REU::selfTest()
         regs.addressControl = 0x00;
         regs.command = command;
         startTransfer();
+        completeTransfer();
     };
 
     // ------------------------------------------------------------
@@ -0,0 +1,167 @@
+﻿// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#include "RomCache.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    // Backing store for spans with no image, large enough for any drive ROM
+    const uint8_t blankROM[RomSpan::MAX_BLANK_SIZE] = {};
+
+    // FNV-1a, ROMs are at most 32K so this is cheap next to opening the file
+    uint64_t hashContents(const uint8_t* data, size_t size)
+    {
+        uint64_t hash = 0xCBF29CE484222325ULL;
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= data[i];
+            hash *= 0x100000001B3ULL;
+        }
+        return hash;
+    }
+}
+
+RomImage::RomImage() :
+    hash(0)
+{
+
+}
+
+bool RomImage::readFile(const std::string& filePath)
+{
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        return false;
+
+    const std::streamsize size = file.tellg();
+    if (size <= 0)
+        return false;
+
+    bytes.resize(size_t(size));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(bytes.data()), size))
+    {
+        bytes.clear();
+        return false;
+    }
+
+    hash = hashContents(bytes.data(), bytes.size());
+    return true;
+}
+
+RomSpan::RomSpan(size_t blankSize) :
+    ptr(blankROM),
+    length(std::min(blankSize, MAX_BLANK_SIZE))
+{
+
+}
+
+RomSpan::RomSpan(std::shared_ptr<const RomImage> image) :
+    image(std::move(image)),
+    ptr(blankROM),
+    length(0)
+{
+    if (this->image)
+    {
+        ptr = this->image->data();
+        length = this->image->size();
+    }
+}
+
+RomCache& RomCache::instance()
+{
+    static RomCache cache;
+    return cache;
+}
+
+RomSpan RomCache::acquire(const std::string& filePath)
+{
+    namespace fs = std::filesystem;
+
+    std::error_code ec;
+    const fs::path path = fs::absolute(fs::path(filePath), ec).lexically_normal();
+    if (ec)
+        return RomSpan();
+
+    const uintmax_t fileSize = fs::file_size(path, ec);
+    if (ec)
+        return RomSpan();
+
+    const auto writeTime = fs::last_write_time(path, ec);
+    if (ec)
+        return RomSpan();
+    const int64_t modified = int64_t(writeTime.time_since_epoch().count());
+
+    std::lock_guard<std::mutex> lock(cacheMut);
+
+    PathEntry& entry = byPath[path.string()];
+    if (entry.fileSize == fileSize && entry.modified == modified)
+    {
+        if (auto image = entry.image.lock())
+            return RomSpan(std::move(image));
+    }
+
+    std::shared_ptr<RomImage> fresh(new RomImage());
+    if (!fresh->readFile(path.string()))
+    {
+        byPath.erase(path.string());
+        return RomSpan();
+    }
+
+    // The same ROM under another path (per-instance copies, renamed dumps) shares one image
+    std::shared_ptr<const RomImage> image = findByContent(*fresh);
+    if (!image)
+    {
+        byHash.emplace(fresh->getHash(), fresh);
+        image = std::move(fresh);
+    }
+
+    entry.image = image;
+    entry.fileSize = fileSize;
+    entry.modified = modified;
+    return RomSpan(std::move(image));
+}
+
+size_t RomCache::getImageCount() const
+{
+    std::lock_guard<std::mutex> lock(cacheMut);
+
+    size_t count = 0;
+    for (const auto& [hash, image] : byHash)
+    {
+        (void)hash;
+        if (!image.expired())
+            ++count;
+    }
+    return count;
+}
+
+std::shared_ptr<const RomImage> RomCache::findByContent(const RomImage& image)
+{
+    auto range = byHash.equal_range(image.getHash());
+    for (auto it = range.first; it != range.second; )
+    {
+        std::shared_ptr<const RomImage> cached = it->second.lock();
+        if (!cached)
+        {
+            // Last user is gone, drop the stale slot
+            it = byHash.erase(it);
+            continue;
+        }
+
+        if (cached->size() == image.size() &&
+            std::equal(image.data(), image.data() + image.size(), cached->data()))
+            return cached;
+
+        ++it;
+    }
+    return nullptr;
+}
@@ -26,10 +26,10 @@ Envelope::Envelope(double sampleRate) :
     sustainRate(0),
     releaseRate(0),
     envCounter(0),
-    stepAccumulator(0.0),
-    attackStepCycles(1.0),
-    decayStepCycles(1.0),
-    releaseStepCycles(1.0),
+    rateCounter(0),
+    attackPeriod(toRatePeriod(1.0)),
+    decayPeriod(toRatePeriod(1.0)),
+    releasePeriod(toRatePeriod(1.0)),
     exponentialCounter(0),
     exponentialPeriod(1),
     sustainCounter(0)
@@ -42,7 +42,7 @@ Envelope::~Envelope() = default;
 void Envelope::trigger()
 {
     state               = State::Attack;
-    stepAccumulator     = 0.0;
+    rateCounter         = 0;
     exponentialCounter  = 0;
     exponentialPeriod   = 1;
 }
@@ -50,7 +50,7 @@ void Envelope::trigger()
 void Envelope::release()
 {
     state               = State::Release;
-    stepAccumulator     = 0.0;
+    rateCounter         = 0;
     exponentialCounter  = 0;
     updateExponentialPeriod();
 }
@@ -60,7 +60,7 @@ void Envelope::reset()
     state               = State::Idle;
     level               = 0.0;
     envCounter          = 0;
-    stepAccumulator     = 0.0;
+    rateCounter         = 0;
     exponentialCounter  = 0;
     exponentialPeriod   = 1;
 }
@@ -84,179 +84,151 @@ void Envelope::setLevel(double newLevel)
     envCounter = static_cast<uint8_t>(std::round(level * 255.0));
 }
 
-double Envelope::processSample()
-{
-    const double sidCyclesThisSample =
-        (sampleRate > 0.0) ? (sidClockFrequency / sampleRate) : 1.0;
-
-    clock(sidCyclesThisSample);
-    return output();
-}
-
 bool Envelope::isIdle() const
 {
     return state == State::Idle;
 }
 
-void Envelope::clock(double sidCycles)
+void Envelope::clock(uint32_t sidCycles)
 {
-    if (sidCycles <= 0.0)
+    if (sidCycles == 0)
         return;
 
-    switch (state)
+    uint64_t remaining = static_cast<uint64_t>(sidCycles) << RATE_FRACTION_BITS;
+
+    while (remaining > 0)
     {
-        case State::Idle:
+        uint64_t period = 0;
+
+        switch (state)
         {
-            envCounter = 0;
-            syncLevelFromCounter();
+            case State::Idle:
+            {
+                envCounter = 0;
 
-            exponentialCounter = 0;
-            exponentialPeriod = 1;
+                exponentialCounter = 0;
+                exponentialPeriod = 1;
+                remaining = 0;
+                continue;
+            }
+
+            case State::Sustain:
+            {
+                envCounter = sustainCounter;
+
+                exponentialCounter = 0;
+                updateExponentialPeriod();
+                remaining = 0;
+                continue;
+            }
+
+            case State::Attack:  period = attackPeriod;  break;
+            case State::Decay:   period = decayPeriod;   break;
+            case State::Release: period = releasePeriod; break;
+        }
+
+        // Nothing happens until the rate counter reaches the period, go there directly
+        if (rateCounter + remaining < period)
+        {
+            rateCounter += remaining;
             break;
         }
 
+        const uint64_t needed = (period > rateCounter) ? (period - rateCounter) : 0;
+
+        remaining -= needed;
+        rateCounter = rateCounter + needed - period;
+
+        stepEnvelope();
+    }
+
+    syncLevelFromCounter();
+}
+
+void Envelope::stepEnvelope()
+{
+    switch (state)
+    {
         case State::Attack:
         {
-            stepAccumulator += sidCycles;
+            if (envCounter < 0xFF)
+                ++envCounter;
 
-            while (stepAccumulator >= attackStepCycles)
+            if (envCounter == 0xFF)
             {
-                stepAccumulator -= attackStepCycles;
-
-                if (envCounter < 0xFF)
-                {
-                    ++envCounter;
-
-                    if (envCounter == 0xFF)
-                    {
-                        state = State::Decay;
-                        stepAccumulator = 0.0;
-
-                        exponentialCounter = 0;
-                        updateExponentialPeriod();
-                        break;
-                    }
-                }
-                else
-                {
-                    envCounter = 0xFF;
-                    state = State::Decay;
-                    stepAccumulator = 0.0;
-
-                    exponentialCounter = 0;
-                    updateExponentialPeriod();
-                    break;
-                }
-            }
+                state = State::Decay;
+                rateCounter = 0;
 
-            syncLevelFromCounter();
+                exponentialCounter = 0;
+                updateExponentialPeriod();
+            }
             break;
         }
 
         case State::Decay:
         {
-            stepAccumulator += sidCycles;
-
-            while (stepAccumulator >= decayStepCycles)
+            if (envCounter <= sustainCounter)
             {
-                stepAccumulator -= decayStepCycles;
-
-                if (envCounter <= sustainCounter)
-                {
-                    envCounter = sustainCounter;
-                    state = State::Sustain;
-                    stepAccumulator = 0.0;
-
-                    exponentialCounter = 0;
-                    updateExponentialPeriod();
-                    break;
-                }
-
-                ++exponentialCounter;
-
-                if (exponentialCounter >= exponentialPeriod)
-                {
-                    exponentialCounter = 0;
-
-                    if (envCounter > sustainCounter)
-                    {
-                        --envCounter;
-                        updateExponentialPeriod();
-
-                        if (envCounter <= sustainCounter)
-                        {
-                            envCounter = sustainCounter;
-                            state = State::Sustain;
-                            stepAccumulator = 0.0;
-
-                            exponentialCounter = 0;
-                            updateExponentialPeriod();
-                            break;
-                        }
-                    }
-                }
-            }
+                envCounter = sustainCounter;
+                state = State::Sustain;
+                rateCounter = 0;
 
-            syncLevelFromCounter();
-            break;
-        }
+                exponentialCounter = 0;
+                updateExponentialPeriod();
+                break;
+            }
 
-        case State::Sustain:
-        {
-            envCounter = sustainCounter;
-            syncLevelFromCounter();
+            if (++exponentialCounter < exponentialPeriod)
+                break;
 
             exponentialCounter = 0;
+            --envCounter;
             updateExponentialPeriod();
+
+            if (envCounter <= sustainCounter)
+            {
+                envCounter = sustainCounter;
+                state = State::Sustain;
+                rateCounter = 0;
+
+                exponentialCounter = 0;
+                updateExponentialPeriod();
+            }
             break;
         }
 
         case State::Release:
         {
-            stepAccumulator += sidCycles;
-
-            while (stepAccumulator >= releaseStepCycles)
+            if (envCounter == 0)
             {
-                stepAccumulator -= releaseStepCycles;
-
-                if (envCounter == 0)
-                {
-                    envCounter = 0;
-                    state = State::Idle;
-                    stepAccumulator = 0.0;
-
-                    exponentialCounter = 0;
-                    exponentialPeriod = 1;
-                    break;
-                }
-
-                ++exponentialCounter;
-
-                if (exponentialCounter >= exponentialPeriod)
-                {
-                    exponentialCounter = 0;
-
-                    if (envCounter > 0)
-                    {
-                        --envCounter;
-                        updateExponentialPeriod();
-
-                        if (envCounter == 0)
-                        {
-                            state = State::Idle;
-                            stepAccumulator = 0.0;
-
-                            exponentialCounter = 0;
-                            exponentialPeriod = 1;
-                            break;
-                        }
-                    }
-                }
+                state = State::Idle;
+                rateCounter = 0;
+
+                exponentialCounter = 0;
+                exponentialPeriod = 1;
+                break;
             }
 
-            syncLevelFromCounter();
+            if (++exponentialCounter < exponentialPeriod)
+                break;
+
+            exponentialCounter = 0;
+            --envCounter;
+            updateExponentialPeriod();
+
+            if (envCounter == 0)
+            {
+                state = State::Idle;
+                rateCounter = 0;
+
+                exponentialCounter = 0;
+                exponentialPeriod = 1;
+            }
             break;
         }
+
+        default:
+            break;
     }
 }
 
@@ -281,9 +253,9 @@ void Envelope::setParameters(double attack, double decay, double sustain, double
 
     // Convert ADSR times into SID-cycle intervals per 8-bit envelope step.
     // This keeps timing tied to the SID clock instead of directly to audio sample count.
-    attackStepCycles  = std::max(1.0, (attackTime  * sidClockFrequency) / 255.0);
-    decayStepCycles   = std::max(1.0, (decayTime   * sidClockFrequency) / 255.0);
-    releaseStepCycles = std::max(1.0, (releaseTime * sidClockFrequency) / 255.0);
+    attackPeriod  = toRatePeriod((attackTime  * sidClockFrequency) / 255.0);
+    decayPeriod   = toRatePeriod((decayTime   * sidClockFrequency) / 255.0);
+    releasePeriod = toRatePeriod((releaseTime * sidClockFrequency) / 255.0);
 }
 
 void Envelope::setADSR(uint8_t attack, uint8_t decay, uint8_t sustain, uint8_t release)
@@ -306,14 +278,9 @@ void Envelope::setADSR(uint8_t attack, uint8_t decay, uint8_t sustain, uint8_t r
     const double clockScale =
         (sidClockFrequency > 0.0) ? (sidClockFrequency / SID_CLOCK_NTSC) : 1.0;
 
-    attackStepCycles =
-        std::max(1.0, SID_ATTACK_STEP_CYCLES_NTSC[attackRate] * clockScale);
-
-    decayStepCycles =
-        std::max(1.0, SID_DECAY_RELEASE_STEP_CYCLES_NTSC[decayRate] * clockScale);
-
-    releaseStepCycles =
-        std::max(1.0, SID_DECAY_RELEASE_STEP_CYCLES_NTSC[releaseRate] * clockScale);
+    attackPeriod  = toRatePeriod(SID_ATTACK_STEP_CYCLES_NTSC[attackRate] * clockScale);
+    decayPeriod   = toRatePeriod(SID_DECAY_RELEASE_STEP_CYCLES_NTSC[decayRate] * clockScale);
+    releasePeriod = toRatePeriod(SID_DECAY_RELEASE_STEP_CYCLES_NTSC[releaseRate] * clockScale);
 }
 
 std::string Envelope::stateToString(State s) {
@@ -328,6 +295,11 @@ std::string Envelope::stateToString(State s) {
     return "Unknown";
 }
 
+uint64_t Envelope::toRatePeriod(double stepCycles)
+{
+    return static_cast<uint64_t>(std::llround(std::max(1.0, stepCycles) * static_cast<double>(1ull << RATE_FRACTION_BITS)));
+}
+
 void Envelope::syncLevelFromCounter()
 {
     level = static_cast<double>(envCounter) / 255.0;
@@ -387,13 +359,15 @@ std::string Envelope::dumpDebug() const
         << std::dec << std::setfill(' ')
         << " (" << static_cast<int>(sustainCounter) << "/255)\n";
 
+    constexpr double rateScale = 1.0 / static_cast<double>(1ull << RATE_FRACTION_BITS);
+
     out << std::fixed << std::setprecision(3);
-    out << "  Step accumulator:   " << stepAccumulator << "\n";
+    out << "  Rate counter:       " << static_cast<double>(rateCounter) * rateScale << "\n";
     out << "  Exponential count:  " << exponentialCounter << "\n";
     out << "  Exponential period: " << exponentialPeriod << "\n";
-    out << "  Attack step cycles: " << attackStepCycles << "\n";
-    out << "  Decay step cycles:  " << decayStepCycles << "\n";
-    out << "  Release step cycles:" << releaseStepCycles << "\n";
+    out << "  Attack step cycles: " << static_cast<double>(attackPeriod) * rateScale << "\n";
+    out << "  Decay step cycles:  " << static_cast<double>(decayPeriod) * rateScale << "\n";
+    out << "  Release step cycles:" << static_cast<double>(releasePeriod) * rateScale << "\n";
 
     out << "  SID clock:          " << sidClockFrequency << " Hz\n";
     out << "  Sample rate:        " << sampleRate << " Hz\n";
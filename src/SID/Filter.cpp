@@ -15,6 +15,8 @@ Filter::Filter(double sampleRate) :
     resonance(0.0),
     f(0.0),
     q(0.0),
+    drive(0.0f),
+    asymmetry(0.0f),
     lowPassOut(0.0),
     bandPassOut(0.0),
     highPassOut(0.0),
@@ -26,46 +28,60 @@ Filter::Filter(double sampleRate) :
 
 Filter::~Filter() = default;
 
-double Filter::processSample(double input)
+void Filter::processBlock(const float* in, float* out, size_t count)
 {
-    const SIDModelProfile& profile = getSIDModelProfile(model);
-
-    double drivenInput = input;
-
     // Model-specific analog-ish input drive.
     // 6581 gets more color; 8580 stays mostly clean.
-    if (profile.filterDrive > 0.0)
+    if (drive > 0.0f)
     {
-        drivenInput *= (1.0 + profile.filterDrive);
-
-        if (profile.filterAsymmetry != 0.0)
+        for (size_t i = 0; i < count; ++i)
         {
+            float x = in[i] * (1.0f + drive);
+
             // Small asymmetric bend. This makes the 6581 filter path less
             // perfectly symmetrical without being a harsh distortion effect.
-            drivenInput += profile.filterAsymmetry * drivenInput * std::abs(drivenInput);
-        }
+            x += asymmetry * x * std::abs(x);
 
-        // Soft saturation before the state-variable filter.
-        drivenInput = std::tanh(drivenInput);
+            // Soft saturation before the state-variable filter.
+            out[i] = tanhApprox(x);
+        }
     }
+    else if (in != out)
+    {
+        std::copy(in, in + count, out);
+    }
+
+    const float fc = static_cast<float>(f);
+    const float qc = static_cast<float>(q);
 
-    highPassOut = drivenInput - lowPassOut - q * bandPassOut;
+    // Mode bits as weights, no branches in the loop
+    const float lowGain  = (mode & 0x01) ? 1.0f : 0.0f;
+    const float bandGain = (mode & 0x02) ? 1.0f : 0.0f;
+    const float highGain = (mode & 0x04) ? 1.0f : 0.0f;
 
-    bandPassOut += f * highPassOut;
-    bandPassOut = std::clamp(bandPassOut, -1.0, 1.0);
+    constexpr float DC_ALPHA = 0.999f;
 
-    lowPassOut += f * bandPassOut;
-    lowPassOut = std::clamp(lowPassOut, -1.0, 1.0);
+    float low = static_cast<float>(lowPassOut);
+    float band = static_cast<float>(bandPassOut);
+    float high = static_cast<float>(highPassOut);
+    float dc = static_cast<float>(dcBlock);
 
-    double output = 0.0;
-    if (mode & 0x01) output += lowPassOut;
-    if (mode & 0x02) output += bandPassOut;
-    if (mode & 0x04) output += highPassOut;
+    for (size_t i = 0; i < count; ++i)
+    {
+        high = out[i] - low - qc * band;
+        band = std::clamp(band + fc * high, -1.0f, 1.0f);
+        low = std::clamp(low + fc * band, -1.0f, 1.0f);
+
+        const float output = lowGain * low + bandGain * band + highGain * high;
+        dc = DC_ALPHA * dc + (1.0f - DC_ALPHA) * output;
 
-    const double dcAlpha = 0.999;
-    dcBlock = dcAlpha * dcBlock + (1.0 - dcAlpha) * output;
+        out[i] = std::clamp(output - dc, -1.0f, 1.0f);
+    }
 
-    return std::clamp(output - dcBlock, -1.0, 1.0);
+    lowPassOut = low;
+    bandPassOut = band;
+    highPassOut = high;
+    dcBlock = dc;
 }
 
 void Filter::setModel(SIDModel newModel)
@@ -126,4 +142,33 @@ void Filter::calculateCoefficients()
 
     q = 1.0 - std::pow(resonance, profile.resonanceCurvePower);
     q = std::clamp(q, 0.0, 1.0);
+
+    drive = static_cast<float>(profile.filterDrive);
+    asymmetry = static_cast<float>(profile.filterAsymmetry);
+}
+
+float Filter::tanhApprox(float x)
+{
+    constexpr int TABLE_SIZE = 1024;
+    constexpr float RANGE = 4.0f;   // tanh(4) is within 0.07% of 1
+
+    struct Table
+    {
+        float values[TABLE_SIZE + 2];
+
+        Table()
+        {
+            for (int i = 0; i <= TABLE_SIZE + 1; ++i)
+                values[i] = static_cast<float>(std::tanh(-RANGE + 2.0 * RANGE * i / TABLE_SIZE));
+        }
+    };
+
+    static const Table table;
+
+    // Linear interpolation, the error stays below 1e-5
+    const float pos = (std::clamp(x, -RANGE, RANGE) + RANGE) * (TABLE_SIZE / (2.0f * RANGE));
+    const int index = static_cast<int>(pos);
+    const float frac = pos - static_cast<float>(index);
+
+    return table.values[index] + (table.values[index + 1] - table.values[index]) * frac;
 }
@@ -7,24 +7,48 @@
 // strictly prohibited without the prior written consent of the author.
 #include "SID/Mixer.h"
 
-Mixer::Mixer() = default;
+Mixer::Mixer() :
+    filterBits(0),
+    filterInputGain(1.0f),
+    directGain(1.0f)
+{
+    setRouting(0, false);
+}
 
 Mixer::~Mixer() = default;
 
-double Mixer::mixSamples(const std::vector<double>& voiceSamples)
+void Mixer::setRouting(uint8_t filterBits, bool voice3DirectOff)
 {
-    if (voiceSamples.empty()) return 0.0;
+    this->filterBits = filterBits & 0x07;
 
-    //double perVoiceGain = 0.5; // ~–6 dB per voice
-    double perVoiceGain = 0.707;
-    double sum = 0.0;
-    for (double s : voiceSamples)
+    for (int i = 0; i < 3; ++i)
     {
-        sum += s * perVoiceGain;
+        const bool filtered = (this->filterBits & (1 << i)) != 0;
+
+        toFilter[i] = filtered ? PER_VOICE_GAIN : 0.0f;
+        toDirect[i] = (filtered || (i == 2 && voice3DirectOff)) ? 0.0f : PER_VOICE_GAIN;
     }
+}
 
-    // soft-clip
-    sum = sum / (1.0 + std::abs(sum));
+void Mixer::setGains(double filterInputGain, double directGain)
+{
+    this->filterInputGain = static_cast<float>(filterInputGain);
+    this->directGain = static_cast<float>(directGain);
+}
 
-    return sum;
+void Mixer::mixBlock(const float* const voices[3], size_t count, float* filtered, float* direct) const
+{
+    const float* v1 = voices[0];
+    const float* v2 = voices[1];
+    const float* v3 = voices[2];
+
+    // Branch free so the compiler can run it 4 or 8 samples wide
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float f = v1[i] * toFilter[0] + v2[i] * toFilter[1] + v3[i] * toFilter[2];
+        const float d = v1[i] * toDirect[0] + v2[i] * toDirect[1] + v3[i] * toDirect[2];
+
+        filtered[i] = std::min(std::max(f, -1.0f), 1.0f) * filterInputGain;
+        direct[i] = std::min(std::max(d, -1.0f), 1.0f) * directGain;
+    }
 }
@@ -9,29 +9,15 @@
 #include <sstream>
 #include "SID/Oscillator.h"
 
-static inline double polyBLEP(double t, double dt) {
-    if (t < dt)
-    {
-        double x = t/dt;
-        return x + x - x*x - 1.0;
-    }
-    else if (t > 1.0 - dt)
-    {
-        double x = (t - 1.0)/dt;
-        return x*x + x + x + 1.0;
-    }
-    return 0.0;
-}
-
 Oscillator::Oscillator(double sampleRate) :
     syncSource(nullptr),
     ringSource(nullptr),
     noiseLFSR(0x7FFFFF),
     sampleRate(sampleRate),
-    phase(0.0),
     sidClockFrequency(0.0),
     frequency(0.0),
     pulseWidth(0.5),
+    pulseWidth24(0x800000),
     phaseOverflow(false),
     control(0),
     accumulator24(0),
@@ -90,12 +76,11 @@ uint16_t Oscillator::applyCombinedWaveformModel(uint16_t mixedBits) const
 void Oscillator::setAccumulator24(uint32_t value)
 {
     accumulator24 = value & 0x00FFFFFF;
-    phase = static_cast<double>(accumulator24) / 16777216.0;
 }
 
 void Oscillator::setPhase(double value)
 {
-    phase = value - std::floor(value);
+    const double phase = value - std::floor(value);
 
     accumulator24 =
         static_cast<uint32_t>(std::clamp(phase, 0.0, 0.999999999) * 16777216.0)
@@ -110,9 +95,14 @@ void Oscillator::setSIDClockFrequency(double clockFrequency)
         (static_cast<double>(frequencyReg) * sidClockFrequency) / 16777216.0;
 }
 
+void Oscillator::setPulseWidth(double width)
+{
+    pulseWidth = width;
+    pulseWidth24 = static_cast<uint32_t>(std::clamp(pulseWidth, 0.0, 1.0) * 16777216.0);
+}
+
 void Oscillator::resetPhase()
 {
-    phase = 0.0;
     accumulator24 = 0;
     phaseOverflow = false;
 }
@@ -248,15 +238,8 @@ std::string Oscillator::describeWaveformSelection() const
     return out.str();
 }
 
-double Oscillator::generateMixedSample()
-{
-    updatePhase();
-    return outputSample();
-}
-
 void Oscillator::reset()
 {
-    phase = 0.0;
     accumulator24 = 0;
     noiseLFSR = 0x7FFFFF;
     phaseOverflow = false;
@@ -279,7 +262,7 @@ uint16_t Oscillator::getAccumulatorTriangle12() const
 
     if ((control & 0x04) && ringSource)
     {
-        if (ringSource->getAccumulatorPhase() >= 0.5)
+        if (ringSource->getAccumulator24() & 0x00800000)
             tri ^= 0x0FFF;
     }
 
@@ -288,10 +271,7 @@ uint16_t Oscillator::getAccumulatorTriangle12() const
 
 uint16_t Oscillator::getAccumulatorPulse12() const
 {
-    const uint32_t pw24 =
-        static_cast<uint32_t>(std::clamp(pulseWidth, 0.0, 1.0) * 16777216.0);
-
-    return ((accumulator24 & 0x00FFFFFF) < pw24) ? 0x0FFF : 0x0000;
+    return ((accumulator24 & 0x00FFFFFF) < pulseWidth24) ? 0x0FFF : 0x0000;
 }
 
 uint8_t Oscillator::getNoiseOutput8() const
@@ -351,19 +331,9 @@ uint16_t Oscillator::getNoiseBits()
     return getNoiseOutput12();
 }
 
-void Oscillator::updatePhase()
-{
-    const double sidCyclesThisSample =
-        (sampleRate > 0.0 && sidClockFrequency > 0.0)
-            ? (sidClockFrequency / sampleRate)
-            : 1.0;
-
-    clock(sidCyclesThisSample);
-}
-
-void Oscillator::clock(double sidCycles)
+void Oscillator::clock(uint32_t sidCycles)
 {
-    if (sidCycles <= 0.0)
+    if (sidCycles == 0)
         return;
 
     if (control & 0x08)
@@ -373,57 +343,30 @@ void Oscillator::clock(double sidCycles)
         return;
     }
 
-    phaseOverflow = false;
+    // All wraps of the batch at once, the 24-bit sum can pass 2^24 several times
+    const uint64_t sum =
+        static_cast<uint64_t>(accumulator24) + static_cast<uint64_t>(frequencyReg) * sidCycles;
 
-    const uint32_t fullCycles =
-        static_cast<uint32_t>(std::floor(sidCycles));
+    uint32_t overflows = static_cast<uint32_t>(sum >> 24);
+    accumulator24 = static_cast<uint32_t>(sum) & 0x00FFFFFF;
 
-    const double fractionalCycles =
-        sidCycles - static_cast<double>(fullCycles);
+    // Sync targets look at the last cycle only, it wrapped if the final add did
+    phaseOverflow = overflows != 0 && accumulator24 < frequencyReg;
 
-    for (uint32_t i = 0; i < fullCycles; ++i)
+    if (control & 0x80)
     {
-        if ((control & 0x02) && syncSource && syncSource->getPhaseOverflow())
-        {
-            resetPhase();
-        }
-
-        const uint32_t oldAcc = accumulator24 & 0x00FFFFFF;
-        accumulator24 = (accumulator24 + frequencyReg) & 0x00FFFFFF;
-
-        const bool overflow = accumulator24 < oldAcc;
-
-        if (overflow)
-        {
-            phaseOverflow = true;
-
-            if (control & 0x80)
-                clockNoiseLFSR();
-        }
+        while (overflows-- > 0)
+            clockNoiseLFSR();
     }
+}
 
-    if (fractionalCycles > 0.0)
-    {
-        const uint32_t oldAcc = accumulator24 & 0x00FFFFFF;
-
-        const double next =
-            static_cast<double>(oldAcc) +
-            (static_cast<double>(frequencyReg) * fractionalCycles);
-
-        accumulator24 =
-            static_cast<uint32_t>(std::fmod(next, 16777216.0)) & 0x00FFFFFF;
-
-        if (accumulator24 < oldAcc)
-        {
-            phaseOverflow = true;
-
-            if (control & 0x80)
-                clockNoiseLFSR();
-        }
-    }
+uint32_t Oscillator::cyclesToOverflow() const
+{
+    if ((control & 0x08) || frequencyReg == 0)
+        return UINT32_MAX;
 
-    phase =
-        static_cast<double>(accumulator24 & 0x00FFFFFF) / 16777216.0;
+    const uint32_t toWrap = 0x01000000 - (accumulator24 & 0x00FFFFFF);
+    return (toWrap + frequencyReg - 1) / frequencyReg;
 }
 
 double Oscillator::outputSample()
@@ -487,7 +430,7 @@ std::string Oscillator::dumpDebug(uint16_t freqReg, uint16_t pulseWidthReg) cons
 {
     std::ostringstream out;
 
-    const double phaseWrapped = phase - std::floor(phase);
+    const double phaseWrapped = getAccumulatorPhase();
     const double dutyPercent = pulseWidth * 100.0;
 
     const bool tri   = (control & 0x10) != 0;
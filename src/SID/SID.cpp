@@ -9,6 +9,7 @@
 #include "DataBusLatch.h"
 #include "Vic.h"
 #include "SID/SID.h"
+#include "SID/SIDThread.h"
 
 SID::SID(double sampleRate) :
     sidModel_(SIDModel::MOS6581),
@@ -21,17 +22,28 @@ SID::SID(double sampleRate) :
     mode_(VideoMode::NTSC), // default to NTSC
     hpPrevIn(0.0),
     hpPrevOut(0.0),
-    lastOutputSample(0.0),
-    underrunOutputSample(0.0),
-    recoveryStartSample(0.0),
+    lastOutputSample{0.0, 0.0},
+    underrunOutputSample{0.0, 0.0},
+    recoveryStartSample{0.0, 0.0},
     audioWasUnderrunning(false),
     underrunRecoverySamples(0),
     sampleRate(sampleRate),
-    sidCycleCounter(0.0),
+    sampleClock(0),
+    sampleClockPeriod(0),
+    pendingCycles(0),
+    cyclesUntilSync(1),
+    audioMuted(false),
+    blockFill(0),
     voice1(sampleRate),
     voice2(sampleRate),
     voice3(sampleRate),
-    filterobj(sampleRate)
+    filterobj(sampleRate),
+    threadCycle(0),
+    threadTarget(0),
+    owner(nullptr),
+    linkIndex(0),
+    pan(0.0),
+    stereo(false)
 {
     // Zero initialize all registers in the SID structure.
     std::memset(&sidRegisters, 0, sizeof(sidRegisters));
@@ -40,12 +52,22 @@ SID::SID(double sampleRate) :
     setSIDModel(SIDModel::MOS6581);
 
     configureOscillatorSources();
+    updatePanGains();
 }
 
 SID::~SID() = default;
 
 void SID::saveState(StateWriter& wrtr) const
 {
+    if (SID* chip = haltAudioThread())
+    {
+        // The audio thread's chip is the complete one, the bus latch lives here
+        chip->sync();
+        chip->takeBusLatch(*this);
+        chip->saveState(wrtr);
+        return;
+    }
+
     // SID0 = "core" and registers
     wrtr.beginChunk("SID0");
 
@@ -92,7 +114,7 @@ void SID::saveState(StateWriter& wrtr) const
     wrtr.writeU8(static_cast<uint8_t>(sidModel_));
 
     // Dump fractional accumulator
-    wrtr.writeF64(sidCycleCounter);
+    wrtr.writeF64(static_cast<double>(sampleClock) / static_cast<double>(1ull << SAMPLE_CLOCK_FRACTION_BITS));
 
     // Dump High pass filter history
     wrtr.writeF64(hpPrevIn);
@@ -151,10 +173,33 @@ void SID::saveState(StateWriter& wrtr) const
 
     // End the chunk
     wrtr.endChunk();
+
+    if (linkedChips.empty())
+        return;
+
+    // SIDL = Linked chips, each with its own SID0/SIDX chunks
+    wrtr.beginChunk("SIDL");
+
+    wrtr.writeU8(static_cast<uint8_t>(linkedChips.size()));
+    for (const LinkedChip& link : linkedChips)
+    {
+        wrtr.writeU16(link.baseAddress);
+        wrtr.writeF64(link.chip->pan);
+        link.chip->saveState(wrtr);
+    }
+
+    wrtr.endChunk();
 }
 
 bool SID::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
 {
+    // Both chips read the same chunk, each enters its payload from the start
+    if (SID* chip = haltAudioThread())
+    {
+        if (!chip->loadState(chunk, rdr))
+            return false;
+    }
+
     if (std::memcmp(chunk.tag, "SID0", 4) == 0)
     {
         rdr.enterChunkPayload(chunk);
@@ -222,6 +267,7 @@ bool SID::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
             updateCutoffFromRegisters();
             filterobj.setMode((sidRegisters.filter.volume >> 4) & 0x07);
             filterobj.setResonance(sidRegisters.filter.resonanceControl);
+            updateOutputRouting();
         }
         rdr.exitChunkPayload(chunk);
         return true;
@@ -231,6 +277,9 @@ bool SID::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
     {
         rdr.enterChunkPayload(chunk);
 
+        // Cycles owed from before the load belong to the old state
+        pendingCycles = 0;
+
         if (!rdr.readU8(sidBusLatch))                       { rdr.exitChunkPayload(chunk); return false; }
         if (!rdr.readU32(sidBusDecayCycles))                { rdr.exitChunkPayload(chunk); return false; }
 
@@ -244,7 +293,15 @@ bool SID::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
         sidModel_ = static_cast<SIDModel>(sidModeU8);
         setSIDModel(sidModel_);
 
-        if (!rdr.readF64(sidCycleCounter))                  { rdr.exitChunkPayload(chunk); return false; }
+        double sampleCycles = 0.0;
+        if (!rdr.readF64(sampleCycles))                     { rdr.exitChunkPayload(chunk); return false; }
+
+        sampleClock = static_cast<uint64_t>(std::max(0.0, sampleCycles) * static_cast<double>(1ull << SAMPLE_CLOCK_FRACTION_BITS));
+
+        if (sampleClockPeriod > 0)
+            sampleClock %= sampleClockPeriod;
+
+        scheduleNextSync();
 
         if (!rdr.readF64(hpPrevIn))                         { rdr.exitChunkPayload(chunk); return false; }
         if (!rdr.readF64(hpPrevOut))                        { rdr.exitChunkPayload(chunk); return false; }
@@ -319,6 +376,51 @@ bool SID::loadState(const StateReader::Chunk& chunk, StateReader& rdr)
         return true;
     }
 
+    if (std::memcmp(chunk.tag, "SIDL", 4) == 0)
+    {
+        rdr.enterChunkPayload(chunk);
+
+        uint8_t count = 0;
+        if (!rdr.readU8(count))                             { rdr.exitChunkPayload(chunk); return false; }
+
+        for (uint8_t i = 0; i < count; ++i)
+        {
+            uint16_t baseAddress = 0;
+            double chipPan = 0.0;
+            if (!rdr.readU16(baseAddress))                  { rdr.exitChunkPayload(chunk); return false; }
+            if (!rdr.readF64(chipPan))                      { rdr.exitChunkPayload(chunk); return false; }
+
+            // A chip that is not configured now is skipped
+            SID* chip = nullptr;
+            for (LinkedChip& link : linkedChips)
+            {
+                if (link.baseAddress == baseAddress)
+                    chip = link.chip.get();
+            }
+
+            for (int part = 0; part < 2; ++part)
+            {
+                StateReader::Chunk sub{};
+                if (!rdr.nextChunk(sub))                    { rdr.exitChunkPayload(chunk); return false; }
+
+                if (chip)
+                {
+                    if (!chip->loadState(sub, rdr))         { rdr.exitChunkPayload(chunk); return false; }
+                }
+                else
+                    rdr.skipChunk(sub);
+            }
+
+            if (chip)
+                chip->pan = std::clamp(chipPan, -1.0, 1.0);
+        }
+
+        updatePanGains();
+
+        rdr.exitChunkPayload(chunk);
+        return true;
+    }
+
     // Unknown chunk tag for SID
     return false;
 }
@@ -330,6 +432,8 @@ double SID::getSidCyclesPerAudioSample() const
 
 void SID::setMode(VideoMode mode)
 {
+    sync();
+
     mode_ = mode;
 
     if (mode_ == VideoMode::NTSC)
@@ -341,7 +445,7 @@ void SID::setMode(VideoMode mode)
         sidClockFrequency = 985248.0;  // PAL SID clock frequency (Hz)
     }
 
-    sidCyclesPerAudioSample = sidClockFrequency / sampleRate;
+    updateSampleClockPeriod();
 
     // Update the voices
     voice1.setSIDClockFrequency(sidClockFrequency);
@@ -350,6 +454,12 @@ void SID::setMode(VideoMode mode)
 
     // Update the filter
     filterobj.setSIDClockFrequency(sidClockFrequency);
+
+    for (LinkedChip& link : linkedChips)
+        link.chip->setMode(mode);
+
+    if (SID* chip = haltAudioThread())
+        chip->setMode(mode);
 }
 
 void SID::setSIDModel(SIDModel model)
@@ -362,25 +472,67 @@ void SID::setSIDModel(SIDModel model)
 
     filterobj.setModel(model);
     updateCutoffFromRegisters();
+
+    analogProfile = getAnalogProfile();
+    mixerobj.setGains(analogProfile.filterInputGain, analogProfile.directGain);
+
+    if (SID* chip = haltAudioThread())
+        chip->setSIDModel(model);
 }
 
 void SID::setSampleRate(double sample)
 {
+    sync();
+
     sampleRate = sample;
-    sidCyclesPerAudioSample = sidClockFrequency / sampleRate;
-
-    // Propagate out
-    voice1.getOscillator().setSampleRate(sample);
-    voice2.getOscillator().setSampleRate(sample);
-    voice3.getOscillator().setSampleRate(sample);
-    filterobj.setSampleRate(sample);
-    voice1.getEnvelope().setSampleRate(sample);
-    voice2.getEnvelope().setSampleRate(sample);
-    voice3.getEnvelope().setSampleRate(sample);
+    updateSampleClockPeriod();
+
+    applyOversampledRate();
+
+    for (LinkedChip& link : linkedChips)
+        link.chip->setSampleRate(sample);
+
+    if (SID* chip = haltAudioThread())
+        chip->setSampleRate(sample);
+}
+
+void SID::setResamplerQuality(SIDResampler::Quality quality)
+{
+    sync();
+
+    resampler.setQuality(quality);
+    resamplerRight.setQuality(quality);
+    updateSampleClockPeriod();
+    applyOversampledRate();
+
+    // Linked chips only take the oversampling factor, their voices run at this chip's sample points
+    for (LinkedChip& link : linkedChips)
+        link.chip->setResamplerQuality(quality);
+
+    if (SID* chip = haltAudioThread())
+        chip->setResamplerQuality(quality);
+}
+
+void SID::applyOversampledRate()
+{
+    // The voices and the filter run at the oversampled rate
+    const double rate = sampleRate * static_cast<double>(resampler.getFactor());
+
+    voice1.getOscillator().setSampleRate(rate);
+    voice2.getOscillator().setSampleRate(rate);
+    voice3.getOscillator().setSampleRate(rate);
+    filterobj.setSampleRate(rate);
+    voice1.getEnvelope().setSampleRate(rate);
+    voice2.getEnvelope().setSampleRate(rate);
+    voice3.getEnvelope().setSampleRate(rate);
 }
 
 uint8_t SID::readRegister(uint16_t address)
 {
+    // A linked chip's bus latch only decays when its owner runs the batch
+    if (owner)
+        owner->sync();
+
     uint8_t value = sidBusLatch;
 
     switch (address)
@@ -404,6 +556,7 @@ uint8_t SID::readRegister(uint16_t address)
         // OSC3
         case 0xD41B:
         {
+            sync();
             value = voice3.getOscillator().readOutput8();
             break;
         }
@@ -411,6 +564,7 @@ uint8_t SID::readRegister(uint16_t address)
         // ENV3
         case 0xD41C:
         {
+            sync();
             value = voice3.getEnvelope().readOutput8();
             break;
         }
@@ -433,6 +587,9 @@ uint8_t SID::readRegister(uint16_t address)
 
 void SID::writeRegister(uint16_t address, uint8_t value)
 {
+    // The voices have to reach this cycle before the write changes them
+    sync();
+
     sidBusLatch = value;
     refreshDataBusDecay();
 
@@ -442,6 +599,12 @@ void SID::writeRegister(uint16_t address, uint8_t value)
                 vicII ? vicII->getRasterDot() : 0);
         traceMgr->recordSidWrite(address & 0x1F, value, stamp);
     }
+
+    // The audio thread replays the write at the same cycle, the voices here follow it for OSC3/ENV3
+    SID* host = owner ? owner : this;
+    if (host->audioThread)
+        host->postToAudioThread(linkIndex, static_cast<uint8_t>(address & 0x1F), value);
+
     switch(address)
     {
         case 0xD400:
@@ -653,6 +816,7 @@ void SID::writeRegister(uint16_t address, uint8_t value)
             //   resonance
             sidRegisters.filter.resonanceControl = value;
             filterobj.setResonance(value);
+            updateOutputRouting();
             break;
         }
         case 0xD418:
@@ -673,6 +837,7 @@ void SID::writeRegister(uint16_t address, uint8_t value)
 
             const uint8_t filterMode = (value >> 4) & 0x07;
             filterobj.setMode(filterMode);
+            updateOutputRouting();
             break;
         }
         case 0xD419:
@@ -698,99 +863,159 @@ void SID::writeRegister(uint16_t address, uint8_t value)
     }
 }
 
-double SID::generateAudioSample()
+void SID::renderBlock()
 {
-    const AnalogProfile profile = getAnalogProfile();
+    const size_t count = blockFill;
+    blockFill = 0;
 
-    const uint8_t resFilt = sidRegisters.filter.resonanceControl;
-    const uint8_t modeVol = sidRegisters.filter.volume;
+    // Straight into the resampler's input, which always has room for a block after process()
+    float* left = resampler.inputBlock();
+    renderChipBlock(count, left);
 
-    // $D417 bits 0-2 select which voices enter the filter.
-    const uint8_t filterRouteBits = resFilt & 0x07;
+    if (stereo)
+    {
+        // Pan every chip into both channels
+        float* right = resamplerRight.inputBlock();
 
-    // $D418 bits 4-6 select LP/BP/HP output modes.
-    const uint8_t filterMode = (modeVol >> 4) & 0x07;
+        for (size_t i = 0; i < count; ++i)
+        {
+            right[i] = left[i] * rightGain[0];
+            left[i] *= leftGain[0];
+        }
 
-    // $D418 bit 7 disconnects voice 3 from the direct audio path.
-    const bool voice3DirectOff = (modeVol & 0x80) != 0;
+        float chipOut[SIDResampler::BLOCK_SIZE];
 
-    filterobj.setMode(filterMode);
+        for (size_t k = 0; k < linkedChips.size(); ++k)
+        {
+            linkedChips[k].chip->renderChipBlock(count, chipOut);
 
-    constexpr double PER_VOICE_GAIN = 0.5;
+            const float gainLeft = leftGain[k + 1];
+            const float gainRight = rightGain[k + 1];
 
-    double filteredMixRaw = 0.0;
-    double unfilteredMixRaw = 0.0;
-    bool anyFilteredVoice = false;
+            for (size_t i = 0; i < count; ++i)
+            {
+                left[i] += chipOut[i] * gainLeft;
+                right[i] += chipOut[i] * gainRight;
+            }
+        }
 
-    for (int i = 0; i < 3; ++i)
-    {
-        Voice* v = (i == 0) ? &voice1 : (i == 1) ? &voice2 : &voice3;
+        resamplerRight.commit(count);
+    }
 
-        const bool routedToFilter = (filterRouteBits & (1 << i)) != 0;
-        v->setFilterRouted(routedToFilter);
+    resampler.commit(count);
 
-        const double s = v->generateVoiceSample() * PER_VOICE_GAIN;
+    float block[SIDResampler::BLOCK_SIZE];
+    float blockRight[SIDResampler::BLOCK_SIZE];
+    const size_t produced = resampler.process(block);
 
-        if (routedToFilter)
-        {
-            filteredMixRaw += s;
-            anyFilteredVoice = true;
-        }
-        else
+    // Both resamplers are in the same phase, so they keep the same samples
+    if (stereo)
+        resamplerRight.process(blockRight);
+
+    for (size_t i = 0; i < produced; ++i)
+    {
+        if (audioBuf.push(AudioFrame{ block[i], stereo ? blockRight[i] : block[i] }))
         {
-            if (!(i == 2 && voice3DirectOff))
-                unfilteredMixRaw += s;
+            audioGeneratedSamples.fetch_add(1, std::memory_order_relaxed);
+            audioBufferedSamples.fetch_add(1, std::memory_order_relaxed);
         }
     }
+}
 
-    filteredMixRaw = std::clamp(filteredMixRaw, -1.0, 1.0);
-    unfilteredMixRaw = std::clamp(unfilteredMixRaw, -1.0, 1.0);
+void SID::renderChipBlock(size_t count, float* out)
+{
+    const AnalogProfile& profile = analogProfile;
+    const uint8_t modeVol = sidRegisters.filter.volume;
 
-    const double filteredMix =
-        filteredMixRaw * profile.filterInputGain;
+    // $D418 bits 4-6 select LP/BP/HP output modes.
+    const uint8_t filterMode = (modeVol >> 4) & 0x07;
 
-    const double unfilteredMix =
-        unfilteredMixRaw * profile.directGain;
+    float filtered[SIDResampler::BLOCK_SIZE];
+    float direct[SIDResampler::BLOCK_SIZE];
 
-    double filteredOut = 0.0;
+    const float* const voices[3] = { voiceBlock[0].data(), voiceBlock[1].data(), voiceBlock[2].data() };
+    mixerobj.mixBlock(voices, count, filtered, direct);
 
-    if (anyFilteredVoice)
+    // The filter only runs while a voice is routed through it
+    float filterOutputGain = 0.0f;
+    if (mixerobj.anyFiltered())
     {
-        const double filterResult = filterobj.processSample(filteredMix);
+        filterobj.processBlock(filtered, filtered, count);
 
         if (filterMode != 0)
-            filteredOut = filterResult * profile.filterOutputGain;
+            filterOutputGain = static_cast<float>(profile.filterOutputGain);
     }
 
-    double mixed = filteredOut + unfilteredMix;
-
     const uint8_t volumeNibble = modeVol & 0x0F;
-    const double masterVol = static_cast<double>(volumeNibble) / 15.0;
+    const float masterVol = static_cast<float>(volumeNibble) / 15.0f;
 
-    mixed *= masterVol;
+    // $D418 volume DAC behavior differs strongly between 6581 and 8580,
+    // and the 6581 has more analog bias / character than the 8580.
+    const float volumeDacCentered = (static_cast<float>(volumeNibble) - 7.5f) / 7.5f;
+    const float offset = static_cast<float>(volumeDacCentered * profile.volumeDacGain + profile.outputBias);
+    const float softClipDrive = static_cast<float>(profile.softClipDrive);
 
-    // $D418 volume DAC behavior differs strongly between 6581 and 8580.
-    const double volumeDacCentered =
-        (static_cast<double>(volumeNibble) - 7.5) / 7.5;
+    for (size_t i = 0; i < count; ++i)
+    {
+        float mixed = filtered[i] * filterOutputGain + direct[i];
+        mixed = mixed * masterVol + offset;
 
-    mixed += volumeDacCentered * profile.volumeDacGain;
+        // Model-specific analog saturation.
+        mixed = std::min(std::max(mixed * softClipDrive, -1.5f), 1.5f);
+        out[i] = mixed / (1.0f + std::abs(mixed));
+    }
+
+    // DC high pass, recursive, the only part left per sample
+    float hpIn = static_cast<float>(hpPrevIn);
+    float hpOut = static_cast<float>(hpPrevOut);
+    constexpr float alpha = static_cast<float>(HP_ALPHA);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        hpOut = alpha * (hpOut + out[i] - hpIn);
+        hpIn = out[i];
+        out[i] = hpOut;
+    }
 
-    // 6581 has more analog bias / character than 8580.
-    mixed += profile.outputBias;
+    hpPrevIn = hpIn;
+    hpPrevOut = hpOut;
+}
 
-    // Model-specific analog saturation.
-    mixed *= profile.softClipDrive;
-    mixed = std::clamp(mixed, -1.5, 1.5);
-    mixed = mixed / (1.0 + std::abs(mixed));
+void SID::updateOutputRouting()
+{
+    // $D417 bits 0-2 select which voices enter the filter,
+    // $D418 bit 7 disconnects voice 3 from the direct audio path.
+    const uint8_t filterRouteBits = sidRegisters.filter.resonanceControl & 0x07;
 
-    const double hp = HP_ALPHA * (hpPrevOut + mixed - hpPrevIn);
-    hpPrevIn  = mixed;
-    hpPrevOut = hp;
+    mixerobj.setRouting(filterRouteBits, (sidRegisters.filter.volume & 0x80) != 0);
 
-    return hp;
+    voice1.setFilterRouted((filterRouteBits & 0x01) != 0);
+    voice2.setFilterRouted((filterRouteBits & 0x02) != 0);
+    voice3.setFilterRouted((filterRouteBits & 0x04) != 0);
 }
 
 void SID::tick(uint32_t cycles)
+{
+    decayDataBus(cycles);
+
+    pendingCycles += cycles;
+
+    if (audioThread)
+    {
+        threadCycle += cycles;
+
+        if (threadCycle >= threadTarget)
+        {
+            audioThread->runTo(threadCycle);
+            threadTarget = threadCycle + SIDThread::BATCH_CYCLES;
+        }
+    }
+
+    if (pendingCycles >= cyclesUntilSync)
+        sync();
+}
+
+void SID::decayDataBus(uint32_t cycles)
 {
     if (sidBusDecayCycles > cycles)
         sidBusDecayCycles -= cycles;
@@ -799,46 +1024,437 @@ void SID::tick(uint32_t cycles)
         sidBusDecayCycles = 0;
         sidBusLatch = 0x00;
     }
+}
+
+void SID::sync()
+{
+    // A linked chip runs in its owner's batches
+    if (owner)
+    {
+        owner->sync();
+        return;
+    }
 
-    const double sidCycles = static_cast<double>(cycles);
+    uint32_t cycles = pendingCycles;
+    pendingCycles = 0;
 
-    voice1.clockEnvelope(sidCycles);
-    voice2.clockEnvelope(sidCycles);
-    voice3.clockEnvelope(sidCycles);
+    for (LinkedChip& link : linkedChips)
+        link.chip->decayDataBus(cycles);
 
-    voice1.clockOscillator(sidCycles);
-    voice2.clockOscillator(sidCycles);
-    voice3.clockOscillator(sidCycles);
+    if (audioThread)
+        audioThread->runTo(threadCycle);
 
-    sidCycleCounter += sidCycles;
+    const bool producing = !audioMuted && !audioThread && sampleClockPeriod > 0;
 
-    if (sidCyclesPerAudioSample <= 0.0)
+    while (cycles > 0)
+    {
+        uint32_t run = cycles;
+
+        // Stop at each sample point so the sample sees the voices as of that cycle
+        if (producing)
+        {
+            const uint64_t toSample =
+                (sampleClockPeriod - sampleClock + (1ull << SAMPLE_CLOCK_FRACTION_BITS) - 1) >> SAMPLE_CLOCK_FRACTION_BITS;
+
+            run = static_cast<uint32_t>(std::min<uint64_t>(run, std::max<uint64_t>(1, toSample)));
+        }
+
+        clockVoices(run);
+        for (LinkedChip& link : linkedChips)
+            link.chip->clockVoices(run);
+
+        cycles -= run;
+
+        if (!producing)
+            continue;
+
+        sampleClock += static_cast<uint64_t>(run) << SAMPLE_CLOCK_FRACTION_BITS;
+
+        while (sampleClock >= sampleClockPeriod)
+        {
+            sampleClock -= sampleClockPeriod;
+
+            // Only the voices are sampled here, the output stage runs over the whole block
+            captureVoices(blockFill);
+            for (LinkedChip& link : linkedChips)
+                link.chip->captureVoices(blockFill);
+
+            if (++blockFill == SIDResampler::BLOCK_SIZE)
+                renderBlock();
+        }
+    }
+
+    // Whatever the block holds so far, so the samples are there when the chip is synced from outside
+    if (producing)
+        renderBlock();
+
+    scheduleNextSync();
+}
+
+void SID::captureVoices(size_t index)
+{
+    voiceBlock[0][index] = static_cast<float>(voice1.generateVoiceSample());
+    voiceBlock[1][index] = static_cast<float>(voice2.generateVoiceSample());
+    voiceBlock[2][index] = static_cast<float>(voice3.generateVoiceSample());
+}
+
+void SID::scheduleNextSync()
+{
+    if (audioMuted || audioThread || sampleClockPeriod == 0)
+    {
+        cyclesUntilSync = MAX_PENDING_CYCLES;
         return;
+    }
+
+    // Run in one batch until the resampler block is full
+    const uint64_t toBlockEnd =
+        (sampleClockPeriod * (SIDResampler::BLOCK_SIZE - blockFill) - std::min(sampleClock, sampleClockPeriod) + (1ull << SAMPLE_CLOCK_FRACTION_BITS) - 1) >> SAMPLE_CLOCK_FRACTION_BITS;
+
+    cyclesUntilSync = static_cast<uint32_t>(std::clamp<uint64_t>(toBlockEnd, 1, MAX_PENDING_CYCLES));
+}
+
+void SID::updateSampleClockPeriod()
+{
+    sidCyclesPerAudioSample = (sampleRate > 0.0) ? (sidClockFrequency / sampleRate) : 0.0;
+
+    sampleClockPeriod =
+        static_cast<uint64_t>(std::llround(sidCyclesPerAudioSample * static_cast<double>(1ull << SAMPLE_CLOCK_FRACTION_BITS) /
+            static_cast<double>(resampler.getFactor())));
+
+    if (sampleClockPeriod > 0)
+        sampleClock %= sampleClockPeriod;
+
+    scheduleNextSync();
+}
+
+void SID::clockVoices(uint32_t cycles)
+{
+    // With the audio thread running only ENV3 is readable here
+    if (!isShadowOnly())
+    {
+        voice1.clockEnvelope(cycles);
+        voice2.clockEnvelope(cycles);
+    }
+    voice3.clockEnvelope(cycles);
 
-    size_t samplesToPush = static_cast<size_t>(sidCycleCounter / sidCyclesPerAudioSample);
-    sidCycleCounter -= samplesToPush * sidCyclesPerAudioSample;
+    clockOscillators(cycles);
+}
+
+bool SID::isShadowOnly() const
+{
+    return audioThread || (owner && owner->audioThread);
+}
 
-    for (size_t i = 0; i < samplesToPush; ++i)
+void SID::clockOscillators(uint32_t cycles)
+{
+    Oscillator* const oscillators[3] =
+    {
+        &voice1.getOscillator(),
+        &voice2.getOscillator(),
+        &voice3.getOscillator()
+    };
+
+    while (cycles > 0)
     {
-        double sample = generateAudioSample();
+        // Hard sync can only fire on the cycle a source wraps, run all three up to the next such cycle
+        uint32_t run = cycles;
 
-        if (audioBuf.push(sample))
+        for (const Oscillator* osc : oscillators)
         {
-            audioGeneratedSamples.fetch_add(1, std::memory_order_relaxed);
-            audioBufferedSamples.fetch_add(1, std::memory_order_relaxed);
+            if (osc->isSyncEnabled())
+                run = std::min(run, osc->getSyncSource()->cyclesToOverflow());
+        }
+
+        for (Oscillator* osc : oscillators)
+            osc->clock(run);
+
+        for (Oscillator* osc : oscillators)
+        {
+            if (osc->isSyncEnabled() && osc->getSyncSource()->getPhaseOverflow())
+                osc->hardSync();
         }
+
+        cycles -= run;
     }
 }
 
-double SID::popSample()
+void SID::setAudioMuted(bool muted)
+{
+    if (muted == audioMuted)
+        return;
+
+    sync();
+
+    audioMuted = muted;
+
+    if (SID* chip = haltAudioThread())
+    {
+        chip->setAudioMuted(muted);
+        return;
+    }
+
+    // Drop the stale cushion, the output rebuilds it after warp
+    blockFill = 0;
+    resampler.reset();
+    resamplerRight.reset();
+    audioBuf.clear();
+    audioBufferedSamples.store(0, std::memory_order_relaxed);
+    sampleClock = 0;
+    scheduleNextSync();
+}
+
+void SID::setAudioThread(bool enabled)
+{
+    if (enabled == (audioThread != nullptr))
+        return;
+
+    sync();
+
+    if (enabled)
+    {
+        // Start the audio thread's chip where this one is now
+        if (!synth)
+            synth = std::make_unique<SID>(sampleRate);
+
+        copyChipState(*this, *synth);
+        synth->setAudioMuted(audioMuted);
+        synth->audioBuf.clear();
+        synth->audioBufferedSamples.store(0, std::memory_order_relaxed);
+
+        threadCycle = 0;
+        threadTarget = SIDThread::BATCH_CYCLES;
+        audioThread = std::make_unique<SIDThread>(*synth, threadCycle);
+        threadedOutput.store(true, std::memory_order_release);
+        scheduleNextSync();
+        return;
+    }
+
+    SID* chip = haltAudioThread();
+    audioThread.reset();
+
+    // Take back the complete state, the voices here only kept up with voice 3
+    chip->sync();
+    chip->takeBusLatch(*this);
+    copyChipState(*chip, *this);
+
+    audioBuf.clear();
+    audioBufferedSamples.store(0, std::memory_order_relaxed);
+    threadedOutput.store(false, std::memory_order_release);
+}
+
+bool SID::addLinkedChip(uint16_t baseAddress, SIDModel model, double pan)
+{
+    if (owner || linkedChips.size() >= MAX_LINKED_CHIPS)
+        return false;
+
+    // 32 byte windows in the SID area above the first chip or in the I/O expansion area
+    const bool sidArea = baseAddress >= 0xD420 && baseAddress <= 0xD7E0;
+    const bool ioArea = baseAddress >= 0xDE00 && baseAddress <= 0xDFE0;
+    if ((baseAddress & 0x1F) != 0 || (!sidArea && !ioArea))
+        return false;
+
+    for (const LinkedChip& link : linkedChips)
+    {
+        if (link.baseAddress == baseAddress)
+            return false;
+    }
+
+    // The audio thread's chip gets the new one when the thread is back
+    const bool threaded = audioThread != nullptr;
+    if (threaded)
+        setAudioThread(false);
+
+    sync();
+
+    auto chip = std::make_unique<SID>(sampleRate);
+    chip->owner = this;
+    chip->linkIndex = static_cast<uint8_t>(linkedChips.size() + 1);
+    chip->attachCPUInstance(processor);
+    chip->attachDataBusLatchInstance(dataBus);
+    chip->attachTraceManagerInstance(traceMgr);
+    chip->attachVicInstance(vicII);
+    chip->setMode(mode_);
+    chip->setResamplerQuality(resampler.getQuality());
+    chip->setSIDModel(model);
+    chip->reset();
+    chip->pan = std::clamp(pan, -1.0, 1.0);
+
+    // The right channel starts from the history the mono output had
+    if (linkedChips.empty())
+        resamplerRight = resampler;
+
+    linkedChips.push_back(LinkedChip{ std::move(chip), baseAddress });
+    updatePanGains();
+
+    if (threaded)
+        setAudioThread(true);
+
+    return true;
+}
+
+void SID::setPan(double pan)
+{
+    this->pan = std::clamp(pan, -1.0, 1.0);
+
+    SID* host = owner ? owner : this;
+    host->updatePanGains();
+
+    if (SID* chip = host->haltAudioThread())
+    {
+        SID* mirror = owner ? chip->linkedChips[linkIndex - 1].chip.get() : chip;
+        mirror->setPan(this->pan);
+    }
+}
+
+void SID::updatePanGains()
+{
+    // Constant gain toward the centre, a chip panned hard to one side is silent on the other
+    const auto gains = [](double p, float& left, float& right)
+    {
+        left = static_cast<float>(std::min(1.0, 1.0 - p));
+        right = static_cast<float>(std::min(1.0, 1.0 + p));
+    };
+
+    gains(pan, leftGain[0], rightGain[0]);
+
+    float sumLeft = leftGain[0];
+    float sumRight = rightGain[0];
+
+    for (size_t k = 0; k < linkedChips.size(); ++k)
+    {
+        gains(linkedChips[k].chip->pan, leftGain[k + 1], rightGain[k + 1]);
+        sumLeft += leftGain[k + 1];
+        sumRight += rightGain[k + 1];
+    }
+
+    // Leave the sum of the chips the headroom of one
+    const float scale = 1.0f / std::max({ 1.0f, sumLeft, sumRight });
+    for (size_t k = 0; k <= linkedChips.size(); ++k)
+    {
+        leftGain[k] *= scale;
+        rightGain[k] *= scale;
+    }
+
+    // A single chip stays mono, its pan only counts next to others
+    stereo = !linkedChips.empty();
+}
+
+SID* SID::chipForAddress(uint16_t address)
+{
+    const uint16_t baseAddress = address & 0xFFE0;
+
+    for (LinkedChip& link : linkedChips)
+    {
+        if (link.baseAddress == baseAddress)
+            return link.chip.get();
+    }
+
+    // The first chip is mirrored through the rest of $D400-$D7FF
+    return (address >= 0xD400 && address <= 0xD7FF) ? this : nullptr;
+}
+
+SID* SID::haltAudioThread() const
+{
+    if (!audioThread)
+        return nullptr;
+
+    audioThread->waitFor(threadCycle);
+    return synth.get();
+}
+
+void SID::postToAudioThread(uint8_t chipIndex, uint8_t reg, uint8_t value)
+{
+    if (!audioThread->postWrite(threadCycle, chipIndex, reg, value))
+    {
+        audioThread->waitFor(threadCycle);
+        audioThread->postWrite(threadCycle, chipIndex, reg, value);
+    }
+}
+
+void SID::writeChipRegister(uint8_t chipIndex, uint16_t address, uint8_t value)
+{
+    if (chipIndex == 0)
+        writeRegister(address, value);
+    else if (chipIndex <= linkedChips.size())
+        linkedChips[chipIndex - 1].chip->writeRegister(address, value);
+}
+
+void SID::takeBusLatch(const SID& from)
+{
+    // The bus latch lives with the emulator's chips, the audio thread never reads them
+    sidBusLatch = from.sidBusLatch;
+    sidBusDecayCycles = from.sidBusDecayCycles;
+
+    for (size_t k = 0; k < linkedChips.size() && k < from.linkedChips.size(); ++k)
+        linkedChips[k].chip->takeBusLatch(*from.linkedChips[k].chip);
+}
+
+void SID::copyChipState(const SID& from, SID& to)
+{
+    // Member by member, a save state would drop the envelope rate counters
+    to.sidModel_ = from.sidModel_;
+    to.sidBusLatch = from.sidBusLatch;
+    to.sidBusDecayCycles = from.sidBusDecayCycles;
+    to.mode_ = from.mode_;
+    to.hpPrevIn = from.hpPrevIn;
+    to.hpPrevOut = from.hpPrevOut;
+    to.sidClockFrequency = from.sidClockFrequency;
+    to.sidCyclesPerAudioSample = from.sidCyclesPerAudioSample;
+    to.sampleRate = from.sampleRate;
+    to.sampleClock = from.sampleClock;
+    to.sampleClockPeriod = from.sampleClockPeriod;
+    to.resampler = from.resampler;
+    to.resamplerRight = from.resamplerRight;
+    to.blockFill = 0;
+    to.pendingCycles = 0;
+    to.sidRegisters = from.sidRegisters;
+
+    to.voice1 = from.voice1;
+    to.voice2 = from.voice2;
+    to.voice3 = from.voice3;
+    to.filterobj = from.filterobj;
+    to.mixerobj = from.mixerobj;
+    to.analogProfile = from.analogProfile;
+
+    to.pan = from.pan;
+    to.stereo = from.stereo;
+    std::copy(std::begin(from.leftGain), std::end(from.leftGain), std::begin(to.leftGain));
+    std::copy(std::begin(from.rightGain), std::end(from.rightGain), std::begin(to.rightGain));
+
+    // Linked chips, the copies are owned by to
+    to.linkedChips.resize(from.linkedChips.size());
+    for (size_t k = 0; k < from.linkedChips.size(); ++k)
+    {
+        LinkedChip& link = to.linkedChips[k];
+        if (!link.chip)
+            link.chip = std::make_unique<SID>(from.sampleRate);
+
+        link.chip->owner = &to;
+        link.chip->linkIndex = static_cast<uint8_t>(k + 1);
+        link.baseAddress = from.linkedChips[k].baseAddress;
+        copyChipState(*from.linkedChips[k].chip, *link.chip);
+    }
+
+    // The copied oscillators still point at the other chip's voices
+    to.configureOscillatorSources();
+    to.scheduleNextSync();
+}
+
+void SID::popFrame(double& left, double& right)
 {
     constexpr int RECOVERY_LEN = 64;
 
+    if (threadedOutput.load(std::memory_order_acquire))
+    {
+        synth->popFrame(left, right);
+        return;
+    }
+
     audioConsumedSamples.fetch_add(1, std::memory_order_relaxed);
 
-    double s = 0.0;
+    AudioFrame frame{};
 
-    if (audioBuf.pop(s))
+    if (audioBuf.pop(frame))
     {
         int buffered = audioBufferedSamples.load(std::memory_order_relaxed);
         if (buffered > 0)
@@ -848,26 +1464,31 @@ double SID::popSample()
         {
             audioWasUnderrunning = false;
             underrunRecoverySamples = RECOVERY_LEN;
-            recoveryStartSample = underrunOutputSample;
+            recoveryStartSample[0] = underrunOutputSample[0];
+            recoveryStartSample[1] = underrunOutputSample[1];
         }
 
-        if (underrunRecoverySamples > 0)
-        {
-            const double t =
-                1.0 - (static_cast<double>(underrunRecoverySamples) /
-                       static_cast<double>(RECOVERY_LEN));
+        const double s[2] = { frame.left, frame.right };
+        const bool recovering = underrunRecoverySamples > 0;
 
-            const double out = recoveryStartSample + (s - recoveryStartSample) * t;
+        const double t =
+            1.0 - (static_cast<double>(underrunRecoverySamples) /
+                   static_cast<double>(RECOVERY_LEN));
 
+        if (recovering)
             --underrunRecoverySamples;
-            lastOutputSample = out;
-            underrunOutputSample = out;
-            return out;
+
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            const double out = recovering ? recoveryStartSample[ch] + (s[ch] - recoveryStartSample[ch]) * t : s[ch];
+
+            lastOutputSample[ch] = out;
+            underrunOutputSample[ch] = out;
         }
 
-        lastOutputSample = s;
-        underrunOutputSample = s;
-        return s;
+        left = lastOutputSample[0];
+        right = lastOutputSample[1];
+        return;
     }
 
     audioUnderrunCount.fetch_add(1, std::memory_order_relaxed);
@@ -875,10 +1496,23 @@ double SID::popSample()
     audioWasUnderrunning = true;
 
     // Fade toward silence during starvation.
-    underrunOutputSample *= 0.995;
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        underrunOutputSample[ch] *= 0.995;
+        lastOutputSample[ch] = underrunOutputSample[ch];
+    }
 
-    lastOutputSample = underrunOutputSample;
-    return underrunOutputSample;
+    left = lastOutputSample[0];
+    right = lastOutputSample[1];
+}
+
+double SID::popSample()
+{
+    double left = 0.0;
+    double right = 0.0;
+
+    popFrame(left, right);
+    return (left + right) * 0.5;
 }
 
 void SID::reset()
@@ -888,11 +1522,15 @@ void SID::reset()
 
     std::memset(&sidRegisters, 0, sizeof(sidRegisters));
     sidRegisters.filter.volume = 0x00;
-    sidCycleCounter = 0.0;
+    sampleClock = 0;
+    pendingCycles = 0;
 
-    lastOutputSample = 0.0;
-    underrunOutputSample = 0.0;
-    recoveryStartSample = 0.0;
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        lastOutputSample[ch] = 0.0;
+        underrunOutputSample[ch] = 0.0;
+        recoveryStartSample[ch] = 0.0;
+    }
     audioUnderrunCount = 0;
     audioWasUnderrunning = false;
     underrunRecoverySamples = 0;
@@ -905,17 +1543,27 @@ void SID::reset()
 
     filterobj.reset();
     setSIDModel(sidModel_);
+    updateOutputRouting();
     setMode(mode_);
 
     hpPrevIn = 0.0;
     hpPrevOut = 0.0;
 
+    blockFill = 0;
+    resampler.reset();
+    resamplerRight.reset();
     audioBuf.clear();
 
+    for (LinkedChip& link : linkedChips)
+        link.chip->reset();
+
     audioGeneratedSamples.store(0, std::memory_order_relaxed);
     audioConsumedSamples.store(0, std::memory_order_relaxed);
     audioUnderrunCount.store(0, std::memory_order_relaxed);
     audioBufferedSamples.store(0, std::memory_order_relaxed);
+
+    if (SID* chip = haltAudioThread())
+        chip->reset();
 }
 
 SID::AnalogProfile SID::getAnalogProfile() const
@@ -1002,6 +1650,11 @@ void SID::configureOscillatorSources()
 
 std::string SID::dumpRegisters(const std::string& group)
 {
+    sync();
+
+    if (SID* chip = haltAudioThread())
+        return chip->dumpRegisters(group);
+
     std::stringstream out;
     out << std::hex << std::uppercase << std::setfill('0');
 
@@ -1189,6 +1842,9 @@ std::string SID::dumpVoice(const voiceRegisters& regs, const Voice& voice, int i
 
 std::string SID::dumpAudioStats() const
 {
+    if (threadedOutput.load(std::memory_order_acquire))
+        return synth->dumpAudioStats();
+
     const uint64_t generated =
         audioGeneratedSamples.load(std::memory_order_relaxed);
 
@@ -1233,7 +1889,17 @@ std::string SID::dumpAudioStats() const
     out << "  Surplus time:        " << surplusMs << " ms\n";
 
     out << std::setprecision(6);
-    out << "  Last output sample:  " << lastOutputSample << "\n";
+    out << "  Last output sample:  " << lastOutputSample[0];
+    if (stereo)
+        out << " / " << lastOutputSample[1];
+    out << "\n";
+    out << "  Resampler:           " << SIDResampler::qualityName(resampler.getQuality()) << " (" << resampler.getFactor()
+        << "x, " << SIDResampler::backendName() << ")\n";
+
+    out << "  Chips:               " << (1 + linkedChips.size()) << " ($D400";
+    for (const LinkedChip& link : linkedChips)
+        out << ", $" << std::hex << std::uppercase << link.baseAddress << std::dec;
+    out << "), " << (stereo ? "stereo" : "mono") << "\n";
 
     out << "\nHealth:\n";
 
@@ -1307,6 +1973,12 @@ std::string SID::dumpCutoffTable() const
 
 void SID::resetAudioStats()
 {
+    if (threadedOutput.load(std::memory_order_acquire))
+    {
+        synth->resetAudioStats();
+        return;
+    }
+
     // Preserve current queue depth instead of blindly zeroing it.
     // audioBufferedSamples is current state, not just a stat counter.
     const int buffered = audioBufferedSamples.load(std::memory_order_relaxed);
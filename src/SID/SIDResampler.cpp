@@ -0,0 +1,189 @@
+﻿// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#include <algorithm>
+#include <cmath>
+#include "SID/SIDResampler.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SID_RESAMPLE_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SID_RESAMPLE_SSE2 1
+#endif
+
+namespace
+{
+    constexpr double PI = 3.14159265358979323846;
+
+    // Zeroth order modified Bessel function, for the Kaiser window
+    double besselI0(double x)
+    {
+        double sum = 1.0;
+        double term = 1.0;
+
+        for (int k = 1; k < 32; ++k)
+        {
+            term *= (x / (2.0 * k)) * (x / (2.0 * k));
+            sum += term;
+        }
+
+        return sum;
+    }
+}
+
+SIDResampler::SIDResampler() :
+    quality(Quality::Fast),
+    factor(1),
+    phase(0),
+    fill(0)
+{
+    buildTaps();
+}
+
+void SIDResampler::setQuality(Quality quality)
+{
+    if (quality == this->quality)
+        return;
+
+    this->quality = quality;
+    buildTaps();
+}
+
+void SIDResampler::reset()
+{
+    std::fill(buffer.begin(), buffer.end(), 0.0f);
+    fill = taps.size() - 1;
+    phase = 0;
+}
+
+size_t SIDResampler::process(float* out)
+{
+    const size_t history = taps.size() - 1;
+    size_t produced = 0;
+
+    for (size_t i = history; i < fill; ++i)
+    {
+        if (++phase < factor)
+            continue;
+
+        phase = 0;
+        out[produced++] = dot(taps.data(), buffer.data() + i - history, taps.size());
+    }
+
+    // Keep the tail for the next block
+    std::copy(buffer.begin() + (fill - history), buffer.begin() + fill, buffer.begin());
+    fill = history;
+
+    return produced;
+}
+
+bool SIDResampler::parseQuality(const std::string& name, Quality& out)
+{
+    if (name == "fast")
+    {
+        out = Quality::Fast;
+        return true;
+    }
+
+    if (name == "high")
+    {
+        out = Quality::High;
+        return true;
+    }
+
+    return false;
+}
+
+const char* SIDResampler::qualityName(Quality quality)
+{
+    return quality == Quality::High ? "high" : "fast";
+}
+
+const char* SIDResampler::backendName()
+{
+#if defined(SID_RESAMPLE_AVX2)
+    return "avx2";
+#elif defined(SID_RESAMPLE_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+void SIDResampler::buildTaps()
+{
+    if (quality == Quality::Fast)
+    {
+        factor = 1;
+        taps.assign(1, 1.0f);
+    }
+    else
+    {
+        // Kaiser windowed sinc: flat to about 0.36 of the host rate, at least 70 dB down from
+        // the host Nyquist frequency on, where the oversampled band would fold back
+        constexpr double CUTOFF = 0.108;     // Oversampled cycles per sample
+        constexpr double BETA = 7.0;
+
+        factor = HIGH_FACTOR;
+        taps.resize(HIGH_TAPS);
+
+        const double centre = static_cast<double>(HIGH_TAPS - 1) / 2.0;
+        double sum = 0.0;
+
+        std::vector<double> h(HIGH_TAPS);
+        for (size_t n = 0; n < HIGH_TAPS; ++n)
+        {
+            const double x = static_cast<double>(n) - centre;
+            const double sinc = 2.0 * CUTOFF * ((x == 0.0) ? 1.0 : std::sin(2.0 * PI * CUTOFF * x) / (2.0 * PI * CUTOFF * x));
+            const double r = x / centre;
+            const double window = besselI0(BETA * std::sqrt(std::max(0.0, 1.0 - r * r))) / besselI0(BETA);
+
+            h[n] = sinc * window;
+            sum += h[n];
+        }
+
+        // Unity gain at DC, reversed for the dot product (symmetric anyway)
+        for (size_t n = 0; n < HIGH_TAPS; ++n)
+            taps[n] = static_cast<float>(h[HIGH_TAPS - 1 - n] / sum);
+    }
+
+    buffer.assign(taps.size() - 1 + BLOCK_SIZE, 0.0f);
+    fill = taps.size() - 1;
+    phase = 0;
+}
+
+float SIDResampler::dot(const float* a, const float* b, size_t n)
+{
+    size_t i = 0;
+    float total = 0.0f;
+
+#if defined(SID_RESAMPLE_AVX2)
+    __m256 acc = _mm256_setzero_ps();
+    for (; i + 8 <= n; i += 8)
+        acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+
+    __m128 sum4 = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    sum4 = _mm_add_ps(sum4, _mm_movehl_ps(sum4, sum4));
+    sum4 = _mm_add_ss(sum4, _mm_shuffle_ps(sum4, sum4, 0x55));
+    total = _mm_cvtss_f32(sum4);
+#elif defined(SID_RESAMPLE_SSE2)
+    __m128 acc = _mm_setzero_ps();
+    for (; i + 4 <= n; i += 4)
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+    acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 0x55));
+    total = _mm_cvtss_f32(acc);
+#endif
+
+    for (; i < n; ++i)
+        total += a[i] * b[i];
+
+    return total;
+}
@@ -0,0 +1,141 @@
+﻿// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#include <algorithm>
+#include "SID/SID.h"
+#include "SID/SIDThread.h"
+
+SIDThread::SIDThread(SID& chip, uint64_t startCycle) :
+    chip(chip),
+    cycle(startCycle),
+    queueHead(0),
+    queueTail(0),
+    target(startCycle),
+    done(startCycle),
+    stopping(false),
+    sleeping(false)
+{
+    worker = std::thread(&SIDThread::run, this);
+}
+
+SIDThread::~SIDThread()
+{
+    stopping.store(true);
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wake.notify_one();
+    }
+
+    if (worker.joinable())
+        worker.join();
+}
+
+void SIDThread::runTo(uint64_t cycle)
+{
+    // Only the emulator thread moves the target
+    if (target.load(std::memory_order_relaxed) == cycle)
+        return;
+
+    target.store(cycle);
+
+    if (sleeping.load())
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wake.notify_one();
+    }
+}
+
+void SIDThread::waitFor(uint64_t cycle)
+{
+    runTo(cycle);
+
+    for (int waits = 0; done.load(std::memory_order_acquire) < cycle; ++waits)
+    {
+        if (waits >= SPIN_WAITS)
+            std::this_thread::yield();
+    }
+}
+
+bool SIDThread::postWrite(uint64_t cycle, uint8_t chipIndex, uint8_t reg, uint8_t value)
+{
+    const uint32_t tail = queueTail.load(std::memory_order_relaxed);
+    if (tail - queueHead.load(std::memory_order_acquire) == QUEUE_SIZE)
+        return false;
+
+    queue[tail & (QUEUE_SIZE - 1)] = RegisterWrite{ cycle, chipIndex, reg, value };
+    queueTail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+void SIDThread::run()
+{
+    uint64_t goal = 0;
+    while (awaitTarget(cycle, goal))
+    {
+        // Writes made during the target cycle itself are already in the log
+        applyQueuedWrites(goal);
+        runChip(goal);
+
+        done.store(cycle, std::memory_order_release);
+    }
+}
+
+bool SIDThread::awaitTarget(uint64_t from, uint64_t& goal)
+{
+    for (int waits = 0; ; ++waits)
+    {
+        if (stopping.load(std::memory_order_acquire))
+            return false;
+
+        goal = target.load(std::memory_order_acquire);
+        if (goal != from)
+            return true;
+
+        if (waits < SPIN_WAITS)
+            continue;
+
+        if (waits < YIELD_WAITS)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Nothing to do for a while (paused, between frames), sleep until runTo()
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        sleeping.store(true);
+        wake.wait(lock, [this, from]() { return stopping.load() || target.load() != from; });
+        sleeping.store(false);
+    }
+}
+
+void SIDThread::runChip(uint64_t upTo)
+{
+    while (cycle < upTo)
+    {
+        const uint32_t run = static_cast<uint32_t>(std::min<uint64_t>(upTo - cycle, UINT32_MAX));
+        chip.tick(run);
+        cycle += run;
+    }
+}
+
+void SIDThread::applyQueuedWrites(uint64_t upTo)
+{
+    uint32_t head = queueHead.load(std::memory_order_relaxed);
+
+    while (head != queueTail.load(std::memory_order_acquire))
+    {
+        const RegisterWrite write = queue[head & (QUEUE_SIZE - 1)];
+        if (write.cycle > upTo)
+            break;
+
+        queueHead.store(++head, std::memory_order_release);
+
+        // The voices have to reach the cycle of the write before it changes them
+        runChip(write.cycle);
+        chip.writeChipRegister(write.chipIndex, static_cast<uint16_t>(0xD400 | write.reg), write.value);
+    }
+}
@@ -48,7 +48,7 @@ void Voice::release()
     env.release();
 }
 
-void Voice::clockEnvelope(double sidCycles)
+void Voice::clockEnvelope(uint32_t sidCycles)
 {
     env.clock(sidCycles);
 }
@@ -394,6 +394,12 @@ bool RS232Device::isTransmitIdle() const
     return txState == TxState::Idle && txBytes.empty();
 }
 
+bool RS232Device::isIdle() const
+{
+    return !endpoint && !breakActive && txd && !rxStartPending &&
+           rxState == RxState::Idle && isTransmitIdle();
+}
+
 bool RS232Device::hasReceivedByte() const
 {
     return !rxBytes.empty();
@@ -69,6 +69,19 @@ bool StateManager::save(const std::string& path)
     // -------------------------
     // Device chunks (next)
     // -------------------------
+    if (components_.scheduler)
+        components_.scheduler->syncAll();
+
+    components_.sid->sync();
+    components_.bus->syncDrives();
+
+    // A drive skipping its idle loop is behind by part of an iteration
+    for (const auto& drive : components_.drives)
+    {
+        if (drive)
+            drive->syncIdle();
+    }
+
     components_.cpu->saveState(wrtr);
     components_.cia1->saveState(wrtr);
     components_.cia2->saveState(wrtr);
@@ -276,7 +289,8 @@ bool StateManager::load(const std::string& path)
                            (std::memcmp(chunk.tag, "VICX", 4) == 0);
 
         const bool isSID = (std::memcmp(chunk.tag, "SID0", 4) == 0) ||
-                           (std::memcmp(chunk.tag, "SIDX", 4) == 0);
+                           (std::memcmp(chunk.tag, "SIDX", 4) == 0) ||
+                           (std::memcmp(chunk.tag, "SIDL", 4) == 0);
 
         #ifdef Debug
         std::cout << "CHUNK: "
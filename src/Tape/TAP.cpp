@@ -185,6 +185,53 @@ void TAP::simulateLoading()
     }
 }
 
+void TAP::advance(uint32_t cycles)
+{
+    while (cycles > 0)
+    {
+        if (pulseIndex >= pulses.size())
+        {
+            currentLevel = true; // idle high
+            return;
+        }
+
+        // Same phases as simulateLoading(), consumed in runs
+        if (blipCountdown > 0)
+        {
+            const uint32_t run = std::min<uint32_t>(cycles, blipCountdown);
+            blipCountdown = static_cast<uint8_t>(blipCountdown - run);
+            if (blipCountdown == 0) currentLevel = true;
+            cycles -= run;
+            continue;
+        }
+
+        if (pulseRemaining > 0)
+        {
+            const uint32_t run = std::min(cycles, pulseRemaining);
+            pulseRemaining -= run;
+            cycles -= run;
+            continue;
+        }
+
+        // Pulse edge
+        simulateLoading();
+        --cycles;
+    }
+}
+
+uint32_t TAP::cyclesUntilLevelChange() const
+{
+    if (pulseIndex >= pulses.size())
+        return currentLevel ? NO_EDGE : 1;
+
+    // The blip returns high on its last cycle
+    if (blipCountdown > 0)
+        return blipCountdown;
+
+    // The pulse edge lands on the cycle after the count runs out
+    return pulseRemaining + 1;
+}
+
 bool TAP::validateHeader()
 {
     // First check the signature to ensure it's really a C16 or C64 tape file
@@ -68,6 +68,7 @@ EmulatorUI::MediaViewState UIBridge::buildMediaViewState() const
         s.cartPath     = m.cartPath;
         s.tapeAttached = m.tapeAttached;
         s.tapePath     = m.tapePath;
+        s.tapeWarp     = m.tapeWarp;
         s.prgAttached  = m.prgAttached;
         s.prgPath      = m.prgPath;
 
@@ -465,6 +466,10 @@ void UIBridge::processCommands()
                 if (media_) media_->tapeEject();
                 break;
 
+            case UiCommand::Type::CassToggleWarp:
+                if (media_) media_->setTapeWarp(!media_->getState().tapeWarp);
+                break;
+
             case UiCommand::Type::SetMOS6581:
                 if (setSIDModel_)
                     setSIDModel_("6581");
@@ -54,6 +54,11 @@ bool UserPort::getFlag2() const
     return device ? device->getFlag2() : true;
 }
 
+bool UserPort::isIdle() const
+{
+    return !device || device->isIdle();
+}
+
 std::string UserPort::debugString() const
 {
     std::ostringstream out;
@@ -107,6 +107,11 @@ bool UserPortRS232Adapter::getFlag2() const
     return rs232Device->getTXD();
 }
 
+bool UserPortRS232Adapter::isIdle() const
+{
+    return !rs232Device || rs232Device->isIdle();
+}
+
 void UserPortRS232Adapter::updateTXD()
 {
     if (!rs232Device)
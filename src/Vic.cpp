@@ -12,6 +12,7 @@
 #include "IRQLine.h"
 #include "Memory.h"
 #include "Vic.h"
+#include "VicSpanCompositor.h"
 
 Vic::Vic(VideoMode mode) :
     cia2(nullptr),
@@ -31,6 +32,8 @@ Vic::Vic(VideoMode mode) :
 
     rasterEventsByRaster.resize(cfg_->maxRasterLines);
     lastFrameRasterEventsByRaster.resize(cfg_->maxRasterLines);
+    rasterSpansByRaster.resize(cfg_->maxRasterLines);
+    lastFrameRasterSpansByRaster.resize(cfg_->maxRasterLines);
 
     rasterRowStates.resize(cfg_->maxRasterLines);
     lastFrameRasterRowStates.resize(cfg_->maxRasterLines);
@@ -248,6 +251,9 @@ void Vic::setMode(VideoMode mode)
     rasterEventsByRaster.resize(cfg_->maxRasterLines);
     lastFrameRasterEventsByRaster.resize(cfg_->maxRasterLines);
 
+    // Span positions depend on the mode's X origin
+    rebuildRegisterSpans();
+
     borderVertical_per_raster.resize(cfg_->maxRasterLines);
     borderVerticalStart_per_raster.resize(cfg_->maxRasterLines);
     borderLeftOpenX_per_raster.resize(cfg_->maxRasterLines);
@@ -1321,25 +1327,42 @@ void Vic::beginFrameIfNeeded()
     // of the frame only.
     if (currentCycle == 0 && registers.raster == 0)
     {
-        if (!rasterEventLog.empty())
-            lastFrameRasterEventLog = rasterEventLog;
+        lastFrameRasterEventsByRaster.swap(rasterEventsByRaster);
+        lastFrameRasterSpansByRaster.swap(rasterSpansByRaster);
+
+        // Preserve completed-frame diagnostics before clearing current-frame state,
+        // only a captured frame has any and the previous capture stays until replaced.
+        if (debugCaptureFrame)
+        {
+            if (!rasterEventLog.empty())
+                lastFrameRasterEventLog.swap(rasterEventLog);
 
-        lastFrameRasterEventsByRaster = rasterEventsByRaster;
+            lastFrameRasterRowStates.swap(rasterRowStates);
+            lastFrameRasterPixelStates.swap(rasterPixelStates);
 
-        // Preserve completed-frame diagnostics before clearing current-frame state.
-        lastFrameRasterRowStates = rasterRowStates;
-        lastFrameRasterPixelStates = rasterPixelStates;
+            rasterEventLog.clear();
 
-        rasterEventLog.clear();
+            for (auto& s : rasterRowStates)
+                s = {};
+
+            for (auto& s : rasterPixelStates)
+                s = {};
+        }
+
+        debugCaptureFrame = debugCaptureContinuous || debugCaptureOneShot;
+        debugCaptureOneShot = false;
 
         for (auto& events : rasterEventsByRaster)
             events.clear();
 
-        for (auto& s : rasterRowStates)
-            s = {};
+        for (auto& spans : rasterSpansByRaster)
+        {
+            spans.d011.clear();
+            spans.d016.clear();
+            spans.d018.clear();
+        }
 
-        for (auto& s : rasterPixelStates)
-            s = {};
+        ++registerSpanRevision;
 
         rasterColorEvents.clear();
         rasterPriorityEvents.clear();
@@ -1497,7 +1520,7 @@ void Vic::handleCycle58Decisions()
     traceVicCycleCheckpoint("cycle-58", registers.raster, currentCycle);
 
     // Preserve the RC actually used to render this raster line.
-    if (registers.raster >= 0 && registers.raster < static_cast<int>(rasterRowStates.size()))
+    if (debugCaptureFrame && registers.raster >= 0 && registers.raster < static_cast<int>(rasterRowStates.size()))
         rasterRowStates[registers.raster].displayRc = vicState.rc;
 
     advanceCharacterSequencerAtCycle58();
@@ -1967,8 +1990,11 @@ void Vic::finalizeCurrentRasterLine(int curRaster)
 {
     renderLine(curRaster);
 
-    snapshotRasterPixelComposition(curRaster);
-    snapshotRasterRowState(curRaster);
+    if (debugCaptureFrame)
+    {
+        snapshotRasterPixelComposition(curRaster);
+        snapshotRasterRowState(curRaster);
+    }
 
     updateSpriteDMAEndOfLine(curRaster);
 
@@ -3609,10 +3635,74 @@ void Vic::recordRasterEventLog(RasterEventKind kind, uint16_t address, uint8_t o
     e.oldValue = oldValue;
     e.newValue = newValue;
 
-    rasterEventLog.push_back(e);
+    if (debugCaptureFrame)
+        rasterEventLog.push_back(e);
 
     if (e.raster >= 0 && e.raster < static_cast<int>(rasterEventsByRaster.size()))
+    {
         rasterEventsByRaster[e.raster].push_back(e);
+        addRegisterSpan(rasterSpansByRaster[e.raster], e);
+    }
+}
+
+void Vic::addRegisterSpan(RasterRegisterSpans& spans, const RasterEventRecord& e)
+{
+    std::vector<RegisterSpan>* list = nullptr;
+    uint8_t mask = 0xFF;
+
+    switch (e.kind)
+    {
+        case RasterEventKind::Control:       list = &spans.d011; mask = 0x7F; break;
+        case RasterEventKind::Control2:      list = &spans.d016; mask = 0x1F; break;
+        case RasterEventKind::MemoryPointer: list = &spans.d018; mask = 0xFE; break;
+        default: return;
+    }
+
+    const int x = rasterRegisterEventPixelX(e);
+
+    while (!list->empty() && list->back().x >= x)
+        list->pop_back();
+
+    list->push_back(RegisterSpan{ x, static_cast<uint8_t>(e.newValue & mask) });
+    ++registerSpanRevision;
+}
+
+void Vic::rebuildRegisterSpans()
+{
+    rasterSpansByRaster.assign(rasterEventsByRaster.size(), RasterRegisterSpans{});
+    lastFrameRasterSpansByRaster.assign(lastFrameRasterEventsByRaster.size(), RasterRegisterSpans{});
+
+    for (size_t raster = 0; raster < rasterEventsByRaster.size(); ++raster)
+    {
+        for (const RasterEventRecord& e : rasterEventsByRaster[raster])
+            addRegisterSpan(rasterSpansByRaster[raster], e);
+    }
+
+    for (size_t raster = 0; raster < lastFrameRasterEventsByRaster.size(); ++raster)
+    {
+        for (const RasterEventRecord& e : lastFrameRasterEventsByRaster[raster])
+            addRegisterSpan(lastFrameRasterSpansByRaster[raster], e);
+    }
+
+    ++registerSpanRevision;
+}
+
+uint8_t Vic::registerValueAtPixelX(const std::vector<RegisterSpan>& spans, RegisterSpanCursor& cursor, uint8_t base, int px) const
+{
+    // Start over when the list changed or the caller went back to the left
+    if (cursor.spans != &spans || cursor.revision != registerSpanRevision || px < cursor.px)
+    {
+        cursor.spans = &spans;
+        cursor.revision = registerSpanRevision;
+        cursor.next = 0;
+    }
+
+    cursor.px = px;
+
+    while (cursor.next < spans.size() && spans[cursor.next].x <= px)
+        ++cursor.next;
+
+    return cursor.next == 0 ? base : spans[cursor.next - 1].value;
 }
 
 void Vic::snapshotRasterPixelComposition(int raster)
@@ -3684,33 +3774,27 @@ bool Vic::initialSpritePriorityForRaster(int raster, uint8_t& value) const
     return false;
 }
 
-bool Vic::spriteBehindBackgroundAtPixel(int sprite, int px) const
+void Vic::buildSpritePriorityLine(int raster)
 {
-    if (sprite < 0 || sprite >= 8)
-        return false;
+    // D01B writes take effect from their X on, a later write replaces an earlier one
+    uint8_t activePriority = registers.spritePriority;
 
-    if (px < 0 || px >= VISIBLE_WIDTH)
-        return false;
+    const bool hasEvents = initialSpritePriorityForRaster(raster, activePriority);
 
-    uint8_t activePriority = registers.spritePriority;
+    std::fill(spritePriorityLine.begin(), spritePriorityLine.begin() + VISIBLE_WIDTH, activePriority);
 
-    if (initialSpritePriorityForRaster(registers.raster, activePriority))
+    if (!hasEvents)
+        return;
+
+    for (const RasterPriorityEvent& e : rasterPriorityEvents)
     {
-        for (const RasterPriorityEvent& e : rasterPriorityEvents)
-        {
-            if (e.raster != registers.raster)
-                continue;
+        if (e.raster != raster)
+            continue;
 
-            const int eventX = rasterPriorityEventPixelX(e);
+        const int eventX = rasterPriorityEventPixelX(e);
 
-            if (eventX > px)
-                continue;
-
-            activePriority = e.newValue;
-        }
+        std::fill(spritePriorityLine.begin() + eventX, spritePriorityLine.begin() + VISIBLE_WIDTH, e.newValue);
     }
-
-    return (activePriority & static_cast<uint8_t>(1u << sprite)) != 0;
 }
 
 Vic::SpriteFetchPhase Vic::spriteFetchPhaseForCycle(int sprite, int cycle) const
@@ -5011,10 +5095,7 @@ void Vic::emitRasterLineInOrder(int raster)
     const int xStart = rasterVisibleStartX(raster);
     const int xEnd   = rasterVisibleEndX(raster);
 
-    for (int px = xStart; px < xEnd; ++px)
-    {
-        sink->setPixel(px, screenY, finalColorLine[px] & 0x0F);
-    }
+    sink->setPixelRow(screenY, finalColorLine.data(), xStart, xEnd);
 }
 
 void Vic::emitActiveStandardTextPixels(int x0, int x1, int pixelBudget)
@@ -5132,66 +5213,28 @@ void Vic::composeFinalRasterLine(int raster)
     const int xStart = rasterVisibleStartX(raster);
     const int xEnd   = rasterVisibleEndX(raster);
 
-    for (int px = xStart; px < xEnd; ++px)
-        finalColorLine[px] = compositePixelAtX(raster, px);
-}
-
-Vic::BackgroundPixel Vic::sampleBackgroundPixelAtX(int raster, int px) const
-{
-    BackgroundPixel out {};
-    out.color = registers.borderColor & 0x0F;
-    out.opaque = false;
-
-    if (px < 0 || px >= VISIBLE_WIDTH)
-        return out;
-
-    if (borderActiveAtPixel(raster, px))
-        return out;
-
-    out.color = bgColorLine[px] & 0x0F;
-    out.opaque = (bgOpaqueLine[px] != 0);
-    return out;
-}
-
-uint8_t Vic::compositePixelAtX(int raster, int px) const
-{
-    // VIC-II border is in front of both background graphics and sprites.
-    if (borderActiveAtPixel(raster, px))
-        return registers.borderColor & 0x0F;
-
-    const BackgroundPixel bg = sampleBackgroundPixelAtX(raster, px);
-
-    uint8_t color = bg.color;
-
-    // Sprites behind background:
-    // only visible if background is not opaque at this pixel.
-    for (int spr = 0; spr < 8; ++spr)
+    if (raster < 0 || raster >= static_cast<int>(cfg_->maxRasterLines))
     {
-        const bool behind = spriteBehindBackgroundAtPixel(spr, px);
-
-        if (!behind)
-            continue;
+        std::fill(finalColorLine.begin() + xStart, finalColorLine.begin() + xEnd, registers.borderColor & 0x0F);
+        return;
+    }
 
-        if (!spriteOpaqueLine[spr][px])
-            continue;
+    buildSpritePriorityLine(raster);
 
-        if (!bg.opaque)
-            color = spriteColorLine[spr][px] & 0x0F;
-    }
+    VicLineLayers layers;
+    layers.bgColor = bgColorLine.data();
+    layers.bgOpaque = bgOpaqueLine.data();
+    layers.borderMask = borderMaskLine.data();
+    layers.spriteBehind = spritePriorityLine.data();
+    layers.borderColor = registers.borderColor;
 
-    // Sprites in front of background.
     for (int spr = 0; spr < 8; ++spr)
     {
-        const bool behind = spriteBehindBackgroundAtPixel(spr, px);
-
-        if (behind)
-            continue;
-
-        if (spriteOpaqueLine[spr][px])
-            color = spriteColorLine[spr][px] & 0x0F;
+        layers.spriteOpaque[spr] = spriteOpaqueLine[spr].data();
+        layers.spriteColor[spr] = spriteColorLine[spr].data();
     }
 
-    return color & 0x0F;
+    VicSpanCompositor::compose(layers, finalColorLine.data(), xStart, xEnd);
 }
 
 int Vic::rasterPixelToCycle(int px) const
@@ -6826,27 +6869,20 @@ uint8_t Vic::d011ForRasterPixelX(int raster, int px, bool preferPreviousFrame) c
     if (raster < 0 || raster >= static_cast<int>(cfg_->maxRasterLines))
         return registers.control & 0x7F;
 
-    uint8_t active = latchedD011ForRaster(raster) & 0x7F;
-
-    const auto& eventTable = preferPreviousFrame ? lastFrameRasterEventsByRaster : rasterEventsByRaster;
-
-    if (raster >= static_cast<int>(eventTable.size()))
-        return active;
+    const uint8_t latched = latchedD011ForRaster(raster) & 0x7F;
 
-    const auto& events = eventTable[raster];
+    const auto& spanTable = preferPreviousFrame ? lastFrameRasterSpansByRaster : rasterSpansByRaster;
 
-    for (const RasterEventRecord& e : events)
-    {
-        if (e.kind != RasterEventKind::Control)
-            continue;
+    if (raster >= static_cast<int>(spanTable.size()))
+        return latched;
 
-        const int eventX = rasterRegisterEventPixelX(e);
+    const auto& spans = spanTable[raster].d011;
 
-        if (px >= eventX)
-            active = e.newValue & 0x7F;
-    }
+    // Most lines never rewrite the register
+    if (spans.empty())
+        return latched;
 
-    return active;
+    return registerValueAtPixelX(spans, registerSpanCursors[0][preferPreviousFrame ? 1 : 0], latched, px);
 }
 
 uint8_t Vic::d016ForRasterPixelX(int raster, int px, bool preferPreviousFrame) const
@@ -6854,27 +6890,20 @@ uint8_t Vic::d016ForRasterPixelX(int raster, int px, bool preferPreviousFrame) c
     if (raster < 0 || raster >= static_cast<int>(cfg_->maxRasterLines))
         return registers.control2 & 0x1F;
 
-    uint8_t active = latchedD016ForRaster(raster) & 0x1F;
-
-    const auto& eventTable = preferPreviousFrame ? lastFrameRasterEventsByRaster : rasterEventsByRaster;
+    const uint8_t latched = latchedD016ForRaster(raster) & 0x1F;
 
-    if (raster >= static_cast<int>(eventTable.size()))
-        return active;
+    const auto& spanTable = preferPreviousFrame ? lastFrameRasterSpansByRaster : rasterSpansByRaster;
 
-    const auto& events = eventTable[raster];
+    if (raster >= static_cast<int>(spanTable.size()))
+        return latched;
 
-    for (const RasterEventRecord& e : events)
-    {
-        if (e.kind != RasterEventKind::Control2)
-            continue;
+    const auto& spans = spanTable[raster].d016;
 
-        const int eventX = rasterRegisterEventPixelX(e);
-
-        if (px >= eventX)
-            active = e.newValue & 0x1F;
-    }
+    // Most lines never rewrite the register
+    if (spans.empty())
+        return latched;
 
-    return active;
+    return registerValueAtPixelX(spans, registerSpanCursors[1][preferPreviousFrame ? 1 : 0], latched, px);
 }
 
 uint8_t Vic::d018ForRasterPixelX(int raster, int px, bool preferPreviousFrame) const
@@ -6882,27 +6911,20 @@ uint8_t Vic::d018ForRasterPixelX(int raster, int px, bool preferPreviousFrame) c
     if (raster < 0 || raster >= static_cast<int>(cfg_->maxRasterLines))
         return registers.memory_pointer & 0xFE;
 
-    uint8_t active = latchedD018ForRaster(raster) & 0xFE;
+    const uint8_t latched = latchedD018ForRaster(raster) & 0xFE;
 
-    const auto& eventTable = preferPreviousFrame ? lastFrameRasterEventsByRaster : rasterEventsByRaster;
+    const auto& spanTable = preferPreviousFrame ? lastFrameRasterSpansByRaster : rasterSpansByRaster;
 
-    if (raster >= static_cast<int>(eventTable.size()))
-        return active;
+    if (raster >= static_cast<int>(spanTable.size()))
+        return latched;
 
-    const auto& events = eventTable[raster];
+    const auto& spans = spanTable[raster].d018;
 
-    for (const RasterEventRecord& e : events)
-    {
-        if (e.kind != RasterEventKind::MemoryPointer)
-            continue;
-
-        const int eventX = rasterRegisterEventPixelX(e);
-
-        if (px >= eventX)
-            active = e.newValue & 0xFE;
-    }
+    // Most lines never rewrite the register
+    if (spans.empty())
+        return latched;
 
-    return active;
+    return registerValueAtPixelX(spans, registerSpanCursors[2][preferPreviousFrame ? 1 : 0], latched, px);
 }
 
 Vic::FetchKind Vic::getFetchKindForCycle(int raster, int cycle) const
@@ -7021,7 +7043,7 @@ std::string Vic::dumpRasterPixelCompositionDebug(int raster, int x0, int x1) con
     if (!snap)
     {
         out << "No pixel composition snapshot available for raster "
-            << raster << "\n";
+            << raster << "\n" << DEBUG_CAPTURE_HINT;
         return out.str();
     }
 
@@ -0,0 +1,149 @@
+// Copyright (c) 2025 Christopher Broschard
+// All rights reserved.
+//
+// This source code is provided for personal, educational, and
+// non-commercial use only. Redistribution, modification, or use
+// of this code in whole or in part for any other purpose is
+// strictly prohibited without the prior written consent of the author.
+#include "VicSpanCompositor.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define VIC_COMPOSE_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VIC_COMPOSE_SSE2 1
+#endif
+
+const char* VicSpanCompositor::backendName()
+{
+#if defined(VIC_COMPOSE_AVX2)
+    return "avx2";
+#elif defined(VIC_COMPOSE_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+void VicSpanCompositor::compose(const VicLineLayers& layers, uint8_t* out, int x0, int x1)
+{
+    int px = x0;
+
+#if defined(VIC_COMPOSE_AVX2)
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i low4 = _mm256_set1_epi8(0x0F);
+    const __m256i border = _mm256_set1_epi8(static_cast<char>(layers.borderColor & 0x0F));
+
+    for (; px + 32 <= x1; px += 32)
+    {
+        __m256i color = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(layers.bgColor + px));
+        const __m256i bgClear = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(layers.bgOpaque + px)), zero);
+        const __m256i priority = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(layers.spriteBehind + px));
+
+        // Sprites behind the background first, then the ones in front, a later sprite paints over an earlier one
+        __m256i front = zero;
+        __m256i frontColor = zero;
+
+        for (int spr = 0; spr < 8; ++spr)
+        {
+            const __m256i bit = _mm256_set1_epi8(static_cast<char>(1u << spr));
+            const __m256i behind = _mm256_cmpeq_epi8(_mm256_and_si256(priority, bit), bit);
+            const __m256i clear = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(layers.spriteOpaque[spr] + px)), zero);
+            const __m256i sprColor = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(layers.spriteColor[spr] + px));
+
+            const __m256i showBehind = _mm256_andnot_si256(clear, _mm256_and_si256(behind, bgClear));
+            color = _mm256_blendv_epi8(color, sprColor, showBehind);
+
+            const __m256i showFront = _mm256_andnot_si256(_mm256_or_si256(clear, behind), _mm256_set1_epi8(-1));
+            frontColor = _mm256_blendv_epi8(frontColor, sprColor, showFront);
+            front = _mm256_or_si256(front, showFront);
+        }
+
+        color = _mm256_blendv_epi8(color, frontColor, front);
+
+        const __m256i outsideBorder = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(layers.borderMask + px)), zero);
+        color = _mm256_blendv_epi8(border, _mm256_and_si256(color, low4), outsideBorder);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + px), color);
+    }
+#elif defined(VIC_COMPOSE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i low4 = _mm_set1_epi8(0x0F);
+    const __m128i border = _mm_set1_epi8(static_cast<char>(layers.borderColor & 0x0F));
+
+    // SSE2 has no byte blend, select with and/andnot/or
+    auto select = [](__m128i mask, __m128i a, __m128i b)
+    {
+        return _mm_or_si128(_mm_and_si128(mask, b), _mm_andnot_si128(mask, a));
+    };
+
+    for (; px + 16 <= x1; px += 16)
+    {
+        __m128i color = _mm_loadu_si128(reinterpret_cast<const __m128i*>(layers.bgColor + px));
+        const __m128i bgClear = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(layers.bgOpaque + px)), zero);
+        const __m128i priority = _mm_loadu_si128(reinterpret_cast<const __m128i*>(layers.spriteBehind + px));
+
+        // Sprites behind the background first, then the ones in front, a later sprite paints over an earlier one
+        __m128i front = zero;
+        __m128i frontColor = zero;
+
+        for (int spr = 0; spr < 8; ++spr)
+        {
+            const __m128i bit = _mm_set1_epi8(static_cast<char>(1u << spr));
+            const __m128i behind = _mm_cmpeq_epi8(_mm_and_si128(priority, bit), bit);
+            const __m128i clear = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(layers.spriteOpaque[spr] + px)), zero);
+            const __m128i sprColor = _mm_loadu_si128(reinterpret_cast<const __m128i*>(layers.spriteColor[spr] + px));
+
+            const __m128i showBehind = _mm_andnot_si128(clear, _mm_and_si128(behind, bgClear));
+            color = select(showBehind, color, sprColor);
+
+            const __m128i showFront = _mm_andnot_si128(_mm_or_si128(clear, behind), _mm_set1_epi8(-1));
+            frontColor = select(showFront, frontColor, sprColor);
+            front = _mm_or_si128(front, showFront);
+        }
+
+        color = select(front, color, frontColor);
+
+        const __m128i outsideBorder = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(layers.borderMask + px)), zero);
+        color = select(outsideBorder, border, _mm_and_si128(color, low4));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + px), color);
+    }
+#endif
+
+    if (px < x1)
+        composeScalar(layers, out, px, x1);
+}
+
+void VicSpanCompositor::composeScalar(const VicLineLayers& layers, uint8_t* out, int x0, int x1)
+{
+    for (int px = x0; px < x1; ++px)
+    {
+        // Border is in front of both background graphics and sprites
+        if (layers.borderMask[px])
+        {
+            out[px] = layers.borderColor & 0x0F;
+            continue;
+        }
+
+        const uint8_t behind = layers.spriteBehind[px];
+        const bool bgOpaque = layers.bgOpaque[px] != 0;
+
+        uint8_t color = layers.bgColor[px];
+
+        for (int spr = 0; spr < 8; ++spr)
+        {
+            if ((behind & (1u << spr)) && layers.spriteOpaque[spr][px] && !bgOpaque)
+                color = layers.spriteColor[spr][px];
+        }
+
+        for (int spr = 0; spr < 8; ++spr)
+        {
+            if (!(behind & (1u << spr)) && layers.spriteOpaque[spr][px])
+                color = layers.spriteColor[spr][px];
+        }
+
+        out[px] = color & 0x0F;
+    }
+}
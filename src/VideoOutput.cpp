@@ -222,6 +222,20 @@ void VideoOutput::setPixel(int x, int y, uint8_t colorIndex, int hardwareX)
     backBuffer[y * screenWidthWithBorder + shiftedX] = palette32[colorIndex & 0x0F];
 }
 
+void VideoOutput::setPixelRow(int y, const uint8_t* colors, int x0, int x1)
+{
+    if (y < 0 || y >= screenHeightWithBorder)
+        return;
+
+    x0 = std::clamp(x0, 0, screenWidthWithBorder);
+    x1 = std::clamp(x1, 0, screenWidthWithBorder);
+
+    uint32_t* destination = backBuffer.data() + y * screenWidthWithBorder;
+
+    for (int x = x0; x < x1; ++x)
+        destination[x] = palette32[colors[x] & 0x0F];
+}
+
 void VideoOutput::finishFrameAndSignal()
 {
     std::lock_guard<std::mutex> lock(renderMut);
@@ -9,8 +9,10 @@
 #include <boost/version.hpp>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
+#include "BenchmarkSuite.h"
 #include "Computer.h"
 #include "main.h"
 #include "Version.h"
@@ -25,6 +27,15 @@ po::options_description get_options()
         ("cartridge", po::value<std::string>(), "Path and filename for cartridge to load on boot")
         ("tape", po::value<std::string>(), "Path and filename for TAP or T64 tape image to load")
         ("program", po::value<std::string>(), "Path and filename for PRG or P00 image to load")
+        ("disk", po::value<std::string>(), "Path and filename for D64, G64, D71 or D81 image to attach to device 8 (headless only)")
+        ("headless", "Run without video, audio or input and without frame pacing")
+        ("frames", po::value<uint64_t>(), "Headless: stop after this many frames")
+        ("cycles", po::value<uint64_t>(), "Headless: stop after this many CPU cycles")
+        ("until-pc", po::value<std::string>(), "Headless: stop when the PC reaches this hex address")
+        ("until-mem", po::value<std::string>(), "Headless: stop when memory matches ADDR=VALUE (hex)")
+        ("audio-capture", po::value<std::string>(), "Headless: write SID output to this WAV file")
+        ("benchmark", po::value<std::string>()->implicit_value("all"), "Run a benchmark workload (idle, cpu, cpu-micro, raster, split, sid, disk, reu, reu-bulk, all or the sid-output check) and print JSON results")
+        ("benchmark-frames", po::value<uint64_t>()->default_value(600), "Benchmark: frames measured per workload")
         ("version", "Print version and exit.");
     return desc;
 }
@@ -43,7 +54,18 @@ po::options_description get_config_file_options()
         ("1581.ROM", po::value<std::string>(), "Full path and filename of the 1581 ROM to load")
         ("c64.Joy1", po::value<std::string>(), "Joystick 1 key bindings: Up,Down,Left,Right,Fire")
         ("c64.Joy2", po::value<std::string>(), "Joystick 2 key bindings: Up,Down,Left,Right,Fire")
-        ("c64.SID.Model", po::value<std::string>(), "SID CHIP Model: 6581 8580");
+        ("c64.SID.Model", po::value<std::string>(), "SID CHIP Model: 6581 8580")
+        ("c64.SID.Pan", po::value<double>(), "Stereo position of the first SID: -1 (left) to 1 (right)")
+        ("c64.SID2.Address", po::value<std::string>(), "Second SID base address (hex): D420-D7E0 or DE00-DFE0")
+        ("c64.SID2.Model", po::value<std::string>(), "Second SID CHIP Model: 6581 8580")
+        ("c64.SID2.Pan", po::value<double>(), "Stereo position of the second SID: -1 (left) to 1 (right)")
+        ("c64.SID3.Address", po::value<std::string>(), "Third SID base address (hex): D420-D7E0 or DE00-DFE0")
+        ("c64.SID3.Model", po::value<std::string>(), "Third SID CHIP Model: 6581 8580")
+        ("c64.SID3.Pan", po::value<double>(), "Stereo position of the third SID: -1 (left) to 1 (right)")
+        ("c64.Drive.Threads", po::value<bool>(), "Run each disk drive on its own host thread: true false")
+        ("c64.SID.Thread", po::value<bool>(), "Synthesise the SID audio on its own host thread: true false")
+        ("c64.SID.Resampler", po::value<std::string>(), "SID output band limiting: fast high")
+        ("c64.Audio.Rate", po::value<int>(), "Host audio sample rate: 44100 48000 96000");
     return desc;
 }
 
@@ -51,100 +73,6 @@ int main(int argc, char* argv[])
 {
     try
     {
-        // Make our c64
-        Computer c64;
-
-        // Process configuration file, exit if there are any errors as we won't know how to boot the system
-        std::ifstream configFile("commodore.cfg");
-        if (!configFile)
-        {
-            std::cerr << "Error: Unable to open configuration file commodore.cfg exiting!" << std::endl;
-            return 1;
-        }
-
-        po::variables_map vmConfig;
-        po::options_description configFileOptions = get_config_file_options();
-
-        // Validate required options before moving on
-        try
-        {
-            po::store(po::parse_config_file(configFile, configFileOptions), vmConfig);
-            po::notify(vmConfig);
-        }
-        catch (const po::unknown_option& e)
-        {
-            std::cerr << "Unknown option encountered: " << e.what() << std::endl;
-            return 1;
-        }
-        catch (const po::required_option& e)
-        {
-            std::cerr << "Error: " << e.what() << std::endl;
-            return 1;
-        }
-
-        // Update the video mode
-        c64.setVideoMode(vmConfig["c64.Video.MODE"].as<std::string>());
-
-        // Update the C64 object with the locations for memory initialization
-        c64.setBASIC_ROM(vmConfig["c64.BASIC.ROM"].as<std::string>());
-        c64.setKernalROM(vmConfig["c64.Kernal.ROM"].as<std::string>());
-        c64.setCHAR_ROM(vmConfig["c64.CHAR.ROM"].as<std::string>());
-
-        // Update the C64 object with locations for 1541 ROMs if present
-        if (vmConfig.count("1541.LO.ROM") && vmConfig.count("1541.HI.ROM"))
-        {
-            c64.set1541LoROM(vmConfig["1541.LO.ROM"].as<std::string>());
-            c64.set1541HiROM(vmConfig["1541.HI.ROM"].as<std::string>());
-        }
-
-        // Update the C64 object with locations for 1571 ROM if present
-        if (vmConfig.count("1571.ROM"))
-        {
-            c64.set1571ROM(vmConfig["1571.ROM"].as<std::string>());
-        }
-
-        if (vmConfig.count("1581.ROM"))
-        {
-            c64.set1581ROM(vmConfig["1581.ROM"].as<std::string>());
-        }
-
-        if (vmConfig.count("c64.Joy1"))
-        {
-            auto cfg = parseJoystickConfig(vmConfig["c64.Joy1"].as<std::string>());
-            c64.setJoystickConfig(1, cfg);
-        }
-        else
-        {
-            JoystickMapping defaults1
-            {
-                SDL_SCANCODE_W, SDL_SCANCODE_S,
-                SDL_SCANCODE_A, SDL_SCANCODE_D,
-                SDL_SCANCODE_SPACE
-            };
-            c64.setJoystickConfig(1, defaults1);
-        }
-
-        if (vmConfig.count("c64.Joy2"))
-        {
-            auto cfg = parseJoystickConfig(vmConfig["c64.Joy2"].as<std::string>());
-            c64.setJoystickConfig(2, cfg);
-        }
-        else
-        {
-            JoystickMapping defaults2
-            {
-                SDL_SCANCODE_UP, SDL_SCANCODE_DOWN,
-                SDL_SCANCODE_LEFT, SDL_SCANCODE_RIGHT,
-                SDL_SCANCODE_RETURN
-            };
-            c64.setJoystickConfig(2, defaults2);
-        }
-
-        if (vmConfig.count("c64.SID.Model"))
-        {
-            c64.setSIDModel(vmConfig["c64.SID.Model"].as<std::string>());
-        }
-
         // Setup command line options
         po::options_description cmdLineOptions = get_options();
         po::variables_map vmCmdLine;
@@ -185,22 +113,95 @@ int main(int argc, char* argv[])
             return 0;
         }
 
-        if (vmCmdLine.count("cartridge"))
+        const bool benchmark = vmCmdLine.count("benchmark") > 0;
+        const bool headless = vmCmdLine.count("headless") > 0 || benchmark;
+
+        HeadlessConfig headlessConfig;
+        if (headless && !benchmark)
         {
-            c64.setCartridgeAttached(true);
-            c64.setCartridgePath(vmCmdLine["cartridge"].as<std::string>());
+            headlessConfig = parseHeadlessConfig(vmCmdLine);
+
+            if (!headlessConfig.hasStopCondition())
+            {
+                std::cerr << "Error: --headless needs at least one of --frames, --cycles, --until-pc or --until-mem" << std::endl;
+                return 1;
+            }
         }
 
-        if (vmCmdLine.count("tape"))
+        // Process configuration file, exit if there are any errors as we won't know how to boot the system
+        std::ifstream configFile("commodore.cfg");
+        if (!configFile)
         {
-            c64.setTapeAttached(true);
-            c64.setTapePath(vmCmdLine["tape"].as<std::string>());
+            std::cerr << "Error: Unable to open configuration file commodore.cfg exiting!" << std::endl;
+            return 1;
         }
 
-        if (vmCmdLine.count("program"))
+        po::variables_map vmConfig;
+        po::options_description configFileOptions = get_config_file_options();
+
+        // Validate required options before moving on
+        try
         {
-            c64.setPrgAttached(true);
-            c64.setPrgPath(vmCmdLine["program"].as<std::string>());
+            po::store(po::parse_config_file(configFile, configFileOptions), vmConfig);
+            po::notify(vmConfig);
+        }
+        catch (const po::unknown_option& e)
+        {
+            std::cerr << "Unknown option encountered: " << e.what() << std::endl;
+            return 1;
+        }
+        catch (const po::required_option& e)
+        {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+
+        if (benchmark)
+        {
+            const std::string workload = vmCmdLine["benchmark"].as<std::string>();
+            if (!BenchmarkSuite::isWorkload(workload))
+            {
+                std::cerr << "Error: Unknown benchmark workload " << workload << std::endl;
+                return 1;
+            }
+
+            // Every workload starts from a freshly built machine
+            BenchmarkSuite suite(
+                [&vmConfig, &vmCmdLine]()
+                {
+                    auto machine = std::make_unique<Computer>(true);
+                    configureComputer(*machine, vmConfig, vmCmdLine);
+                    return machine;
+                },
+                vmCmdLine["benchmark-frames"].as<uint64_t>(),
+                vmCmdLine.count("disk") ? vmCmdLine["disk"].as<std::string>() : std::string());
+
+            return suite.run(workload, std::cout) ? 0 : 1;
+        }
+
+        // Make our c64
+        Computer c64(headless);
+        configureComputer(c64, vmConfig, vmCmdLine);
+
+        if (headless)
+        {
+            HeadlessResult result;
+            const bool ok = c64.runHeadless(headlessConfig, result);
+
+            printHeadlessResult(result);
+
+            if (!ok)
+                return 1;
+
+            // A match condition was requested but a limit stopped the run first
+            if (headlessConfig.hasMatchCondition() &&
+                result.reason != HeadlessStopReason::PCMatch &&
+                result.reason != HeadlessStopReason::MemoryMatch)
+            {
+                return 2;
+            }
+
+            return 0;
         }
 
         // Startup the system
@@ -230,6 +231,137 @@ int main(int argc, char* argv[])
     }
 }
 
+void configureComputer(Computer& c64, const po::variables_map& vmConfig, const po::variables_map& vmCmdLine)
+{
+    // Update the video mode
+    c64.setVideoMode(vmConfig["c64.Video.MODE"].as<std::string>());
+
+    // Update the C64 object with the locations for memory initialization
+    c64.setBASIC_ROM(vmConfig["c64.BASIC.ROM"].as<std::string>());
+    c64.setKernalROM(vmConfig["c64.Kernal.ROM"].as<std::string>());
+    c64.setCHAR_ROM(vmConfig["c64.CHAR.ROM"].as<std::string>());
+
+    // Update the C64 object with locations for 1541 ROMs if present
+    if (vmConfig.count("1541.LO.ROM") && vmConfig.count("1541.HI.ROM"))
+    {
+        c64.set1541LoROM(vmConfig["1541.LO.ROM"].as<std::string>());
+        c64.set1541HiROM(vmConfig["1541.HI.ROM"].as<std::string>());
+    }
+
+    // Update the C64 object with locations for 1571 ROM if present
+    if (vmConfig.count("1571.ROM"))
+    {
+        c64.set1571ROM(vmConfig["1571.ROM"].as<std::string>());
+    }
+
+    if (vmConfig.count("1581.ROM"))
+    {
+        c64.set1581ROM(vmConfig["1581.ROM"].as<std::string>());
+    }
+
+    if (vmConfig.count("c64.Joy1"))
+    {
+        auto cfg = parseJoystickConfig(vmConfig["c64.Joy1"].as<std::string>());
+        c64.setJoystickConfig(1, cfg);
+    }
+    else
+    {
+        JoystickMapping defaults1
+        {
+            SDL_SCANCODE_W, SDL_SCANCODE_S,
+            SDL_SCANCODE_A, SDL_SCANCODE_D,
+            SDL_SCANCODE_SPACE
+        };
+        c64.setJoystickConfig(1, defaults1);
+    }
+
+    if (vmConfig.count("c64.Joy2"))
+    {
+        auto cfg = parseJoystickConfig(vmConfig["c64.Joy2"].as<std::string>());
+        c64.setJoystickConfig(2, cfg);
+    }
+    else
+    {
+        JoystickMapping defaults2
+        {
+            SDL_SCANCODE_UP, SDL_SCANCODE_DOWN,
+            SDL_SCANCODE_LEFT, SDL_SCANCODE_RIGHT,
+            SDL_SCANCODE_RETURN
+        };
+        c64.setJoystickConfig(2, defaults2);
+    }
+
+    if (vmConfig.count("c64.SID.Model"))
+    {
+        c64.setSIDModel(vmConfig["c64.SID.Model"].as<std::string>());
+    }
+
+    if (vmConfig.count("c64.Drive.Threads"))
+    {
+        c64.setDriveThreads(vmConfig["c64.Drive.Threads"].as<bool>());
+    }
+
+    if (vmConfig.count("c64.SID.Resampler"))
+    {
+        c64.setSIDResampler(vmConfig["c64.SID.Resampler"].as<std::string>());
+    }
+
+    if (vmConfig.count("c64.Audio.Rate"))
+    {
+        c64.setAudioSampleRate(vmConfig["c64.Audio.Rate"].as<int>());
+    }
+
+    // Extra SIDs, before the audio thread takes a copy of the chips. Two chips default
+    // to left and right, a third one to the centre.
+    for (int n = 2; n <= 3; ++n)
+    {
+        const std::string key = "c64.SID" + std::to_string(n);
+        if (!vmConfig.count(key + ".Address"))
+            continue;
+
+        const uint16_t baseAddress = static_cast<uint16_t>(parseHexValue(vmConfig[key + ".Address"].as<std::string>(), 0xFFFF));
+
+        std::string model = "6581";
+        if (vmConfig.count(key + ".Model"))
+            model = vmConfig[key + ".Model"].as<std::string>();
+        else if (vmConfig.count("c64.SID.Model"))
+            model = vmConfig["c64.SID.Model"].as<std::string>();
+
+        const double pan = vmConfig.count(key + ".Pan") ? vmConfig[key + ".Pan"].as<double>() : (n == 2 ? 1.0 : 0.0);
+
+        if (c64.addSID(baseAddress, model, pan) && !vmConfig.count("c64.SID.Pan"))
+            c64.setSIDPan(-1.0);
+    }
+
+    if (vmConfig.count("c64.SID.Pan"))
+    {
+        c64.setSIDPan(vmConfig["c64.SID.Pan"].as<double>());
+    }
+
+    if (vmConfig.count("c64.SID.Thread"))
+    {
+        c64.setSIDThread(vmConfig["c64.SID.Thread"].as<bool>());
+    }
+
+    if (vmCmdLine.count("cartridge"))
+    {
+        c64.setCartridgeAttached(true);
+        c64.setCartridgePath(vmCmdLine["cartridge"].as<std::string>());
+    }
+
+    if (vmCmdLine.count("tape"))
+    {
+        c64.setTapeAttached(true);
+        c64.setTapePath(vmCmdLine["tape"].as<std::string>());
+    }
+
+    if (vmCmdLine.count("program"))
+    {
+        c64.setPrgAttached(true);
+        c64.setPrgPath(vmCmdLine["program"].as<std::string>());
+    }
+}
+
 JoystickMapping parseJoystickConfig(const std::string& config)
 {
     JoystickMapping jm{};
@@ -258,6 +390,86 @@ JoystickMapping parseJoystickConfig(const std::string& config)
     return jm;
 }
 
+uint32_t parseHexValue(const std::string& text, uint32_t maxValue)
+{
+    std::string digits = text;
+
+    if (!digits.empty() && digits[0] == '$')
+        digits.erase(0, 1);
+    else if (digits.size() > 2 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X'))
+        digits.erase(0, 2);
+
+    size_t used = 0;
+    unsigned long value = 0;
+
+    try
+    {
+        value = std::stoul(digits, &used, 16);
+    }
+    catch (const std::exception&)
+    {
+        throw std::runtime_error("Invalid hex value: " + text);
+    }
+
+    if (used != digits.size() || value > maxValue)
+        throw std::runtime_error("Invalid hex value: " + text);
+
+    return static_cast<uint32_t>(value);
+}
+
+HeadlessConfig parseHeadlessConfig(const po::variables_map& vm)
+{
+    HeadlessConfig cfg;
+
+    if (vm.count("frames"))
+        cfg.maxFrames = vm["frames"].as<uint64_t>();
+
+    if (vm.count("cycles"))
+        cfg.maxCycles = vm["cycles"].as<uint64_t>();
+
+    if (vm.count("until-pc"))
+    {
+        cfg.stopOnPC = true;
+        cfg.stopPC = static_cast<uint16_t>(parseHexValue(vm["until-pc"].as<std::string>(), 0xFFFF));
+    }
+
+    if (vm.count("until-mem"))
+    {
+        const std::string spec = vm["until-mem"].as<std::string>();
+        const size_t eq = spec.find('=');
+
+        if (eq == std::string::npos)
+            throw std::runtime_error("--until-mem must be ADDR=VALUE: " + spec);
+
+        cfg.stopOnMemory = true;
+        cfg.stopMemoryAddress = static_cast<uint16_t>(parseHexValue(spec.substr(0, eq), 0xFFFF));
+        cfg.stopMemoryValue = static_cast<uint8_t>(parseHexValue(spec.substr(eq + 1), 0xFF));
+    }
+
+    if (vm.count("audio-capture"))
+        cfg.audioCapturePath = vm["audio-capture"].as<std::string>();
+
+    if (vm.count("disk"))
+        cfg.diskPath = vm["disk"].as<std::string>();
+
+    return cfg;
+}
+
+void printHeadlessResult(const HeadlessResult& result)
+{
+    const double speed = result.hostSeconds > 0.0 ? result.emulatedSeconds / result.hostSeconds : 0.0;
+
+    std::cout << "headless"
+              << " stop=" << headlessStopReasonToString(result.reason)
+              << " frames=" << result.frames
+              << " cycles=" << result.cycles
+              << " audio_samples=" << result.audioSamples
+              << " emulated_s=" << result.emulatedSeconds
+              << " host_s=" << result.hostSeconds
+              << " speed=" << speed
+              << std::endl;
+}
+
 std::vector<std::string> splitCSV(const std::string& input)
 {
     std::vector<std::string> tokens;